@@ -0,0 +1,442 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfig.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfigVersion.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindKerberos5.cmake"
+  "/root/repo/cmake/FindMacaroons.cmake"
+  "/root/repo/cmake/FindReadline.cmake"
+  "/root/repo/cmake/FindSciTokensCpp.cmake"
+  "/root/repo/cmake/FindVOMS.cmake"
+  "/root/repo/cmake/Findfuse.cmake"
+  "/root/repo/cmake/Findlibuuid.cmake"
+  "/root/repo/cmake/Findlibzip.cmake"
+  "/root/repo/cmake/Findsystemd.cmake"
+  "/root/repo/cmake/XRootDConfig.cmake.in"
+  "/root/repo/cmake/XRootDDefaults.cmake"
+  "/root/repo/cmake/XRootDFindLibs.cmake"
+  "/root/repo/cmake/XRootDOSDefs.cmake"
+  "/root/repo/cmake/XRootDSummary.cmake"
+  "/root/repo/cmake/XRootDSystemCheck.cmake"
+  "/root/repo/cmake/XRootDVersion.cmake"
+  "/root/repo/cmake/uninstall.cmake.in"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/docs/man/CMakeLists.txt"
+  "/root/repo/docs/man/cmsd.8"
+  "/root/repo/docs/man/frm_admin.8"
+  "/root/repo/docs/man/frm_purged.8"
+  "/root/repo/docs/man/frm_xfragent.8"
+  "/root/repo/docs/man/frm_xfrd.8"
+  "/root/repo/docs/man/mpxstats.8"
+  "/root/repo/docs/man/xrdadler32.1"
+  "/root/repo/docs/man/xrdcp.1"
+  "/root/repo/docs/man/xrdfs.1"
+  "/root/repo/docs/man/xrdgsiproxy.1"
+  "/root/repo/docs/man/xrdgsitest.1"
+  "/root/repo/docs/man/xrdmapc.1"
+  "/root/repo/docs/man/xrdpfc_print.8"
+  "/root/repo/docs/man/xrdpwdadmin.8"
+  "/root/repo/docs/man/xrdsssadmin.8"
+  "/root/repo/docs/man/xrootd.8"
+  "/root/repo/python/CMakeLists.txt"
+  "/root/repo/python/setup.py"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/XProtocol/CMakeLists.txt"
+  "/root/repo/src/Xrd/CMakeLists.txt"
+  "/root/repo/src/XrdAcc/CMakeLists.txt"
+  "/root/repo/src/XrdApps/CMakeLists.txt"
+  "/root/repo/src/XrdBwm/CMakeLists.txt"
+  "/root/repo/src/XrdCeph/CMakeLists.txt"
+  "/root/repo/src/XrdCks/CMakeLists.txt"
+  "/root/repo/src/XrdCl/CMakeLists.txt"
+  "/root/repo/src/XrdClHttp/CMakeLists.txt"
+  "/root/repo/src/XrdClS3/CMakeLists.txt"
+  "/root/repo/src/XrdCms/CMakeLists.txt"
+  "/root/repo/src/XrdCrypto/CMakeLists.txt"
+  "/root/repo/src/XrdDig/CMakeLists.txt"
+  "/root/repo/src/XrdEc/CMakeLists.txt"
+  "/root/repo/src/XrdFfs/CMakeLists.txt"
+  "/root/repo/src/XrdFrc/CMakeLists.txt"
+  "/root/repo/src/XrdFrm/CMakeLists.txt"
+  "/root/repo/src/XrdHeaders.cmake"
+  "/root/repo/src/XrdHttp/CMakeLists.txt"
+  "/root/repo/src/XrdHttpCors/CMakeLists.txt"
+  "/root/repo/src/XrdHttpTpc/CMakeLists.txt"
+  "/root/repo/src/XrdMacaroons/CMakeLists.txt"
+  "/root/repo/src/XrdNet/CMakeLists.txt"
+  "/root/repo/src/XrdOfs/CMakeLists.txt"
+  "/root/repo/src/XrdOss/CMakeLists.txt"
+  "/root/repo/src/XrdOssArc/CMakeLists.txt"
+  "/root/repo/src/XrdOssCsi/CMakeLists.txt"
+  "/root/repo/src/XrdOssMirage/CMakeLists.txt"
+  "/root/repo/src/XrdOssStats/CMakeLists.txt"
+  "/root/repo/src/XrdOuc/CMakeLists.txt"
+  "/root/repo/src/XrdPfc/CMakeLists.txt"
+  "/root/repo/src/XrdPosix/CMakeLists.txt"
+  "/root/repo/src/XrdPss/CMakeLists.txt"
+  "/root/repo/src/XrdRmc/CMakeLists.txt"
+  "/root/repo/src/XrdSciTokens/CMakeLists.txt"
+  "/root/repo/src/XrdSec/CMakeLists.txt"
+  "/root/repo/src/XrdSecgsi/CMakeLists.txt"
+  "/root/repo/src/XrdSeckrb5/CMakeLists.txt"
+  "/root/repo/src/XrdSecpwd/CMakeLists.txt"
+  "/root/repo/src/XrdSecsss/CMakeLists.txt"
+  "/root/repo/src/XrdSecunix/CMakeLists.txt"
+  "/root/repo/src/XrdSecztn/CMakeLists.txt"
+  "/root/repo/src/XrdSfs/CMakeLists.txt"
+  "/root/repo/src/XrdSsi/CMakeLists.txt"
+  "/root/repo/src/XrdSut/CMakeLists.txt"
+  "/root/repo/src/XrdSys/CMakeLists.txt"
+  "/root/repo/src/XrdThrottle/CMakeLists.txt"
+  "/root/repo/src/XrdTls/CMakeLists.txt"
+  "/root/repo/src/XrdVersion.hh.in"
+  "/root/repo/src/XrdVoms/CMakeLists.txt"
+  "/root/repo/src/XrdXml/CMakeLists.txt"
+  "/root/repo/src/XrdXml/tinyxml/CMakeLists.txt"
+  "/root/repo/src/XrdXrootd/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/root/repo/utils/xrootd-config"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "src/XrdVersion.hh"
+  "DartConfiguration.tcl"
+  "cmake/XRootDConfigVersion.cmake"
+  "cmake/XRootDConfig.cmake"
+  "cmake/uninstall.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XProtocol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Xrd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdCks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdNet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSut/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOuc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdTls/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdRmc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdApps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdCrypto/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdPosix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSecgsi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSeckrb5/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSecpwd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSecsss/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSecunix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSecztn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdXml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdXml/tinyxml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdCl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdClHttp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdClS3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdEc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdAcc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdCms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdDig/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdFrc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOss/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdXrootd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdFrm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdFfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdBwm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdPss/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSsi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdPfc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOssArc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOssCsi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOssStats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdThrottle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdHttp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdHttpTpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdMacaroons/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdVoms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdHttpCors/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdCeph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdSciTokens/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/XrdOssMirage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "python/setup.py"
+  "python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/man/man8/cmsd.8"
+  "docs/man/man8/frm_admin.8"
+  "docs/man/man8/frm_purged.8"
+  "docs/man/man8/frm_xfragent.8"
+  "docs/man/man8/frm_xfrd.8"
+  "docs/man/man8/mpxstats.8"
+  "docs/man/man8/xrdpfc_print.8"
+  "docs/man/man8/xrdpwdadmin.8"
+  "docs/man/man8/xrdsssadmin.8"
+  "docs/man/man8/xrootd.8"
+  "docs/man/man1/xrdcp.1"
+  "docs/man/man1/xrdfs.1"
+  "docs/man/man1/xrdmapc.1"
+  "docs/man/man1/xrdadler32.1"
+  "docs/man/man1/xrdgsiproxy.1"
+  "docs/man/man1/xrdgsitest.1"
+  "docs/man/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/xrootd-config"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/plugins.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  "src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "src/Xrd/CMakeFiles/xrootd.dir/DependInfo.cmake"
+  "src/XrdCks/CMakeFiles/XrdCksCalczcrc32-6.dir/DependInfo.cmake"
+  "src/XrdOuc/CMakeFiles/XrdN2No2p-6.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/XrdAppUtils.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/XrdClProxyPlugin-6.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/XrdClRecorder-6.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdreplay.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/cconfig.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/mpxstats.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/wait41.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdacctest.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdadler32.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdcks.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdcrc32c.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdmapc.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdpinls.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdprep.dir/DependInfo.cmake"
+  "src/XrdApps/CMakeFiles/xrdqstats.dir/DependInfo.cmake"
+  "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/DependInfo.cmake"
+  "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/DependInfo.cmake"
+  "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/DependInfo.cmake"
+  "src/XrdPosix/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/DependInfo.cmake"
+  "src/XrdSec/CMakeFiles/XrdSec-6.dir/DependInfo.cmake"
+  "src/XrdSec/CMakeFiles/XrdSecProt-6.dir/DependInfo.cmake"
+  "src/XrdSecgsi/CMakeFiles/XrdSecgsi-6.dir/DependInfo.cmake"
+  "src/XrdSecgsi/CMakeFiles/XrdSecgsiAUTHZVO-6.dir/DependInfo.cmake"
+  "src/XrdSecgsi/CMakeFiles/XrdSecgsiGMAPDN-6.dir/DependInfo.cmake"
+  "src/XrdSecgsi/CMakeFiles/xrdgsiproxy.dir/DependInfo.cmake"
+  "src/XrdSecgsi/CMakeFiles/xrdgsitest.dir/DependInfo.cmake"
+  "src/XrdSecpwd/CMakeFiles/XrdSecpwd-6.dir/DependInfo.cmake"
+  "src/XrdSecpwd/CMakeFiles/xrdpwdadmin.dir/DependInfo.cmake"
+  "src/XrdSecsss/CMakeFiles/XrdSecsss-6.dir/DependInfo.cmake"
+  "src/XrdSecsss/CMakeFiles/xrdsssadmin.dir/DependInfo.cmake"
+  "src/XrdSecunix/CMakeFiles/XrdSecunix-6.dir/DependInfo.cmake"
+  "src/XrdSecztn/CMakeFiles/XrdSecztn-6.dir/DependInfo.cmake"
+  "src/XrdXml/CMakeFiles/XrdXml.dir/DependInfo.cmake"
+  "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/DependInfo.cmake"
+  "src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "src/XrdCl/CMakeFiles/xrdcp.dir/DependInfo.cmake"
+  "src/XrdCl/CMakeFiles/xrdfs.dir/DependInfo.cmake"
+  "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/DependInfo.cmake"
+  "src/XrdClHttp/CMakeFiles/XrdClHttp-6.dir/DependInfo.cmake"
+  "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/DependInfo.cmake"
+  "src/XrdClS3/CMakeFiles/XrdClS3-6.dir/DependInfo.cmake"
+  "src/XrdCms/CMakeFiles/cmsd.dir/DependInfo.cmake"
+  "src/XrdCms/CMakeFiles/XrdCmsRedirectLocal-6.dir/DependInfo.cmake"
+  "src/XrdOfs/CMakeFiles/XrdOfsPrepGPI-6.dir/DependInfo.cmake"
+  "src/XrdOss/CMakeFiles/XrdOssSIgpfsT-6.dir/DependInfo.cmake"
+  "src/XrdXrootd/CMakeFiles/XrdXrootd-6.dir/DependInfo.cmake"
+  "src/XrdFrm/CMakeFiles/XrdFrm.dir/DependInfo.cmake"
+  "src/XrdFrm/CMakeFiles/frm_admin.dir/DependInfo.cmake"
+  "src/XrdFrm/CMakeFiles/frm_purged.dir/DependInfo.cmake"
+  "src/XrdFrm/CMakeFiles/frm_xfrd.dir/DependInfo.cmake"
+  "src/XrdFrm/CMakeFiles/frm_xfragent.dir/DependInfo.cmake"
+  "src/XrdFfs/CMakeFiles/XrdFfs.dir/DependInfo.cmake"
+  "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/DependInfo.cmake"
+  "src/XrdPss/CMakeFiles/XrdPss-6.dir/DependInfo.cmake"
+  "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/DependInfo.cmake"
+  "src/XrdSsi/CMakeFiles/XrdSsiShMap.dir/DependInfo.cmake"
+  "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/DependInfo.cmake"
+  "src/XrdSsi/CMakeFiles/XrdSsiLog-6.dir/DependInfo.cmake"
+  "src/XrdPfc/CMakeFiles/XrdBlacklistDecision-6.dir/DependInfo.cmake"
+  "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/DependInfo.cmake"
+  "src/XrdPfc/CMakeFiles/XrdPfcPurgeQuota-6.dir/DependInfo.cmake"
+  "src/XrdPfc/CMakeFiles/xrdpfc_print.dir/DependInfo.cmake"
+  "src/XrdPfc/CMakeFiles/xrdpfc_bench.dir/DependInfo.cmake"
+  "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/DependInfo.cmake"
+  "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/DependInfo.cmake"
+  "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/DependInfo.cmake"
+  "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/DependInfo.cmake"
+  "src/XrdHttp/CMakeFiles/XrdHttp-6.dir/DependInfo.cmake"
+  "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/DependInfo.cmake"
+  "src/XrdHttpCors/CMakeFiles/XrdHttpCors-6.dir/DependInfo.cmake"
+  "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/DependInfo.cmake"
+  )
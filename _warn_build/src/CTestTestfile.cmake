@@ -0,0 +1,56 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_warn_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("XProtocol")
+subdirs("Xrd")
+subdirs("XrdCks")
+subdirs("XrdNet")
+subdirs("XrdSut")
+subdirs("XrdSys")
+subdirs("XrdOuc")
+subdirs("XrdTls")
+subdirs("XrdRmc")
+subdirs("XrdApps")
+subdirs("XrdCrypto")
+subdirs("XrdPosix")
+subdirs("XrdSec")
+subdirs("XrdSecgsi")
+subdirs("XrdSeckrb5")
+subdirs("XrdSecpwd")
+subdirs("XrdSecsss")
+subdirs("XrdSecunix")
+subdirs("XrdSecztn")
+subdirs("XrdXml")
+subdirs("XrdCl")
+subdirs("XrdClHttp")
+subdirs("XrdClS3")
+subdirs("XrdEc")
+subdirs("XrdAcc")
+subdirs("XrdCms")
+subdirs("XrdDig")
+subdirs("XrdFrc")
+subdirs("XrdOfs")
+subdirs("XrdOss")
+subdirs("XrdSfs")
+subdirs("XrdXrootd")
+subdirs("XrdFrm")
+subdirs("XrdFfs")
+subdirs("XrdBwm")
+subdirs("XrdPss")
+subdirs("XrdSsi")
+subdirs("XrdPfc")
+subdirs("XrdOssArc")
+subdirs("XrdOssCsi")
+subdirs("XrdOssStats")
+subdirs("XrdThrottle")
+subdirs("XrdHttp")
+subdirs("XrdHttpTpc")
+subdirs("XrdMacaroons")
+subdirs("XrdVoms")
+subdirs("XrdHttpCors")
+subdirs("XrdCeph")
+subdirs("XrdSciTokens")
+subdirs("XrdOssMirage")
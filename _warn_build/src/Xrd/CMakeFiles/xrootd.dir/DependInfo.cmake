@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Xrd/XrdConfig.cc" "src/Xrd/CMakeFiles/xrootd.dir/XrdConfig.cc.o" "gcc" "src/Xrd/CMakeFiles/xrootd.dir/XrdConfig.cc.o.d"
+  "/root/repo/src/Xrd/XrdMain.cc" "src/Xrd/CMakeFiles/xrootd.dir/XrdMain.cc.o" "gcc" "src/Xrd/CMakeFiles/xrootd.dir/XrdMain.cc.o.d"
+  "/root/repo/src/Xrd/XrdProtLoad.cc" "src/Xrd/CMakeFiles/xrootd.dir/XrdProtLoad.cc.o" "gcc" "src/Xrd/CMakeFiles/xrootd.dir/XrdProtLoad.cc.o.d"
+  "/root/repo/src/Xrd/XrdStats.cc" "src/Xrd/CMakeFiles/xrootd.dir/XrdStats.cc.o" "gcc" "src/Xrd/CMakeFiles/xrootd.dir/XrdStats.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
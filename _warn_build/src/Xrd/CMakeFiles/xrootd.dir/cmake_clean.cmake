@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/xrootd"
+  "../../bin/xrootd.pdb"
+  "CMakeFiles/xrootd.dir/XrdConfig.cc.o"
+  "CMakeFiles/xrootd.dir/XrdConfig.cc.o.d"
+  "CMakeFiles/xrootd.dir/XrdMain.cc.o"
+  "CMakeFiles/xrootd.dir/XrdMain.cc.o.d"
+  "CMakeFiles/xrootd.dir/XrdProtLoad.cc.o"
+  "CMakeFiles/xrootd.dir/XrdProtLoad.cc.o.d"
+  "CMakeFiles/xrootd.dir/XrdStats.cc.o"
+  "CMakeFiles/xrootd.dir/XrdStats.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrootd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdApps/XrdCpConfig.cc" "src/XrdApps/CMakeFiles/XrdAppUtils.dir/XrdCpConfig.cc.o" "gcc" "src/XrdApps/CMakeFiles/XrdAppUtils.dir/XrdCpConfig.cc.o.d"
+  "/root/repo/src/XrdApps/XrdCpFile.cc" "src/XrdApps/CMakeFiles/XrdAppUtils.dir/XrdCpFile.cc.o" "gcc" "src/XrdApps/CMakeFiles/XrdAppUtils.dir/XrdCpFile.cc.o.d"
+  "/root/repo/src/XrdApps/XrdMpxXml.cc" "src/XrdApps/CMakeFiles/XrdAppUtils.dir/XrdMpxXml.cc.o" "gcc" "src/XrdApps/CMakeFiles/XrdAppUtils.dir/XrdMpxXml.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdAppUtils.so" "/root/repo/_warn_build/lib/libXrdAppUtils.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdAppUtils.so.6" "/root/repo/_warn_build/lib/libXrdAppUtils.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdAppUtils.pdb"
+  "../../lib/libXrdAppUtils.so"
+  "../../lib/libXrdAppUtils.so.6"
+  "../../lib/libXrdAppUtils.so.6.0"
+  "CMakeFiles/XrdAppUtils.dir/XrdCpConfig.cc.o"
+  "CMakeFiles/XrdAppUtils.dir/XrdCpConfig.cc.o.d"
+  "CMakeFiles/XrdAppUtils.dir/XrdCpFile.cc.o"
+  "CMakeFiles/XrdAppUtils.dir/XrdCpFile.cc.o.d"
+  "CMakeFiles/XrdAppUtils.dir/XrdMpxXml.cc.o"
+  "CMakeFiles/XrdAppUtils.dir/XrdMpxXml.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdAppUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdClProxyPlugin-6.pdb"
+  "../../lib/libXrdClProxyPlugin-6.so"
+  "CMakeFiles/XrdClProxyPlugin-6.dir/XrdClProxyPlugin/ProxyPrefixFile.cc.o"
+  "CMakeFiles/XrdClProxyPlugin-6.dir/XrdClProxyPlugin/ProxyPrefixFile.cc.o.d"
+  "CMakeFiles/XrdClProxyPlugin-6.dir/XrdClProxyPlugin/ProxyPrefixPlugin.cc.o"
+  "CMakeFiles/XrdClProxyPlugin-6.dir/XrdClProxyPlugin/ProxyPrefixPlugin.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClProxyPlugin-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdApps/XrdClRecordPlugin/XrdClRecorderPlugin.cc" "src/XrdApps/CMakeFiles/XrdClRecorder-6.dir/XrdClRecordPlugin/XrdClRecorderPlugin.cc.o" "gcc" "src/XrdApps/CMakeFiles/XrdClRecorder-6.dir/XrdClRecordPlugin/XrdClRecorderPlugin.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdClRecorder-6.pdb"
+  "../../lib/libXrdClRecorder-6.so"
+  "CMakeFiles/XrdClRecorder-6.dir/XrdClRecordPlugin/XrdClRecorderPlugin.cc.o"
+  "CMakeFiles/XrdClRecorder-6.dir/XrdClRecordPlugin/XrdClRecorderPlugin.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClRecorder-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
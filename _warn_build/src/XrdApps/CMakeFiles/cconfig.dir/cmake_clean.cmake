@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cconfig"
+  "../../bin/cconfig.pdb"
+  "CMakeFiles/cconfig.dir/XrdAppsCconfig.cc.o"
+  "CMakeFiles/cconfig.dir/XrdAppsCconfig.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
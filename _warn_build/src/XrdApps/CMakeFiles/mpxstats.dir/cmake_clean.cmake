@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mpxstats"
+  "../../bin/mpxstats.pdb"
+  "CMakeFiles/mpxstats.dir/XrdMpxStats.cc.o"
+  "CMakeFiles/mpxstats.dir/XrdMpxStats.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpxstats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/wait41"
+  "../../bin/wait41.pdb"
+  "CMakeFiles/wait41.dir/XrdWait41.cc.o"
+  "CMakeFiles/wait41.dir/XrdWait41.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wait41.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdacctest"
+  "../../bin/xrdacctest.pdb"
+  "CMakeFiles/xrdacctest.dir/XrdAccTest.cc.o"
+  "CMakeFiles/xrdacctest.dir/XrdAccTest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdacctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
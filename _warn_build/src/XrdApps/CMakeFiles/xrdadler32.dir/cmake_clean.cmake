@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdadler32"
+  "../../bin/xrdadler32.pdb"
+  "CMakeFiles/xrdadler32.dir/Xrdadler32.cc.o"
+  "CMakeFiles/xrdadler32.dir/Xrdadler32.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdadler32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
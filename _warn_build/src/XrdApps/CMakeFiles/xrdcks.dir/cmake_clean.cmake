@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdcks"
+  "../../bin/xrdcks.pdb"
+  "CMakeFiles/xrdcks.dir/XrdCks.cc.o"
+  "CMakeFiles/xrdcks.dir/XrdCks.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdcks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
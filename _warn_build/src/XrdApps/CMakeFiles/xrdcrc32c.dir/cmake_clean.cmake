@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdcrc32c"
+  "../../bin/xrdcrc32c.pdb"
+  "CMakeFiles/xrdcrc32c.dir/XrdCrc32c.cc.o"
+  "CMakeFiles/xrdcrc32c.dir/XrdCrc32c.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdcrc32c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdmapc"
+  "../../bin/xrdmapc.pdb"
+  "CMakeFiles/xrdmapc.dir/XrdMapCluster.cc.o"
+  "CMakeFiles/xrdmapc.dir/XrdMapCluster.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdmapc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdpinls"
+  "../../bin/xrdpinls.pdb"
+  "CMakeFiles/xrdpinls.dir/XrdPinls.cc.o"
+  "CMakeFiles/xrdpinls.dir/XrdPinls.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpinls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
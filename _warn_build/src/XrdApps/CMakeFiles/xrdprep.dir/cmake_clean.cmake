@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdprep"
+  "../../bin/xrdprep.pdb"
+  "CMakeFiles/xrdprep.dir/XrdPrep.cc.o"
+  "CMakeFiles/xrdprep.dir/XrdPrep.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdprep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
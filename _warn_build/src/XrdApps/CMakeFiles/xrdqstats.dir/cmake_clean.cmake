@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdqstats"
+  "../../bin/xrdqstats.pdb"
+  "CMakeFiles/xrdqstats.dir/XrdQStats.cc.o"
+  "CMakeFiles/xrdqstats.dir/XrdQStats.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdqstats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
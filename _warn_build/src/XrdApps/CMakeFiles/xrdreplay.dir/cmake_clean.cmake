@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdreplay"
+  "../../bin/xrdreplay.pdb"
+  "CMakeFiles/xrdreplay.dir/XrdClRecordPlugin/XrdClReplay.cc.o"
+  "CMakeFiles/xrdreplay.dir/XrdClRecordPlugin/XrdClReplay.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdreplay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
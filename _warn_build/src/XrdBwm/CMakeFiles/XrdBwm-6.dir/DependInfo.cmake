@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdBwm/XrdBwm.cc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwm.cc.o" "gcc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwm.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmConfig.cc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmConfig.cc.o" "gcc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmConfig.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmHandle.cc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmHandle.cc.o" "gcc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmHandle.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmLogger.cc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmLogger.cc.o" "gcc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmLogger.cc.o.d"
+  "/root/repo/src/XrdBwm/XrdBwmPolicy1.cc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmPolicy1.cc.o" "gcc" "src/XrdBwm/CMakeFiles/XrdBwm-6.dir/XrdBwmPolicy1.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
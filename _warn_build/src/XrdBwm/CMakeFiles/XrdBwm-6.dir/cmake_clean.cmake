@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdBwm-6.pdb"
+  "../../lib/libXrdBwm-6.so"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwm.cc.o"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwm.cc.o.d"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmConfig.cc.o"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmConfig.cc.o.d"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmHandle.cc.o"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmHandle.cc.o.d"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmLogger.cc.o"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmLogger.cc.o.d"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmPolicy1.cc.o"
+  "CMakeFiles/XrdBwm-6.dir/XrdBwmPolicy1.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdBwm-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdCksCalczcrc32-6.pdb"
+  "../../lib/libXrdCksCalczcrc32-6.so"
+  "CMakeFiles/XrdCksCalczcrc32-6.dir/XrdCksCalczcrc32.cc.o"
+  "CMakeFiles/XrdCksCalczcrc32-6.dir/XrdCksCalczcrc32.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCksCalczcrc32-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,80 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCl/XrdClAsyncSocketHandler.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClAsyncSocketHandler.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClAsyncSocketHandler.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClBufferCache.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClBufferCache.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClBufferCache.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClChannel.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClChannel.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClChannel.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClChannelHandlerList.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClChannelHandlerList.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClChannelHandlerList.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClCheckSumManager.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClCheckSumManager.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClCheckSumManager.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClCheckSumPipeline.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClCheckSumPipeline.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClCheckSumPipeline.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClClassicCopyJob.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClClassicCopyJob.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClClassicCopyJob.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClCopyProcess.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClCopyProcess.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClCopyProcess.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClDefaultEnv.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClDefaultEnv.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClDefaultEnv.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClEnv.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClEnv.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClEnv.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClFile.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFile.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFile.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClFileStateHandler.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileStateHandler.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileStateHandler.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClFileSystem.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileSystem.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileSystem.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClFileSystemUtils.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileSystemUtils.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileSystemUtils.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClFileTimer.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileTimer.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClFileTimer.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClForkHandler.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClForkHandler.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClForkHandler.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClInQueue.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClInQueue.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClInQueue.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClIoUring.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClIoUring.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClIoUring.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClJobManager.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClJobManager.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClJobManager.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClLocalFileHandler.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClLocalFileHandler.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClLocalFileHandler.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClLocalFileTask.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClLocalFileTask.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClLocalFileTask.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClLog.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClLog.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClLog.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClMessageUtils.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClMessageUtils.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClMessageUtils.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClMetalinkRedirector.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClMetalinkRedirector.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClMetalinkRedirector.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClOperations.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClOperations.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClOperations.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClOutQueue.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClOutQueue.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClOutQueue.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClPlugInManager.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPlugInManager.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPlugInManager.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClPollerBuiltIn.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPollerBuiltIn.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPollerBuiltIn.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClPollerFactory.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPollerFactory.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPollerFactory.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClPostMaster.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPostMaster.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPostMaster.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClPreWarm.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPreWarm.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClPreWarm.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClReadAhead.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClReadAhead.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClReadAhead.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClReadCoalescer.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClReadCoalescer.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClReadCoalescer.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClRedirectorRegistry.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClRedirectorRegistry.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClRedirectorRegistry.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClRequestStats.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClRequestStats.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClRequestStats.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClSIDManager.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClSIDManager.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClSIDManager.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClSocket.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClSocket.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClSocket.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClStatus.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClStatus.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClStatus.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClStream.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClStream.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClStream.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClTPFallBackCopyJob.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTPFallBackCopyJob.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTPFallBackCopyJob.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClTaskManager.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTaskManager.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTaskManager.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClThirdPartyCopyJob.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClThirdPartyCopyJob.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClThirdPartyCopyJob.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClTls.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTls.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTls.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClTransportManager.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTransportManager.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClTransportManager.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClURL.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClURL.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClURL.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClUtils.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClUtils.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClUtils.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClXCpCtx.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXCpCtx.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXCpCtx.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClXCpSrc.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXCpSrc.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXCpSrc.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClXRootDMsgHandler.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXRootDMsgHandler.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXRootDMsgHandler.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClXRootDResponses.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXRootDResponses.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXRootDResponses.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClXRootDTransport.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXRootDTransport.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClXRootDTransport.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClZipArchive.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClZipArchive.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClZipArchive.cc.o.d"
+  "/root/repo/src/XrdCl/XrdClZipListHandler.cc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClZipListHandler.cc.o" "gcc" "src/XrdCl/CMakeFiles/XrdCl.dir/XrdClZipListHandler.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdCl.so" "/root/repo/_warn_build/lib/libXrdCl.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdCl.so.6" "/root/repo/_warn_build/lib/libXrdCl.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdXml/CMakeFiles/XrdXml.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
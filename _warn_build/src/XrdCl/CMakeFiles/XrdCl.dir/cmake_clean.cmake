@@ -0,0 +1,117 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdCl.pdb"
+  "../../lib/libXrdCl.so"
+  "../../lib/libXrdCl.so.6"
+  "../../lib/libXrdCl.so.6.0"
+  "CMakeFiles/XrdCl.dir/XrdClAsyncSocketHandler.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClAsyncSocketHandler.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClBufferCache.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClBufferCache.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClChannel.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClChannel.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClChannelHandlerList.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClChannelHandlerList.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClCheckSumManager.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClCheckSumManager.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClCheckSumPipeline.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClCheckSumPipeline.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClClassicCopyJob.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClClassicCopyJob.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClCopyProcess.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClCopyProcess.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClDefaultEnv.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClDefaultEnv.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClEnv.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClEnv.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClFile.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClFile.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClFileStateHandler.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClFileStateHandler.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClFileSystem.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClFileSystem.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClFileSystemUtils.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClFileSystemUtils.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClFileTimer.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClFileTimer.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClForkHandler.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClForkHandler.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClInQueue.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClInQueue.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClIoUring.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClIoUring.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClJobManager.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClJobManager.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClLocalFileHandler.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClLocalFileHandler.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClLocalFileTask.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClLocalFileTask.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClLog.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClLog.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClMessageUtils.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClMessageUtils.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClMetalinkRedirector.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClMetalinkRedirector.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClOperations.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClOperations.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClOutQueue.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClOutQueue.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClPlugInManager.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClPlugInManager.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClPollerBuiltIn.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClPollerBuiltIn.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClPollerFactory.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClPollerFactory.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClPostMaster.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClPostMaster.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClPreWarm.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClPreWarm.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClReadAhead.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClReadAhead.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClReadCoalescer.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClReadCoalescer.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClRedirectorRegistry.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClRedirectorRegistry.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClRequestStats.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClRequestStats.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClSIDManager.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClSIDManager.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClSocket.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClSocket.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClStatus.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClStatus.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClStream.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClStream.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClTPFallBackCopyJob.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClTPFallBackCopyJob.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClTaskManager.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClTaskManager.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClThirdPartyCopyJob.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClThirdPartyCopyJob.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClTls.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClTls.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClTransportManager.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClTransportManager.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClURL.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClURL.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClUtils.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClUtils.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClXCpCtx.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClXCpCtx.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClXCpSrc.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClXCpSrc.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClXRootDMsgHandler.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClXRootDMsgHandler.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClXRootDResponses.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClXRootDResponses.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClXRootDTransport.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClXRootDTransport.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClZipArchive.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClZipArchive.cc.o.d"
+  "CMakeFiles/XrdCl.dir/XrdClZipListHandler.cc.o"
+  "CMakeFiles/XrdCl.dir/XrdClZipListHandler.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdcp"
+  "../../bin/xrdcp.pdb"
+  "CMakeFiles/xrdcp.dir/XrdClCopy.cc.o"
+  "CMakeFiles/xrdcp.dir/XrdClCopy.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdfs"
+  "../../bin/xrdfs.pdb"
+  "CMakeFiles/xrdfs.dir/XrdClFS.cc.o"
+  "CMakeFiles/xrdfs.dir/XrdClFS.cc.o.d"
+  "CMakeFiles/xrdfs.dir/XrdClFSExecutor.cc.o"
+  "CMakeFiles/xrdfs.dir/XrdClFSExecutor.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdClHttp-6.pdb"
+  "../../lib/libXrdClHttp-6.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClHttp-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
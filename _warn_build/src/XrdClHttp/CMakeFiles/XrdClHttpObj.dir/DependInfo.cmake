@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdClHttp/XrdClHttpFactory.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpFactory.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpFactory.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpFile.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpFile.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpFile.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpFilesystem.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpFilesystem.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpFilesystem.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpChecksum.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpChecksum.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpChecksum.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpCopy.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpCopy.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpCopy.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpDelete.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpDelete.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpDelete.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpListdir.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpListdir.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpListdir.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpMkcol.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpMkcol.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpMkcol.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpOpen.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOpen.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOpen.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpOptions.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOptions.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOptions.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpPut.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpPut.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpPut.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpQuery.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpQuery.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpQuery.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpRead.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpRead.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpRead.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpReadV.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpReadV.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpReadV.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOpStat.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpStat.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpStat.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOps.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOps.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOps.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpOptionsCache.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOptionsCache.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpOptionsCache.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpParseTimeout.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpParseTimeout.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpParseTimeout.cc.o.d"
+  "/root/repo/src/XrdClHttp/XrdClHttpUtil.cc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpUtil.cc.o" "gcc" "src/XrdClHttp/CMakeFiles/XrdClHttpObj.dir/XrdClHttpUtil.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpFactory.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpFactory.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpFile.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpFile.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpFilesystem.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpFilesystem.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpChecksum.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpChecksum.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpCopy.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpCopy.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpDelete.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpDelete.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpListdir.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpListdir.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpMkcol.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpMkcol.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOpen.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOpen.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOptions.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpOptions.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpPut.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpPut.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpQuery.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpQuery.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpRead.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpRead.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpReadV.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpReadV.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpStat.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOpStat.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOps.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOps.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOptionsCache.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpOptionsCache.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpParseTimeout.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpParseTimeout.cc.o.d"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpUtil.cc.o"
+  "CMakeFiles/XrdClHttpObj.dir/XrdClHttpUtil.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClHttpObj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdClS3-6.pdb"
+  "../../lib/libXrdClS3-6.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClS3-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdClS3/XrdClS3DownloadHandler.cc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3DownloadHandler.cc.o" "gcc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3DownloadHandler.cc.o.d"
+  "/root/repo/src/XrdClS3/XrdClS3Factory.cc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3Factory.cc.o" "gcc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3Factory.cc.o.d"
+  "/root/repo/src/XrdClS3/XrdClS3File.cc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3File.cc.o" "gcc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3File.cc.o.d"
+  "/root/repo/src/XrdClS3/XrdClS3Filesystem.cc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3Filesystem.cc.o" "gcc" "src/XrdClS3/CMakeFiles/XrdClS3Obj.dir/XrdClS3Filesystem.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3DownloadHandler.cc.o"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3DownloadHandler.cc.o.d"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3Factory.cc.o"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3Factory.cc.o.d"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3File.cc.o"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3File.cc.o.d"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3Filesystem.cc.o"
+  "CMakeFiles/XrdClS3Obj.dir/XrdClS3Filesystem.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdClS3Obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdCmsRedirectLocal-6.pdb"
+  "../../lib/libXrdCmsRedirectLocal-6.so"
+  "CMakeFiles/XrdCmsRedirectLocal-6.dir/XrdCmsRedirLocal.cc.o"
+  "CMakeFiles/XrdCmsRedirectLocal-6.dir/XrdCmsRedirLocal.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCmsRedirectLocal-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCms/XrdCmsAdmin.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsAdmin.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsAdmin.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsBaseFS.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsBaseFS.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsBaseFS.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsCache.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsCache.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsCache.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsClustID.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsClustID.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsClustID.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsCluster.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsCluster.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsCluster.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsConfig.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsConfig.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsConfig.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsJob.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsJob.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsJob.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsKey.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsKey.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsKey.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsManList.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsManList.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsManList.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsManTree.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsManTree.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsManTree.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsManager.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsManager.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsManager.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsMeter.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsMeter.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsMeter.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsNash.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsNash.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsNash.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsNode.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsNode.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsNode.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsPList.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsPList.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsPList.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsPrepArgs.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsPrepArgs.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsPrepArgs.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsPrepare.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsPrepare.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsPrepare.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsProtocol.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsProtocol.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsProtocol.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsRRQ.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsRRQ.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsRRQ.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsRouting.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsRouting.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsRouting.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsState.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsState.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsState.cc.o.d"
+  "/root/repo/src/XrdCms/XrdCmsSupervisor.cc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsSupervisor.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/XrdCmsSupervisor.cc.o.d"
+  "/root/repo/src/Xrd/XrdConfig.cc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdConfig.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdConfig.cc.o.d"
+  "/root/repo/src/Xrd/XrdMain.cc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdMain.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdMain.cc.o.d"
+  "/root/repo/src/Xrd/XrdProtLoad.cc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdProtLoad.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdProtLoad.cc.o.d"
+  "/root/repo/src/Xrd/XrdStats.cc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdStats.cc.o" "gcc" "src/XrdCms/CMakeFiles/cmsd.dir/__/Xrd/XrdStats.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
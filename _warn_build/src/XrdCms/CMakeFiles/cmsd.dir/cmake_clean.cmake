@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "../../bin/cmsd"
+  "../../bin/cmsd.pdb"
+  "CMakeFiles/cmsd.dir/XrdCmsAdmin.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsAdmin.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsBaseFS.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsBaseFS.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsCache.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsCache.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsClustID.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsClustID.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsCluster.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsCluster.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsConfig.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsConfig.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsJob.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsJob.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsKey.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsKey.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsManList.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsManList.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsManTree.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsManTree.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsManager.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsManager.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsMeter.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsMeter.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsNash.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsNash.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsNode.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsNode.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsPList.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsPList.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsPrepArgs.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsPrepArgs.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsPrepare.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsPrepare.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsProtocol.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsProtocol.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsRRQ.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsRRQ.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsRouting.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsRouting.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsState.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsState.cc.o.d"
+  "CMakeFiles/cmsd.dir/XrdCmsSupervisor.cc.o"
+  "CMakeFiles/cmsd.dir/XrdCmsSupervisor.cc.o.d"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdConfig.cc.o"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdConfig.cc.o.d"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdMain.cc.o"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdMain.cc.o.d"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdProtLoad.cc.o"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdProtLoad.cc.o.d"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdStats.cc.o"
+  "CMakeFiles/cmsd.dir/__/Xrd/XrdStats.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmsd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCrypto/XrdCryptoBasic.cc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoBasic.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoBasic.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoCipher.cc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoCipher.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoCipher.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoFactory.cc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoFactory.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoFactory.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoMsgDigest.cc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoMsgDigest.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptoMsgDigest.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptogsiX509Chain.cc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptogsiX509Chain.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCrypto.dir/XrdCryptogsiX509Chain.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdCrypto.so" "/root/repo/_warn_build/lib/libXrdCrypto.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdCrypto.so.6" "/root/repo/_warn_build/lib/libXrdCrypto.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
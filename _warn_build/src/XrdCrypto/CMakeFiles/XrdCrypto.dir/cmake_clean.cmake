@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdCrypto.pdb"
+  "../../lib/libXrdCrypto.so"
+  "../../lib/libXrdCrypto.so.6"
+  "../../lib/libXrdCrypto.so.6.0"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoBasic.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoBasic.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoCipher.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoCipher.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoFactory.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoFactory.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoMsgDigest.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptoMsgDigest.cc.o.d"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptogsiX509Chain.cc.o"
+  "CMakeFiles/XrdCrypto.dir/XrdCryptogsiX509Chain.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCrypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
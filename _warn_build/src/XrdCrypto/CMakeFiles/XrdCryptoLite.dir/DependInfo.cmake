@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCrypto/XrdCryptoLite.cc" "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoLite_BFecb.cc" "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_BFecb.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_BFecb.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptoLite_bf32.cc" "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_bf32.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_bf32.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdCryptoLite.so" "/root/repo/_warn_build/lib/libXrdCryptoLite.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdCryptoLite.so.6" "/root/repo/_warn_build/lib/libXrdCryptoLite.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdCryptoLite.pdb"
+  "../../lib/libXrdCryptoLite.so"
+  "../../lib/libXrdCryptoLite.so.6"
+  "../../lib/libXrdCryptoLite.so.6.0"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite.cc.o"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite.cc.o.d"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_BFecb.cc.o"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_BFecb.cc.o.d"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_bf32.cc.o"
+  "CMakeFiles/XrdCryptoLite.dir/XrdCryptoLite_bf32.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCryptoLite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdCrypto/XrdCryptosslCipher.cc" "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslCipher.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslCipher.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslFactory.cc" "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslFactory.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslFactory.cc.o.d"
+  "/root/repo/src/XrdCrypto/XrdCryptosslMsgDigest.cc" "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslMsgDigest.cc.o" "gcc" "src/XrdCrypto/CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslMsgDigest.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdCrypto/CMakeFiles/XrdCrypto.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdCryptossl-6.pdb"
+  "../../lib/libXrdCryptossl-6.so"
+  "CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslCipher.cc.o"
+  "CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslCipher.cc.o.d"
+  "CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslFactory.cc.o"
+  "CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslFactory.cc.o.d"
+  "CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslMsgDigest.cc.o"
+  "CMakeFiles/XrdCryptossl-6.dir/XrdCryptosslMsgDigest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdCryptossl-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdFfs/XrdFfsDent.cc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsDent.cc.o" "gcc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsDent.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsFsinfo.cc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsFsinfo.cc.o" "gcc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsFsinfo.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsMisc.cc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsMisc.cc.o" "gcc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsMisc.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsPosix.cc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsPosix.cc.o" "gcc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsPosix.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsQueue.cc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsQueue.cc.o" "gcc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsQueue.cc.o.d"
+  "/root/repo/src/XrdFfs/XrdFfsWcache.cc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsWcache.cc.o" "gcc" "src/XrdFfs/CMakeFiles/XrdFfs.dir/XrdFfsWcache.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdFfs.so" "/root/repo/_warn_build/lib/libXrdFfs.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdFfs.so.6" "/root/repo/_warn_build/lib/libXrdFfs.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdPosix/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
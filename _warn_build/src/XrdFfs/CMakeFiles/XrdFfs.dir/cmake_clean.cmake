@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdFfs.pdb"
+  "../../lib/libXrdFfs.so"
+  "../../lib/libXrdFfs.so.6"
+  "../../lib/libXrdFfs.so.6.0"
+  "CMakeFiles/XrdFfs.dir/XrdFfsDent.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfsDent.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfsFsinfo.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfsFsinfo.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfsMisc.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfsMisc.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfsPosix.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfsPosix.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfsQueue.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfsQueue.cc.o.d"
+  "CMakeFiles/XrdFfs.dir/XrdFfsWcache.cc.o"
+  "CMakeFiles/XrdFfs.dir/XrdFfsWcache.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdFfs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
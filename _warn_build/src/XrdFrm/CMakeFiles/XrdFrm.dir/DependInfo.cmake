@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdFrm/XrdFrmCns.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmCns.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmCns.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmConfig.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmConfig.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmConfig.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmFiles.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmFiles.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmFiles.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmMigrate.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmMigrate.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmMigrate.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmMonitor.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmMonitor.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmMonitor.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmReqBoss.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmReqBoss.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmReqBoss.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmTSort.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmTSort.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmTSort.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmTransfer.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmTransfer.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmTransfer.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmXfrAgent.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmXfrAgent.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmXfrAgent.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmXfrDaemon.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmXfrDaemon.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmXfrDaemon.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmXfrQueue.cc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmXfrQueue.cc.o" "gcc" "src/XrdFrm/CMakeFiles/XrdFrm.dir/XrdFrmXfrQueue.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
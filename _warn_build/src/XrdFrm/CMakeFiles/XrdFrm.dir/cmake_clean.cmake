@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdFrm.a"
+  "../../lib/libXrdFrm.pdb"
+  "CMakeFiles/XrdFrm.dir/XrdFrmCns.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmCns.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmConfig.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmConfig.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmFiles.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmFiles.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmMigrate.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmMigrate.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmMonitor.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmMonitor.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmReqBoss.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmReqBoss.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmTSort.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmTSort.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmTransfer.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmTransfer.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmXfrAgent.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmXfrAgent.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmXfrDaemon.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmXfrDaemon.cc.o.d"
+  "CMakeFiles/XrdFrm.dir/XrdFrmXfrQueue.cc.o"
+  "CMakeFiles/XrdFrm.dir/XrdFrmXfrQueue.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdFrm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
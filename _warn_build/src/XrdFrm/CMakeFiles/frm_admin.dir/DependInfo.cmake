@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdFrm/XrdFrmAdmin.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdmin.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdmin.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmAdminAudit.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminAudit.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminAudit.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmAdminFiles.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminFiles.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminFiles.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmAdminFind.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminFind.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminFind.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmAdminMain.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminMain.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminMain.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmAdminQuery.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminQuery.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminQuery.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmAdminUnlink.cc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminUnlink.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_admin.dir/XrdFrmAdminUnlink.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdFrm/CMakeFiles/XrdFrm.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
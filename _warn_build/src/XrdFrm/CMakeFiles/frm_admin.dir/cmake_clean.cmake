@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../bin/frm_admin"
+  "../../bin/frm_admin.pdb"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdmin.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdmin.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminAudit.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminAudit.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminFiles.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminFiles.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminFind.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminFind.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminMain.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminMain.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminQuery.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminQuery.cc.o.d"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminUnlink.cc.o"
+  "CMakeFiles/frm_admin.dir/XrdFrmAdminUnlink.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_admin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
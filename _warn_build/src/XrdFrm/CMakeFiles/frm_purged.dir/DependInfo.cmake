@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdFrm/XrdFrmPurgMain.cc" "src/XrdFrm/CMakeFiles/frm_purged.dir/XrdFrmPurgMain.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_purged.dir/XrdFrmPurgMain.cc.o.d"
+  "/root/repo/src/XrdFrm/XrdFrmPurge.cc" "src/XrdFrm/CMakeFiles/frm_purged.dir/XrdFrmPurge.cc.o" "gcc" "src/XrdFrm/CMakeFiles/frm_purged.dir/XrdFrmPurge.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdFrm/CMakeFiles/XrdFrm.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
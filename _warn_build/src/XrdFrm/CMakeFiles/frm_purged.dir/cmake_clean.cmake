@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/frm_purged"
+  "../../bin/frm_purged.pdb"
+  "CMakeFiles/frm_purged.dir/XrdFrmPurgMain.cc.o"
+  "CMakeFiles/frm_purged.dir/XrdFrmPurgMain.cc.o.d"
+  "CMakeFiles/frm_purged.dir/XrdFrmPurge.cc.o"
+  "CMakeFiles/frm_purged.dir/XrdFrmPurge.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_purged.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/frm_xfragent"
+  "../../bin/frm_xfragent.pdb"
+  "CMakeFiles/frm_xfragent.dir/XrdFrmXfrMain.cc.o"
+  "CMakeFiles/frm_xfragent.dir/XrdFrmXfrMain.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_xfragent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
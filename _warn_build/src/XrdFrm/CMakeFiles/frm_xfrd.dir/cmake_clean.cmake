@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/frm_xfrd"
+  "../../bin/frm_xfrd.pdb"
+  "CMakeFiles/frm_xfrd.dir/XrdFrmXfrMain.cc.o"
+  "CMakeFiles/frm_xfrd.dir/XrdFrmXfrMain.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frm_xfrd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
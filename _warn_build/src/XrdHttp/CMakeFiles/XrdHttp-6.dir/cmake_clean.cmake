@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdHttp-6.pdb"
+  "../../lib/libXrdHttp-6.so"
+  "CMakeFiles/XrdHttp-6.dir/XrdHttpModule.cc.o"
+  "CMakeFiles/XrdHttp-6.dir/XrdHttpModule.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttp-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
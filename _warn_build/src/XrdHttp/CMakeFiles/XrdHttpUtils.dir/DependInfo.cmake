@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdHttp/XrdHttpChecksum.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksum.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksum.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpChecksumHandler.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksumHandler.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksumHandler.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpExtHandler.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpExtHandler.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpExtHandler.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpHeaderUtils.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpHeaderUtils.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpHeaderUtils.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpMon.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpMon.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpMon.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpProtocol.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpProtocol.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpProtocol.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpReadRangeHandler.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpReadRangeHandler.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpReadRangeHandler.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpReq.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpReq.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpReq.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpSecurity.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpSecurity.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpSecurity.cc.o.d"
+  "/root/repo/src/XrdHttp/XrdHttpUtils.cc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpUtils.cc.o" "gcc" "src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/XrdHttpUtils.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdHttpUtils.so" "/root/repo/_warn_build/lib/libXrdHttpUtils.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdHttpUtils.so.6" "/root/repo/_warn_build/lib/libXrdHttpUtils.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/XrdCrypto/CMakeFiles/XrdCrypto.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
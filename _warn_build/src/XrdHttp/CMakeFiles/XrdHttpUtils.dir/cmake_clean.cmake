@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdHttpUtils.pdb"
+  "../../lib/libXrdHttpUtils.so"
+  "../../lib/libXrdHttpUtils.so.6"
+  "../../lib/libXrdHttpUtils.so.6.0"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksum.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksum.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksumHandler.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpChecksumHandler.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpExtHandler.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpExtHandler.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpHeaderUtils.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpHeaderUtils.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpMon.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpMon.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpProtocol.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpProtocol.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpReadRangeHandler.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpReadRangeHandler.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpReq.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpReq.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpSecurity.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpSecurity.cc.o.d"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpUtils.cc.o"
+  "CMakeFiles/XrdHttpUtils.dir/XrdHttpUtils.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttpUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
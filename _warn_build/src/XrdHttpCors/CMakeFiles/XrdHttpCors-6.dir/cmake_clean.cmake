@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdHttpCors-6.pdb"
+  "../../lib/libXrdHttpCors-6.so"
+  "CMakeFiles/XrdHttpCors-6.dir/XrdHttpCorsHandler.cc.o"
+  "CMakeFiles/XrdHttpCors-6.dir/XrdHttpCorsHandler.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttpCors-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcConfigure.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcConfigure.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcConfigure.cc.o.d"
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcMultistream.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcMultistream.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcMultistream.cc.o.d"
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcPMarkManager.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcPMarkManager.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcPMarkManager.cc.o.d"
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcState.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcState.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcState.cc.o.d"
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcStream.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcStream.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcStream.cc.o.d"
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcTPC.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcTPC.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcTPC.cc.o.d"
+  "/root/repo/src/XrdHttpTpc/XrdHttpTpcUtils.cc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcUtils.cc.o" "gcc" "src/XrdHttpTpc/CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcUtils.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdHttp/CMakeFiles/XrdHttpUtils.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
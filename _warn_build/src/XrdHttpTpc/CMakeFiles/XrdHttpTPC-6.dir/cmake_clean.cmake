@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdHttpTPC-6.pdb"
+  "../../lib/libXrdHttpTPC-6.so"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcConfigure.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcConfigure.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcMultistream.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcMultistream.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcPMarkManager.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcPMarkManager.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcState.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcState.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcStream.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcStream.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcTPC.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcTPC.cc.o.d"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcUtils.cc.o"
+  "CMakeFiles/XrdHttpTPC-6.dir/XrdHttpTpcUtils.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdHttpTPC-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
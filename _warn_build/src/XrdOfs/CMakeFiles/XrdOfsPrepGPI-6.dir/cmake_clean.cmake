@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdOfsPrepGPI-6.pdb"
+  "../../lib/libXrdOfsPrepGPI-6.so"
+  "CMakeFiles/XrdOfsPrepGPI-6.dir/XrdOfsPrepGPI.cc.o"
+  "CMakeFiles/XrdOfsPrepGPI-6.dir/XrdOfsPrepGPI.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdOfsPrepGPI-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
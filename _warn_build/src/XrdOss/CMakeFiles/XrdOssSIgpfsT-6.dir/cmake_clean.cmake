@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdOssSIgpfsT-6.pdb"
+  "../../lib/libXrdOssSIgpfsT-6.so"
+  "CMakeFiles/XrdOssSIgpfsT-6.dir/XrdOssSIgpfsT.cc.o"
+  "CMakeFiles/XrdOssSIgpfsT-6.dir/XrdOssSIgpfsT.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdOssSIgpfsT-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
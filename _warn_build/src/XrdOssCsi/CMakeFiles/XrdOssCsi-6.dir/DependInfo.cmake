@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdOssCsi/XrdOssCsi.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsi.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsi.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiConfig.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiConfig.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiConfig.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiCrcUtils.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiCrcUtils.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiCrcUtils.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiFile.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFile.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFile.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiFileAio.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFileAio.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFileAio.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiPages.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPages.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPages.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiPagesUnaligned.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPagesUnaligned.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPagesUnaligned.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiRanges.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiRanges.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiRanges.cc.o.d"
+  "/root/repo/src/XrdOssCsi/XrdOssCsiTagstoreFile.cc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiTagstoreFile.cc.o" "gcc" "src/XrdOssCsi/CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiTagstoreFile.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
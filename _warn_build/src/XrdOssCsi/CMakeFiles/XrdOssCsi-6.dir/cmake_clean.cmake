@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdOssCsi-6.pdb"
+  "../../lib/libXrdOssCsi-6.so"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsi.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsi.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiConfig.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiConfig.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiCrcUtils.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiCrcUtils.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFile.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFile.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFileAio.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiFileAio.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPages.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPages.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPagesUnaligned.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiPagesUnaligned.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiRanges.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiRanges.cc.o.d"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiTagstoreFile.cc.o"
+  "CMakeFiles/XrdOssCsi-6.dir/XrdOssCsiTagstoreFile.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdOssCsi-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
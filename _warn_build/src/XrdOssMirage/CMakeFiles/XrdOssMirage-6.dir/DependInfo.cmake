@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdOssMirage/XrdOssMirage.cc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirage.cc.o" "gcc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirage.cc.o.d"
+  "/root/repo/src/XrdOssMirage/XrdOssMirageDir.cc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageDir.cc.o" "gcc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageDir.cc.o.d"
+  "/root/repo/src/XrdOssMirage/XrdOssMirageFile.cc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageFile.cc.o" "gcc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageFile.cc.o.d"
+  "/root/repo/src/XrdOssMirage/XrdOssMirageXAttr.cc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageXAttr.cc.o" "gcc" "src/XrdOssMirage/CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageXAttr.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
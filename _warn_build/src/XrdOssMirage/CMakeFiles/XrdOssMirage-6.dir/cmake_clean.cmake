@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdOssMirage-6.pdb"
+  "../../lib/libXrdOssMirage-6.so"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirage.cc.o"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirage.cc.o.d"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageDir.cc.o"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageDir.cc.o.d"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageFile.cc.o"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageFile.cc.o.d"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageXAttr.cc.o"
+  "CMakeFiles/XrdOssMirage-6.dir/XrdOssMirageXAttr.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdOssMirage-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
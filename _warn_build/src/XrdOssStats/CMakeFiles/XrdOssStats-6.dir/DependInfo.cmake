@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdOssStats/XrdOssStatsConfig.cc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsConfig.cc.o" "gcc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsConfig.cc.o.d"
+  "/root/repo/src/XrdOssStats/XrdOssStatsFile.cc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFile.cc.o" "gcc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFile.cc.o.d"
+  "/root/repo/src/XrdOssStats/XrdOssStatsFileSystem.cc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFileSystem.cc.o" "gcc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFileSystem.cc.o.d"
+  "/root/repo/src/XrdOssStats/XrdOssStatsHistogram.cc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsHistogram.cc.o" "gcc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsHistogram.cc.o.d"
+  "/root/repo/src/XrdOssStats/XrdOssStatsSlowLog.cc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsSlowLog.cc.o" "gcc" "src/XrdOssStats/CMakeFiles/XrdOssStats-6.dir/XrdOssStatsSlowLog.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
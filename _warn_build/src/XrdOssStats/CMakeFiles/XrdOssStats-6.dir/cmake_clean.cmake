@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdOssStats-6.pdb"
+  "../../lib/libXrdOssStats-6.so"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsConfig.cc.o"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsConfig.cc.o.d"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFile.cc.o"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFile.cc.o.d"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFileSystem.cc.o"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsFileSystem.cc.o.d"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsHistogram.cc.o"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsHistogram.cc.o.d"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsSlowLog.cc.o"
+  "CMakeFiles/XrdOssStats-6.dir/XrdOssStatsSlowLog.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdOssStats-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdN2No2p-6.pdb"
+  "../../lib/libXrdN2No2p-6.so"
+  "CMakeFiles/XrdN2No2p-6.dir/XrdOucN2No2p.cc.o"
+  "CMakeFiles/XrdN2No2p-6.dir/XrdOucN2No2p.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdN2No2p-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdBlacklistDecision-6.pdb"
+  "../../lib/libXrdBlacklistDecision-6.so"
+  "CMakeFiles/XrdBlacklistDecision-6.dir/XrdPfcBlacklistDecision.cc.o"
+  "CMakeFiles/XrdBlacklistDecision-6.dir/XrdPfcBlacklistDecision.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdBlacklistDecision-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPfc/XrdPfc.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfc.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfc.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcAdmission.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcAdmission.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcAdmission.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcCommand.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcCommand.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcCommand.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcConfiguration.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcConfiguration.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcConfiguration.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcDirState.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcDirState.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcDirState.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcDirStateSnapshot.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcDirStateSnapshot.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcDirStateSnapshot.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcFPurgeState.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFPurgeState.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFPurgeState.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcFSctl.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFSctl.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFSctl.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcFile.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFile.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFile.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcFsTraversal.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFsTraversal.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcFsTraversal.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcIO.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcIO.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcIO.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcIOFile.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcIOFile.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcIOFile.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcIOFileBlock.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcIOFileBlock.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcIOFileBlock.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcInfo.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcInfo.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcInfo.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcInfoStore.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcInfoStore.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcInfoStore.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcPurge.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcPurge.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcPurge.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcPurgeIndex.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcPurgeIndex.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcPurgeIndex.cc.o.d"
+  "/root/repo/src/XrdPfc/XrdPfcResourceMonitor.cc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcResourceMonitor.cc.o" "gcc" "src/XrdPfc/CMakeFiles/XrdPfc-6.dir/XrdPfcResourceMonitor.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/XrdPosix/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdPfc-6.pdb"
+  "../../lib/libXrdPfc-6.so"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfc.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfc.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcAdmission.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcAdmission.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcCommand.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcCommand.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcConfiguration.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcConfiguration.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcDirState.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcDirState.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcDirStateSnapshot.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcDirStateSnapshot.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFPurgeState.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFPurgeState.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFSctl.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFSctl.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFile.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFile.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFsTraversal.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcFsTraversal.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcIO.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcIO.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcIOFile.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcIOFile.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcIOFileBlock.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcIOFileBlock.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcInfo.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcInfo.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcInfoStore.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcInfoStore.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcPurge.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcPurge.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcPurgeIndex.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcPurgeIndex.cc.o.d"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcResourceMonitor.cc.o"
+  "CMakeFiles/XrdPfc-6.dir/XrdPfcResourceMonitor.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPfc-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdPfcPurgeQuota-6.pdb"
+  "../../lib/libXrdPfcPurgeQuota-6.so"
+  "CMakeFiles/XrdPfcPurgeQuota-6.dir/XrdPfcPurgeQuota.cc.o"
+  "CMakeFiles/XrdPfcPurgeQuota-6.dir/XrdPfcPurgeQuota.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPfcPurgeQuota-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
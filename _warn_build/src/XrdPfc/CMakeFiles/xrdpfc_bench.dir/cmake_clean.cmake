@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdpfc_bench"
+  "../../bin/xrdpfc_bench.pdb"
+  "CMakeFiles/xrdpfc_bench.dir/XrdPfcBench.cc.o"
+  "CMakeFiles/xrdpfc_bench.dir/XrdPfcBench.cc.o.d"
+  "CMakeFiles/xrdpfc_bench.dir/XrdPfcInfo.cc.o"
+  "CMakeFiles/xrdpfc_bench.dir/XrdPfcInfo.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpfc_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
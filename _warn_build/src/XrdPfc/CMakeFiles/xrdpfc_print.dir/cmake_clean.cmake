@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdpfc_print"
+  "../../bin/xrdpfc_print.pdb"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfcInfo.cc.o"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfcInfo.cc.o.d"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfcPrint.cc.o"
+  "CMakeFiles/xrdpfc_print.dir/XrdPfcPrint.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpfc_print.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
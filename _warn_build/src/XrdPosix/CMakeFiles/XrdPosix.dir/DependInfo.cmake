@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPosix/XrdPosixAdmin.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixAdmin.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixAdmin.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixCache.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixCache.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixCache.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixCallBack.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixCallBack.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixCallBack.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixConfig.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixConfig.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixConfig.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixDir.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixDir.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixDir.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixExtra.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixExtra.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixExtra.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixFile.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixFile.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixFile.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixFileRH.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixFileRH.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixFileRH.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixMap.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixMap.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixMap.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixObject.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixObject.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixObject.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixPrepIO.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixPrepIO.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixPrepIO.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixXrootd.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixXrootd.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixXrootd.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixXrootdPath.cc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixXrootdPath.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosix.dir/XrdPosixXrootdPath.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdPosix.so" "/root/repo/_warn_build/lib/libXrdPosix.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdPosix.so.6" "/root/repo/_warn_build/lib/libXrdPosix.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
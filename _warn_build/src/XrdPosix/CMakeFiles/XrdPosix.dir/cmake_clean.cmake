@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdPosix.pdb"
+  "../../lib/libXrdPosix.so"
+  "../../lib/libXrdPosix.so.6"
+  "../../lib/libXrdPosix.so.6.0"
+  "CMakeFiles/XrdPosix.dir/XrdPosixAdmin.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixAdmin.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixCache.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixCache.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixCallBack.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixCallBack.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixConfig.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixConfig.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixDir.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixDir.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixExtra.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixExtra.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixFile.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixFile.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixFileRH.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixFileRH.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixMap.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixMap.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixObject.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixObject.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixPrepIO.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixPrepIO.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixXrootd.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixXrootd.cc.o.d"
+  "CMakeFiles/XrdPosix.dir/XrdPosixXrootdPath.cc.o"
+  "CMakeFiles/XrdPosix.dir/XrdPosixXrootdPath.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPosix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
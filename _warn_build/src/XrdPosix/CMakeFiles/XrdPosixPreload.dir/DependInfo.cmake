@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPosix/XrdPosix.cc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosix.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosix.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixLinkage.cc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosixLinkage.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosixLinkage.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixPreload.cc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload.cc.o.d"
+  "/root/repo/src/XrdPosix/XrdPosixPreload32.cc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload32.cc.o" "gcc" "src/XrdPosix/CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload32.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdPosixPreload.so" "/root/repo/_warn_build/lib/libXrdPosixPreload.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdPosixPreload.so.6" "/root/repo/_warn_build/lib/libXrdPosixPreload.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdPosix/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
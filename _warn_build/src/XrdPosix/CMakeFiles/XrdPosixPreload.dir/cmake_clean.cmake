@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdPosixPreload.pdb"
+  "../../lib/libXrdPosixPreload.so"
+  "../../lib/libXrdPosixPreload.so.6"
+  "../../lib/libXrdPosixPreload.so.6.0"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosix.cc.o.d"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosixLinkage.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosixLinkage.cc.o.d"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload.cc.o.d"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload32.cc.o"
+  "CMakeFiles/XrdPosixPreload.dir/XrdPosixPreload32.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPosixPreload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdPss/XrdPss.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPss.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPss.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssAio.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssAio.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssAio.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssAioCB.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssAioCB.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssAioCB.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssCks.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssCks.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssCks.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssConfig.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssConfig.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssConfig.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssUrlInfo.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssUrlInfo.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssUrlInfo.cc.o.d"
+  "/root/repo/src/XrdPss/XrdPssUtils.cc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssUtils.cc.o" "gcc" "src/XrdPss/CMakeFiles/XrdPss-6.dir/XrdPssUtils.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdPosix/CMakeFiles/XrdPosix.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
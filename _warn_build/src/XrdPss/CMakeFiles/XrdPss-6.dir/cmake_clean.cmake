@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdPss-6.pdb"
+  "../../lib/libXrdPss-6.so"
+  "CMakeFiles/XrdPss-6.dir/XrdPss.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPss.cc.o.d"
+  "CMakeFiles/XrdPss-6.dir/XrdPssAio.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPssAio.cc.o.d"
+  "CMakeFiles/XrdPss-6.dir/XrdPssAioCB.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPssAioCB.cc.o.d"
+  "CMakeFiles/XrdPss-6.dir/XrdPssCks.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPssCks.cc.o.d"
+  "CMakeFiles/XrdPss-6.dir/XrdPssConfig.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPssConfig.cc.o.d"
+  "CMakeFiles/XrdPss-6.dir/XrdPssUrlInfo.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPssUrlInfo.cc.o.d"
+  "CMakeFiles/XrdPss-6.dir/XrdPssUtils.cc.o"
+  "CMakeFiles/XrdPss-6.dir/XrdPssUtils.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdPss-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSec-6.pdb"
+  "../../lib/libXrdSec-6.so"
+  "CMakeFiles/XrdSec-6.dir/XrdSecClient.cc.o"
+  "CMakeFiles/XrdSec-6.dir/XrdSecClient.cc.o.d"
+  "CMakeFiles/XrdSec-6.dir/XrdSecPManager.cc.o"
+  "CMakeFiles/XrdSec-6.dir/XrdSecPManager.cc.o.d"
+  "CMakeFiles/XrdSec-6.dir/XrdSecProtocolhost.cc.o"
+  "CMakeFiles/XrdSec-6.dir/XrdSecProtocolhost.cc.o.d"
+  "CMakeFiles/XrdSec-6.dir/XrdSecServer.cc.o"
+  "CMakeFiles/XrdSec-6.dir/XrdSecServer.cc.o.d"
+  "CMakeFiles/XrdSec-6.dir/XrdSecTLayer.cc.o"
+  "CMakeFiles/XrdSec-6.dir/XrdSecTLayer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSec-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecProt-6.pdb"
+  "../../lib/libXrdSecProt-6.so"
+  "CMakeFiles/XrdSecProt-6.dir/XrdSecProtect.cc.o"
+  "CMakeFiles/XrdSecProt-6.dir/XrdSecProtect.cc.o.d"
+  "CMakeFiles/XrdSecProt-6.dir/XrdSecProtector.cc.o"
+  "CMakeFiles/XrdSecProt-6.dir/XrdSecProtector.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecProt-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
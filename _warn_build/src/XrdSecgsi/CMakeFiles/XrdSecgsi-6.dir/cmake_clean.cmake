@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecgsi-6.pdb"
+  "../../lib/libXrdSecgsi-6.so"
+  "CMakeFiles/XrdSecgsi-6.dir/XrdSecProtocolgsi.cc.o"
+  "CMakeFiles/XrdSecgsi-6.dir/XrdSecProtocolgsi.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecgsi-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecgsiAUTHZVO-6.pdb"
+  "../../lib/libXrdSecgsiAUTHZVO-6.so"
+  "CMakeFiles/XrdSecgsiAUTHZVO-6.dir/XrdSecgsiAuthzFunVO.cc.o"
+  "CMakeFiles/XrdSecgsiAUTHZVO-6.dir/XrdSecgsiAuthzFunVO.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecgsiAUTHZVO-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecgsiGMAPDN-6.pdb"
+  "../../lib/libXrdSecgsiGMAPDN-6.so"
+  "CMakeFiles/XrdSecgsiGMAPDN-6.dir/XrdSecgsiGMAPFunDN.cc.o"
+  "CMakeFiles/XrdSecgsiGMAPDN-6.dir/XrdSecgsiGMAPFunDN.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecgsiGMAPDN-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
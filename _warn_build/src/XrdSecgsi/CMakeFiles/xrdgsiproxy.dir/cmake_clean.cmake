@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdgsiproxy"
+  "../../bin/xrdgsiproxy.pdb"
+  "CMakeFiles/xrdgsiproxy.dir/XrdSecgsiProxy.cc.o"
+  "CMakeFiles/xrdgsiproxy.dir/XrdSecgsiProxy.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdgsiproxy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdgsitest"
+  "../../bin/xrdgsitest.pdb"
+  "CMakeFiles/xrdgsitest.dir/XrdSecgsitest.cc.o"
+  "CMakeFiles/xrdgsitest.dir/XrdSecgsitest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdgsitest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
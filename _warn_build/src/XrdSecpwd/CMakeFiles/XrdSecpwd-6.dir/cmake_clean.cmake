@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecpwd-6.pdb"
+  "../../lib/libXrdSecpwd-6.so"
+  "CMakeFiles/XrdSecpwd-6.dir/XrdSecProtocolpwd.cc.o"
+  "CMakeFiles/XrdSecpwd-6.dir/XrdSecProtocolpwd.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecpwd-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdpwdadmin"
+  "../../bin/xrdpwdadmin.pdb"
+  "CMakeFiles/xrdpwdadmin.dir/XrdSecpwdSrvAdmin.cc.o"
+  "CMakeFiles/xrdpwdadmin.dir/XrdSecpwdSrvAdmin.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdpwdadmin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecsss-6.pdb"
+  "../../lib/libXrdSecsss-6.so"
+  "CMakeFiles/XrdSecsss-6.dir/XrdSecProtocolsss.cc.o"
+  "CMakeFiles/XrdSecsss-6.dir/XrdSecProtocolsss.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecsss-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
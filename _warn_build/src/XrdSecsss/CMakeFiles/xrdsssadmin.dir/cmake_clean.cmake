@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/xrdsssadmin"
+  "../../bin/xrdsssadmin.pdb"
+  "CMakeFiles/xrdsssadmin.dir/XrdSecsssAdmin.cc.o"
+  "CMakeFiles/xrdsssadmin.dir/XrdSecsssAdmin.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xrdsssadmin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
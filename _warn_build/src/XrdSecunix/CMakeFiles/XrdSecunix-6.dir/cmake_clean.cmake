@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecunix-6.pdb"
+  "../../lib/libXrdSecunix-6.so"
+  "CMakeFiles/XrdSecunix-6.dir/XrdSecProtocolunix.cc.o"
+  "CMakeFiles/XrdSecunix-6.dir/XrdSecProtocolunix.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecunix-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
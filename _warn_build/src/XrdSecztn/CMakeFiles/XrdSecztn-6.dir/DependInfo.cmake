@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSecztn/XrdSecProtocolztn.cc" "src/XrdSecztn/CMakeFiles/XrdSecztn-6.dir/XrdSecProtocolztn.cc.o" "gcc" "src/XrdSecztn/CMakeFiles/XrdSecztn-6.dir/XrdSecProtocolztn.cc.o.d"
+  "/root/repo/src/XrdSecztn/XrdSecztn.cc" "src/XrdSecztn/CMakeFiles/XrdSecztn-6.dir/XrdSecztn.cc.o" "gcc" "src/XrdSecztn/CMakeFiles/XrdSecztn-6.dir/XrdSecztn.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
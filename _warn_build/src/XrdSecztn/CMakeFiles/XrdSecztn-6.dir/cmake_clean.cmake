@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSecztn-6.pdb"
+  "../../lib/libXrdSecztn-6.so"
+  "CMakeFiles/XrdSecztn-6.dir/XrdSecProtocolztn.cc.o"
+  "CMakeFiles/XrdSecztn-6.dir/XrdSecProtocolztn.cc.o.d"
+  "CMakeFiles/XrdSecztn-6.dir/XrdSecztn.cc.o"
+  "CMakeFiles/XrdSecztn-6.dir/XrdSecztn.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSecztn-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
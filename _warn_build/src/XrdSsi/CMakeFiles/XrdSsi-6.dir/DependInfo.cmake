@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSsi/XrdSsiDir.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiDir.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiDir.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFile.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiFile.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiFile.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFileReq.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiFileReq.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiFileReq.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFileSess.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiFileSess.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiFileSess.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiSfs.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiSfs.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiSfs.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiSfsConfig.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiSfsConfig.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiSfsConfig.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiStat.cc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiStat.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsi-6.dir/XrdSsiStat.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdSsi/CMakeFiles/XrdSsiLib.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
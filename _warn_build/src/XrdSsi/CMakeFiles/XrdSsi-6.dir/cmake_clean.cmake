@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSsi-6.pdb"
+  "../../lib/libXrdSsi-6.so"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiDir.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiDir.cc.o.d"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiFile.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiFile.cc.o.d"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiFileReq.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiFileReq.cc.o.d"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiFileSess.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiFileSess.cc.o.d"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiSfs.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiSfs.cc.o.d"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiSfsConfig.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiSfsConfig.cc.o.d"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiStat.cc.o"
+  "CMakeFiles/XrdSsi-6.dir/XrdSsiStat.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsi-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdSsi/XrdSsiAlert.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiAlert.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiAlert.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiAtomics.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiAtomics.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiAtomics.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiClient.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiClient.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiClient.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiCms.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiCms.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiCms.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiErrInfo.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiErrInfo.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiErrInfo.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiEvent.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiEvent.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiEvent.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiFileResource.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiFileResource.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiFileResource.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiLogger.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiLogger.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiLogger.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiRequest.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiRequest.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiRequest.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiResponder.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiResponder.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiResponder.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiScale.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiScale.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiScale.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiServReal.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiServReal.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiServReal.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiService.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiService.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiService.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiSessReal.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiSessReal.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiSessReal.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiStats.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiStats.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiStats.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiTaskReal.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiTaskReal.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiTaskReal.cc.o.d"
+  "/root/repo/src/XrdSsi/XrdSsiUtils.cc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiUtils.cc.o" "gcc" "src/XrdSsi/CMakeFiles/XrdSsiLib.dir/XrdSsiUtils.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdSsiLib.so" "/root/repo/_warn_build/lib/libXrdSsiLib.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdSsiLib.so.6" "/root/repo/_warn_build/lib/libXrdSsiLib.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/XrdCl/CMakeFiles/XrdCl.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
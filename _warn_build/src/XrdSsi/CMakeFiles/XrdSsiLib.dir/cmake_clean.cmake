@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSsiLib.pdb"
+  "../../lib/libXrdSsiLib.so"
+  "../../lib/libXrdSsiLib.so.6"
+  "../../lib/libXrdSsiLib.so.6.0"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiAlert.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiAlert.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiAtomics.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiAtomics.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiClient.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiClient.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiCms.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiCms.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiErrInfo.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiErrInfo.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiEvent.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiEvent.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiFileResource.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiFileResource.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiLogger.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiLogger.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiRequest.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiRequest.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiResponder.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiResponder.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiScale.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiScale.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiServReal.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiServReal.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiService.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiService.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiSessReal.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiSessReal.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiStats.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiStats.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiTaskReal.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiTaskReal.cc.o.d"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiUtils.cc.o"
+  "CMakeFiles/XrdSsiLib.dir/XrdSsiUtils.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsiLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSsiLog-6.pdb"
+  "../../lib/libXrdSsiLog-6.so"
+  "CMakeFiles/XrdSsiLog-6.dir/XrdSsiLogging.cc.o"
+  "CMakeFiles/XrdSsiLog-6.dir/XrdSsiLogging.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsiLog-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
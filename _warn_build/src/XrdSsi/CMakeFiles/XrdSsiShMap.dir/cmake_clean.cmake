@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdSsiShMap.pdb"
+  "../../lib/libXrdSsiShMap.so"
+  "../../lib/libXrdSsiShMap.so.6"
+  "../../lib/libXrdSsiShMap.so.6.0"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsiShMam.cc.o"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsiShMam.cc.o.d"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsiShMat.cc.o"
+  "CMakeFiles/XrdSsiShMap.dir/XrdSsiShMat.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdSsiShMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdThrottle/XrdOssThrottleFile.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdOssThrottleFile.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdOssThrottleFile.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleConfig.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleConfig.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleConfig.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleFile.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleFile.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleFile.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleFileSystem.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystem.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystem.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleFileSystemConfig.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystemConfig.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystemConfig.cc.o.d"
+  "/root/repo/src/XrdThrottle/XrdThrottleManager.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleManager.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/XrdThrottleManager.cc.o.d"
+  "/root/repo/src/XrdOfs/XrdOfsFS.cc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/__/XrdOfs/XrdOfsFS.cc.o" "gcc" "src/XrdThrottle/CMakeFiles/XrdThrottle-6.dir/__/XrdOfs/XrdOfsFS.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdServer.dir/DependInfo.cmake"
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
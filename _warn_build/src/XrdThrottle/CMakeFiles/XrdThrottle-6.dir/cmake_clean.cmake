@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdThrottle-6.pdb"
+  "../../lib/libXrdThrottle-6.so"
+  "CMakeFiles/XrdThrottle-6.dir/XrdOssThrottleFile.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/XrdOssThrottleFile.cc.o.d"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleConfig.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleConfig.cc.o.d"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleFile.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleFile.cc.o.d"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystem.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystem.cc.o.d"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystemConfig.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleFileSystemConfig.cc.o.d"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleManager.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/XrdThrottleManager.cc.o.d"
+  "CMakeFiles/XrdThrottle-6.dir/__/XrdOfs/XrdOfsFS.cc.o"
+  "CMakeFiles/XrdThrottle-6.dir/__/XrdOfs/XrdOfsFS.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdThrottle-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
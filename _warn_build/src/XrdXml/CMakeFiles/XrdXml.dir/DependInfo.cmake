@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdXml/XrdXmlMetaLink.cc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlMetaLink.cc.o" "gcc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlMetaLink.cc.o.d"
+  "/root/repo/src/XrdXml/XrdXmlRdrTiny.cc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlRdrTiny.cc.o" "gcc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlRdrTiny.cc.o.d"
+  "/root/repo/src/XrdXml/XrdXmlRdrXml2.cc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlRdrXml2.cc.o" "gcc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlRdrXml2.cc.o.d"
+  "/root/repo/src/XrdXml/XrdXmlReader.cc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlReader.cc.o" "gcc" "src/XrdXml/CMakeFiles/XrdXml.dir/XrdXmlReader.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_warn_build/lib/libXrdXml.so" "/root/repo/_warn_build/lib/libXrdXml.so.6.0"
+  "/root/repo/_warn_build/lib/libXrdXml.so.6" "/root/repo/_warn_build/lib/libXrdXml.so.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/XrdUtils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdXml.pdb"
+  "../../lib/libXrdXml.so"
+  "../../lib/libXrdXml.so.6"
+  "../../lib/libXrdXml.so.6.0"
+  "CMakeFiles/XrdXml.dir/XrdXmlMetaLink.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXmlMetaLink.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXmlRdrTiny.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXmlRdrTiny.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXmlRdrXml2.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXmlRdrXml2.cc.o.d"
+  "CMakeFiles/XrdXml.dir/XrdXmlReader.cc.o"
+  "CMakeFiles/XrdXml.dir/XrdXmlReader.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdXml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
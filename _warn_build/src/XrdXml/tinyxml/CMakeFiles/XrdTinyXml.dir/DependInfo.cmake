@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/XrdXml/tinyxml/tinystr.cpp" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinystr.cpp.o" "gcc" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinystr.cpp.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinyxml.cpp" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinyxml.cpp.o" "gcc" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinyxml.cpp.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinyxmlerror.cpp" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinyxmlerror.cpp.o" "gcc" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinyxmlerror.cpp.o.d"
+  "/root/repo/src/XrdXml/tinyxml/tinyxmlparser.cpp" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinyxmlparser.cpp.o" "gcc" "src/XrdXml/tinyxml/CMakeFiles/XrdTinyXml.dir/tinyxmlparser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
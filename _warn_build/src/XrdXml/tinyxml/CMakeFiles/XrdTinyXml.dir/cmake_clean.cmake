@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XrdTinyXml.dir/tinystr.cpp.o"
+  "CMakeFiles/XrdTinyXml.dir/tinystr.cpp.o.d"
+  "CMakeFiles/XrdTinyXml.dir/tinyxml.cpp.o"
+  "CMakeFiles/XrdTinyXml.dir/tinyxml.cpp.o.d"
+  "CMakeFiles/XrdTinyXml.dir/tinyxmlerror.cpp.o"
+  "CMakeFiles/XrdTinyXml.dir/tinyxmlerror.cpp.o.d"
+  "CMakeFiles/XrdTinyXml.dir/tinyxmlparser.cpp.o"
+  "CMakeFiles/XrdTinyXml.dir/tinyxmlparser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdTinyXml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
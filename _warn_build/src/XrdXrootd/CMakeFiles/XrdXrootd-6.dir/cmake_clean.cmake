@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libXrdXrootd-6.pdb"
+  "../../lib/libXrdXrootd-6.so"
+  "CMakeFiles/XrdXrootd-6.dir/XrdXrootdPlugin.cc.o"
+  "CMakeFiles/XrdXrootd-6.dir/XrdXrootdPlugin.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/XrdXrootd-6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -105,6 +105,25 @@ endif()
 check_include_file( et/com_err.h HAVE_ET_COM_ERR_H )
 compiler_define_if_found( HAVE_ET_COM_ERR_H HAVE_ET_COM_ERR_H )
 
+#-------------------------------------------------------------------------------
+# Check for io_uring (the client drives it with the raw system calls, so only
+# the kernel headers are needed)
+#-------------------------------------------------------------------------------
+if( ${CMAKE_SYSTEM_NAME} STREQUAL "Linux" )
+  check_cxx_source_compiles("
+    #include <linux/io_uring.h>
+    #include <sys/syscall.h>
+    int main()
+    {
+      io_uring_params params;
+      (void)params;
+      return IORING_OP_READ + IORING_REGISTER_PROBE + IORING_FEAT_NODROP +
+             __NR_io_uring_setup + __NR_io_uring_enter + __NR_io_uring_register;
+    }"
+    HAVE_IO_URING )
+  compiler_define_if_found( HAVE_IO_URING HAVE_IO_URING )
+endif()
+
 #-------------------------------------------------------------------------------
 # Check for pthreads
 #-------------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 //------------------------------------------------------------------------------
 
 #include "XrdClAction.hh"
+#include "XrdCl/XrdClRequestStats.hh"
 #include <fstream>
 #include <vector>
 #include <tuple>
@@ -115,6 +116,12 @@ struct ActionMetrics
           ss << "# " << std::setw(16) << key << " : " << std::setw(16) << i.second << std::endl;
         }
       }
+      for (auto& i : latency)
+      {
+        std::string key = i.first + "::lat";
+        std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+        ss << "# " << std::setw(16) << key << " : " << LatencyString(i.second) << std::endl;
+      }
     }
     else
     {
@@ -145,6 +152,12 @@ struct ActionMetrics
           ss << "      \"" << key << "\": " << i.second << "," << std::endl;
         }
       }
+      for (auto& i : latency)
+      {
+        std::string key = i.first + "::lat";
+        std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+        ss << LatencyJson(key, i.second, "      ") << "," << std::endl;
+      }
       ss.seekp(-2, std::ios_base::end);
       ss << "\n";
       if (fname.empty())
@@ -192,6 +205,35 @@ struct ActionMetrics
     // function called from callbacks requires a guard
     std::unique_lock<std::mutex> guard(mtx);
     delays[action + "::" + field] += value;
+    if (field == "tmeas")
+    {
+      // measured latencies also go into the histogram of the action
+      uint64_t                 us = value * 1000000.0;
+      RequestStats::Histogram& h  = latency[action];
+      h.count++;
+      h.latency += us;
+      h.buckets[RequestStats::Bucket(us)]++;
+    }
+  }
+
+  static std::string LatencyString(const RequestStats::Histogram& h)
+  {
+    std::stringstream ss;
+    ss << "n=" << h.count << " mean=" << h.Mean() << "us p50=" << h.Percentile(50)
+       << "us p90=" << h.Percentile(90) << "us p99=" << h.Percentile(99)
+       << "us max=" << h.Percentile(100) << "us";
+    return ss.str();
+  }
+
+  static std::string LatencyJson(const std::string&             key,
+                                 const RequestStats::Histogram& h,
+                                 const std::string&             indent)
+  {
+    std::stringstream ss;
+    ss << indent << "\"" << key << "\": { \"n\": " << h.count << ", \"mean\": " << h.Mean()
+       << ", \"p50\": " << h.Percentile(50) << ", \"p90\": " << h.Percentile(90)
+       << ", \"p99\": " << h.Percentile(99) << ", \"max\": " << h.Percentile(100) << " }";
+    return ss.str();
   }
 
   void addIos(const std::string& action, const std::string& field, double value)
@@ -215,6 +257,14 @@ struct ActionMetrics
     {
       delays[k.first] += k.second;
     }
+    for (auto& k : other.latency)
+    {
+      RequestStats::Histogram& h = latency[k.first];
+      h.count += k.second.count;
+      h.latency += k.second.latency;
+      for (uint32_t i = 0; i < RequestStats::NbBuckets; ++i)
+        h.buckets[i] += k.second.buckets[i];
+    }
     errors += other.errors;
 
     auto w1 = other.ios.find("Write::b");
@@ -335,6 +385,7 @@ struct ActionMetrics
 
   std::map<std::string, uint64_t> ios;
   std::map<std::string, double>   delays;
+  std::map<std::string, RequestStats::Histogram> latency;  // measured latency of each action [us]
   std::mutex                      mtx;  // only required for async callbacks
 };
 }
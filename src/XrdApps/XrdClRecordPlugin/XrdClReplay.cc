@@ -46,6 +46,8 @@
 #include <numeric>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
+#include <queue>
 
 namespace XrdCl
 {
@@ -185,29 +187,31 @@ class mytimer_t
 
 //------------------------------------------------------------------------------
 //! Barrier for synchronizing the asynchronous execution of actions
-//! It is actually a wrapper around semaphore.
+//! It calls the given callback once the last copy has been released.
 //------------------------------------------------------------------------------
 class barrier_t
 {
   public:
   //------------------------------------------------------------------------
   //! Constructor
-  //! @param sem : the semaphore
+  //! @param callback : called when the barrier is released
   //------------------------------------------------------------------------
-  barrier_t(XrdSysSemaphore& sem)
-  : sem(sem)
+  barrier_t(std::function<void()> callback)
+  : callback(std::move(callback))
   {
   }
 
   //------------------------------------------------------------------------
   //! Destructor
   //------------------------------------------------------------------------
-  ~barrier_t() { sem.Post(); }
-
-  inline XrdSysSemaphore& get() { return sem; }
+  ~barrier_t()
+  {
+    if (callback)
+      callback();
+  }
 
   private:
-  XrdSysSemaphore& sem;  //< the semaphore to be posted
+  std::function<void()> callback;  //< to be called on release
 };
 
 //------------------------------------------------------------------------------
@@ -339,14 +343,27 @@ class ActionExecutor
   {
   }
 
+  //--------------------------------------------------------------------------
+  //! Constructor - the same action in the context of another file
+  //! @param file  : the file that should be the context of the action
+  //! @param other : the action to be copied
+  //--------------------------------------------------------------------------
+  ActionExecutor(File& file, const ActionExecutor& other)
+  : file(file)
+  , action(other.action)
+  , args(other.args)
+  , orgststr(other.orgststr)
+  , nominalduration(other.nominalduration)
+  {
+  }
+
   //--------------------------------------------------------------------------
   //! Execute the action
-  //! @param ending  : synchronization object for ending the execution
+  //! @param ending   : released once the action has been completed
+  //! @param metric   : metrics of the file session
+  //! @param simulate : if true only account for the action
   //--------------------------------------------------------------------------
-  void Execute(std::shared_ptr<barrier_t>& ending,
-               std::shared_ptr<barrier_t>& closing,
-               ActionMetrics&              metric,
-               bool                        simulate)
+  void Execute(std::shared_ptr<barrier_t>& ending, ActionMetrics& metric, bool simulate)
   {
     if (action == "Open")  // open action
     {
@@ -371,18 +388,16 @@ class ActionExecutor
       mytimer_t timer;
 
       if (!simulate)
-        WaitFor(Open(file, url, flags, mode, timeout) >>
-                [orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s) mutable
-                {
-                  metric.addIos("Open", "e", HandleStatus(s, orgststr, "Open"));
-                  metric.addDelays("Open", "tmeas", timer.elapsed());
-                  ending.reset();
-                  closing.reset();
-                });
+        Async(Open(file, url, flags, mode, timeout) >>
+              [orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s) mutable
+              {
+                metric.addIos("Open", "e", HandleStatus(s, orgststr, "Open"));
+                metric.addDelays("Open", "tmeas", timer.elapsed());
+                ending.reset();
+              });
       else
       {
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "Close")  // close action
@@ -390,13 +405,6 @@ class ActionExecutor
       time_t      timeout = GetCloseArgs();
       mytimer_t   timer;
 
-      if (closing)
-      {
-        auto& sem = closing->get();
-        closing.reset();
-        sem.Wait();
-      }
-
       metric.ios["Close::n"]++;
 
       if (!simulate)
@@ -422,17 +430,15 @@ class ActionExecutor
 
       if (!simulate)
         Async(Stat(file, force, timeout) >>
-              [orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s, StatInfo& r) mutable
+              [orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s, StatInfo& r) mutable
               {
                 metric.addIos("Stat", "e", HandleStatus(s, orgststr, "Stat"));
                 metric.addDelays("Stat", "tmeas", timer.elapsed());
                 ending.reset();
-                closing.reset();
               });
       else
       {
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "Read")  // read action
@@ -449,20 +455,18 @@ class ActionExecutor
       mytimer_t timer;
       if (!simulate)
         Async(Read(file, offset, buffer->size(), buffer->data(), timeout) >>
-              [buffer, orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s,
+              [buffer, orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s,
                                                                               ChunkInfo& r) mutable
               {
                 metric.addIos("Read", "e", HandleStatus(s, orgststr, "Read"));
                 metric.addDelays("Read", "tmeas", timer.elapsed());
                 buffer.reset();
                 ending.reset();
-                closing.reset();
               });
       else
       {
         buffer.reset();
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "PgRead")  // pgread action
@@ -478,20 +482,18 @@ class ActionExecutor
       mytimer_t timer;
       if (!simulate)
         Async(PgRead(file, offset, buffer->size(), buffer->data(), timeout) >>
-              [buffer, orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s,
+              [buffer, orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s,
                                                                               PageInfo& r) mutable
               {
                 metric.addIos("PgRead", "e", HandleStatus(s, orgststr, "PgRead"));
                 metric.addDelays("PgRead", "tmeas", timer.elapsed());
                 buffer.reset();
                 ending.reset();
-                closing.reset();
               });
       else
       {
         buffer.reset();
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "Write")  // write action
@@ -509,19 +511,17 @@ class ActionExecutor
       if (!simulate)
         Async(
           Write(file, offset, buffer->size(), buffer->data(), timeout) >>
-          [buffer, orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s) mutable
+          [buffer, orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s) mutable
           {
             metric.addIos("Write", "e", HandleStatus(s, orgststr, "Write"));
             metric.addDelays("Write", "tmeas", timer.elapsed());
             buffer.reset();
             ending.reset();
-            closing.reset();
           });
       else
       {
         buffer.reset();
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "PgWrite")  // pgwrite action
@@ -538,19 +538,17 @@ class ActionExecutor
       if (!simulate)
         Async(
           PgWrite(file, offset, buffer->size(), buffer->data(), timeout) >>
-          [buffer, orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s) mutable
+          [buffer, orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s) mutable
           {
             metric.addIos("PgWrite", "e", HandleStatus(s, orgststr, "PgWrite"));
             metric.addDelays("PgWrite", "tmeas", timer.elapsed());
             buffer.reset();
             ending.reset();
-            closing.reset();
           });
       else
       {
         buffer.reset();
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "Sync")  // sync action
@@ -560,17 +558,15 @@ class ActionExecutor
       mytimer_t timer;
       if (!simulate)
         Async(Sync(file, timeout) >>
-              [orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s) mutable
+              [orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s) mutable
               {
                 metric.addIos("Sync", "e", HandleStatus(s, orgststr, "Sync"));
                 metric.addDelays("Sync", "tmeas", timer.elapsed());
                 ending.reset();
-                closing.reset();
               });
       else
       {
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "Truncate")  // truncate action
@@ -585,17 +581,15 @@ class ActionExecutor
       mytimer_t timer;
       if (!simulate)
         Async(Truncate(file, size, timeout) >>
-              [orgststr{ orgststr }, ending, closing, timer, &metric](XRootDStatus& s) mutable
+              [orgststr{ orgststr }, ending, timer, &metric](XRootDStatus& s) mutable
               {
                 metric.addIos("Truncate", "e", HandleStatus(s, orgststr, "Truncate"));
                 metric.addDelays("Truncate", "tmeas", timer.elapsed());
                 ending.reset();
-                closing.reset();
               });
       else
       {
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "VectorRead")  // vector read action
@@ -616,19 +610,17 @@ class ActionExecutor
       if (!simulate)
         Async(
           VectorRead(file, chunks, timeout) >>
-          [orgststr{ orgststr }, buffers, ending, closing, timer, &metric](XRootDStatus& s, VectorReadInfo& r) mutable
+          [orgststr{ orgststr }, buffers, ending, timer, &metric](XRootDStatus& s, VectorReadInfo& r) mutable
           {
             metric.addIos("VectorRead", "e", HandleStatus(s, orgststr, "VectorRead"));
             metric.addDelays("VectorRead", "tmeas", timer.elapsed());
             buffers.clear();
             ending.reset();
-            closing.reset();
           });
       else
       {
         buffers.clear();
         ending.reset();
-        closing.reset();
       }
     }
     else if (action == "VectorWrite")  // vector write
@@ -647,19 +639,17 @@ class ActionExecutor
       mytimer_t timer;
       if (!simulate)
         Async(VectorWrite(file, chunks, timeout) >>
-              [orgststr{ orgststr }, buffers, ending, closing, timer, &metric](XRootDStatus& s) mutable
+              [orgststr{ orgststr }, buffers, ending, timer, &metric](XRootDStatus& s) mutable
               {
                 metric.addIos("VectorWrite", "e", HandleStatus(s, orgststr, "VectorWrite"));
                 metric.addDelays("VectorWrite", "tmeas", timer.elapsed());
                 buffers.clear();
                 ending.reset();
-                closing.reset();
               });
       else
       {
         buffers.clear();
         ending.reset();
-        closing.reset();
       }
     }
     else
@@ -1011,60 +1001,244 @@ std::unordered_map<File*, action_list> ParseInput(const std::string&
 }
 
 //------------------------------------------------------------------------------
-//! Execute list of actions against given file
-//! @param file    : the file object
-//! @param actions : list of actions to be executed
-//! @param t0      : offset to add to each start time to determine when to ru an action
-//! @return        : thread that will executed the list of actions
+//! Runs the file sessions asynchronously on a fixed number of worker threads
+//!
+//! Each session submits its actions at the recorded start time (scaled by
+//! the playback speed) without waiting for the preceding ones to complete,
+//! except for an open, which has to complete before the next action, and
+//! a close, which waits for all the preceding actions.
 //------------------------------------------------------------------------------
-std::thread ExecuteActions(std::unique_ptr<File> file,
-                           action_list&&         actions,
-                           double                t0,
-                           double                speed,
-                           ActionMetrics&        metric,
-                           bool                  simulate)
+class Runner
 {
-  std::thread t(
-    [file{ std::move(file) },
-     actions{ std::move(actions) },
-     t0,
-     &metric,
-     simulate,
-     &speed]() mutable
+  public:
+  //--------------------------------------------------------------------------
+  //! Constructor
+  //! @param t0       : start time of the recording
+  //! @param speed    : playback speed
+  //! @param asap     : if true ignore the recorded timing
+  //! @param simulate : if true only account for the actions
+  //--------------------------------------------------------------------------
+  Runner(double t0, double speed, bool asap, bool simulate)
+  : t0(t0)
+  , speed(speed)
+  , asap(asap)
+  , simulate(simulate)
+  , tstart(0)
+  , active(0)
+  {
+  }
+
+  //--------------------------------------------------------------------------
+  //! Add a file session
+  //! @param file    : the file object
+  //! @param actions : list of actions to be executed
+  //! @param metric  : metrics of the session
+  //--------------------------------------------------------------------------
+  void AddSession(std::unique_ptr<File> file, action_list&& actions, ActionMetrics& metric)
+  {
+    sessions.emplace_back(new Session(std::move(file), std::move(actions), metric));
+  }
+
+  //--------------------------------------------------------------------------
+  //! Run all the sessions and wait until they are done
+  //! @param nbworkers : number of worker threads
+  //--------------------------------------------------------------------------
+  void Run(size_t nbworkers)
+  {
+    tstart = XrdCl::Action::timeNow();
+    active = sessions.size();
+    for (auto& s : sessions)
+      Schedule(s.get(), tstart);
+
+    std::vector<std::thread> workers;
+    workers.reserve(nbworkers);
+    for (size_t i = 0; i < nbworkers; ++i)
+      workers.emplace_back(&Runner::Worker, this);
+    for (auto& t : workers)
+      t.join();
+    sessions.clear();
+  }
+
+  private:
+  //--------------------------------------------------------------------------
+  //! A file session in progress
+  //--------------------------------------------------------------------------
+  struct Session
+  {
+    Session(std::unique_ptr<File> file, action_list&& actions, ActionMetrics& metric)
+    : file(std::move(file))
+    , actions(std::move(actions))
+    , next(this->actions.begin())
+    , metric(metric)
+    , inflight(0)
+    , waiting(false)
+    , drain(false)
     {
-      XrdSysSemaphore endsem(0);
-      XrdSysSemaphore closesem(0);
-      auto            ending  = std::make_shared<barrier_t>(endsem);
-      auto            closing = std::make_shared<barrier_t>(closesem);
+    }
+
+    std::unique_ptr<File>  file;      //< the file object
+    action_list            actions;   //< actions to be executed
+    action_list::iterator  next;      //< next action to be executed
+    ActionMetrics&         metric;    //< metrics of the session
+    std::mutex             mtx;       //< guards inflight and waiting
+    size_t                 inflight;  //< number of actions in progress
+    bool                   waiting;   //< waiting for the actions in progress
+    bool                   drain;     //< the next action waits for the ones in progress
+  };
+
+  using task_t = std::pair<double, Session*>;
 
-      for (auto& p : actions)
+  //--------------------------------------------------------------------------
+  //! Queue a session to be continued at given time
+  //--------------------------------------------------------------------------
+  void Schedule(Session* s, double when)
+  {
+    std::unique_lock<std::mutex> lck(mtx);
+    queue.emplace(when, s);
+    cv.notify_one();
+  }
+
+  //--------------------------------------------------------------------------
+  //! Worker loop: continue the sessions that are due
+  //--------------------------------------------------------------------------
+  void Worker()
+  {
+    std::unique_lock<std::mutex> lck(mtx);
+    while (active)
+    {
+      if (queue.empty())
+      {
+        cv.wait(lck);
+        continue;
+      }
+      double delay = queue.top().first - XrdCl::Action::timeNow();
+      if (delay > 0)
       {
-        auto& action = p.second;
+        cv.wait_for(lck, std::chrono::microseconds((int64_t)(delay * 1000000)));
+        continue;
+      }
+      Session* s = queue.top().second;
+      queue.pop();
+      lck.unlock();
+      Step(s);
+      lck.lock();
+    }
+  }
 
-        auto tdelay = t0 ? ((p.first + t0) - XrdCl::Action::timeNow()) : 0;
-        if (tdelay > 0)
+  //--------------------------------------------------------------------------
+  //! Execute all the actions of a session that are due
+  //--------------------------------------------------------------------------
+  void Step(Session* s)
+  {
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lck(s->mtx);
+        bool mustwait = s->next == s->actions.end() || s->drain
+                        || s->next->second.Name() == "Close";
+        if (mustwait && s->inflight)
         {
-          tdelay /= speed;
-          metric.delays[action.Name() + "::tloss"] += tdelay;
-	  std::this_thread::sleep_for(std::chrono::milliseconds((int) (tdelay * 1000)));
+          s->waiting = true;  // continued once the last action is done
+          return;
         }
-        else
+        s->drain = false;
+      }
+
+      if (s->next == s->actions.end())
+      {
+        Finish(s);
+        return;
+      }
+
+      auto&  action = s->next->second;
+      double tdelay = 0;
+      if (!asap)
+      {
+        double due = tstart + (s->next->first - t0) / speed;
+        tdelay     = due - XrdCl::Action::timeNow();
+        if (tdelay > 0)
         {
-          metric.delays[action.Name() + "::tgain"] += tdelay;
+          s->metric.addDelays(action.Name(), "tloss", tdelay);
+          Schedule(s, due);
+          return;
         }
+      }
+      s->metric.addDelays(action.Name(), "tgain", tdelay);
 
-        mytimer_t timer;
-        action.Execute(ending, closing, metric, simulate);
-        metric.addDelays(action.Name(), "tnomi", action.NominalDuration());
-        metric.addDelays(action.Name(), "texec", timer.elapsed());
+      {
+        std::unique_lock<std::mutex> lck(s->mtx);
+        ++s->inflight;
+        s->drain = action.Name() == "Open";
       }
-      ending.reset();
-      closing.reset();
-      endsem.Wait();
-      file->GetProperty("LastURL", metric.url);
-      file.reset();
-    });
-  return t;
+      auto done = std::make_shared<barrier_t>([this, s]() { Completed(s); });
+      mytimer_t timer;
+      action.Execute(done, s->metric, simulate);
+      done.reset();
+      s->metric.addDelays(action.Name(), "tnomi", action.NominalDuration());
+      s->metric.addDelays(action.Name(), "texec", timer.elapsed());
+      ++s->next;
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  //! Called when an action of a session has been completed
+  //--------------------------------------------------------------------------
+  void Completed(Session* s)
+  {
+    std::unique_lock<std::mutex> lck(s->mtx);
+    if (--s->inflight || !s->waiting)
+      return;
+    s->waiting = false;
+    lck.unlock();
+    Schedule(s, 0);
+  }
+
+  //--------------------------------------------------------------------------
+  //! Finalize a session that has executed all of its actions
+  //--------------------------------------------------------------------------
+  void Finish(Session* s)
+  {
+    s->file->GetProperty("LastURL", s->metric.url);
+    s->file.reset();
+    std::unique_lock<std::mutex> lck(mtx);
+    if (!--active)
+      cv.notify_all();
+  }
+
+  double                                                      t0;        //< start of the recording
+  double                                                      speed;     //< playback speed
+  bool                                                        asap;      //< ignore the timing
+  bool                                                        simulate;  //< don't run any IO
+  double                                                      tstart;    //< start of the playback
+  std::vector<std::unique_ptr<Session>>                       sessions;  //< all sessions
+  std::priority_queue<task_t, std::vector<task_t>, std::greater<task_t>> queue;  //< due sessions
+  size_t                                                      active;    //< sessions in progress
+  std::mutex                                                  mtx;       //< guards queue and active
+  std::condition_variable                                     cv;
+};
+
+//------------------------------------------------------------------------------
+//! Aggregate the client side statistics of the requests sent to each server
+//------------------------------------------------------------------------------
+std::map<std::string, RequestStats::Histogram> ServerStats()
+{
+  std::map<std::string, RequestStats::Histogram> result;
+  for (auto& e : RequestStats::GetSnapshot())
+  {
+    if (!e.requestId)
+      continue;  // skip the per sub-stream entries, they account for the same requests
+    RequestStats::Histogram& h = result[e.server];
+    h.count     += e.histogram.count;
+    h.errors    += e.histogram.errors;
+    h.stalls    += e.histogram.stalls;
+    h.stallTime += e.histogram.stallTime;
+    h.bytesOut  += e.histogram.bytesOut;
+    h.bytesIn   += e.histogram.bytesIn;
+    h.latency   += e.histogram.latency;
+    for (uint32_t i = 0; i < RequestStats::NbBuckets; ++i)
+      h.buckets[i] += e.histogram.buckets[i];
+  }
+  return result;
 }
 
 }
@@ -1124,10 +1298,7 @@ int main(int argc, char** argv)
                                      synchronicity,
                                      responseerrors,
                                      opt.regex());  // parse the input file
-    std::vector<std::thread>                               threads;
     std::unordered_map<XrdCl::File*, XrdCl::ActionMetrics> metrics;
-    threads.reserve(actions.size());
-    double               toffset = XrdCl::Action::timeNow() - t0;
     XrdCl::mytimer_t     timer;
     XrdCl::ActionMetrics summetric;
     bool                 sampling_error = false;
@@ -1154,23 +1325,38 @@ int main(int argc, char** argv)
       }
     }
 
+    if (!opt.print())
+    {
+      // collect the client side statistics of the requests sent to the servers
+      XrdCl::RequestStats::Enable(true);
+    }
 
-    if (opt.print())
-      toffset = 0;  // indicate not to follow timing
+    // in print mode the timing is not followed
+    XrdCl::Runner runner(t0, opt.speed(), opt.asap() || opt.print(), opt.print());
+    size_t        nsessions = opt.print() ? 1 : opt.sessions();
 
     for (auto& action : actions)
     {
+      // replay the session several times concurrently, each copy with its own file object
+      for (size_t i = 1; i < nsessions; ++i)
+      {
+        XrdCl::File* file = new XrdCl::File(false);
+        file->SetProperty("BundledClose", "true");
+        XrdCl::action_list copy;
+        for (auto& p : action.second)
+          copy.emplace(p.first, XrdCl::ActionExecutor(*file, p.second));
+        metrics[file].fname         = metrics[action.first].fname;
+        metrics[file].synchronicity = metrics[action.first].synchronicity;
+        metrics[file].errors        = metrics[action.first].errors;
+        runner.AddSession(std::unique_ptr<XrdCl::File>(file), std::move(copy), metrics[file]);
+      }
       // execute list of actions against file object
-      threads.emplace_back(ExecuteActions(std::unique_ptr<XrdCl::File>(action.first),
-                                          std::move(action.second),
-                                          toffset,
-                                          opt.speed(),
-                                          metrics[action.first],
-                                          opt.print()));
+      runner.AddSession(std::unique_ptr<XrdCl::File>(action.first),
+                        std::move(action.second),
+                        metrics[action.first]);
     }
 
-    for (auto& t : threads)  // wait until we are done
-      t.join();
+    runner.Run(opt.workers());  // wait until we are done
 
     if (opt.json())
     {
@@ -1197,7 +1383,11 @@ int main(int argc, char** argv)
         std::cout << "  ]," << std::endl;
     }
 
-    double tbench = timer.elapsed();
+    double   tbench  = timer.elapsed();
+    uint64_t nops    = 0;  // number of completed operations
+    for (auto& l : summetric.latency)
+      nops += l.second.count;
+    auto     servers = XrdCl::ServerStats();
 
     if (opt.json())
     {
@@ -1206,8 +1396,11 @@ int main(int argc, char** argv)
         if (!opt.print())
         {
           std::cout << "    \"player::runtime\": " << tbench << "," << std::endl;
+          std::cout << "    \"player::sessions\": " << metrics.size() << "," << std::endl;
+          std::cout << "    \"player::oprate\": " << nops / tbench << "," << std::endl;
         }
-        std::cout << "    \"player::speed\": " << opt.speed() << "," << std::endl;
+        std::cout << "    \"player::speed\": " << (opt.asap() ? 0 : opt.speed()) << ","
+                  << std::endl;
         std::cout << "    \"sampled::runtime\": " << t1 - t0 << "," << std::endl;
         std::cout << "    \"volume::totalread\": " << summetric.getBytesRead() << "," << std::endl;
         std::cout << "    \"volume::totalwrite\": " << summetric.getBytesWritten() << ","
@@ -1252,7 +1445,32 @@ int main(int argc, char** argv)
         std::cout << "    \"synchronicity::write\":"
                   << summetric.aggregated_synchronicity.WriteSynchronicity() << "," << std::endl;
         std::cout << "    \"response::error:\":" << summetric.ios["All::e"] << std::endl;
-        std::cout << "  }" << std::endl;
+        if (opt.print())
+        {
+          std::cout << "  }" << std::endl;
+        }
+        else
+        {
+          std::cout << "  }," << std::endl;
+          std::cout << "  \"latency\": {" << std::endl;
+          for (auto it = summetric.latency.begin(); it != summetric.latency.end(); ++it)
+          {
+            std::cout << XrdCl::ActionMetrics::LatencyJson(it->first, it->second, "    ")
+                      << (std::next(it) != summetric.latency.end() ? "," : "") << std::endl;
+          }
+          std::cout << "  }," << std::endl;
+          std::cout << "  \"servers\": {" << std::endl;
+          for (auto it = servers.begin(); it != servers.end(); ++it)
+          {
+            auto& h = it->second;
+            std::cout << "    \"" << it->first << "\": { \"requests\": " << h.count
+                      << ", \"errors\": " << h.errors << ", \"stalls\": " << h.stalls
+                      << ", \"stalltime\": " << h.stallTime << ", \"mean\": " << h.Mean()
+                      << ", \"p50\": " << h.Percentile(50) << ", \"p99\": " << h.Percentile(99)
+                      << " }" << (std::next(it) != servers.end() ? "," : "") << std::endl;
+          }
+          std::cout << "  }" << std::endl;
+        }
         std::cout << "}" << std::endl;
       }
     }
@@ -1267,10 +1485,16 @@ int main(int argc, char** argv)
       if (!opt.print())
       {
         std::cout << "# Total   Runtime  : " << std::fixed << tbench << " s" << std::endl;
+        std::cout << "# Sessions         : " << metrics.size() << std::endl;
+        std::cout << "# Op Rate          : " << std::fixed << std::setprecision(2)
+                  << nops / tbench << " ops/s" << std::endl;
       }
       std::cout << "# Sampled Runtime  : " << std::fixed << t1 - t0 << " s" << std::endl;
-      std::cout << "# Playback Speed   : " << std::fixed << std::setprecision(2) << opt.speed()
-                << std::endl;
+      if (opt.asap())
+        std::cout << "# Playback Speed   : asap" << std::endl;
+      else
+        std::cout << "# Playback Speed   : " << std::fixed << std::setprecision(2) << opt.speed()
+                  << std::endl;
       std::cout << "# IO Volume (R)    : " << std::fixed
                 << XrdCl::ActionMetrics::humanreadable(summetric.getBytesRead())
                 << " [ std:" << XrdCl::ActionMetrics::humanreadable(summetric.ios["Read::b"])
@@ -1324,6 +1548,24 @@ int main(int argc, char** argv)
                 << summetric.aggregated_synchronicity.WriteSynchronicity() << "%" << std::endl;
       if (!opt.print())
       {
+        std::cout << "# ---------------------------------------------" << std::endl;
+        std::cout << "# Latency" << std::endl;
+        std::cout << "# ---------------------------------------------" << std::endl;
+        for (auto& l : summetric.latency)
+        {
+          std::cout << "# " << std::left << std::setw(16) << l.first << std::right << " : "
+                    << XrdCl::ActionMetrics::LatencyString(l.second) << std::endl;
+        }
+        std::cout << "# ---------------------------------------------" << std::endl;
+        std::cout << "# Servers" << std::endl;
+        std::cout << "# ---------------------------------------------" << std::endl;
+        for (auto& srv : servers)
+        {
+          auto& h = srv.second;
+          std::cout << "# " << srv.first << " : requests=" << h.count << " errors=" << h.errors
+                    << " stalls=" << h.stalls << " stalled=" << h.stallTime << "s"
+                    << " mean=" << h.Mean() << "us p99=" << h.Percentile(99) << "us" << std::endl;
+        }
         std::cout << "# ---------------------------------------------" << std::endl;
         std::cout << "# Response Errors  : " << std::fixed << summetric.ios["All::e"] << std::endl;
         std::cout << "# =============================================" << std::endl;
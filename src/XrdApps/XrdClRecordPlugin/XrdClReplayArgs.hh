@@ -27,6 +27,7 @@
 #include <regex>
 #include <map>
 #include <vector>
+#include <thread>
 namespace XrdCl
 {
 //------------------------------------------------------------------------------
@@ -45,6 +46,9 @@ class ReplayArgs
   , option_suppress_error(false)
   , option_verify(false)
   , option_speed(1.0)
+  , option_asap(false)
+  , option_sessions(1)
+  , option_workers(std::thread::hardware_concurrency())
   {
     while (1)
     {
@@ -55,9 +59,11 @@ class ReplayArgs
             { "long", no_argument, 0, 'l' },        { "json", no_argument, 0, 'j' },
             { "summary", no_argument, 0, 's' },     { "replace", required_argument, 0, 'r' },
             { "suppress", no_argument, 0, 'f' },    { "verify", no_argument, 0, 'v' },
-            { "speed", required_argument, 0, 'x' }, { 0, 0, 0, 0 } };
+            { "speed", required_argument, 0, 'x' }, { "asap", no_argument, 0, 'a' },
+            { "sessions", required_argument, 0, 'n' }, { "workers", required_argument, 0, 'w' },
+            { 0, 0, 0, 0 } };
 
-      int c = getopt_long(argc, argv, "vjpctshlfr:x:", long_options, &option_index);
+      int c = getopt_long(argc, argv, "vjpctshlfar:x:n:w:", long_options, &option_index);
       if (c == -1)
         break;
 
@@ -106,6 +112,26 @@ class ReplayArgs
           }
           break;
 
+        case 'a':
+          option_asap = true;
+          break;
+
+        case 'n':
+          option_sessions = std::strtoul(optarg, 0, 10);
+          if (!option_sessions)
+          {
+            usage();
+          }
+          break;
+
+        case 'w':
+          option_workers = std::strtoul(optarg, 0, 10);
+          if (!option_workers)
+          {
+            usage();
+          }
+          break;
+
         case 'r':
           option_regex.push_back(optarg);
           break;
@@ -122,6 +148,9 @@ class ReplayArgs
     if (option_json && (option_long || option_summary))
       option_long = option_summary = true;
 
+    if (!option_workers)
+      option_workers = 1;
+
     if (option_verify)
     {
       option_print    = true;
@@ -144,7 +173,7 @@ class ReplayArgs
   void usage()
   {
     std::cerr
-      << "usage: xrdreplay [-p|--print] [-c|--create-data] [t|--truncate-data] [-l|--long] [-s|--summary] [-h|--help] [-r|--replace <arg>:=<newarg>] [-f|--suppress] [-v|--verify] [-x|--speed <value] p<recordfilename>]\n"
+      << "usage: xrdreplay [-p|--print] [-c|--create-data] [t|--truncate-data] [-l|--long] [-s|--summary] [-h|--help] [-r|--replace <arg>:=<newarg>] [-f|--suppress] [-v|--verify] [-x|--speed <value] [-a|--asap] [-n|--sessions <n>] [-w|--workers <n>] p<recordfilename>]\n"
       << std::endl;
     std::cerr << "                -h | --help             : show this help" << std::endl;
     std::cerr
@@ -168,6 +197,15 @@ class ReplayArgs
     std::cerr
       << "                -x | --speed <x>        : change playback speed by factor <x> [ <x> > 0.0 ]"
       << std::endl;
+    std::cerr
+      << "                -a | --asap             : ignore the recorded timing and run the IO as fast as possible"
+      << std::endl;
+    std::cerr
+      << "                -n | --sessions <n>     : replay every recorded file session <n> times concurrently"
+      << std::endl;
+    std::cerr
+      << "                -w | --workers <n>      : number of threads running the sessions [ default: number of cores ]"
+      << std::endl;
     std::cerr
       << "                -r | --replace <a>:=<b> : replace in the argument list the string <a> with <b> "
       << std::endl;
@@ -194,6 +232,9 @@ class ReplayArgs
   bool                      suppress_error() { return option_suppress_error; }
   bool                      verify() { return option_verify; }
   double                    speed() { return option_speed; }
+  bool                      asap() { return option_asap; }
+  size_t                    sessions() { return option_sessions; }
+  size_t                    workers() { return option_workers; }
   std::vector<std::string>& regex() { return option_regex; }
   std::string&              path() { return _path; }
 
@@ -207,6 +248,9 @@ class ReplayArgs
   bool                     option_suppress_error;
   bool                     option_verify;
   double                   option_speed;
+  bool                     option_asap;
+  size_t                   option_sessions;
+  size_t                   option_workers;
   std::vector<std::string> option_regex;
   std::string              _path;
 };
@@ -19,6 +19,8 @@
 #ifndef __XRD_CL_BUFFER_HH__
 #define __XRD_CL_BUFFER_HH__
 
+#include "XrdCl/XrdClBufferCache.hh"
+
 #include <cstdlib>
 #include <cstdint>
 #include <new>
@@ -87,9 +89,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       void ReAllocate( uint32_t size )
       {
-        pBuffer = (char *)realloc( pBuffer, size );
-        if( !pBuffer )
-          throw std::bad_alloc();
+        pBuffer = BufferCache::ReAllocate( pBuffer, pSize, size );
         pSize = size;
       }
 
@@ -98,7 +98,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       void Free()
       {
-        free( pBuffer );
+        BufferCache::Free( pBuffer );
         pBuffer = 0;
         pSize   = 0;
         pCursor = 0;
@@ -112,9 +112,7 @@ namespace XrdCl
         if( !size )
          return;
 
-        pBuffer = (char *)malloc( size );
-        if( !pBuffer )
-          throw std::bad_alloc();
+        pBuffer = BufferCache::Allocate( size );
         pSize = size;
       }
 
@@ -233,7 +231,7 @@ namespace XrdCl
       }
 
       //------------------------------------------------------------------------
-      //! Release the buffer
+      //! Release the buffer (it has to be freed with free())
       //------------------------------------------------------------------------
       char *Release()
       {
@@ -0,0 +1,379 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClBufferCache.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(__FreeBSD__)
+#include <malloc_np.h>
+#elif defined(__linux__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Size classes: 64 B, 128 B, ..., 64 KiB
+  //----------------------------------------------------------------------------
+  const uint32_t MinShift    = 6;
+  const uint32_t MaxShift    = 16;
+  const uint32_t NbClasses   = MaxShift - MinShift + 1;
+
+  //----------------------------------------------------------------------------
+  // Bytes of free blocks kept per size class in a thread cache and in the
+  // depot (but at least a couple of blocks)
+  //----------------------------------------------------------------------------
+  const uint32_t ThreadBytes = 64 * 1024;
+  const uint32_t DepotBytes  = 1024 * 1024;
+
+  //----------------------------------------------------------------------------
+  // Merge the per-thread counters every that many allocations
+  //----------------------------------------------------------------------------
+  const uint32_t StatsPeriod = 1024;
+
+  inline int SizeClass( uint32_t size )
+  {
+    if( size > ( 1u << MaxShift ) ) return -1;
+    int cls = 0;
+    while( ( 1u << ( cls + MinShift ) ) < size ) ++cls;
+    return cls;
+  }
+
+  inline uint32_t ClassSize( int cls )
+  {
+    return 1u << ( cls + MinShift );
+  }
+
+  //----------------------------------------------------------------------------
+  // Usable size of a malloc'ed block, 0 if the platform cannot tell, in
+  // which case nothing is cached
+  //----------------------------------------------------------------------------
+#if defined(__APPLE__)
+  inline size_t UsableSize( char *block ) { return malloc_size( block ); }
+  const bool CacheEnabled = true;
+#elif defined(__linux__) || defined(__FreeBSD__)
+  inline size_t UsableSize( char *block ) { return malloc_usable_size( block ); }
+  const bool CacheEnabled = true;
+#else
+  inline size_t UsableSize( char * ) { return 0; }
+  const bool CacheEnabled = false;
+#endif
+
+  //----------------------------------------------------------------------------
+  // The largest size class a block of the given usable size can serve, -1
+  // if it is too small or so big that caching it would pin the memory
+  //----------------------------------------------------------------------------
+  inline int BlockClass( size_t usable )
+  {
+    if( usable < ClassSize( 0 ) || usable >= 2 * size_t( ClassSize( NbClasses - 1 ) ) )
+      return -1;
+    int cls = 0;
+    while( cls + 1 < int( NbClasses ) && ClassSize( cls + 1 ) <= usable ) ++cls;
+    return cls;
+  }
+
+  inline uint32_t ThreadSlots( int cls )
+  {
+    return std::max<uint32_t>( 2, ThreadBytes / ClassSize( cls ) );
+  }
+
+  inline uint32_t DepotSlots( int cls )
+  {
+    return std::max<uint32_t>( 4, DepotBytes / ClassSize( cls ) );
+  }
+
+  //----------------------------------------------------------------------------
+  // Free blocks are chained through their first bytes
+  //----------------------------------------------------------------------------
+  inline char *&Next( char *block )
+  {
+    return *reinterpret_cast<char**>( block );
+  }
+
+  struct FreeList
+  {
+    char     *head;
+    uint32_t  count;
+
+    void Push( char *block )
+    {
+      Next( block ) = head;
+      head = block;
+      ++count;
+    }
+
+    char *Pop()
+    {
+      char *block = head;
+      head = Next( block );
+      --count;
+      return block;
+    }
+  };
+
+  //----------------------------------------------------------------------------
+  // Shared depot, never destroyed so that buffers may still be freed
+  // during the static destruction
+  //----------------------------------------------------------------------------
+  struct Depot
+  {
+    XrdSysMutex mutex[NbClasses];
+    FreeList    lists[NbClasses];
+
+    std::atomic<uint64_t> allocs;
+    std::atomic<uint64_t> hits;
+
+    Depot(): allocs( 0 ), hits( 0 )
+    {
+      memset( (void*)lists, 0, sizeof( lists ) );
+    }
+  };
+
+  Depot &GetDepot()
+  {
+    static Depot *depot = new Depot();
+    return *depot;
+  }
+
+  //----------------------------------------------------------------------------
+  // Per-thread cache, trivially destructible so that it is still usable
+  // (as dead) while other thread-local objects are being destroyed
+  //----------------------------------------------------------------------------
+  struct ThreadCache
+  {
+    FreeList lists[NbClasses];
+    uint32_t allocs;
+    uint32_t hits;
+    bool     dead;
+  };
+
+  thread_local ThreadCache tlsCache;
+
+  void FlushStats( ThreadCache &tc )
+  {
+    Depot &depot = GetDepot();
+    depot.allocs.fetch_add( tc.allocs, std::memory_order_relaxed );
+    depot.hits.fetch_add( tc.hits, std::memory_order_relaxed );
+    tc.allocs = 0;
+    tc.hits   = 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Move up to count blocks from the thread cache to the depot, the ones
+  // that do not fit are freed
+  //----------------------------------------------------------------------------
+  void Drain( FreeList &list, int cls, uint32_t count )
+  {
+    Depot &depot = GetDepot();
+    XrdSysMutexHelper scopedLock( depot.mutex[cls] );
+    FreeList &shared = depot.lists[cls];
+    uint32_t  slots  = DepotSlots( cls );
+    while( count-- && list.head )
+    {
+      char *block = list.Pop();
+      if( shared.count < slots )
+        shared.Push( block );
+      else
+        free( block );
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Release everything the thread cache holds when the thread exits, it is
+  // touched whenever blocks are put into the thread cache so that the
+  // destructor gets registered
+  //----------------------------------------------------------------------------
+  struct ThreadCacheFlusher
+  {
+    ~ThreadCacheFlusher()
+    {
+      ThreadCache &tc = tlsCache;
+      for( uint32_t cls = 0; cls < NbClasses; ++cls )
+        Drain( tc.lists[cls], cls, tc.lists[cls].count );
+      FlushStats( tc );
+      tc.dead = true;
+    }
+  };
+
+  thread_local ThreadCacheFlusher tlsFlusher;
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Allocate a block of at least the given size
+  //----------------------------------------------------------------------------
+  char *BufferCache::Allocate( uint32_t size )
+  {
+    int cls = CacheEnabled ? SizeClass( size ) : -1;
+    if( cls < 0 )
+    {
+      char *block = (char *)malloc( size );
+      if( !block )
+        throw std::bad_alloc();
+      return block;
+    }
+
+    char        *block = 0;
+    ThreadCache &tc    = tlsCache;
+    FreeList    &list  = tc.lists[cls];
+    ++tc.allocs;
+
+    if( !list.head )
+    {
+      //------------------------------------------------------------------------
+      // Refill the thread cache with half of its capacity from the depot
+      //------------------------------------------------------------------------
+      (void)&tlsFlusher;
+      Depot &depot = GetDepot();
+      XrdSysMutexHelper scopedLock( depot.mutex[cls] );
+      FreeList &shared = depot.lists[cls];
+      uint32_t  count  = tc.dead ? 1 : ThreadSlots( cls ) / 2;
+      while( count-- && shared.head )
+        list.Push( shared.Pop() );
+    }
+
+    if( list.head )
+    {
+      block = list.Pop();
+      ++tc.hits;
+    }
+    else
+    {
+      block = (char *)malloc( ClassSize( cls ) );
+      if( !block )
+        throw std::bad_alloc();
+    }
+
+    if( tc.allocs >= StatsPeriod || tc.dead )
+      FlushStats( tc );
+
+    return block;
+  }
+
+  //----------------------------------------------------------------------------
+  // Resize a block
+  //----------------------------------------------------------------------------
+  char *BufferCache::ReAllocate( char *buffer, uint32_t size, uint32_t newSize )
+  {
+    if( !buffer )
+      return Allocate( newSize );
+
+    //--------------------------------------------------------------------------
+    // Sizes past the largest class keep being handled by realloc, and so
+    // does everything when the cache is disabled
+    //--------------------------------------------------------------------------
+    if( !CacheEnabled || SizeClass( newSize ) < 0 )
+    {
+      char *block = (char *)realloc( buffer, newSize );
+      if( !block )
+        throw std::bad_alloc();
+      return block;
+    }
+
+    //--------------------------------------------------------------------------
+    // Keep the block unless it would be at least four times too big, so that
+    // a large buffer cut down to a small one does not pin the large block
+    //--------------------------------------------------------------------------
+    size_t capacity = UsableSize( buffer );
+    if( newSize <= capacity &&
+        ( newSize > capacity / 4 || capacity < 4 * ClassSize( 0 ) ) )
+      return buffer;
+
+    char *block = Allocate( newSize );
+    memcpy( block, buffer, std::min( size, newSize ) );
+    Free( buffer );
+    return block;
+  }
+
+  //----------------------------------------------------------------------------
+  // Give a block back
+  //----------------------------------------------------------------------------
+  void BufferCache::Free( char *buffer )
+  {
+    if( !buffer )
+      return;
+
+    int cls = CacheEnabled ? BlockClass( UsableSize( buffer ) ) : -1;
+    if( cls < 0 )
+    {
+      free( buffer );
+      return;
+    }
+
+    ThreadCache &tc = tlsCache;
+    if( tc.dead )
+    {
+      FreeList list = { buffer, 1 };
+      Next( buffer ) = 0;
+      Drain( list, cls, 1 );
+      return;
+    }
+
+    (void)&tlsFlusher;
+    FreeList &list = tc.lists[cls];
+    list.Push( buffer );
+    if( list.count > ThreadSlots( cls ) )
+      Drain( list, cls, ThreadSlots( cls ) / 2 );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the cache statistics
+  //----------------------------------------------------------------------------
+  BufferCache::Stats BufferCache::GetStats()
+  {
+    Depot &depot = GetDepot();
+    Stats  stats;
+    stats.allocs = depot.allocs.load( std::memory_order_relaxed );
+    stats.hits   = depot.hits.load( std::memory_order_relaxed );
+    stats.cached = 0;
+    for( uint32_t cls = 0; cls < NbClasses; ++cls )
+    {
+      XrdSysMutexHelper scopedLock( depot.mutex[cls] );
+      stats.cached += uint64_t( depot.lists[cls].count ) * ClassSize( cls );
+    }
+    return stats;
+  }
+
+  //----------------------------------------------------------------------------
+  // Lock the depot
+  //----------------------------------------------------------------------------
+  void BufferCache::Lock()
+  {
+    Depot &depot = GetDepot();
+    for( uint32_t cls = 0; cls < NbClasses; ++cls )
+      depot.mutex[cls].Lock();
+  }
+
+  //----------------------------------------------------------------------------
+  // Unlock the depot
+  //----------------------------------------------------------------------------
+  void BufferCache::UnLock()
+  {
+    Depot &depot = GetDepot();
+    for( uint32_t cls = NbClasses; cls > 0; --cls )
+      depot.mutex[cls - 1].UnLock();
+  }
+}
@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_BUFFER_CACHE_HH__
+#define __XRD_CL_BUFFER_CACHE_HH__
+
+#include <cstdint>
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  //! Process-wide cache of the memory blocks backing XrdCl::Buffer objects.
+  //!
+  //! Blocks are kept in power of two size classes from 64 bytes up to 64 KiB.
+  //! Every thread has its own cache of free blocks in front of a shared
+  //! depot, so that allocating request headers and small responses normally
+  //! takes neither a lock nor a trip to malloc. Larger blocks are allocated
+  //! with malloc directly. All the blocks come from malloc, so memory taken
+  //! out of a buffer with Buffer::Release may still be freed with free().
+  //!
+  //! The size class of a block is derived from the usable size malloc
+  //! reports for it rather than stored in the Buffer, which keeps the layout
+  //! of Buffer (and Message) unchanged and lets blocks allocated elsewhere
+  //! (Buffer::Grab, or code built against older headers) be given back
+  //! safely. Where the usable size is not available the cache is disabled.
+  //----------------------------------------------------------------------------
+  class BufferCache
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Cache statistics
+      //------------------------------------------------------------------------
+      struct Stats
+      {
+        uint64_t allocs; //!< Allocations of cacheable size
+        uint64_t hits;   //!< Allocations served from the cache
+        uint64_t cached; //!< Bytes held in the shared depot
+      };
+
+      //------------------------------------------------------------------------
+      //! Allocate a block of at least the given size
+      //!
+      //! @param size requested size
+      //! @throws std::bad_alloc
+      //------------------------------------------------------------------------
+      static char *Allocate( uint32_t size );
+
+      //------------------------------------------------------------------------
+      //! Resize a block, preserving its content up to the smaller of the two
+      //! sizes
+      //!
+      //! @param buffer  the block (may be null)
+      //! @param size    the current size of the data in the block
+      //! @param newSize the requested size
+      //! @throws std::bad_alloc
+      //------------------------------------------------------------------------
+      static char *ReAllocate( char *buffer, uint32_t size, uint32_t newSize );
+
+      //------------------------------------------------------------------------
+      //! Give a block back
+      //!
+      //! @param buffer the block (may be null), any block obtained from malloc
+      //------------------------------------------------------------------------
+      static void Free( char *buffer );
+
+      //------------------------------------------------------------------------
+      //! Get the cache statistics (the per-thread counters are merged in
+      //! periodically, so the figures may lag slightly behind)
+      //------------------------------------------------------------------------
+      static Stats GetStats();
+
+      //------------------------------------------------------------------------
+      //! Lock the depot (before forking)
+      //------------------------------------------------------------------------
+      static void Lock();
+
+      //------------------------------------------------------------------------
+      //! Unlock the depot (after forking)
+      //------------------------------------------------------------------------
+      static void UnLock();
+  };
+}
+
+#endif // __XRD_CL_BUFFER_CACHE_HH__
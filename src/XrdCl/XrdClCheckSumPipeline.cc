@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClCheckSumPipeline.hh"
+#include "XrdCl/XrdClCheckSumHelper.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdSys/XrdSysE2T.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Size of the pieces fed to each of the calculators in turn, small enough
+  // to stay in the L2 cache
+  //----------------------------------------------------------------------------
+  const uint32_t PassSize = 65536;
+
+  //----------------------------------------------------------------------------
+  // Number of processed blocks kept for reuse
+  //----------------------------------------------------------------------------
+  const size_t MaxSpare = 4;
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  CheckSumPipeline::CheckSumPipeline( const std::vector<CheckSumHelper*> &helpers,
+                                      uint64_t                            maxQueued ):
+    pHelpers( helpers ), pMaxQueued( maxQueued ), pQueued( 0 ), pStop( false ),
+    pRunning( false ), pThread(), pCV( 0 )
+  {
+    if( !pMaxQueued || pHelpers.empty() ) return;
+
+    int rc = pthread_create( &pThread, 0, Run, this );
+    if( rc )
+    {
+      DefaultEnv::GetLog()->Warning( UtilityMsg, "Unable to start the checksum "
+                                     "thread, computing checksums inline: %s",
+                                     XrdSysE2T( rc ) );
+      return;
+    }
+    pRunning = true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Destructor
+  //----------------------------------------------------------------------------
+  CheckSumPipeline::~CheckSumPipeline()
+  {
+    if( pRunning )
+    {
+      {
+        XrdSysCondVarHelper lck( pCV );
+        pStop = true;
+        pCV.Broadcast();
+      }
+      pthread_join( pThread, 0 );
+    }
+
+    for( auto &blk : pSpare )
+      delete [] blk.data;
+  }
+
+  //----------------------------------------------------------------------------
+  // Add data to the checksums
+  //----------------------------------------------------------------------------
+  void CheckSumPipeline::Update( const void *buffer, uint32_t size )
+  {
+    if( !size ) return;
+
+    if( !pRunning )
+    {
+      UpdateAll( static_cast<const char*>( buffer ), size );
+      return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Wait for room in the queue (a single block is always admitted) and
+    // pick up a spare block if there is one big enough
+    //--------------------------------------------------------------------------
+    Block blk = { 0, size, 0 };
+    {
+      XrdSysCondVarHelper lck( pCV );
+      while( pQueued && pQueued + size > pMaxQueued )
+        pCV.Wait();
+      pQueued += size;
+
+      for( auto itr = pSpare.begin(); itr != pSpare.end(); ++itr )
+        if( itr->capacity >= size )
+        {
+          blk.data     = itr->data;
+          blk.capacity = itr->capacity;
+          pSpare.erase( itr );
+          break;
+        }
+    }
+
+    if( !blk.data )
+    {
+      blk.data     = new char[size];
+      blk.capacity = size;
+    }
+    memcpy( blk.data, buffer, size );
+
+    XrdSysCondVarHelper lck( pCV );
+    pQueue.push_back( blk );
+    pCV.Broadcast();
+  }
+
+  //----------------------------------------------------------------------------
+  // Wait until all the data have been added to the checksums
+  //----------------------------------------------------------------------------
+  void CheckSumPipeline::Sync()
+  {
+    if( !pRunning ) return;
+    XrdSysCondVarHelper lck( pCV );
+    while( pQueued )
+      pCV.Wait();
+  }
+
+  //----------------------------------------------------------------------------
+  // Thread entry point
+  //----------------------------------------------------------------------------
+  void *CheckSumPipeline::Run( void *arg )
+  {
+    static_cast<CheckSumPipeline*>( arg )->Process();
+    return 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Process the queued blocks in order
+  //----------------------------------------------------------------------------
+  void CheckSumPipeline::Process()
+  {
+    XrdSysCondVarHelper lck( pCV );
+    while( true )
+    {
+      if( pQueue.empty() )
+      {
+        if( pStop ) break;
+        pCV.Wait();
+        continue;
+      }
+
+      Block blk = pQueue.front();
+      pQueue.pop_front();
+      lck.UnLock();
+
+      UpdateAll( blk.data, blk.size );
+
+      lck.Lock( &pCV );
+      pQueued -= blk.size;
+      if( pSpare.size() < MaxSpare )
+        pSpare.push_back( blk );
+      else
+        delete [] blk.data;
+      pCV.Broadcast();
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Update all the checksums in one pass
+  //----------------------------------------------------------------------------
+  void CheckSumPipeline::UpdateAll( const char *buffer, uint32_t size )
+  {
+    if( pHelpers.empty() ) return;
+
+    if( pHelpers.size() == 1 )
+    {
+      pHelpers.front()->Update( buffer, size );
+      return;
+    }
+
+    for( uint32_t off = 0; off < size; off += PassSize )
+    {
+      uint32_t len = std::min( PassSize, size - off );
+      for( auto helper : pHelpers )
+        helper->Update( buffer + off, len );
+    }
+  }
+}
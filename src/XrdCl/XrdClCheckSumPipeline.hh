@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_CHECK_SUM_PIPELINE_HH__
+#define __XRD_CL_CHECK_SUM_PIPELINE_HH__
+
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace XrdCl
+{
+  class CheckSumHelper;
+
+  //----------------------------------------------------------------------------
+  //! Computes the checksums of a data stream on a dedicated thread.
+  //!
+  //! The data are copied into the pipeline, so the caller may release its
+  //! buffer as soon as Update returns, and processed in the order they were
+  //! given. All the checksums are updated in one pass: each block of data
+  //! is fed to every calculator while it is still in the CPU cache. If more
+  //! than the given number of bytes is waiting to be processed Update blocks.
+  //!
+  //! If the queue size is 0 (or the thread cannot be started) the checksums
+  //! are updated inline.
+  //----------------------------------------------------------------------------
+  class CheckSumPipeline
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Constructor
+      //!
+      //! @param helpers   the checksums to be computed, they have to outlive
+      //!                  the pipeline
+      //! @param maxQueued maximum number of bytes waiting to be processed
+      //------------------------------------------------------------------------
+      CheckSumPipeline( const std::vector<CheckSumHelper*> &helpers,
+                        uint64_t                            maxQueued );
+
+      //------------------------------------------------------------------------
+      //! Destructor - stops the thread, the data still in the queue are
+      //! processed first
+      //------------------------------------------------------------------------
+      ~CheckSumPipeline();
+
+      //------------------------------------------------------------------------
+      //! Add data to the checksums
+      //------------------------------------------------------------------------
+      void Update( const void *buffer, uint32_t size );
+
+      //------------------------------------------------------------------------
+      //! Wait until all the data have been added to the checksums
+      //------------------------------------------------------------------------
+      void Sync();
+
+    private:
+      CheckSumPipeline( const CheckSumPipeline& ) = delete;
+      CheckSumPipeline& operator=( const CheckSumPipeline& ) = delete;
+
+      struct Block
+      {
+        char     *data;
+        uint32_t  size;
+        uint32_t  capacity;
+      };
+
+      static void *Run( void *arg );
+      void Process();
+      void UpdateAll( const char *buffer, uint32_t size );
+
+      std::vector<CheckSumHelper*>  pHelpers;
+      uint64_t                      pMaxQueued;
+      uint64_t                      pQueued;
+      std::deque<Block>             pQueue;
+      std::vector<Block>            pSpare;
+      bool                          pStop;
+      bool                          pRunning;
+      pthread_t                     pThread;
+      XrdSysCondVar                 pCV;
+  };
+}
+
+#endif // __XRD_CL_CHECK_SUM_PIPELINE_HH__
@@ -39,6 +39,7 @@
 #include "XrdCl/XrdClXRootDTransport.hh"
 #include "XrdClXCpCtx.hh"
 #include "XrdCl/XrdClCheckSumHelper.hh"
+#include "XrdCl/XrdClCheckSumPipeline.hh"
 #include "XrdSys/XrdSysE2T.hh"
 #include "XrdSys/XrdSysPthread.hh"
 
@@ -138,6 +139,22 @@ namespace
     return XrdCl::XRootDStatus();
   }
 
+  //----------------------------------------------------------------------------
+  //! Create the pipeline computing the given checksums alongside the copy
+  //----------------------------------------------------------------------------
+  XrdCl::CheckSumPipeline* CreateCksPipeline( XrdCl::CheckSumHelper                     *cksHelper,
+                                              const std::vector<XrdCl::CheckSumHelper*> &addCksHelpers )
+  {
+    std::vector<XrdCl::CheckSumHelper*> helpers;
+    if( cksHelper )
+      helpers.push_back( cksHelper );
+    helpers.insert( helpers.end(), addCksHelpers.begin(), addCksHelpers.end() );
+
+    int queueSize = XrdCl::DefaultCPCksumQueueSize;
+    XrdCl::DefaultEnv::GetEnv()->GetInt( "CPCksumQueueSize", queueSize );
+    return new XrdCl::CheckSumPipeline( helpers, queueSize > 0 ? queueSize : 0 );
+  }
+
   //----------------------------------------------------------------------------
   //! Abstract chunk source
   //----------------------------------------------------------------------------
@@ -161,6 +178,7 @@ namespace
 
       virtual ~Source()
       {
+        pCksPipeline.reset();
         delete pCkSumHelper;
         for( auto ptr : pAddCksHelpers )
           delete ptr;
@@ -217,9 +235,29 @@ namespace
 
     protected:
 
-      XrdCl::CheckSumHelper               *pCkSumHelper;
-      std::vector<XrdCl::CheckSumHelper*>  pAddCksHelpers;
-      bool                                 pContinue;
+      //------------------------------------------------------------------------
+      //! Add a chunk (in offset order) to all the checksums
+      //------------------------------------------------------------------------
+      void UpdateCheckSums( const void *buffer, uint32_t size )
+      {
+        if( !pCksPipeline )
+          pCksPipeline.reset( CreateCksPipeline( pCkSumHelper, pAddCksHelpers ) );
+        pCksPipeline->Update( buffer, size );
+      }
+
+      //------------------------------------------------------------------------
+      //! Wait until all the chunks have been added to the checksums
+      //------------------------------------------------------------------------
+      void SyncCheckSums()
+      {
+        if( pCksPipeline )
+          pCksPipeline->Sync();
+      }
+
+      XrdCl::CheckSumHelper                   *pCkSumHelper;
+      std::vector<XrdCl::CheckSumHelper*>      pAddCksHelpers;
+      std::unique_ptr<XrdCl::CheckSumPipeline> pCksPipeline;
+      bool                                     pContinue;
   };
 
   //----------------------------------------------------------------------------
@@ -244,6 +282,7 @@ namespace
       //------------------------------------------------------------------------
       virtual ~Destination()
       {
+        pCksPipeline.reset();
         delete pCkSumHelper;
       }
 
@@ -345,13 +384,34 @@ namespace
       }
 
     protected:
+
+      //------------------------------------------------------------------------
+      //! Add a chunk (in offset order) to the checksum
+      //------------------------------------------------------------------------
+      void UpdateCheckSum( const void *buffer, uint32_t size )
+      {
+        if( !pCksPipeline )
+          pCksPipeline.reset( CreateCksPipeline( pCkSumHelper, {} ) );
+        pCksPipeline->Update( buffer, size );
+      }
+
+      //------------------------------------------------------------------------
+      //! Wait until all the chunks have been added to the checksum
+      //------------------------------------------------------------------------
+      void SyncCheckSum()
+      {
+        if( pCksPipeline )
+          pCksPipeline->Sync();
+      }
+
       bool pPosc;
       bool pForce;
       bool pCoerce;
       bool pMakeDir;
       bool pContinue;
 
-      XrdCl::CheckSumHelper    *pCkSumHelper;
+      XrdCl::CheckSumHelper                   *pCkSumHelper;
+      std::unique_ptr<XrdCl::CheckSumPipeline> pCksPipeline;
   };
 
   //----------------------------------------------------------------------------
@@ -452,11 +512,7 @@ namespace
           return XRootDStatus( stOK, suDone );
         }
 
-        if( pCkSumHelper )
-          pCkSumHelper->Update( buffer, bytesRead );
-
-        for( auto cksHelper : pAddCksHelpers )
-          cksHelper->Update( buffer, bytesRead );
+        UpdateCheckSums( buffer, bytesRead );
 
         ci = XrdCl::PageInfo( pCurrentOffset, bytesRead, buffer );
         pCurrentOffset += bytesRead;
@@ -471,6 +527,7 @@ namespace
                                                    std::string           &checkSumType )
       {
         using namespace XrdCl;
+        SyncCheckSums();
         if( cksHelper )
           return cksHelper->GetCheckSum( checkSum, checkSumType );
         return XRootDStatus( stError, errCheckSumError );
@@ -766,6 +823,7 @@ namespace
             // in case of --continue option we have to calculate the checksum from scratch
             return XrdCl::Utils::GetLocalCheckSum( checkSum, checkSumType, pUrl->GetPath() );
 
+          SyncCheckSums();
           if( cksHelper )
             return cksHelper->GetCheckSum( checkSum, checkSumType );
 
@@ -903,11 +961,7 @@ namespace
         // if it is a local file update the checksum
         if( pUrl->IsLocalFile() && !pUrl->IsMetalink() && !pContinue )
         {
-          if( pCkSumHelper )
-            pCkSumHelper->Update( ci.GetBuffer(), ci.GetLength() );
-
-          for( auto cksHelper : pAddCksHelpers )
-            cksHelper->Update( ci.GetBuffer(), ci.GetLength() );
+          UpdateCheckSums( ci.GetBuffer(), ci.GetLength() );
         }
 
         return XRootDStatus( stOK, suContinue );
@@ -1126,7 +1180,10 @@ namespace
 
         // if it is a local file we can calculate the checksum ourself
         if( pUrl->IsLocalFile() && !pUrl->IsMetalink() && cksHelper && !pContinue )
+        {
+          SyncCheckSums();
           return cksHelper->GetCheckSum( checkSum, checkSumType );
+        }
 
         // if it is a remote file other types of checksum are not supported
         return XrdCl::XRootDStatus( XrdCl::stError, XrdCl::errNotSupported );
@@ -1313,11 +1370,7 @@ namespace
         // if it is a local file update the checksum
         if( pUrl->IsLocalFile() && !pUrl->IsMetalink() && !pContinue )
         {
-          if( pCkSumHelper )
-            pCkSumHelper->Update( buffer, bytesRead );
-
-          for( auto cksHelper : pAddCksHelpers )
-            cksHelper->Update( buffer, bytesRead );
+          UpdateCheckSums( buffer, bytesRead );
         }
 
         ci = XrdCl::PageInfo( pCurrentOffset, bytesRead, buffer );
@@ -1353,6 +1406,7 @@ namespace
             // in case of --continue option we have to calculate the checksum from scratch
             return XrdCl::Utils::GetLocalCheckSum( checkSum, checkSumType, pUrl->GetPath() );
 
+          SyncCheckSums();
           if( cksHelper )
             return cksHelper->GetCheckSum( checkSum, checkSumType );
 
@@ -1644,7 +1698,7 @@ namespace
         while( length );
 
         if( pCkSumHelper )
-          pCkSumHelper->Update( ci.GetBuffer(), ci.GetLength() );
+          UpdateCheckSum( ci.GetBuffer(), ci.GetLength() );
         delete [] (char*)ci.GetBuffer();
         return XRootDStatus();
       }
@@ -1663,6 +1717,7 @@ namespace
       virtual XrdCl::XRootDStatus GetCheckSum( std::string &checkSum,
                                                std::string &checkSumType )
       {
+        SyncCheckSum();
         if( pCkSumHelper )
           return pCkSumHelper->GetCheckSum( checkSum, checkSumType );
         return XrdCl::XRootDStatus( XrdCl::stError, XrdCl::errCheckSumError );
@@ -1908,7 +1963,7 @@ namespace
         // we are writing chunks in order so we can calc the checksum
         // in case of local files
         if( pUrl.IsLocalFile() && pCkSumHelper && !pContinue )
-          pCkSumHelper->Update( ci.GetBuffer(), ci.GetLength() );
+          UpdateCheckSum( ci.GetBuffer(), ci.GetLength() );
 
         ChunkHandler *ch = new ChunkHandler( std::move( ci ) );
         XrdCl::XRootDStatus st;
@@ -1963,6 +2018,7 @@ namespace
             // in case of --continue option we have to calculate the checksum from scratch
             return XrdCl::Utils::GetLocalCheckSum( checkSum, checkSumType, pUrl.GetPath() );
 
+          SyncCheckSum();
           if( pCkSumHelper )
             return pCkSumHelper->GetCheckSum( checkSum, checkSumType );
 
@@ -2157,6 +2213,7 @@ namespace
       virtual XrdCl::XRootDStatus Finalize()
       {
         uint32_t crc32 = 0;
+        SyncCheckSum();
         auto st = pCkSumHelper->GetRawCheckSum( "zcrc32", crc32 );
         if( !st.IsOK() ) return st;
         pZip->UpdateMetadata( crc32 );
@@ -2236,7 +2293,7 @@ namespace
       {
         // we are writing chunks in order so we can calc the checksum
         // in case of local files
-        if( pCkSumHelper ) pCkSumHelper->Update( ci.GetBuffer(), ci.GetLength() );
+        if( pCkSumHelper ) UpdateCheckSum( ci.GetBuffer(), ci.GetLength() );
 
         ChunkHandler *ch = new ChunkHandler( std::move( ci ) );
         XrdCl::XRootDStatus st;
@@ -75,6 +75,7 @@ namespace XrdCl
   const int DefaultLocalMetalinkFile       = 0;
   const int DefaultXRateThreshold          = 0;
   const int DefaultXCpBlockSize            = 134217728; // DefaultCPChunkSize * DefaultCPParallelChunks * 2
+  const int DefaultXCpDropSlowSrc          = 10;
 #ifdef __APPLE__
   // we don't have corking on osx so we cannot turn of nagle
   const int DefaultNoDelay                 = 0;
@@ -96,6 +97,21 @@ namespace XrdCl
   const int DefaultRetryWrtAtLBLimit       = 3;
   const int DefaultCpRetry                 = 0;
   const int DefaultCpUsePgWrtRd            = 1;
+  const int DefaultReadStripeSize          = 4194304;
+  const int DefaultReadAheadWindow         = 0;
+  const int DefaultReadAheadBlockSize      = 1048576;
+  const int DefaultReadCoalesce            = 0;
+  const int DefaultReadCoalesceMaxSize     = 65536;
+  const int DefaultRequestStats            = 0;
+  const int DefaultRequestStatsDumpInterval = 0;
+  const int DefaultZipCDReadSize           = 0;
+  const int DefaultZipPrefetchBudget       = 67108864;
+  const int DefaultCPCksumQueueSize        = 67108864;
+  const int DefaultIoUring                 = 0;
+  const int DefaultLocalODirect            = 0;
+  const int DefaultRecursiveDirListParallel = 16;
+  const int DefaultPreWarm                 = 0;
+  const int DefaultPreWarmMax              = 16;
 
   const char * const DefaultPollerPreference   = "built-in";
   const char * const DefaultNetworkStack       = "IPAuto";
@@ -148,6 +164,7 @@ namespace XrdCl
       { to_lower( "LocalMetalinkFile" ),       DefaultLocalMetalinkFile },
       { to_lower( "XRateThreshold" ),          DefaultXRateThreshold },
       { to_lower( "XCpBlockSize" ),            DefaultXCpBlockSize },
+      { to_lower( "XCpDropSlowSrc" ),          DefaultXCpDropSlowSrc },
       { to_lower( "NoDelay" ),                 DefaultNoDelay },
       { to_lower( "AioSignal" ),               DefaultAioSignal },
       { to_lower( "PreferIPv4" ),              DefaultPreferIPv4 },
@@ -161,7 +178,22 @@ namespace XrdCl
       { to_lower( "ZipMtlnCksum" ),            DefaultZipMtlnCksum },
       { to_lower( "IPNoShuffle" ),             DefaultIPNoShuffle },
       { to_lower( "WantTlsOnNoPgrw" ),         DefaultWantTlsOnNoPgrw },
-      { to_lower( "RetryWrtAtLBLimit" ),       DefaultRetryWrtAtLBLimit }
+      { to_lower( "RetryWrtAtLBLimit" ),       DefaultRetryWrtAtLBLimit },
+      { to_lower( "ReadStripeSize" ),          DefaultReadStripeSize },
+      { to_lower( "ReadAheadWindow" ),         DefaultReadAheadWindow },
+      { to_lower( "ReadAheadBlockSize" ),      DefaultReadAheadBlockSize },
+      { to_lower( "ReadCoalesce" ),            DefaultReadCoalesce },
+      { to_lower( "ReadCoalesceMaxSize" ),     DefaultReadCoalesceMaxSize },
+      { to_lower( "RequestStats" ),            DefaultRequestStats },
+      { to_lower( "RequestStatsDumpInterval" ), DefaultRequestStatsDumpInterval },
+      { to_lower( "ZipCDReadSize" ),           DefaultZipCDReadSize },
+      { to_lower( "ZipPrefetchBudget" ),       DefaultZipPrefetchBudget },
+      { to_lower( "CPCksumQueueSize" ),        DefaultCPCksumQueueSize },
+      { to_lower( "IoUring" ),                 DefaultIoUring },
+      { to_lower( "LocalODirect" ),            DefaultLocalODirect },
+      { to_lower( "RecursiveDirListParallel" ), DefaultRecursiveDirListParallel },
+      { to_lower( "PreWarm" ),                 DefaultPreWarm },
+      { to_lower( "PreWarmMax" ),              DefaultPreWarmMax }
     };
 
   static std::unordered_map<std::string, std::string> theDefaultStrs
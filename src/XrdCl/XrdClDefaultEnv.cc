@@ -22,6 +22,7 @@
 #include "XrdCl/XrdClLog.hh"
 #include "XrdCl/XrdClForkHandler.hh"
 #include "XrdCl/XrdClFileTimer.hh"
+#include "XrdCl/XrdClRequestStats.hh"
 #include "XrdCl/XrdClUtils.hh"
 #include "XrdCl/XrdClMonitor.hh"
 #include "XrdCl/XrdClCheckSumManager.hh"
@@ -289,6 +290,7 @@ namespace XrdCl
     REGISTER_VAR_INT( varsInt, "MetalinkProcessing",      DefaultMetalinkProcessing      );
     REGISTER_VAR_INT( varsInt, "LocalMetalinkFile",       DefaultLocalMetalinkFile       );
     REGISTER_VAR_INT( varsInt, "XCpBlockSize",            DefaultXCpBlockSize            );
+    REGISTER_VAR_INT( varsInt, "XCpDropSlowSrc",          DefaultXCpDropSlowSrc          );
     REGISTER_VAR_INT( varsInt, "NoDelay",                 DefaultNoDelay                 );
     REGISTER_VAR_INT( varsInt, "AioSignal",               DefaultAioSignal               );
     REGISTER_VAR_INT( varsInt, "PreferIPv4",              DefaultPreferIPv4              );
@@ -306,6 +308,21 @@ namespace XrdCl
     REGISTER_VAR_INT( varsInt, "XRateThreshold",          DefaultXRateThreshold          );
     REGISTER_VAR_INT( varsInt, "CpRetry",                 DefaultCpRetry                 );
     REGISTER_VAR_INT( varsInt, "CpUsePgWrtRd",            DefaultCpUsePgWrtRd            );
+    REGISTER_VAR_INT( varsInt, "ReadStripeSize",          DefaultReadStripeSize          );
+    REGISTER_VAR_INT( varsInt, "ReadAheadWindow",         DefaultReadAheadWindow         );
+    REGISTER_VAR_INT( varsInt, "ReadAheadBlockSize",      DefaultReadAheadBlockSize      );
+    REGISTER_VAR_INT( varsInt, "ReadCoalesce",            DefaultReadCoalesce            );
+    REGISTER_VAR_INT( varsInt, "ReadCoalesceMaxSize",     DefaultReadCoalesceMaxSize     );
+    REGISTER_VAR_INT( varsInt, "RequestStats",            DefaultRequestStats            );
+    REGISTER_VAR_INT( varsInt, "RequestStatsDumpInterval", DefaultRequestStatsDumpInterval );
+    REGISTER_VAR_INT( varsInt, "ZipCDReadSize",           DefaultZipCDReadSize           );
+    REGISTER_VAR_INT( varsInt, "ZipPrefetchBudget",       DefaultZipPrefetchBudget       );
+    REGISTER_VAR_INT( varsInt, "CPCksumQueueSize",        DefaultCPCksumQueueSize        );
+    REGISTER_VAR_INT( varsInt, "IoUring",                 DefaultIoUring                 );
+    REGISTER_VAR_INT( varsInt, "LocalODirect",            DefaultLocalODirect            );
+    REGISTER_VAR_INT( varsInt, "RecursiveDirListParallel", DefaultRecursiveDirListParallel );
+    REGISTER_VAR_INT( varsInt, "PreWarm",                 DefaultPreWarm                 );
+    REGISTER_VAR_INT( varsInt, "PreWarmMax",              DefaultPreWarmMax              );
 
     REGISTER_VAR_STR( varsStr, "ClientMonitor",           DefaultClientMonitor           );
     REGISTER_VAR_STR( varsStr, "ClientMonitorParam",      DefaultClientMonitorParam      );
@@ -481,6 +498,7 @@ namespace XrdCl
 
       sForkHandler->RegisterPostMaster( postMaster );
       postMaster->GetTaskManager()->RegisterTask( sFileTimer, time(0), false );
+      RequestStats::Initialize( postMaster->GetTaskManager() );
       AtomicCAS(sPostMaster, sPostMaster, postMaster);
     }
 
@@ -39,6 +39,8 @@
 #include "XrdCl/XrdClRedirectorRegistry.hh"
 #include "XrdCl/XrdClAnyObject.hh"
 #include "XrdCl/XrdClUtils.hh"
+#include "XrdCl/XrdClReadAhead.hh"
+#include "XrdCl/XrdClReadCoalescer.hh"
 
 #ifdef WITH_XRDEC
 #include "XrdCl/XrdClEcHandler.hh"
@@ -52,6 +54,7 @@
 #include "XrdSys/XrdSysPageSize.hh"
 #include "XrdSys/XrdSysPthread.hh"
 
+#include <atomic>
 #include <sstream>
 #include <memory>
 #include <numeric>
@@ -397,6 +400,195 @@ namespace
       XrdCl::ResponseHandler                   *userHandler;
   };
 
+
+  //----------------------------------------------------------------------------
+  // Helper collecting the responses to the chunks of a read that has been
+  // split over several data streams and reporting them to the user as a
+  // single response once all of them came back
+  //----------------------------------------------------------------------------
+  class StripedReadHandler
+  {
+    public:
+
+      //------------------------------------------------------------------------
+      // Handler of a single chunk
+      //------------------------------------------------------------------------
+      class ChunkHandler : public XrdCl::ResponseHandler
+      {
+        public:
+          ChunkHandler( StripedReadHandler *parent, size_t index ) :
+            parent( parent ), index( index )
+          {
+          }
+
+          void HandleResponseWithHosts( XrdCl::XRootDStatus *status,
+                                        XrdCl::AnyObject    *response,
+                                        XrdCl::HostList     *hostList )
+          {
+            parent->ChunkDone( index, status, response, hostList );
+            delete this;
+          }
+
+        private:
+          StripedReadHandler *parent;
+          size_t              index;
+      };
+
+      //------------------------------------------------------------------------
+      // Constructor
+      //------------------------------------------------------------------------
+      StripedReadHandler( XrdCl::ResponseHandler *userHandler,
+                          uint64_t                offset,
+                          void                   *buffer,
+                          bool                    pgread ) :
+        userHandler( userHandler ),
+        offset( offset ),
+        buffer( buffer ),
+        pgread( pgread ),
+        pending( 1 ),
+        nbrepair( 0 )
+      {
+      }
+
+      //------------------------------------------------------------------------
+      // Add a chunk, must be done before any of them is sent
+      //------------------------------------------------------------------------
+      size_t AddChunk( uint32_t size )
+      {
+        chunks.emplace_back();
+        chunks.back().size = size;
+        ++pending;
+        return chunks.size() - 1;
+      }
+
+      //------------------------------------------------------------------------
+      // Handle the response to a chunk
+      //------------------------------------------------------------------------
+      void ChunkDone( size_t                index,
+                      XrdCl::XRootDStatus  *status,
+                      XrdCl::AnyObject     *response,
+                      XrdCl::HostList      *hostList )
+      {
+        using namespace XrdCl;
+
+        std::unique_lock<std::mutex> lck( mtx );
+        Chunk &chunk = chunks[index];
+        if( status->IsOK() && response )
+        {
+          if( pgread )
+          {
+            PageInfo *pginf = 0;
+            response->Get( pginf );
+            if( pginf )
+            {
+              chunk.length = pginf->GetLength();
+              chunk.cksums.swap( pginf->GetCksums() );
+              nbrepair += pginf->GetNbRepair();
+            }
+          }
+          else
+          {
+            ChunkInfo *chunkInfo = 0;
+            response->Get( chunkInfo );
+            if( chunkInfo )
+              chunk.length = chunkInfo->length;
+          }
+          delete status;
+        }
+        else if( !st )
+          st.reset( status );
+        else
+          delete status;
+        delete response;
+
+        if( index == 0 )
+          hosts.reset( hostList );
+        else
+          delete hostList;
+
+        Release( lck );
+      }
+
+      //------------------------------------------------------------------------
+      // Account for a chunk that could not be sent
+      //------------------------------------------------------------------------
+      void ChunkFailed( size_t index, const XrdCl::XRootDStatus &status )
+      {
+        ChunkDone( index, new XrdCl::XRootDStatus( status ), 0, 0 );
+      }
+
+      //------------------------------------------------------------------------
+      // Called once all the chunks have been sent
+      //------------------------------------------------------------------------
+      void Sent()
+      {
+        std::unique_lock<std::mutex> lck( mtx );
+        Release( lck );
+      }
+
+    private:
+
+      struct Chunk
+      {
+        Chunk() : size( 0 ), length( 0 ) { }
+        uint32_t              size;
+        uint32_t              length;
+        std::vector<uint32_t> cksums;
+      };
+
+      //------------------------------------------------------------------------
+      // Drop a reference, respond to the user when the last one is gone. The
+      // data is only valid up to the first chunk that came back short.
+      //------------------------------------------------------------------------
+      void Release( std::unique_lock<std::mutex> &lck )
+      {
+        using namespace XrdCl;
+
+        if( --pending ) return;
+
+        if( st )
+          userHandler->HandleResponseWithHosts( st.release(), 0, hosts.release() );
+        else
+        {
+          uint32_t              length = 0;
+          std::vector<uint32_t> cksums;
+          for( Chunk &chunk : chunks )
+          {
+            length += chunk.length;
+            if( pgread )
+              cksums.insert( cksums.end(), chunk.cksums.begin(), chunk.cksums.end() );
+            if( chunk.length < chunk.size ) break;
+          }
+
+          AnyObject *response = new AnyObject();
+          if( pgread )
+          {
+            PageInfo *pginf = new PageInfo( offset, length, buffer, std::move( cksums ) );
+            pginf->SetNbRepair( nbrepair );
+            response->Set( pginf );
+          }
+          else
+            response->Set( new ChunkInfo( offset, length, buffer ) );
+          userHandler->HandleResponseWithHosts( new XRootDStatus(), response,
+                                                hosts.release() );
+        }
+
+        lck.unlock();
+        delete this;
+      }
+
+      XrdCl::ResponseHandler               *userHandler;
+      uint64_t                              offset;
+      void                                 *buffer;
+      bool                                  pgread;
+      std::vector<Chunk>                    chunks;
+      std::unique_ptr<XrdCl::XRootDStatus>  st;
+      std::unique_ptr<XrdCl::HostList>      hosts;
+      std::mutex                            mtx;
+      size_t                                pending;
+      size_t                                nbrepair;
+  };
+
   //----------------------------------------------------------------------------
   // Object that does things to the FileStateHandler when kXR_open returns
   // and then calls the user handler
@@ -672,9 +864,15 @@ namespace XrdCl
     pUseVirtRedirector( true ),
     pIsChannelEncrypted( false ),
     pAllowBundledClose( false ),
+    pReadStripeSize( 0 ),
+    pReadAheadBlock( 0 ),
+    pReadAheadWindow( 0 ),
+    pReadCoalesce( 0 ),
+    pReadCoalesceMaxSize( 0 ),
     pPlugin( plugin )
   {
     pFileHandle = new uint8_t[4];
+    LoadReadSettings();
     ResetMonitoringVars();
     DefaultEnv::GetForkHandler()->RegisterFileObject( this );
     DefaultEnv::GetFileTimer()->RegisterFileObject( this );
@@ -704,15 +902,50 @@ namespace XrdCl
     pFollowRedirects( true ),
     pUseVirtRedirector( useVirtRedirector ),
     pAllowBundledClose( false ),
+    pReadStripeSize( 0 ),
+    pReadAheadBlock( 0 ),
+    pReadAheadWindow( 0 ),
+    pReadCoalesce( 0 ),
+    pReadCoalesceMaxSize( 0 ),
     pPlugin( plugin )
   {
     pFileHandle = new uint8_t[4];
+    LoadReadSettings();
     ResetMonitoringVars();
     DefaultEnv::GetForkHandler()->RegisterFileObject( this );
     DefaultEnv::GetFileTimer()->RegisterFileObject( this );
     pLFileHandler = new LocalFileHandler();
   }
 
+  //----------------------------------------------------------------------------
+  // Read the striping, readahead and coalescing settings from the env
+  //----------------------------------------------------------------------------
+  void FileStateHandler::LoadReadSettings()
+  {
+    Env *env = DefaultEnv::GetEnv();
+    int stripeSize = DefaultReadStripeSize;
+    env->GetInt( "ReadStripeSize", stripeSize );
+    if( stripeSize > 0 ) pReadStripeSize = stripeSize;
+    int raWindow = DefaultReadAheadWindow;
+    int raBlock  = DefaultReadAheadBlockSize;
+    env->GetInt( "ReadAheadWindow", raWindow );
+    env->GetInt( "ReadAheadBlockSize", raBlock );
+    if( raWindow > 0 && raBlock > 0 )
+    {
+      pReadAheadWindow = raWindow;
+      pReadAheadBlock  = raBlock;
+    }
+    int coalesce    = DefaultReadCoalesce;
+    int coalesceMax = DefaultReadCoalesceMaxSize;
+    env->GetInt( "ReadCoalesce", coalesce );
+    env->GetInt( "ReadCoalesceMaxSize", coalesceMax );
+    if( coalesce > 0 && coalesceMax > 0 )
+    {
+      pReadCoalesce        = coalesce;
+      pReadCoalesceMaxSize = coalesceMax;
+    }
+  }
+
   //----------------------------------------------------------------------------
   // Destructor
   //----------------------------------------------------------------------------
@@ -938,6 +1171,44 @@ namespace XrdCl
                                         ResponseHandler                   *handler,
                                         time_t                             timeout )
   {
+    //--------------------------------------------------------------------------
+    // Stop reading ahead and flush the reads held back by the coalescer, if
+    // there are requests of either in flight the close is sent once they
+    // all came back
+    //--------------------------------------------------------------------------
+    std::shared_ptr<ReadAhead>     readAhead;
+    std::shared_ptr<ReadCoalescer> coalescer;
+    {
+      XrdSysMutexHelper scopedLock( self->pMutex );
+      readAhead.swap( self->pReadAhead );
+      coalescer.swap( self->pReadCoalescer );
+    }
+    if( readAhead || coalescer )
+    {
+      std::shared_ptr<FileStateHandler> file = self;
+      auto busy = std::make_shared<std::atomic<int>>( 1 );
+      auto deferredClose = [file, handler, timeout, busy]() mutable
+      {
+        if( --*busy ) return;
+        XRootDStatus st = Close( file, handler, timeout );
+        if( !st.IsOK() )
+          DefaultEnv::GetPostMaster()->GetJobManager()->QueueJob(
+              new ResponseJob( handler, new XRootDStatus( st ), 0, 0 ) );
+      };
+      if( readAhead )
+      {
+        ++*busy;
+        if( !readAhead->Stop( deferredClose ) ) --*busy;
+      }
+      if( coalescer )
+      {
+        ++*busy;
+        if( !coalescer->Stop( deferredClose ) ) --*busy;
+      }
+      if( --*busy )
+        return XRootDStatus();
+    }
+
     XrdSysMutexHelper scopedLock( self->pMutex );
 
     //--------------------------------------------------------------------------
@@ -1142,6 +1413,61 @@ namespace XrdCl
                                        void            *buffer,
                                        ResponseHandler *handler,
                                        time_t           timeout )
+  {
+    std::shared_ptr<ReadAhead> readAhead = GetReadAhead( self );
+    if( readAhead && readAhead->Read( offset, size, buffer, handler, timeout ) )
+      return XRootDStatus();
+
+    std::shared_ptr<ReadCoalescer> coalescer = GetReadCoalescer( self );
+    if( coalescer && coalescer->Read( offset, size, buffer, handler, timeout ) )
+      return XRootDStatus();
+
+    uint32_t nbstripes = GetReadStripes( self, size );
+    if( nbstripes > 1 )
+      return StripedRead( self, offset, size, buffer, nbstripes, false, handler, timeout );
+    return ReadImpl( self, offset, size, buffer, handler, timeout );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the readahead window of the file
+  //----------------------------------------------------------------------------
+  std::shared_ptr<ReadAhead> FileStateHandler::GetReadAhead( std::shared_ptr<FileStateHandler> &self )
+  {
+    if( !self->pReadAheadWindow ) return nullptr;
+
+    XrdSysMutexHelper scopedLock( self->pMutex );
+    if( !self->pReadAhead && self->pFileState == Opened && self->IsReadOnly() )
+      self->pReadAhead = std::make_shared<ReadAhead>( self, *self->pDataServer,
+                                                      self->pReadAheadBlock,
+                                                      self->pReadAheadWindow );
+    return self->pReadAhead;
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the read coalescer of the file
+  //----------------------------------------------------------------------------
+  std::shared_ptr<ReadCoalescer> FileStateHandler::GetReadCoalescer( std::shared_ptr<FileStateHandler> &self )
+  {
+    if( !self->pReadCoalesce ) return nullptr;
+
+    XrdSysMutexHelper scopedLock( self->pMutex );
+    if( !self->pReadCoalescer && self->pFileState == Opened &&
+        !self->pDataServer->IsLocalFile() )
+      self->pReadCoalescer = std::make_shared<ReadCoalescer>( self,
+                                                  self->pReadCoalesce,
+                                                  self->pReadCoalesceMaxSize );
+    return self->pReadCoalescer;
+  }
+
+  //----------------------------------------------------------------------------
+  // Read a data chunk at a given offset (actual implementation)
+  //----------------------------------------------------------------------------
+  XRootDStatus FileStateHandler::ReadImpl( std::shared_ptr<FileStateHandler> &self,
+                                           uint64_t         offset,
+                                           uint32_t         size,
+                                           void            *buffer,
+                                           ResponseHandler *handler,
+                                           time_t           timeout )
   {
     XrdSysMutexHelper scopedLock( self->pMutex );
 
@@ -1214,12 +1540,134 @@ namespace XrdCl
       return st;
     }
 
+    uint32_t nbstripes = GetReadStripes( self, size );
+    if( nbstripes > 1 )
+      return StripedRead( self, offset, size, buffer, nbstripes, true, handler, timeout );
+
     ResponseHandler* pgHandler = new PgReadHandler( self, handler, offset );
     auto st = PgReadImpl( self, offset, size, buffer, PgReadFlags::None, pgHandler, timeout );
     if( !st.IsOK() ) delete pgHandler;
     return st;
   }
 
+  //----------------------------------------------------------------------------
+  // Number of chunks a read of the given size should be split into
+  //----------------------------------------------------------------------------
+  uint32_t FileStateHandler::GetReadStripes( std::shared_ptr<FileStateHandler> &self,
+                                             uint32_t                           size )
+  {
+    if( !self->pReadStripeSize || size < 2 * (uint64_t)self->pReadStripeSize )
+      return 1;
+
+    URL dataServer;
+    {
+      XrdSysMutexHelper scopedLock( self->pMutex );
+      if( self->pFileState != Opened || !self->pDataServer ||
+          self->pDataServer->IsLocalFile() )
+        return 1;
+      dataServer = *self->pDataServer;
+    }
+
+    AnyObject obj;
+    XRootDStatus st = DefaultEnv::GetPostMaster()->QueryTransport( dataServer,
+                                                   XRootDQuery::DataStreams, obj );
+    if( !st.IsOK() ) return 1;
+    int *nbstreams = 0;
+    obj.Get( nbstreams );
+    std::unique_ptr<int> ptr( nbstreams );
+    if( !nbstreams || *nbstreams < 2 ) return 1;
+
+    return std::min<uint32_t>( *nbstreams, size / self->pReadStripeSize );
+  }
+
+  //----------------------------------------------------------------------------
+  // Split a read into chunks cut at page boundaries, so that the checksums
+  // of PgRead chunks can simply be concatenated
+  //----------------------------------------------------------------------------
+  void FileStateHandler::SplitRead( uint64_t                                    offset,
+                                    uint32_t                                    size,
+                                    uint32_t                                    nbstripes,
+                                    std::vector<std::pair<uint64_t, uint32_t>> &stripes )
+  {
+    uint64_t start = offset;
+    uint64_t end   = offset + size;
+    for( uint32_t i = 1; i <= nbstripes && start < end; ++i )
+    {
+      uint64_t stop = offset + (uint64_t)size * i / nbstripes;
+      stop = ( stop + XrdSys::PageSize - 1 ) / XrdSys::PageSize * XrdSys::PageSize;
+      if( stop > end || i == nbstripes ) stop = end;
+      if( stop <= start ) continue;
+      stripes.emplace_back( start, stop - start );
+      start = stop;
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Split a read into chunks sent concurrently, each of them will be
+  // multiplexed to the least busy data stream
+  //----------------------------------------------------------------------------
+  XRootDStatus FileStateHandler::StripedRead( std::shared_ptr<FileStateHandler> &self,
+                                              uint64_t                           offset,
+                                              uint32_t                           size,
+                                              void                              *buffer,
+                                              uint32_t                           nbstripes,
+                                              bool                               pgread,
+                                              ResponseHandler                   *handler,
+                                              time_t                             timeout )
+  {
+    std::vector<std::pair<uint64_t, uint32_t>> stripes;
+    SplitRead( offset, size, nbstripes, stripes );
+
+    Log *log = DefaultEnv::GetLog();
+    log->Debug( FileMsg, "[%p@%s] Splitting a %s of %u bytes at offset %llu "
+                "into %zu chunks", (void*)self.get(),
+                self->pFileUrl->GetObfuscatedURL().c_str(),
+                pgread ? "pgread" : "read", size, (unsigned long long)offset,
+                stripes.size() );
+
+    StripedReadHandler *stHandler = new StripedReadHandler( handler, offset,
+                                                            buffer, pgread );
+    for( auto &stripe : stripes )
+      stHandler->AddChunk( stripe.second );
+
+    for( size_t i = 0; i < stripes.size(); ++i )
+    {
+      char *chunkBuff = reinterpret_cast<char*>( buffer ) + ( stripes[i].first - offset );
+      ResponseHandler *chHandler = new StripedReadHandler::ChunkHandler( stHandler, i );
+      ResponseHandler *pgHandler = 0;
+      XRootDStatus     st;
+      if( pgread )
+      {
+        pgHandler = new PgReadHandler( self, chHandler, stripes[i].first );
+        st = PgReadImpl( self, stripes[i].first, stripes[i].second, chunkBuff,
+                         PgReadFlags::None, pgHandler, timeout );
+      }
+      else
+        st = ReadImpl( self, stripes[i].first, stripes[i].second, chunkBuff,
+                       chHandler, timeout );
+      if( st.IsOK() ) continue;
+
+      delete pgHandler;
+      delete chHandler;
+
+      //------------------------------------------------------------------------
+      // Nothing has been sent yet so we can just fail, otherwise the error
+      // will be reported once the chunks in flight came back
+      //------------------------------------------------------------------------
+      if( i == 0 )
+      {
+        delete stHandler;
+        return st;
+      }
+      for( ; i < stripes.size(); ++i )
+        stHandler->ChunkFailed( i, st );
+      break;
+    }
+
+    stHandler->Sent();
+    return XRootDStatus();
+  }
+
   XRootDStatus FileStateHandler::PgReadRetry( std::shared_ptr<FileStateHandler> &self,
                                               uint64_t                           offset,
                                               uint32_t                           size,
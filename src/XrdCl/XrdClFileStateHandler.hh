@@ -56,6 +56,8 @@ namespace XrdCl
   class Message;
   class EcHandler;
   class FileStateHandler;
+  class ReadAhead;
+  class ReadCoalescer;
 
   //----------------------------------------------------------------------------
   //! PgRead flags
@@ -98,6 +100,8 @@ namespace XrdCl
       friend class ::PgReadRetryHandler;
       friend class ::PgReadSubstitutionHandler;
       friend class ::OpenHandler;
+      friend class ReadAhead;
+      friend class ReadCoalescer;
 
     public:
       //------------------------------------------------------------------------
@@ -791,6 +795,20 @@ namespace XrdCl
         return std::make_unique<FileStateHandlerTemplate>(self);
       }
 
+      //------------------------------------------------------------------------
+      //! Split a read into at most nbstripes chunks of about the same size,
+      //! cut at page boundaries
+      //!
+      //! @param offset    offset of the read
+      //! @param size      size of the read
+      //! @param nbstripes the number of chunks wanted
+      //! @param stripes   the offsets and sizes of the chunks, in order
+      //------------------------------------------------------------------------
+      static void SplitRead( uint64_t                                    offset,
+                             uint32_t                                    size,
+                             uint32_t                                    nbstripes,
+                             std::vector<std::pair<uint64_t, uint32_t>> &stripes );
+
       //------------------------------------------------------------------------
       //! Checks if we need to set a file template
       //------------------------------------------------------------------------
@@ -802,6 +820,52 @@ namespace XrdCl
       }
 
     private:
+      //------------------------------------------------------------------------
+      //! Read a data chunk at a given offset (actual implementation)
+      //------------------------------------------------------------------------
+      static XRootDStatus ReadImpl( std::shared_ptr<FileStateHandler> &self,
+                                    uint64_t                           offset,
+                                    uint32_t                           size,
+                                    void                              *buffer,
+                                    ResponseHandler                   *handler,
+                                    time_t                             timeout );
+
+      //------------------------------------------------------------------------
+      //! Get the readahead window of the file, creating it if readahead is
+      //! enabled and the file is open read-only
+      //------------------------------------------------------------------------
+      static std::shared_ptr<ReadAhead> GetReadAhead( std::shared_ptr<FileStateHandler> &self );
+
+      //------------------------------------------------------------------------
+      //! Get the read coalescer of the file, creating it if coalescing is
+      //! enabled and the file is open on a remote data server
+      //------------------------------------------------------------------------
+      static std::shared_ptr<ReadCoalescer> GetReadCoalescer( std::shared_ptr<FileStateHandler> &self );
+
+      //------------------------------------------------------------------------
+      //! Get the number of chunks a read of the given size should be split
+      //! into: one unless it is at least twice the ReadStripeSize and the
+      //! data server connection has more than one data stream. Data streams
+      //! are only opened with SubStreamsPerChannel > 1 and by servers that
+      //! support them, otherwise reads are never split.
+      //------------------------------------------------------------------------
+      static uint32_t GetReadStripes( std::shared_ptr<FileStateHandler> &self,
+                                      uint32_t                           size );
+
+      //------------------------------------------------------------------------
+      //! Split a (pg)read into nbstripes chunks sent in parallel, so that
+      //! they are spread over the data streams, and report them to the
+      //! handler as a single response
+      //------------------------------------------------------------------------
+      static XRootDStatus StripedRead( std::shared_ptr<FileStateHandler> &self,
+                                       uint64_t                           offset,
+                                       uint32_t                           size,
+                                       void                              *buffer,
+                                       uint32_t                           nbstripes,
+                                       bool                               pgread,
+                                       ResponseHandler                   *handler,
+                                       time_t                             timeout );
+
       //------------------------------------------------------------------------
       // Helper for queuing messages
       //------------------------------------------------------------------------
@@ -919,6 +983,11 @@ namespace XrdCl
       //------------------------------------------------------------------------
       void ReWriteFileHandle( Message *msg );
 
+      //------------------------------------------------------------------------
+      //! Read the striping, readahead and coalescing settings from the env
+      //------------------------------------------------------------------------
+      void LoadReadSettings();
+
       //------------------------------------------------------------------------
       //! Reset monitoring vars
       //------------------------------------------------------------------------
@@ -983,6 +1052,13 @@ namespace XrdCl
       bool                    pUseVirtRedirector;
       bool                    pIsChannelEncrypted;
       bool                    pAllowBundledClose;
+      uint32_t                pReadStripeSize;
+      uint32_t                pReadAheadBlock;
+      uint64_t                pReadAheadWindow;
+      std::shared_ptr<ReadAhead> pReadAhead;
+      uint32_t                pReadCoalesce;
+      uint32_t                pReadCoalesceMaxSize;
+      std::shared_ptr<ReadCoalescer> pReadCoalescer;
 
       //------------------------------------------------------------------------
       // Monitoring variables
@@ -42,6 +42,7 @@
 #include <sys/stat.h>
 
 #include <memory>
+#include <deque>
 #include <algorithm>
 #include <iterator>
 
@@ -497,20 +498,37 @@ namespace
       XrdCl::RequestSync   *pSync;
   };
 
+  //----------------------------------------------------------------------------
+  // Number of directories waiting to be listed above which the recursive
+  // dirlist goes depth-first, so that the backlog of a very wide tree does
+  // not grow without bound
+  //----------------------------------------------------------------------------
+  const size_t RecursiveDirListMaxQueued = 16384;
+
+  class RecursiveDirListHandler;
+
   //----------------------------------------------------------------------------
   // Recursive dirlist common context for all handlers
+  //
+  // The directories still to be listed are kept in a work queue, which is
+  // consumed breadth-first while it is small, and at most maxInFlight
+  // kXR_dirlist requests are outstanding at any time.
   //----------------------------------------------------------------------------
   struct RecursiveDirListCtx
   {
       RecursiveDirListCtx( const XrdCl::URL &url, const std::string &path,
                            XrdCl::DirListFlags::Flags flags,
                            XrdCl::ResponseHandler *handler, time_t expires ) :
-                             finalst( 0 ), pending( 1 ),
+                             finalst( 0 ), inFlight( 1 ), maxInFlight( 0 ),
                              dirList( new XrdCl::DirectoryList() ), expires( expires ),
                              handler( handler ), flags( flags ),
                              fs( new XrdCl::FileSystem( url ) )
       {
         dirList->SetParentName( path );
+
+        int parallel = XrdCl::DefaultRecursiveDirListParallel;
+        XrdCl::DefaultEnv::GetEnv()->GetInt( "RecursiveDirListParallel", parallel );
+        maxInFlight = parallel > 0 ? parallel : 1;
       }
 
       ~RecursiveDirListCtx()
@@ -536,8 +554,16 @@ namespace
           *finalst = XRootDStatus( stOK, suPartial );
       }
 
+      //------------------------------------------------------------------------
+      // Send the dirlist requests for the queued directories as long as we
+      // are below the in-flight limit (has to be called with mtx locked)
+      //------------------------------------------------------------------------
+      void Dispatch();
+
       XrdCl::XRootDStatus        *finalst;
-      int                         pending;
+      uint32_t                    inFlight;
+      uint32_t                    maxInFlight;
+      std::deque<std::string>     queue;
       XrdCl::DirectoryList       *dirList;
       time_t                      expires;
       XrdCl::ResponseHandler     *handler;
@@ -581,10 +607,9 @@ namespace
         XrdSysMutexHelper scoped( pCtx->mtx );
 
         // check if we have to continue with the same handler (the response
-        // has been chunked), if not we can decrement the number of pending
-        // DieLists
+        // has been chunked), if not the request is no longer in flight
         if( finalrsp )
-          --pCtx->pending;
+          --pCtx->inFlight;
 
         pCtx->UpdateStatus( *status );
 
@@ -618,47 +643,16 @@ namespace
                 new DirectoryList::ListEntry( entry->GetHostAddress(), path, info );
             pCtx->dirList->Add( e );
 
-            // if it's a directory do a recursive call
+            // if it's a directory queue it for listing
             if( info->TestFlags( StatInfo::IsDir ) )
-            {
-              // bump the pending counter
-              ++pCtx->pending;
-              // switch of the recursive flag, we will
-              // provide the respective handler ourself,
-              // make sure that stat is on
-              DirListFlags::Flags flags = ( pCtx->flags & (~DirListFlags::Recursive) )
-                                          | DirListFlags::Stat;
-              // the recursive dir list handler
-              RecursiveDirListHandler *handler = new RecursiveDirListHandler( pCtx );
-              // timeout
-              time_t timeout = 0;
-              if( pCtx->expires )
-              {
-                timeout = pCtx->expires - ::time( 0 );
-                if( timeout <= 0 )
-                {
-                  log->Error( FileMsg, "Recursive directory list operation for %s expired.",
-                              parent.c_str() );
-                  pCtx->UpdateStatus( XRootDStatus( stError, errOperationExpired ) );
-                  break;
-                }
-              }
-              // send the request
-              std::string child = parent + path;
-              XRootDStatus st = pCtx->fs->DirList( child, flags, handler, timeout );
-              if( !st.IsOK() )
-              {
-                log->Error( FileMsg, "Recursive directory list operation for %s failed: %s",
-                            child.c_str(), st.ToString().c_str() );
-                pCtx->UpdateStatus( st );
-                continue;
-              }
-            }
+              pCtx->queue.push_back( path );
           }
         }
 
+        pCtx->Dispatch();
+
         // if there are no more outstanding dirlist queries we can finalize the request
-        if( pCtx->pending == 0 )
+        if( pCtx->inFlight == 0 )
         {
           AnyObject *resp = new AnyObject();
           resp->Set( pCtx->dirList );
@@ -670,8 +664,10 @@ namespace
           scoped.UnLock();
           delete pCtx;
         }
-        // if the user requested chunked response we give what we have to the user handler
-        else if( status->IsOK() && ( pCtx->flags & DirListFlags::Chunked ) )
+        // if the user requested chunked response we give what we have to the
+        // user handler, so that the entries are not accumulated
+        else if( status->IsOK() && ( pCtx->flags & DirListFlags::Chunked ) &&
+                 pCtx->dirList->GetSize() )
         {
           std::string parent = pCtx->dirList->GetParentName();
           AnyObject *resp = new AnyObject();
@@ -694,6 +690,67 @@ namespace
       RecursiveDirListCtx *pCtx;
   };
 
+  //----------------------------------------------------------------------------
+  // Send the dirlist requests for the queued directories
+  //----------------------------------------------------------------------------
+  void RecursiveDirListCtx::Dispatch()
+  {
+    using namespace XrdCl;
+
+    Log *log = DefaultEnv::GetLog();
+    std::string parent = dirList->GetParentName();
+
+    // switch of the recursive flag, we will provide the respective
+    // handler ourself, make sure that stat is on
+    DirListFlags::Flags lsflags = ( flags & (~DirListFlags::Recursive) )
+                                  | DirListFlags::Stat;
+
+    while( inFlight < maxInFlight && !queue.empty() )
+    {
+      // timeout
+      time_t timeout = 0;
+      if( expires )
+      {
+        timeout = expires - ::time( 0 );
+        if( timeout <= 0 )
+        {
+          log->Error( FileMsg, "Recursive directory list operation for %s expired.",
+                      parent.c_str() );
+          UpdateStatus( XRootDStatus( stError, errOperationExpired ) );
+          queue.clear();
+          break;
+        }
+      }
+
+      // breadth-first unless the backlog is too big
+      std::string path;
+      if( queue.size() > RecursiveDirListMaxQueued )
+      {
+        path = std::move( queue.back() );
+        queue.pop_back();
+      }
+      else
+      {
+        path = std::move( queue.front() );
+        queue.pop_front();
+      }
+
+      // send the request
+      std::string child = parent + path;
+      RecursiveDirListHandler *handler = new RecursiveDirListHandler( this );
+      XRootDStatus st = fs->DirList( child, lsflags, handler, timeout );
+      if( !st.IsOK() )
+      {
+        log->Error( FileMsg, "Recursive directory list operation for %s failed: %s",
+                    child.c_str(), st.ToString().c_str() );
+        UpdateStatus( st );
+        delete handler;
+        continue;
+      }
+      ++inFlight;
+    }
+  }
+
   //----------------------------------------------------------------------------
   // Exception for a merge dirlist handler
   //----------------------------------------------------------------------------
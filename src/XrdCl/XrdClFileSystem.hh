@@ -616,7 +616,11 @@ namespace XrdCl
       //! List entries of a directory - async
       //!
       //! @param path    directory path
-      //! @param flags   currently unused
+      //! @param flags   DirListFlags, with Recursive the subdirectories are
+      //!                listed with at most XRD_RECURSIVEDIRLISTPARALLEL
+      //!                requests in flight; adding Chunked makes the entries
+      //!                be delivered as they arrive (suContinue) instead of
+      //!                being collected in a single DirectoryList
       //! @param handler handler to be notified when the response arrives,
       //!                the response parameter will hold a DirectoryList
       //!                object if the procedure is successful
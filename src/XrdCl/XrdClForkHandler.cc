@@ -23,6 +23,8 @@
 #include "XrdCl/XrdClPostMaster.hh"
 #include "XrdCl/XrdClFileTimer.hh"
 #include "XrdCl/XrdClFileStateHandler.hh"
+#include "XrdCl/XrdClBufferCache.hh"
+#include "XrdCl/XrdClRequestStats.hh"
 
 namespace XrdCl
 {
@@ -64,6 +66,12 @@ namespace XrdCl
     for( itFs = pFileSystemObjects.begin(); itFs != pFileSystemObjects.end();
          ++itFs )
       (*itFs)->Lock();
+
+    //--------------------------------------------------------------------------
+    // The buffer cache goes last, the objects above may allocate while
+    // holding their locks
+    //--------------------------------------------------------------------------
+    BufferCache::Lock();
   }
 
   //----------------------------------------------------------------------------
@@ -76,6 +84,8 @@ namespace XrdCl
     log->Debug( UtilityMsg, "Running the parent fork handler for process %d",
                 pid );
 
+    BufferCache::UnLock();
+
     log->Debug( UtilityMsg, "Unlocking File and FileSystem objects for "
                 "process:  %d", pid );
 
@@ -106,6 +116,8 @@ namespace XrdCl
     log->Debug( UtilityMsg, "Running the child fork handler for process %d",
                 pid );
 
+    BufferCache::UnLock();
+
     log->Debug( UtilityMsg, "Unlocking File and FileSystem objects for "
                 "process:  %d", pid );
 
@@ -129,6 +141,7 @@ namespace XrdCl
       pPostMaster->Initialize();
       pPostMaster->Start();
       pPostMaster->GetTaskManager()->RegisterTask( pFileTimer, time(0), false );
+      RequestStats::Initialize( pPostMaster->GetTaskManager() );
     }
 
     pMutex.UnLock();
@@ -25,9 +25,21 @@
 #include "XrdCl/XrdClConstants.hh"
 
 #include <arpa/inet.h>              // for network unmarshalling stuff
+#include <cstring>
+#include <vector>
 
 namespace XrdCl
 {
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  InQueue::InQueue(): pWheelTime( 0 )
+  {
+    memset( pPageCount, 0, sizeof( pPageCount ) );
+    for( int i = 0; i <= pWheelSize; ++i )
+      pBuckets[i] = pNoBucket;
+  }
+
   //----------------------------------------------------------------------------
   // Filter messages
   //----------------------------------------------------------------------------
@@ -48,6 +60,106 @@ namespace XrdCl
     return false;
   }
 
+  //----------------------------------------------------------------------------
+  // Get the handler slot of a stream id
+  //----------------------------------------------------------------------------
+  InQueue::HandlerSlot *InQueue::GetSlot( uint16_t sid, bool create )
+  {
+    std::unique_ptr<HandlerSlot[]> &page = pPages[sid >> pPageShift];
+    if( !page )
+    {
+      if( !create ) return 0;
+      page.reset( new HandlerSlot[pPageSize] );
+      for( int i = 0; i < pPageSize; ++i )
+      {
+        page[i].handler = 0;
+        page[i].expires = 0;
+        page[i].bucket  = pNoBucket;
+      }
+    }
+    return &page[sid & ( pPageSize - 1 )];
+  }
+
+  //----------------------------------------------------------------------------
+  // Link the slot into a timer wheel bucket
+  //----------------------------------------------------------------------------
+  void InQueue::Link( uint16_t sid, HandlerSlot &slot, int bucket )
+  {
+    slot.bucket = bucket;
+    slot.prev   = sid;
+    if( pBuckets[bucket] == pNoBucket )
+      slot.next = sid;
+    else
+    {
+      //------------------------------------------------------------------------
+      // Circular list, insert in front of the head
+      //------------------------------------------------------------------------
+      uint16_t     headSid = pBuckets[bucket];
+      HandlerSlot *head    = GetSlot( headSid );
+      HandlerSlot *tail    = GetSlot( head->prev );
+      slot.next  = headSid;
+      slot.prev  = head->prev;
+      tail->next = sid;
+      head->prev = sid;
+    }
+    pBuckets[bucket] = sid;
+  }
+
+  //----------------------------------------------------------------------------
+  // Unlink the slot from its timer wheel bucket
+  //----------------------------------------------------------------------------
+  void InQueue::Unlink( uint16_t sid, HandlerSlot &slot )
+  {
+    if( slot.bucket == pNoBucket ) return;
+    if( slot.next == sid )
+      pBuckets[slot.bucket] = pNoBucket;
+    else
+    {
+      GetSlot( slot.prev )->next = slot.next;
+      GetSlot( slot.next )->prev = slot.prev;
+      if( pBuckets[slot.bucket] == sid )
+        pBuckets[slot.bucket] = slot.next;
+    }
+    slot.bucket = pNoBucket;
+  }
+
+  //----------------------------------------------------------------------------
+  // Set the expiration of a handler and put it on the timer wheel
+  //----------------------------------------------------------------------------
+  void InQueue::SetExpiration( uint16_t sid, HandlerSlot &slot, time_t expires )
+  {
+    Unlink( sid, slot );
+    slot.expires = expires;
+    if( !expires ) return;
+    if( expires <= pWheelTime )
+      Link( sid, slot, pOverdue );
+    else
+      Link( sid, slot, expires % pWheelSize );
+  }
+
+  //----------------------------------------------------------------------------
+  // Insert a handler
+  //----------------------------------------------------------------------------
+  void InQueue::SetHandler( uint16_t sid, MsgHandler *handler, time_t expires )
+  {
+    HandlerSlot *slot = GetSlot( sid, true );
+    if( !slot->handler )
+      ++pPageCount[sid >> pPageShift];
+    slot->handler = handler;
+    SetExpiration( sid, *slot, expires );
+  }
+
+  //----------------------------------------------------------------------------
+  // Remove the handler from the slot
+  //----------------------------------------------------------------------------
+  void InQueue::ClearSlot( uint16_t sid, HandlerSlot &slot )
+  {
+    Unlink( sid, slot );
+    slot.handler = 0;
+    slot.expires = 0;
+    --pPageCount[sid >> pPageShift];
+  }
+
   //----------------------------------------------------------------------------
   // Add a listener that should be notified about incoming messages
   //----------------------------------------------------------------------------
@@ -56,7 +168,7 @@ namespace XrdCl
     uint16_t handlerSid = handler->GetSid();
     XrdSysMutexHelper scopedLock( pMutex );
 
-    pHandlers[handlerSid] = HandlerAndExpire( handler, 0 );
+    SetHandler( handlerSid, handler, 0 );
   }
 
   //----------------------------------------------------------------------------
@@ -78,26 +190,26 @@ namespace XrdCl
     }
 
     XrdSysMutexHelper scopedLock( pMutex );
-    HandlerMap::iterator it = pHandlers.find(msgSid);
+    HandlerSlot *slot = GetSlot( msgSid );
 
-    if (it != pHandlers.end())
+    if( slot && slot->handler )
     {
       Log *log = DefaultEnv::GetLog();
-      handler = it->second.first;
+      handler = slot->handler;
       act     = handler->Examine( msg );
-      if( it->second.second == 0 ) {
-        it->second.second = handler->GetExpiration();
+      if( slot->expires == 0 ) {
+        SetExpiration( msgSid, *slot, handler->GetExpiration() );
         log->Debug( ExDbgMsg, "[handler: %p] Assigned expiration %lld.",
-                    (void*)handler, (long long)it->second.second );
+                    (void*)handler, (long long)slot->expires );
       }
-      exp     = it->second.second;
+      exp     = slot->expires;
       log->Debug( ExDbgMsg, "[msg: %p] Assigned MsgHandler: %p.",
                   (void*)msg.get(), (void*)handler );
 
 
       if( act & MsgHandler::RemoveHandler )
       {
-        pHandlers.erase( it );
+        ClearSlot( msgSid, *slot );
         log->Debug( ExDbgMsg, "[handler: %p] Removed MsgHandler: %p from the in-queue.",
                     (void*)handler, (void*)handler );
       }
@@ -120,7 +232,7 @@ namespace XrdCl
   {
     uint16_t handlerSid = handler->GetSid();
     XrdSysMutexHelper scopedLock( pMutex );
-    pHandlers[handlerSid] = HandlerAndExpire( handler, expires );
+    SetHandler( handlerSid, handler, expires );
   }
 
   //----------------------------------------------------------------------------
@@ -130,7 +242,9 @@ namespace XrdCl
   {
     uint16_t handlerSid = handler->GetSid();
     XrdSysMutexHelper scopedLock( pMutex );
-    pHandlers.erase(handlerSid);
+    HandlerSlot *slot = GetSlot( handlerSid );
+    if( slot && slot->handler )
+      ClearSlot( handlerSid, *slot );
     Log *log = DefaultEnv::GetLog();
     log->Debug( ExDbgMsg, "[handler: %p] Removed MsgHandler: %p from the in-queue.",
                 (void*)handler, (void*)handler );
@@ -145,18 +259,21 @@ namespace XrdCl
   {
     uint8_t action = 0;
     XrdSysMutexHelper scopedLock( pMutex );
-    for( HandlerMap::iterator it = pHandlers.begin(); it != pHandlers.end(); )
+    for( int p = 0; p < pNPages; ++p )
     {
-      action = it->second.first->OnStreamEvent( event, status );
-
-      if( action & MsgHandler::RemoveHandler )
+      if( !pPageCount[p] ) continue;
+      for( int i = 0; i < pPageSize; ++i )
       {
-        auto next = it; ++next;
-        pHandlers.erase( it );
-        it = next;
+        uint16_t     sid     = ( p << pPageShift ) | i;
+        HandlerSlot &slot    = pPages[p][i];
+        MsgHandler  *handler = slot.handler;
+        if( !handler ) continue;
+
+        action = handler->OnStreamEvent( event, status );
+
+        if( ( action & MsgHandler::RemoveHandler ) && slot.handler == handler )
+          ClearSlot( sid, slot );
       }
-      else
-        ++it;
     }
   }
 
@@ -169,20 +286,57 @@ namespace XrdCl
       now = ::time(0);
 
     XrdSysMutexHelper scopedLock( pMutex );
-    HandlerMap::iterator it = pHandlers.begin();
-    while( it != pHandlers.end() )
+
+    //--------------------------------------------------------------------------
+    // Collect the handlers from the buckets of the seconds elapsed since
+    // the previous call (all of them if a full turn of the wheel passed)
+    // and from the overdue list. The handlers are only notified once the
+    // candidates are collected as they may add or remove handlers.
+    //--------------------------------------------------------------------------
+    std::vector<uint16_t> expired;
+    std::vector<int>      buckets;
+    if( now > pWheelTime )
+    {
+      time_t from = now - pWheelTime >= pWheelSize ? now - pWheelSize + 1
+                                                   : pWheelTime + 1;
+      for( time_t t = from; t <= now; ++t )
+        buckets.push_back( t % pWheelSize );
+      pWheelTime = now;
+    }
+    buckets.push_back( pOverdue );
+
+    for( int bucket : buckets )
     {
-      if( it->second.second && it->second.second <= now )
+      if( pBuckets[bucket] == pNoBucket ) continue;
+      uint16_t sid = pBuckets[bucket];
+      do
+      {
+        HandlerSlot *slot = GetSlot( sid );
+        if( slot->expires <= now )
+          expired.push_back( sid );
+        sid = slot->next;
+      }
+      while( sid != pBuckets[bucket] );
+    }
+
+    for( uint16_t sid : expired )
+    {
+      HandlerSlot *slot    = GetSlot( sid );
+      MsgHandler  *handler = slot->handler;
+      if( !handler || !slot->expires || slot->expires > now )
+        continue;
+
+      uint8_t act = handler->OnStreamEvent( MsgHandler::Timeout,
+                                            Status( stError, errOperationExpired ) );
+      if( slot->handler != handler || slot->expires > now )
+        continue;
+      if( act & MsgHandler::RemoveHandler )
+        ClearSlot( sid, *slot );
+      else if( slot->bucket != pOverdue )
       {
-        uint8_t act = it->second.first->OnStreamEvent( MsgHandler::Timeout,
-                                         Status( stError, errOperationExpired ) );
-        auto next = it; ++next;
-        if( act & MsgHandler::RemoveHandler )
-          pHandlers.erase( it );
-        it = next;
+        Unlink( sid, *slot );
+        Link( sid, *slot, pOverdue );
       }
-      else
-        ++it;
     }
   }
 
@@ -193,16 +347,16 @@ namespace XrdCl
   {
     uint16_t handlerSid = handler->GetSid();
     XrdSysMutexHelper scopedLock( pMutex );
-    HandlerMap::iterator it = pHandlers.find( handlerSid );
-    if( it != pHandlers.end() )
+    HandlerSlot *slot = GetSlot( handlerSid );
+    if( slot && slot->handler )
     {
-      if( it->second.second == 0 )
+      if( slot->expires == 0 )
       {
-        it->second.second   = handler->GetExpiration();
+        SetExpiration( handlerSid, *slot, handler->GetExpiration() );
 
         Log *log = DefaultEnv::GetLog();
         log->Debug( ExDbgMsg, "[handler: %p] Assigned expiration %lld.",
-                    (void*)handler, (long long)it->second.second );
+                    (void*)handler, (long long)slot->expires );
 
       }
     }
@@ -216,9 +370,9 @@ namespace XrdCl
   {
     uint16_t handlerSid = handler->GetSid();
     XrdSysMutexHelper scopedLock( pMutex );
-    HandlerMap::iterator it = pHandlers.find( handlerSid );
-    if( it == pHandlers.end() ) return false;
-    if( it->second.second == 0 ) return true;
+    HandlerSlot *slot = GetSlot( handlerSid );
+    if( !slot || !slot->handler ) return false;
+    if( slot->expires == 0 ) return true;
     return false;
   }
 
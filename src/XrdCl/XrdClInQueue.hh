@@ -20,9 +20,9 @@
 #define __XRD_CL_IN_QUEUE_HH__
 
 #include <XrdSys/XrdSysPthread.hh>
-#include <map>
 #include <memory>
-#include <utility>
+#include <cstdint>
+#include <ctime>
 #include "XrdCl/XrdClXRootDResponses.hh"
 #include "XrdCl/XrdClPostMasterInterfaces.hh"
 
@@ -36,6 +36,11 @@ namespace XrdCl
   class InQueue
   {
     public:
+      //------------------------------------------------------------------------
+      //! Constructor
+      //------------------------------------------------------------------------
+      InQueue();
+
       //------------------------------------------------------------------------
       //! Add a listener that should be notified about incoming messages.
       //! Freshly added handlers have no expire time set and will not trigger
@@ -113,10 +118,44 @@ namespace XrdCl
       //------------------------------------------------------------------------
       bool DiscardMessage(Message& msg, uint16_t& sid) const;
 
-      typedef std::pair<MsgHandler *, time_t> HandlerAndExpire;
-      typedef std::map<uint16_t, HandlerAndExpire> HandlerMap;
-      HandlerMap pHandlers;
-      XrdSysRecMutex pMutex;
+      //------------------------------------------------------------------------
+      // The handlers are kept in a table indexed directly by the stream id,
+      // split into pages of pPageSize slots that are created on first use.
+      // Handlers with an expiry set are additionally linked, through the
+      // stream ids, into one bucket of a timer wheel with a resolution of
+      // one second, so that ReportTimeout only needs to look at the buckets
+      // of the seconds that passed since its previous call. Handlers that
+      // expired but have not been removed are kept in the overdue list and
+      // reported again on each call.
+      //------------------------------------------------------------------------
+      static const int      pPageShift = 8;
+      static const int      pPageSize  = 1 << pPageShift;
+      static const int      pNPages    = 0x10000 >> pPageShift;
+      static const int      pWheelSize = 512;
+      static const int      pOverdue   = pWheelSize;
+      static const int      pNoBucket  = -1;
+
+      struct HandlerSlot
+      {
+        MsgHandler *handler;
+        time_t      expires;
+        int         bucket;
+        uint16_t    prev;
+        uint16_t    next;
+      };
+
+      HandlerSlot *GetSlot( uint16_t sid, bool create = false );
+      void SetHandler( uint16_t sid, MsgHandler *handler, time_t expires );
+      void SetExpiration( uint16_t sid, HandlerSlot &slot, time_t expires );
+      void ClearSlot( uint16_t sid, HandlerSlot &slot );
+      void Link( uint16_t sid, HandlerSlot &slot, int bucket );
+      void Unlink( uint16_t sid, HandlerSlot &slot );
+
+      std::unique_ptr<HandlerSlot[]> pPages[pNPages];
+      uint16_t                       pPageCount[pNPages];
+      int                            pBuckets[pWheelSize + 1];
+      time_t                         pWheelTime;
+      XrdSysRecMutex                 pMutex;
   };
 }
 
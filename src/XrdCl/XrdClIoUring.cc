@@ -0,0 +1,728 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClIoUring.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XrdSys/XrdSysE2T.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Size of the submission queue, the completion queue is twice as big
+  //----------------------------------------------------------------------------
+  const unsigned RingEntries = 256;
+
+  //----------------------------------------------------------------------------
+  // Failed waits tolerated while reaping the cancelled requests of a broken
+  // ring, and the pause between them (in microseconds)
+  //----------------------------------------------------------------------------
+  const int      AbortRetries = 16;
+  const unsigned AbortPause   = 10000;
+
+  std::mutex                    InstanceMutex;
+  std::atomic<XrdCl::IoUring*>  Instance( nullptr );
+  std::atomic<bool>             Initialized( false );
+}
+#endif
+
+namespace XrdCl
+{
+#ifdef HAVE_IO_URING
+  //----------------------------------------------------------------------------
+  // Get the process-wide instance
+  //----------------------------------------------------------------------------
+  IoUring *IoUring::Get()
+  {
+    if( Initialized.load( std::memory_order_acquire ) )
+      return Instance.load( std::memory_order_acquire );
+
+    std::lock_guard<std::mutex> lck( InstanceMutex );
+    if( Initialized.load( std::memory_order_acquire ) )
+      return Instance.load( std::memory_order_acquire );
+
+    static bool atForkRegistered = false;
+    if( !atForkRegistered )
+    {
+      pthread_atfork( 0, 0, AfterFork );
+      atForkRegistered = true;
+    }
+
+    Log *log     = DefaultEnv::GetLog();
+    int  enabled = DefaultIoUring;
+    DefaultEnv::GetEnv()->GetInt( "IoUring", enabled );
+
+    IoUring *ring = 0;
+    if( enabled )
+    {
+      ring = new IoUring();
+      int rc = ring->Setup( RingEntries );
+      if( !rc )
+      {
+        rc = pthread_create( &ring->pReaper, 0, RunReaper, ring );
+        if( !rc ) pthread_detach( ring->pReaper );
+      }
+
+      if( rc )
+      {
+        log->Debug( FileMsg, "io_uring is not available, using POSIX AIO for "
+                    "local files: %s", XrdSysE2T( rc ) );
+        delete ring;
+        ring = 0;
+      }
+      else
+        log->Debug( FileMsg, "Using io_uring for local files." );
+    }
+
+    Instance.store( ring, std::memory_order_release );
+    Initialized.store( true, std::memory_order_release );
+    return ring;
+  }
+
+  //----------------------------------------------------------------------------
+  // In the child the ring (shared with the parent) cannot be used and the
+  // reaper thread does not exist, the next user creates a new one
+  //----------------------------------------------------------------------------
+  void IoUring::AfterFork()
+  {
+    IoUring *ring = Instance.load();
+    if( ring )
+    {
+      // the object itself is leaked, its mutex may have been held by another
+      // thread of the parent
+      munmap( ring->pSqes, ring->pSqesSize );
+      if( ring->pCqRing != ring->pSqRing )
+        munmap( ring->pCqRing, ring->pCqRingSize );
+      munmap( ring->pSqRing, ring->pSqRingSize );
+      close( ring->pRingFd );
+    }
+    Instance.store( nullptr );
+    Initialized.store( false );
+  }
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  IoUring::IoUring() : pRingFd( -1 ), pSqRing( MAP_FAILED ), pSqRingSize( 0 ),
+    pCqRing( MAP_FAILED ), pCqRingSize( 0 ), pSqes( 0 ), pSqesSize( 0 ),
+    pSqHead( 0 ), pSqTail( 0 ), pSqMask( 0 ), pSqEntries( 0 ), pSqArray( 0 ),
+    pCqHead( 0 ), pCqTail( 0 ), pCqMask( 0 ), pCqes( 0 ), pCqEntries( 0 ),
+    pInFlight( 0 ), pPending( 0 ), pSubmitting( false ), pFailed( 0 ),
+    pRequests( 0 ), pReaper()
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  // Destructor (only used if the setup failed)
+  //----------------------------------------------------------------------------
+  IoUring::~IoUring()
+  {
+    if( pSqes )
+      munmap( pSqes, pSqesSize );
+    if( pCqRing != MAP_FAILED && pCqRing != pSqRing )
+      munmap( pCqRing, pCqRingSize );
+    if( pSqRing != MAP_FAILED )
+      munmap( pSqRing, pSqRingSize );
+    if( pRingFd >= 0 )
+      close( pRingFd );
+  }
+
+  //----------------------------------------------------------------------------
+  // Create the ring and map the queues
+  //----------------------------------------------------------------------------
+  int IoUring::Setup( unsigned entries )
+  {
+    io_uring_params params;
+    memset( &params, 0, sizeof( params ) );
+    pRingFd = syscall( __NR_io_uring_setup, entries, &params );
+    if( pRingFd < 0 ) return errno;
+
+    //--------------------------------------------------------------------------
+    // We need a kernel with the plain read and write operations (5.6) and
+    // that never drops completions
+    //--------------------------------------------------------------------------
+    if( !( params.features & IORING_FEAT_NODROP ) ) return ENOTSUP;
+
+    size_t probeSize = sizeof( io_uring_probe ) + 256 * sizeof( io_uring_probe_op );
+    std::unique_ptr<char[]> buffer( new char[probeSize] );
+    memset( buffer.get(), 0, probeSize );
+    io_uring_probe *probe = reinterpret_cast<io_uring_probe*>( buffer.get() );
+    if( syscall( __NR_io_uring_register, pRingFd, IORING_REGISTER_PROBE, probe, 256 ) < 0 )
+      return errno;
+    for( uint8_t op : { IORING_OP_READ, IORING_OP_WRITE, IORING_OP_FSYNC,
+                        IORING_OP_ASYNC_CANCEL } )
+      if( op >= probe->ops_len || !( probe->ops[op].flags & IO_URING_OP_SUPPORTED ) )
+        return ENOTSUP;
+
+    //--------------------------------------------------------------------------
+    // Map the queues
+    //--------------------------------------------------------------------------
+    pSqRingSize = params.sq_off.array + params.sq_entries * sizeof( unsigned );
+    pCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof( io_uring_cqe );
+    bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+    if( single )
+      pSqRingSize = pCqRingSize = std::max( pSqRingSize, pCqRingSize );
+
+    pSqRing = mmap( 0, pSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    pRingFd, IORING_OFF_SQ_RING );
+    if( pSqRing == MAP_FAILED ) return errno;
+
+    if( single )
+      pCqRing = pSqRing;
+    else
+    {
+      pCqRing = mmap( 0, pCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      pRingFd, IORING_OFF_CQ_RING );
+      if( pCqRing == MAP_FAILED ) return errno;
+    }
+
+    pSqesSize = params.sq_entries * sizeof( io_uring_sqe );
+    void *sqes = mmap( 0, pSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       pRingFd, IORING_OFF_SQES );
+    if( sqes == MAP_FAILED ) return errno;
+    pSqes = static_cast<io_uring_sqe*>( sqes );
+
+    char *sq    = static_cast<char*>( pSqRing );
+    pSqHead     = reinterpret_cast<unsigned*>( sq + params.sq_off.head );
+    pSqTail     = reinterpret_cast<unsigned*>( sq + params.sq_off.tail );
+    pSqMask     = *reinterpret_cast<unsigned*>( sq + params.sq_off.ring_mask );
+    pSqEntries  = params.sq_entries;
+    pSqArray    = reinterpret_cast<unsigned*>( sq + params.sq_off.array );
+
+    char *cq    = static_cast<char*>( pCqRing );
+    pCqHead     = reinterpret_cast<unsigned*>( cq + params.cq_off.head );
+    pCqTail     = reinterpret_cast<unsigned*>( cq + params.cq_off.tail );
+    pCqMask     = *reinterpret_cast<unsigned*>( cq + params.cq_off.ring_mask );
+    pCqes       = reinterpret_cast<io_uring_cqe*>( cq + params.cq_off.cqes );
+    pCqEntries  = params.cq_entries;
+    return 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Queue requests
+  //----------------------------------------------------------------------------
+  int IoUring::Read( int fd, uint64_t offset, uint32_t size, void *buffer,
+                     Request *req )
+  {
+    return Submit( { IORING_OP_READ, 0, fd, offset,
+                     reinterpret_cast<uint64_t>( buffer ), size, req } );
+  }
+
+  int IoUring::Write( int fd, uint64_t offset, uint32_t size, const void *buffer,
+                      Request *req )
+  {
+    return Submit( { IORING_OP_WRITE, 0, fd, offset,
+                     reinterpret_cast<uint64_t>( buffer ), size, req } );
+  }
+
+  //----------------------------------------------------------------------------
+  // The sync must not start before the writes queued ahead of it for the
+  // same file are done, Submit parks it until then
+  //----------------------------------------------------------------------------
+  int IoUring::Fsync( int fd, Request *req )
+  {
+    return Submit( { IORING_OP_FSYNC, 0, fd, 0, 0, 0, req } );
+  }
+
+  //----------------------------------------------------------------------------
+  // Put a request in the submission queue, whoever finds nobody else
+  // submitting hands all the queued entries to the kernel in one go
+  //----------------------------------------------------------------------------
+  int IoUring::Submit( const Entry &entry )
+  {
+    std::unique_lock<std::mutex> lck( pMutex );
+    if( pFailed ) return pFailed;
+
+    //--------------------------------------------------------------------------
+    // A sync waits for the writes outstanding for its file, the reaper
+    // queues it once the last of them is reaped
+    //--------------------------------------------------------------------------
+    if( entry.opcode == IORING_OP_FSYNC )
+    {
+      auto it = pFiles.find( entry.fd );
+      if( it != pFiles.end() && it->second.writes )
+      {
+        Track( entry );
+        it->second.syncs.push_back( entry );
+        return 0;
+      }
+    }
+
+    //--------------------------------------------------------------------------
+    // The reaper resubmits short transfers and must never wait for room, as
+    // only the reaper makes room. If there is none the entry is parked and
+    // queued by the reaper once it has reaped the next completions.
+    //--------------------------------------------------------------------------
+    if( pthread_equal( pthread_self(), pReaper ) && !Room() )
+    {
+      Track( entry );
+      pOverflow.push_back( entry );
+      return 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // The number of requests in flight is limited by the size of the
+    // completion queue, the unsubmitted ones by the submission queue
+    //--------------------------------------------------------------------------
+    bool submitter = false;
+    while( !Room() )
+    {
+      if( !pSubmitting && pPending )
+      {
+        submitter = pSubmitting = true;
+        break;
+      }
+      pCV.wait( lck );
+      if( pFailed ) return pFailed;
+    }
+
+    if( !submitter )
+    {
+      Track( entry );
+      Push( entry );
+      if( pSubmitting ) return 0;
+      pSubmitting = true;
+    }
+
+    std::vector<Request*> failed;
+    int rc = Enter( lck, failed );
+    pSubmitting = false;
+    pCV.notify_all();
+    lck.unlock();
+
+    Fail( failed, rc );
+    if( submitter ) return Submit( entry );
+    return 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Check if another entry may be queued, must be called with the lock held
+  //----------------------------------------------------------------------------
+  bool IoUring::Room()
+  {
+    return pInFlight < pCqEntries &&
+           *pSqTail - __atomic_load_n( pSqHead, __ATOMIC_ACQUIRE ) < pSqEntries;
+  }
+
+  //----------------------------------------------------------------------------
+  // Fill in the next submission queue entry, must be called with the lock
+  // held and with room in the queues
+  //----------------------------------------------------------------------------
+  void IoUring::Push( const Entry &entry )
+  {
+    unsigned      tail = *pSqTail;
+    unsigned      idx  = tail & pSqMask;
+    io_uring_sqe *sqe  = &pSqes[idx];
+    memset( sqe, 0, sizeof( io_uring_sqe ) );
+    sqe->opcode    = entry.opcode;
+    sqe->flags     = entry.flags;
+    sqe->fd        = entry.fd;
+    sqe->off       = entry.offset;
+    sqe->addr      = entry.addr;
+    sqe->len       = entry.size;
+    sqe->user_data = reinterpret_cast<uint64_t>( entry.req );
+    pSqArray[idx]  = idx;
+    __atomic_store_n( pSqTail, tail + 1, __ATOMIC_RELEASE );
+    ++pInFlight;
+    ++pPending;
+  }
+
+  //----------------------------------------------------------------------------
+  // Hand the queued entries to the kernel, must be called with the lock held
+  // by the thread that set pSubmitting. If the kernel refuses them, or the
+  // reaper has given up on the ring meanwhile, the ring is marked as broken
+  // and the entries the kernel has not taken, together with the parked ones,
+  // are taken back and returned in failed.
+  //----------------------------------------------------------------------------
+  int IoUring::Enter( std::unique_lock<std::mutex> &lck,
+                      std::vector<Request*> &failed )
+  {
+    while( pPending )
+    {
+      unsigned n = pPending;
+      lck.unlock();
+      int rc = syscall( __NR_io_uring_enter, pRingFd, n, 0, 0, 0, 0 );
+      int err = errno;
+      lck.lock();
+
+      if( rc > 0 )
+      {
+        pPending -= rc;
+        continue;
+      }
+
+      if( ( rc == 0 || err == EINTR || err == EAGAIN || err == EBUSY ) &&
+          !pFailed )
+      {
+        lck.unlock();
+        sched_yield();
+        lck.lock();
+        continue;
+      }
+
+      if( !pFailed )
+      {
+        DefaultEnv::GetLog()->Error( FileMsg, "io_uring submission failed, "
+                                     "not using it anymore: %s", XrdSysE2T( err ) );
+        pFailed = err;
+      }
+
+      unsigned head = __atomic_load_n( pSqHead, __ATOMIC_ACQUIRE );
+      unsigned tail = *pSqTail;
+      for( unsigned i = head; i != tail; ++i )
+      {
+        io_uring_sqe &sqe = pSqes[pSqArray[i & pSqMask]];
+        failed.push_back( reinterpret_cast<Request*>( sqe.user_data ) );
+      }
+      __atomic_store_n( pSqTail, head, __ATOMIC_RELEASE );
+      pInFlight -= tail - head;
+      pPending   = 0;
+
+      for( auto &entry : pOverflow )
+        failed.push_back( entry.req );
+      pOverflow.clear();
+      TakeSyncs( failed );
+
+      for( auto req : failed )
+        Untrack( req );
+      return pFailed;
+    }
+    return 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Queue the entries parked by the reaper, called by the reaper
+  //----------------------------------------------------------------------------
+  void IoUring::Drain()
+  {
+    std::unique_lock<std::mutex> lck( pMutex );
+    std::vector<Request*> failed;
+    int rc = 0;
+
+    while( !pOverflow.empty() || pPending )
+    {
+      while( !pOverflow.empty() && Room() )
+      {
+        Push( pOverflow.front() );
+        pOverflow.pop_front();
+      }
+
+      //------------------------------------------------------------------------
+      // Somebody else is submitting and will take our entries too
+      //------------------------------------------------------------------------
+      if( !pPending || pSubmitting ) break;
+
+      pSubmitting = true;
+      rc = Enter( lck, failed );
+      pSubmitting = false;
+      pCV.notify_all();
+      if( rc ) break;
+
+      //------------------------------------------------------------------------
+      // The rest waits for the next completions
+      //------------------------------------------------------------------------
+      if( !Room() ) break;
+    }
+
+    lck.unlock();
+    Fail( failed, rc );
+  }
+
+  //----------------------------------------------------------------------------
+  // Keep track of the requests not completed yet and of the writes
+  // outstanding per file, must be called with the lock held
+  //----------------------------------------------------------------------------
+  void IoUring::Track( const Entry &entry )
+  {
+    Request *req = entry.req;
+    req->pFd     = entry.fd;
+    req->pOpcode = entry.opcode;
+    req->pPrev   = 0;
+    req->pNext   = pRequests;
+    if( pRequests ) pRequests->pPrev = req;
+    pRequests = req;
+
+    if( entry.opcode == IORING_OP_WRITE )
+      ++pFiles[entry.fd].writes;
+  }
+
+  void IoUring::Untrack( Request *req )
+  {
+    if( req->pPrev ) req->pPrev->pNext = req->pNext;
+    else pRequests = req->pNext;
+    if( req->pNext ) req->pNext->pPrev = req->pPrev;
+    req->pPrev = req->pNext = 0;
+
+    if( req->pOpcode != IORING_OP_WRITE ) return;
+    auto it = pFiles.find( req->pFd );
+    if( it == pFiles.end() || --it->second.writes ) return;
+    if( it->second.syncs.empty() )
+      pFiles.erase( it );
+    else
+      pIdle.push_back( req->pFd );
+  }
+
+  //----------------------------------------------------------------------------
+  // Take out the syncs waiting for writes, must be called with the lock held
+  //----------------------------------------------------------------------------
+  void IoUring::TakeSyncs( std::vector<Request*> &failed )
+  {
+    for( auto &f : pFiles )
+    {
+      for( auto &entry : f.second.syncs )
+        failed.push_back( entry.req );
+      f.second.syncs.clear();
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Call back the requests that could not be executed, must be called
+  // without the lock
+  //----------------------------------------------------------------------------
+  void IoUring::Fail( std::vector<Request*> &failed, int err )
+  {
+    for( auto req : failed )
+      req->Done( -err );
+    failed.clear();
+  }
+
+  //----------------------------------------------------------------------------
+  // Reaper thread
+  //----------------------------------------------------------------------------
+  void *IoUring::RunReaper( void *arg )
+  {
+    static_cast<IoUring*>( arg )->Reap();
+    return 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Reap the available completions and call back their requests, called by
+  // the reaper. Returns the number of completions reaped.
+  //----------------------------------------------------------------------------
+  unsigned IoUring::Complete( std::vector<std::pair<Request*, int>> &done )
+  {
+    unsigned head = *pCqHead;
+    unsigned tail = __atomic_load_n( pCqTail, __ATOMIC_ACQUIRE );
+    unsigned n    = tail - head;
+    if( !n ) return 0;
+
+    //--------------------------------------------------------------------------
+    // Cancellations are queued without a request
+    //--------------------------------------------------------------------------
+    for( ; head != tail; ++head )
+    {
+      io_uring_cqe &cqe = pCqes[head & pCqMask];
+      if( cqe.user_data )
+        done.emplace_back( reinterpret_cast<Request*>( cqe.user_data ), cqe.res );
+    }
+    __atomic_store_n( pCqHead, head, __ATOMIC_RELEASE );
+
+    //--------------------------------------------------------------------------
+    // Make room before calling back, the requests may queue new ones
+    //--------------------------------------------------------------------------
+    {
+      std::lock_guard<std::mutex> lck( pMutex );
+      pInFlight -= n;
+      for( auto &d : done )
+        Untrack( d.first );
+    }
+    pCV.notify_all();
+
+    for( auto &d : done )
+      d.first->Done( d.second );
+    done.clear();
+
+    //--------------------------------------------------------------------------
+    // Release the syncs of the files that have no writes outstanding anymore,
+    // only now as the call backs may have queued the rest of short writes
+    //--------------------------------------------------------------------------
+    std::lock_guard<std::mutex> lck( pMutex );
+    for( int fd : pIdle )
+    {
+      auto it = pFiles.find( fd );
+      if( it == pFiles.end() || it->second.writes ) continue;
+      for( auto &entry : it->second.syncs )
+        pOverflow.push_back( entry );
+      pFiles.erase( it );
+    }
+    pIdle.clear();
+    return n;
+  }
+
+  //----------------------------------------------------------------------------
+  // The reaper cannot wait for completions anymore: fail the requests the
+  // kernel does not have, ask it to cancel the others and call those back
+  // only once their completions have been reaped, as until then the kernel
+  // may still access their buffers. If the completions cannot be reaped at
+  // all the requests are left outstanding.
+  //----------------------------------------------------------------------------
+  void IoUring::Abort( int err )
+  {
+    Log *log = DefaultEnv::GetLog();
+    log->Error( FileMsg, "io_uring wait failed, not using it anymore: %s",
+                XrdSysE2T( err ) );
+
+    std::vector<Request*> failed;
+    std::vector<Request*> owned;
+    {
+      std::unique_lock<std::mutex> lck( pMutex );
+      pFailed = err;
+      pCV.notify_all();
+      while( pSubmitting )
+        pCV.wait( lck );
+      pSubmitting = true;
+
+      for( auto &entry : pOverflow )
+        failed.push_back( entry.req );
+      pOverflow.clear();
+      TakeSyncs( failed );
+      for( auto req : failed )
+        Untrack( req );
+
+      for( Request *req = pRequests; req; req = req->pNext )
+        owned.push_back( req );
+    }
+    Fail( failed, err );
+
+    std::vector<std::pair<Request*, int>> done;
+    size_t next   = 0;
+    int    errors = 0;
+    while( true )
+    {
+      unsigned toSubmit = 0;
+      {
+        std::lock_guard<std::mutex> lck( pMutex );
+        if( !pRequests ) break;
+
+        //----------------------------------------------------------------------
+        // The key of a cancellation is only looked up by the kernel, it does
+        // not matter if the request has completed meanwhile
+        //----------------------------------------------------------------------
+        while( next < owned.size() &&
+               *pSqTail - __atomic_load_n( pSqHead, __ATOMIC_ACQUIRE ) < pSqEntries )
+          Push( { IORING_OP_ASYNC_CANCEL, 0, -1, 0,
+                  reinterpret_cast<uint64_t>( owned[next++] ), 0, 0 } );
+        toSubmit = pPending;
+      }
+
+      int rc = syscall( __NR_io_uring_enter, pRingFd, toSubmit, 0, 0, 0, 0 );
+      if( rc > 0 )
+      {
+        std::lock_guard<std::mutex> lck( pMutex );
+        pPending -= rc;
+      }
+
+      if( !Complete( done ) )
+      {
+        rc = syscall( __NR_io_uring_enter, pRingFd, 0, 1,
+                      IORING_ENTER_GETEVENTS, 0, 0 );
+        if( rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY )
+        {
+          if( ++errors >= AbortRetries )
+          {
+            std::lock_guard<std::mutex> lck( pMutex );
+            unsigned left = 0;
+            for( Request *req = pRequests; req; req = req->pNext )
+              ++left;
+            log->Error( FileMsg, "io_uring: cannot reap the cancelled "
+                        "requests, leaving %u of them outstanding: %s", left,
+                        XrdSysE2T( errno ) );
+            break;
+          }
+          usleep( AbortPause );
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lck( pMutex );
+    pSubmitting = false;
+    pCV.notify_all();
+  }
+
+  //----------------------------------------------------------------------------
+  // Wait for completions and call back the requests
+  //----------------------------------------------------------------------------
+  void IoUring::Reap()
+  {
+    std::vector<std::pair<Request*, int>> done;
+    done.reserve( pCqEntries );
+
+    while( true )
+    {
+      int rc = syscall( __NR_io_uring_enter, pRingFd, 0, 1,
+                        IORING_ENTER_GETEVENTS, 0, 0 );
+      if( rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY )
+      {
+        //----------------------------------------------------------------------
+        // Without the reaper nothing completes anymore, so get rid of
+        // everything that is outstanding and make further requests use the
+        // fallback
+        //----------------------------------------------------------------------
+        Abort( errno );
+        return;
+      }
+
+      if( !Complete( done ) ) continue;
+
+      //------------------------------------------------------------------------
+      // Queue what the call backs could not and the syncs released
+      //------------------------------------------------------------------------
+      Drain();
+    }
+  }
+
+#else
+
+  IoUring *IoUring::Get()
+  {
+    return 0;
+  }
+
+  int IoUring::Read( int, uint64_t, uint32_t, void*, Request* )
+  {
+    return ENOTSUP;
+  }
+
+  int IoUring::Write( int, uint64_t, uint32_t, const void*, Request* )
+  {
+    return ENOTSUP;
+  }
+
+  int IoUring::Fsync( int, Request* )
+  {
+    return ENOTSUP;
+  }
+
+#endif
+}
@@ -0,0 +1,181 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_IO_URING_HH__
+#define __XRD_CL_IO_URING_HH__
+
+#include <cstdint>
+#include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pthread.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  //! Asynchronous local file I/O on top of a Linux io_uring.
+  //!
+  //! One ring is shared by the whole process. Requests queued by concurrent
+  //! callers are handed to the kernel with a single system call, and a
+  //! dedicated thread reaps the completions in batches and calls back the
+  //! requests. The ring is driven with the raw system calls, liburing is
+  //! not needed.
+  //----------------------------------------------------------------------------
+  class IoUring
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! A request, Done is called from the completion thread
+      //------------------------------------------------------------------------
+      class Request
+      {
+        public:
+          Request() : pPrev( 0 ), pNext( 0 ), pFd( -1 ), pOpcode( 0 ) {}
+          virtual ~Request() {}
+
+          //--------------------------------------------------------------------
+          //! @param result number of bytes transferred or -errno
+          //--------------------------------------------------------------------
+          virtual void Done( int result ) = 0;
+
+        private:
+          friend class IoUring;
+          Request *pPrev;   //!< list of the requests not completed yet
+          Request *pNext;
+          int      pFd;     //!< file and operation of the request
+          uint8_t  pOpcode;
+      };
+
+      //------------------------------------------------------------------------
+      //! Get the process-wide instance
+      //!
+      //! @return the instance or null if io_uring is not enabled (XRD_IOURING=1),
+      //!         not supported by the build or by the kernel
+      //------------------------------------------------------------------------
+      static IoUring *Get();
+
+      //------------------------------------------------------------------------
+      //! Queue a read
+      //!
+      //! @return 0 or errno if the request could not be queued, in which
+      //!         case Done is not called. Once a submission has failed the
+      //!         ring is not used anymore and all further requests fail
+      //------------------------------------------------------------------------
+      int Read( int fd, uint64_t offset, uint32_t size, void *buffer,
+                Request *req );
+
+      //------------------------------------------------------------------------
+      //! Queue a write
+      //------------------------------------------------------------------------
+      int Write( int fd, uint64_t offset, uint32_t size, const void *buffer,
+                 Request *req );
+
+      //------------------------------------------------------------------------
+      //! Queue an fsync, it is handed to the kernel once none of the writes
+      //! queued for the same file is outstanding anymore
+      //------------------------------------------------------------------------
+      int Fsync( int fd, Request *req );
+
+    private:
+      IoUring();
+      ~IoUring();
+      IoUring( const IoUring& ) = delete;
+      IoUring& operator=( const IoUring& ) = delete;
+
+      //------------------------------------------------------------------------
+      //! A submission queue entry
+      //------------------------------------------------------------------------
+      struct Entry
+      {
+        uint8_t   opcode;
+        uint8_t   flags;
+        int       fd;
+        uint64_t  offset;
+        uint64_t  addr;
+        uint32_t  size;
+        Request  *req;
+      };
+
+      //------------------------------------------------------------------------
+      //! Writes outstanding for a file and the syncs waiting for them
+      //------------------------------------------------------------------------
+      struct File
+      {
+        File() : writes( 0 ) {}
+        unsigned           writes;
+        std::vector<Entry> syncs;
+      };
+
+      int  Setup( unsigned entries );
+      int  Submit( const Entry &entry );
+      bool Room();
+      void Push( const Entry &entry );
+      int  Enter( std::unique_lock<std::mutex> &lck,
+                  std::vector<Request*> &failed );
+      void Drain();
+      void Track( const Entry &entry );
+      void Untrack( Request *req );
+      void TakeSyncs( std::vector<Request*> &failed );
+      void Fail( std::vector<Request*> &failed, int err );
+      unsigned Complete( std::vector<std::pair<Request*, int>> &done );
+      void Abort( int err );
+      void Reap();
+
+      static void *RunReaper( void *arg );
+      static void  AfterFork();
+
+      int             pRingFd;
+      void           *pSqRing;
+      size_t          pSqRingSize;
+      void           *pCqRing;
+      size_t          pCqRingSize;
+      io_uring_sqe   *pSqes;
+      size_t          pSqesSize;
+      unsigned       *pSqHead;
+      unsigned       *pSqTail;
+      unsigned        pSqMask;
+      unsigned        pSqEntries;
+      unsigned       *pSqArray;
+      unsigned       *pCqHead;
+      unsigned       *pCqTail;
+      unsigned        pCqMask;
+      io_uring_cqe   *pCqes;
+      unsigned        pCqEntries;
+
+      std::mutex               pMutex;
+      std::condition_variable  pCV;
+      unsigned                 pInFlight;   //!< queued and not reaped yet
+      unsigned                 pPending;    //!< queued and not submitted yet
+      bool                     pSubmitting; //!< a caller is in io_uring_enter
+      int                      pFailed;     //!< errno if the ring is broken
+      Request                 *pRequests;   //!< not completed yet
+      std::deque<Entry>        pOverflow;   //!< resubmitted by the reaper
+      std::unordered_map<int, File> pFiles; //!< files with writes outstanding
+      std::vector<int>         pIdle;       //!< files whose writes are done
+      pthread_t                pReaper;
+  };
+}
+
+#endif // __XRD_CL_IO_URING_HH__
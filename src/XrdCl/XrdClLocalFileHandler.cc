@@ -22,6 +22,7 @@
 #include "XrdCl/XrdClURL.hh"
 #include "XrdCl/XrdClMessageUtils.hh"
 #include "XrdCl/XrdClFileSystem.hh"
+#include "XrdCl/XrdClIoUring.hh"
 #include "XProtocol/XProtocol.hh"
 
 #include "XrdSys/XrdSysE2T.hh"
@@ -126,6 +127,41 @@ namespace
         return cb.get();
       }
 
+      static const char* GetErrMsg( Opcode opcode )
+      {
+        static const char readmsg[]  = "Read:  failed %s";
+        static const char writemsg[] = "Write: failed %s";
+        static const char syncmsg[]  = "Sync:  failed %s";
+
+        switch( opcode )
+        {
+          case Opcode::Read:  return readmsg;
+
+          case Opcode::Write: return writemsg;
+
+          case Opcode::Sync:  return syncmsg;
+
+          default:            return 0;
+        }
+      }
+
+      static void QueueTask( XrdCl::XRootDStatus *status, XrdCl::AnyObject *resp,
+                             XrdCl::HostList *hosts, XrdCl::ResponseHandler *handler )
+      {
+        using namespace XrdCl;
+
+        // if it is simply the sync handler we can release the semaphore
+        // and return there is no need to execute this in the thread-pool
+        if(SyncResponseHandler *syncHandler = dynamic_cast<SyncResponseHandler*>( handler )) {
+          syncHandler->HandleResponse( status, resp );
+        } else if(auto postmaster = DefaultEnv::GetPostMaster()) {
+          if (JobManager *jmngr = postmaster->GetJobManager()) {
+            LocalFileTask *task = new LocalFileTask( status, resp, hosts, handler );
+            jmngr->QueueJob( task );
+          }
+        }
+      }
+
     private:
 
       struct SignalHandlerRegistrator
@@ -174,45 +210,96 @@ namespace
         }
       }
 
-      static const char* GetErrMsg( Opcode opcode )
+      std::unique_ptr<aiocb>  cb;
+      Opcode                  opcode;
+      XrdCl::HostList        *hosts;
+      XrdCl::ResponseHandler *handler;
+  };
+
+  //----------------------------------------------------------------------------
+  // A read, write or sync executed with io_uring, short transfers are
+  // resubmitted until the whole request is done or the end of file is hit
+  //----------------------------------------------------------------------------
+  class UringCtx : public XrdCl::IoUring::Request
+  {
+    public:
+
+      UringCtx( XrdCl::IoUring *ring, const XrdCl::HostList &hostList,
+                XrdCl::ResponseHandler *handler, AioCtx::Opcode opcode, int fd,
+                uint64_t offset, uint32_t size, const void *buffer ) :
+        ring( ring ), hosts( new XrdCl::HostList( hostList ) ), handler( handler ),
+        opcode( opcode ), fd( fd ), offset( offset ), size( size ), done( 0 ),
+        buffer( const_cast<char*>( reinterpret_cast<const char*>( buffer ) ) )
       {
-        static const char readmsg[]  = "Read:  failed %s";
-        static const char writemsg[] = "Write: failed %s";
-        static const char syncmsg[]  = "Sync:  failed %s";
+      }
 
+      int Submit()
+      {
         switch( opcode )
         {
-          case Opcode::Read:  return readmsg;
-
-          case Opcode::Write: return writemsg;
+          case AioCtx::Opcode::Read:
+            return ring->Read( fd, offset + done, size - done, buffer + done, this );
 
-          case Opcode::Sync:  return syncmsg;
+          case AioCtx::Opcode::Write:
+            return ring->Write( fd, offset + done, size - done, buffer + done, this );
 
-          default:            return 0;
+          default:
+            return ring->Fsync( fd, this );
         }
       }
 
-      static void QueueTask( XrdCl::XRootDStatus *status, XrdCl::AnyObject *resp,
-                             XrdCl::HostList *hosts, XrdCl::ResponseHandler *handler )
+      void Done( int result ) override
       {
         using namespace XrdCl;
 
-        // if it is simply the sync handler we can release the semaphore
-        // and return there is no need to execute this in the thread-pool
-        if(SyncResponseHandler *syncHandler = dynamic_cast<SyncResponseHandler*>( handler )) {
-          syncHandler->HandleResponse( status, resp );
-        } else if(auto postmaster = DefaultEnv::GetPostMaster()) {
-          if (JobManager *jmngr = postmaster->GetJobManager()) {
-            LocalFileTask *task = new LocalFileTask( status, resp, hosts, handler );
-            jmngr->QueueJob( task );
+        //----------------------------------------------------------------------
+        // A read returning nothing is the end of file, a write returning
+        // nothing would never finish
+        //----------------------------------------------------------------------
+        if( result == 0 && opcode == AioCtx::Opcode::Write && done < size )
+          result = -EIO;
+
+        if( result > 0 && opcode != AioCtx::Opcode::Sync )
+        {
+          done += result;
+          if( done < size )
+          {
+            result = Submit();
+            if( !result ) return;
+            result = -result;
           }
         }
+
+        std::unique_ptr<UringCtx> me( this );
+        if( result < 0 )
+        {
+          Log *log = DefaultEnv::GetLog();
+          log->Error( FileMsg, AioCtx::GetErrMsg( opcode ), XrdSysE2T( -result ) );
+          XRootDStatus *error = new XRootDStatus( stError, errLocalError, -result );
+          AioCtx::QueueTask( error, 0, hosts, handler );
+          return;
+        }
+
+        AnyObject *resp = 0;
+        if( opcode == AioCtx::Opcode::Read )
+        {
+          resp = new AnyObject();
+          resp->Set( new ChunkInfo( offset, done, buffer ) );
+        }
+        AioCtx::QueueTask( new XRootDStatus(), resp, hosts, handler );
       }
-      
-      std::unique_ptr<aiocb>  cb;
-      Opcode                  opcode;
+
+    private:
+
+      XrdCl::IoUring         *ring;
       XrdCl::HostList        *hosts;
       XrdCl::ResponseHandler *handler;
+      AioCtx::Opcode          opcode;
+      int                     fd;
+      uint64_t                offset;
+      uint32_t                size;
+      uint32_t                done;
+      char                   *buffer;
   };
 
 };
@@ -224,7 +311,7 @@ namespace XrdCl
   // Constructor
   //------------------------------------------------------------------------
   LocalFileHandler::LocalFileHandler() :
-      fd( -1 )
+      fd( -1 ), directfd( -1 )
   {
   }
 
@@ -265,6 +352,12 @@ namespace XrdCl
   XRootDStatus LocalFileHandler::Close( ResponseHandler* handler,
       time_t timeout )
   {
+    if( directfd != -1 )
+    {
+      close( directfd );
+      directfd = -1;
+    }
+
     if( close( fd ) == -1 )
     {
       Log *log = DefaultEnv::GetLog();
@@ -330,8 +423,20 @@ namespace XrdCl
     resp->Set( chunk );
     return QueueTask( new XRootDStatus(), resp, handler );
 #else
+    if( IoUring *ring = IoUring::Get() )
+    {
+      UringCtx *ctx = new UringCtx( ring, pHostList, handler, AioCtx::Opcode::Read,
+                                    IoFd( offset, size, buffer ), offset, size,
+                                    buffer );
+      int rc = ctx->Submit();
+      if( !rc ) return XRootDStatus();
+      delete ctx;
+      Log *log = DefaultEnv::GetLog();
+      log->Debug( FileMsg, "Read: io_uring failed, using AIO: %s", XrdSysE2T( rc ) );
+    }
+
     AioCtx *ctx = new AioCtx( pHostList, handler );
-    ctx->SetRead( fd, offset, size, buffer );
+    ctx->SetRead( IoFd( offset, size, buffer ), offset, size, buffer );
 
     int rc = aio_read( *ctx );
 
@@ -412,8 +517,20 @@ namespace XrdCl
     }
     return QueueTask( new XRootDStatus(), 0, handler );
 #else
+    if( IoUring *ring = IoUring::Get() )
+    {
+      UringCtx *ctx = new UringCtx( ring, pHostList, handler, AioCtx::Opcode::Write,
+                                    IoFd( offset, size, buffer ), offset, size,
+                                    buffer );
+      int rc = ctx->Submit();
+      if( !rc ) return XRootDStatus();
+      delete ctx;
+      Log *log = DefaultEnv::GetLog();
+      log->Debug( FileMsg, "Write: io_uring failed, using AIO: %s", XrdSysE2T( rc ) );
+    }
+
     AioCtx *ctx = new AioCtx( pHostList, handler );
-    ctx->SetWrite( fd, offset, size, buffer );
+    ctx->SetWrite( IoFd( offset, size, buffer ), offset, size, buffer );
 
     int rc = aio_write( *ctx );
 
@@ -446,6 +563,17 @@ namespace XrdCl
     }
     return QueueTask( new XRootDStatus(), 0, handler );
 #else
+    if( IoUring *ring = IoUring::Get() )
+    {
+      UringCtx *ctx = new UringCtx( ring, pHostList, handler, AioCtx::Opcode::Sync,
+                                    fd, 0, 0, 0 );
+      int rc = ctx->Submit();
+      if( !rc ) return XRootDStatus();
+      delete ctx;
+      Log *log = DefaultEnv::GetLog();
+      log->Debug( FileMsg, "Sync: io_uring failed, using AIO: %s", XrdSysE2T( rc ) );
+    }
+
     AioCtx *ctx = new AioCtx( pHostList, handler );
     ctx->SetFsync( fd );
     int rc = aio_fsync( O_SYNC, *ctx );
@@ -812,6 +940,19 @@ namespace XrdCl
     return XRootDStatus();
   }
 
+  //------------------------------------------------------------------------
+  // The O_DIRECT descriptor is used if buffer, offset and size are aligned
+  //------------------------------------------------------------------------
+  int LocalFileHandler::IoFd( uint64_t offset, uint32_t size,
+                              const void *buffer ) const
+  {
+    static const uint64_t align = 4096;
+    if( directfd == -1 || offset % align || size % align ||
+        reinterpret_cast<uintptr_t>( buffer ) % align )
+      return fd;
+    return directfd;
+  }
+
   XRootDStatus LocalFileHandler::OpenImpl( const std::string &url, uint16_t flags,
                                            uint16_t mode, AnyObject *&resp)
   {
@@ -869,6 +1010,22 @@ namespace XrdCl
       return XRootDStatus( stError, errLocalError,
                            XProtocol::mapError( errno ) );
     }
+#if defined(O_DIRECT)
+    //---------------------------------------------------------------------
+    // Open a second descriptor bypassing the page cache if requested, it
+    // is used for the suitably aligned reads and writes
+    //---------------------------------------------------------------------
+    int odirect = DefaultLocalODirect;
+    DefaultEnv::GetEnv()->GetInt( "LocalODirect", odirect );
+    if( odirect )
+    {
+      int directflags = ( openflags & ~( O_CREAT | O_EXCL | O_TRUNC ) ) | O_DIRECT;
+      directfd = XrdSysFD_Open( path.c_str(), directflags );
+      if( directfd == -1 )
+        log->Debug( FileMsg, "Open: O_DIRECT not available for %s: %s",
+                    path.c_str(), XrdSysE2T( errno ) );
+    }
+#endif
     //---------------------------------------------------------------------
     // Stat File and cache statInfo in openInfo
     //---------------------------------------------------------------------
@@ -321,6 +321,11 @@ namespace XrdCl
       XRootDStatus OpenImpl( const std::string &url, uint16_t flags,
                              uint16_t mode, AnyObject *&resp );
 
+      //------------------------------------------------------------------------
+      //! Descriptor to be used for a read or write of the given buffer
+      //------------------------------------------------------------------------
+      int IoFd( uint64_t offset, uint32_t size, const void *buffer ) const;
+
       //------------------------------------------------------------------------
       //! Parses kXR_fattr request and calls respective XAttr operation
       //------------------------------------------------------------------------
@@ -335,6 +340,11 @@ namespace XrdCl
       //---------------------------------------------------------------------
       int fd;
 
+      //---------------------------------------------------------------------
+      // Descriptor opened with O_DIRECT (XRD_LOCALODIRECT), -1 if not used
+      //---------------------------------------------------------------------
+      int directfd;
+
       //---------------------------------------------------------------------
       // The file URL
       //---------------------------------------------------------------------
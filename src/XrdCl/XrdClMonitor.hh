@@ -44,6 +44,7 @@
 #include "XrdCl/XrdClFileSystem.hh"
 
 #include <sys/time.h>
+#include <vector>
 
 namespace XrdCl
 {
@@ -94,6 +95,9 @@ namespace XrdCl
         uint64_t    sBytes;  //!< Number of bytes sent
         time_t      cTime;   //!< Seconds connected to the server
         Status      status;  //!< Disconnection status
+        std::vector<uint64_t> subStreamRBytes; //!< Bytes received per
+                                               //!< sub-stream (0 is the main
+                                               //!< one), empty if only one
       };
 
       //------------------------------------------------------------------------
@@ -206,6 +210,37 @@ namespace XrdCl
         bool         isOK;      //!< True if checksum matched, false otherwise
       };
 
+      //------------------------------------------------------------------------
+      //! Describe the state of the message buffer cache, reported along with
+      //! every server logout
+      //------------------------------------------------------------------------
+      struct BufferCacheInfo
+      {
+        BufferCacheInfo(): allocs(0), hits(0), cached(0) {}
+        uint64_t     allocs;    //!< Buffer allocations of cacheable size
+        uint64_t     hits;      //!< Allocations served from the cache
+        uint64_t     cached;    //!< Bytes of free buffers held by the cache
+      };
+
+      //------------------------------------------------------------------------
+      //! Describe the first use of a channel that has been opened ahead of
+      //! time (XRD_PREWARM)
+      //------------------------------------------------------------------------
+      struct PreWarmInfo
+      {
+        PreWarmInfo(): warmed(0), hits(0)
+        {
+          sTOD.tv_sec = 0; sTOD.tv_usec = 0;
+          eTOD.tv_sec = 0; eTOD.tv_usec = 0;
+        }
+        std::string  server;    //!< "user@host:port"
+        timeval      sTOD;      //!< gettimeofday() when warming started
+        timeval      eTOD;      //!< gettimeofday() when the channel was ready,
+                                //!< zero if it was still being connected
+        uint64_t     warmed;    //!< Channels warmed so far
+        uint64_t     hits;      //!< Warmed channels used so far
+      };
+
       //------------------------------------------------------------------------
       //! Event codes passed to the Event() method. Event code values not
       //! listed here, if encountered, should be ignored.
@@ -219,7 +254,9 @@ namespace XrdCl
         EvClose,          //!< CloseInfo: File closed
         EvErrIO,          //!< ErrorInfo: An I/O error occurred
         EvConnect,        //!< ConnectInfo: Login  into a server
-        EvDisconnect      //!< DisconnectInfo: Logout from a server
+        EvDisconnect,     //!< DisconnectInfo: Logout from a server
+        EvBufferCache,    //!< BufferCacheInfo: Message buffer cache stats
+        EvPreWarm         //!< PreWarmInfo: A pre-warmed channel has been used
 
       };
 
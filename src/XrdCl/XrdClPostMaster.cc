@@ -30,6 +30,7 @@
 #include "XrdCl/XrdClConstants.hh"
 #include "XrdCl/XrdClLog.hh"
 #include "XrdCl/XrdClRedirectorRegistry.hh"
+#include "XrdCl/XrdClPreWarm.hh"
 
 #include "XrdSys/XrdSysPthread.hh"
 
@@ -251,6 +252,7 @@ namespace XrdCl
                                  bool          stateful,
                                  time_t        expires )
   {
+    PreWarmer::Instance().Used( url );
     auto channel = pImpl->GetChannel( url );
 
     if( !channel )
@@ -407,6 +409,15 @@ namespace XrdCl
     return Status();
   }
 
+  //------------------------------------------------------------------------
+  // Check if there is a channel for the given URL
+  //------------------------------------------------------------------------
+  bool PostMaster::HasChannel( const URL &url )
+  {
+    XrdSysMutexHelper scopedLock( pImpl->pChannelMapMutex );
+    return pImpl->pChannelMap.count( url.GetChannelId() );
+  }
+
   //------------------------------------------------------------------------
   // Get the number of connected data streams
   //------------------------------------------------------------------------
@@ -168,6 +168,11 @@ namespace XrdCl
       //------------------------------------------------------------------------
       Status ForceReconnect( const URL &url );
 
+      //------------------------------------------------------------------------
+      //! Check if there is a channel for the given URL (without creating it)
+      //------------------------------------------------------------------------
+      bool HasChannel( const URL &url );
+
       //------------------------------------------------------------------------
       //! Get the number of connected data streams
       //------------------------------------------------------------------------
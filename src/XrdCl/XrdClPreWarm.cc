@@ -0,0 +1,362 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClPreWarm.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XrdCl/XrdClMessageUtils.hh"
+#include "XrdCl/XrdClMonitor.hh"
+#include "XrdCl/XrdClPostMaster.hh"
+#include "XrdCl/XrdClURL.hh"
+#include "XrdCl/XrdClXRootDResponses.hh"
+#include "XrdCl/XrdClXRootDTransport.hh"
+#include "XProtocol/XProtocol.hh"
+
+#include <vector>
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Bound on the bookkeeping, warmed channels nobody used and locates
+  // already done are forgotten beyond that
+  //----------------------------------------------------------------------------
+  const size_t MaxTracked = 4096;
+
+  //----------------------------------------------------------------------------
+  // Seconds a warmed channel is tracked after the ping has been answered, a
+  // first request coming later is not counted as a hit
+  //----------------------------------------------------------------------------
+  const time_t HitWindow = 60;
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Handle the response to the warming ping
+  //----------------------------------------------------------------------------
+  class PreWarmer::PingHandler: public ResponseHandler
+  {
+    public:
+      PingHandler( const std::string &channelId ) : pChannelId( channelId )
+      {
+      }
+
+      virtual void HandleResponse( XRootDStatus *status,
+                                   AnyObject    *response )
+      {
+        PreWarmer::Instance().Warmed( pChannelId, status->IsOK() );
+        delete status;
+        delete response;
+        delete this;
+      }
+
+    private:
+      std::string pChannelId;
+  };
+
+  //----------------------------------------------------------------------------
+  // Handle the response to the background locate. The data servers have
+  // already been offered to Located() when the response was parsed, but
+  // that was while the locate still counted as in flight, so offer them
+  // again (channels already warming are skipped)
+  //----------------------------------------------------------------------------
+  class PreWarmer::LocateHandler: public ResponseHandler
+  {
+    public:
+      LocateHandler( const URL &manager ) : pManager( manager )
+      {
+      }
+
+      virtual void HandleResponse( XRootDStatus *status,
+                                   AnyObject    *response )
+      {
+        PreWarmer &prewarmer = PreWarmer::Instance();
+        prewarmer.Done();
+
+        LocationInfo *info = 0;
+        if( status->IsOK() && response )
+          response->Get( info );
+        if( info )
+          prewarmer.Located( pManager, *info );
+
+        delete status;
+        delete response;
+        delete this;
+      }
+
+    private:
+      URL pManager;
+  };
+
+  //----------------------------------------------------------------------------
+  // Get the instance
+  //----------------------------------------------------------------------------
+  PreWarmer &PreWarmer::Instance()
+  {
+    static PreWarmer prewarmer;
+    return prewarmer;
+  }
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  PreWarmer::PreWarmer(): pEnabled( -1 ), pMax( 0 ), pNextExpiry( 0 ),
+    pInFlight( 0 ), pWarmed( 0 ), pHits( 0 ), pPending( 0 )
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  // Read the configuration on first use
+  //----------------------------------------------------------------------------
+  bool PreWarmer::Enabled()
+  {
+    std::lock_guard<std::mutex> lck( pMutex );
+    if( pEnabled < 0 )
+    {
+      Env *env = DefaultEnv::GetEnv();
+      int enabled = DefaultPreWarm;
+      int max     = DefaultPreWarmMax;
+      env->GetInt( "PreWarm",    enabled );
+      env->GetInt( "PreWarmMax", max );
+      pEnabled = enabled && max > 0 ? 1 : 0;
+      pMax     = max > 0 ? max : 0;
+    }
+    return pEnabled;
+  }
+
+  //----------------------------------------------------------------------------
+  // Warm the data servers from a locate response
+  //----------------------------------------------------------------------------
+  void PreWarmer::Located( const URL &origin, const LocationInfo &locations )
+  {
+    if( !Enabled() ) return;
+
+    for( auto itr = locations.Begin(); itr != locations.End(); ++itr )
+    {
+      if( itr->GetType() != LocationInfo::ServerOnline &&
+          itr->GetType() != LocationInfo::ServerPending )
+        continue;
+
+      URL server( itr->GetAddress() );
+      if( !server.IsValid() ) continue;
+
+      URL url( origin );
+      url.SetHostName( server.GetHostName() );
+      url.SetPort( server.GetPort() );
+      url.SetPath( "" );
+      Warm( url );
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // A manager redirected a request, locate the directory of the path at the
+  // manager to learn which servers the next requests are likely to go to
+  //----------------------------------------------------------------------------
+  void PreWarmer::Redirected( const URL &manager )
+  {
+    if( !Enabled() ) return;
+
+    std::string path = manager.GetPath();
+    size_t slash = path.rfind( '/' );
+    if( slash == std::string::npos || slash == 0 ) return;
+    std::string dir = "*" + path.substr( 0, slash + 1 );
+    if( dir[1] != '/' ) dir.insert( 1, "/" );
+
+    {
+      std::lock_guard<std::mutex> lck( pMutex );
+      if( pInFlight >= pMax ) return;
+      std::string key = manager.GetChannelId() + dir;
+      if( pLocated.count( key ) ) return;
+      if( pLocated.size() >= MaxTracked ) pLocated.clear();
+      pLocated.insert( key );
+      ++pInFlight;
+    }
+
+    Message             *msg;
+    ClientLocateRequest *req;
+    MessageUtils::CreateRequest( msg, req, dir.length() );
+    req->requestid = kXR_locate;
+    req->options   = kXR_prefname | kXR_compress;
+    req->dlen      = dir.length();
+    msg->Append( dir.c_str(), dir.length(), 24 );
+    XRootDTransport::SetDescription( msg );
+
+    MessageSendParams params;
+    MessageUtils::ProcessSendParams( params );
+    URL url( manager );
+    url.SetPath( "" );
+    ResponseHandler *handler = new LocateHandler( url );
+    XRootDStatus st = MessageUtils::SendMessage( url, msg, handler, params, 0 );
+    if( !st.IsOK() )
+    {
+      Done();
+      delete handler;
+      delete msg;
+      return;
+    }
+
+    DefaultEnv::GetLog()->Debug( PostMasterMsg, "[%s] Locating %s to pre-warm "
+                                 "the data servers", url.GetHostId().c_str(),
+                                 dir.c_str() + 1 );
+  }
+
+  //----------------------------------------------------------------------------
+  // Open a channel to the given server unless there is one already
+  //----------------------------------------------------------------------------
+  void PreWarmer::Warm( const URL &url )
+  {
+    PostMaster *postMaster = DefaultEnv::GetPostMaster();
+    if( !postMaster ) return;
+
+    std::string channelId = url.GetChannelId();
+    {
+      std::lock_guard<std::mutex> lck( pMutex );
+      Expire( time( 0 ) );
+      if( pInFlight >= pMax || pChannels.count( channelId ) ) return;
+      if( postMaster->HasChannel( url ) ) return;
+      if( pChannels.size() >= MaxTracked ) return;
+      ++pInFlight;
+    }
+
+    Message           *msg;
+    ClientPingRequest *req;
+    MessageUtils::CreateRequest( msg, req );
+    req->requestid = kXR_ping;
+    XRootDTransport::SetDescription( msg );
+
+    MessageSendParams params;
+    MessageUtils::ProcessSendParams( params );
+    ResponseHandler *handler = new PingHandler( channelId );
+    XRootDStatus st = MessageUtils::SendMessage( url, msg, handler, params, 0 );
+
+    std::lock_guard<std::mutex> lck( pMutex );
+    if( !st.IsOK() )
+    {
+      --pInFlight;
+      delete handler;
+      delete msg;
+      return;
+    }
+
+    //--------------------------------------------------------------------------
+    // From now on a request to this server counts as a hit
+    //--------------------------------------------------------------------------
+    Channel &channel = pChannels[channelId];
+    gettimeofday( &channel.sTOD, 0 );
+    channel.eTOD.tv_sec = 0; channel.eTOD.tv_usec = 0;
+    channel.expires = 0;
+    pPending.store( pChannels.size(), std::memory_order_relaxed );
+    ++pWarmed;
+
+    DefaultEnv::GetLog()->Debug( PostMasterMsg, "[%s] Pre-warming the channel",
+                                 url.GetHostId().c_str() );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the number of pings and locates in flight
+  //----------------------------------------------------------------------------
+  uint32_t PreWarmer::InFlight()
+  {
+    std::lock_guard<std::mutex> lck( pMutex );
+    return pInFlight;
+  }
+
+  //----------------------------------------------------------------------------
+  // A background locate has completed
+  //----------------------------------------------------------------------------
+  void PreWarmer::Done()
+  {
+    std::lock_guard<std::mutex> lck( pMutex );
+    --pInFlight;
+  }
+
+  //----------------------------------------------------------------------------
+  // The warming ping has been answered
+  //----------------------------------------------------------------------------
+  void PreWarmer::Warmed( const std::string &channelId, bool ok )
+  {
+    std::lock_guard<std::mutex> lck( pMutex );
+    --pInFlight;
+    auto itr = pChannels.find( channelId );
+    if( itr == pChannels.end() ) return;
+    if( !ok )
+    {
+      pChannels.erase( itr );
+      pPending.store( pChannels.size(), std::memory_order_relaxed );
+      return;
+    }
+    gettimeofday( &itr->second.eTOD, 0 );
+    itr->second.expires = itr->second.eTOD.tv_sec + HitWindow;
+    if( !pNextExpiry || itr->second.expires < pNextExpiry )
+      pNextExpiry = itr->second.expires;
+  }
+
+  //----------------------------------------------------------------------------
+  // Forget the warmed channels nobody has used within the hit window, so
+  // that requests stop looking them up, must be called with the lock held
+  //----------------------------------------------------------------------------
+  void PreWarmer::Expire( time_t now )
+  {
+    if( !pNextExpiry || now < pNextExpiry ) return;
+
+    pNextExpiry = 0;
+    for( auto itr = pChannels.begin(); itr != pChannels.end(); )
+    {
+      time_t expires = itr->second.expires;
+      if( expires && expires <= now )
+      {
+        itr = pChannels.erase( itr );
+        continue;
+      }
+      if( expires && ( !pNextExpiry || expires < pNextExpiry ) )
+        pNextExpiry = expires;
+      ++itr;
+    }
+    pPending.store( pChannels.size(), std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Check if a request goes to a pre-warmed channel and report it
+  //----------------------------------------------------------------------------
+  void PreWarmer::Hit( const URL &url )
+  {
+    Monitor::PreWarmInfo info;
+    {
+      std::lock_guard<std::mutex> lck( pMutex );
+      Expire( time( 0 ) );
+      if( pChannels.empty() ) return;
+      auto itr = pChannels.find( url.GetChannelId() );
+      if( itr == pChannels.end() ) return;
+      info.sTOD = itr->second.sTOD;
+      info.eTOD = itr->second.eTOD;
+      pChannels.erase( itr );
+      pPending.store( pChannels.size(), std::memory_order_relaxed );
+      info.warmed = pWarmed;
+      info.hits   = ++pHits;
+    }
+    info.server = url.GetHostId();
+
+    DefaultEnv::GetLog()->Debug( PostMasterMsg, "[%s] Using a pre-warmed channel%s",
+                                 info.server.c_str(),
+                                 info.eTOD.tv_sec ? "" : " (still connecting)" );
+
+    Monitor *mon = DefaultEnv::GetMonitor();
+    if( mon )
+      mon->Event( Monitor::EvPreWarm, &info );
+  }
+}
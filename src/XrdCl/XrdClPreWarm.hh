@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_PRE_WARM_HH__
+#define __XRD_CL_PRE_WARM_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <sys/time.h>
+
+namespace XrdCl
+{
+  class URL;
+  class LocationInfo;
+
+  //----------------------------------------------------------------------------
+  //! Opens channels in the background to the servers the client is likely
+  //! to talk to next, so that the first request does not pay for the
+  //! connection, handshake, login and authentication.
+  //!
+  //! The candidates are the data servers returned by a kXR_locate and, when
+  //! a manager redirects a request, the data servers holding the directory
+  //! of the redirected path (found with a background locate at that
+  //! manager). A channel is warmed with a kXR_ping and then simply stays in
+  //! the PostMaster pool. The first request that uses a warmed channel while
+  //! it is warming or shortly after is reported to the monitor as a pre-warm
+  //! hit, after that the channel is not tracked anymore.
+  //!
+  //! Enabled with XRD_PREWARM, XRD_PREWARMMAX limits the number of channels
+  //! being warmed and background locates running at the same time.
+  //----------------------------------------------------------------------------
+  class PreWarmer
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Get the instance
+      //------------------------------------------------------------------------
+      static PreWarmer &Instance();
+
+      //------------------------------------------------------------------------
+      //! Warm the data servers from a locate response
+      //!
+      //! @param origin    the server that answered the locate, its protocol,
+      //!                  user name and credentials are used for the new
+      //!                  channels
+      //! @param locations the response
+      //------------------------------------------------------------------------
+      void Located( const URL &origin, const LocationInfo &locations );
+
+      //------------------------------------------------------------------------
+      //! A manager redirected an open of the file at the given URL
+      //------------------------------------------------------------------------
+      void Redirected( const URL &manager );
+
+      //------------------------------------------------------------------------
+      //! A request is about to be sent to the given URL
+      //------------------------------------------------------------------------
+      void Used( const URL &url )
+      {
+        if( pPending.load( std::memory_order_relaxed ) )
+          Hit( url );
+      }
+
+      //------------------------------------------------------------------------
+      //! Get the number of warming pings and background locates in flight
+      //------------------------------------------------------------------------
+      uint32_t InFlight();
+
+    private:
+      PreWarmer();
+      PreWarmer( const PreWarmer& ) = delete;
+      PreWarmer& operator=( const PreWarmer& ) = delete;
+
+      struct Channel
+      {
+        timeval sTOD;    //!< warming started
+        timeval eTOD;    //!< warming finished, zero if still in progress
+        time_t  expires; //!< not tracked anymore, zero if still in progress
+      };
+
+      class PingHandler;
+      friend class PingHandler;
+      class LocateHandler;
+      friend class LocateHandler;
+
+      bool Enabled();
+      void Warm( const URL &url );
+      void Hit( const URL &url );
+      void Warmed( const std::string &channelId, bool ok );
+      void Expire( time_t now );
+      void Done();
+
+      int                                        pEnabled;
+      uint32_t                                   pMax;
+      std::mutex                                 pMutex;
+      std::unordered_map<std::string, Channel>   pChannels; //!< warmed, unused
+      std::unordered_set<std::string>            pLocated;  //!< manager + dir
+      time_t                                     pNextExpiry; //!< 0 if none
+      uint32_t                                   pInFlight;
+      uint64_t                                   pWarmed;
+      uint64_t                                   pHits;
+      std::atomic<size_t>                        pPending;
+  };
+}
+
+#endif // __XRD_CL_PRE_WARM_HH__
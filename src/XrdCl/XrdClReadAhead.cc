@@ -0,0 +1,434 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClReadAhead.hh"
+#include "XrdCl/XrdClFileStateHandler.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClPostMaster.hh"
+#include "XrdCl/XrdClResponseJob.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClLog.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sys/time.h>
+
+namespace
+{
+  //----------------------------------------------------------------------------
+  // Seconds elapsed between two time stamps
+  //----------------------------------------------------------------------------
+  inline double Elapsed( const timeval &from, const timeval &to )
+  {
+    return ( to.tv_sec - from.tv_sec ) + ( to.tv_usec - from.tv_usec ) / 1e6;
+  }
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Handler of a readahead request
+  //----------------------------------------------------------------------------
+  class ReadAhead::BlockHandler : public ResponseHandler
+  {
+    public:
+      BlockHandler( std::shared_ptr<ReadAhead> readAhead, BlockPtr block ):
+        pReadAhead( readAhead ), pBlock( block )
+      {
+      }
+
+      void HandleResponse( XRootDStatus *status, AnyObject *response )
+      {
+        pReadAhead->BlockDone( pBlock, status, response );
+        delete this;
+      }
+
+    private:
+      std::shared_ptr<ReadAhead> pReadAhead;
+      BlockPtr                   pBlock;
+  };
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  ReadAhead::ReadAhead( std::weak_ptr<FileStateHandler> file,
+                        const URL                      &dataServer,
+                        uint32_t                        blockSize,
+                        uint64_t                        maxWindow ):
+    pFile( file ),
+    pDataServer( dataServer ),
+    pBlockSize( blockSize ),
+    pMaxWindow( std::max<uint64_t>( maxWindow, 2 * (uint64_t)blockSize ) ),
+    pWindow( 2 * (uint64_t)blockSize ),
+    pNextOffset( 0 ),
+    pIssued( 0 ),
+    pEof( std::numeric_limits<uint64_t>::max() ),
+    pSeqCount( 0 ),
+    pInFlight( 0 ),
+    pStopped( false ),
+    pBandwidth( 0 ),
+    pMinRtt( 0 ),
+    pRttWinMin( 0 ),
+    pRttSamples( 0 )
+  {
+    pLastDone.tv_sec  = 0;
+    pLastDone.tv_usec = 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Account for a read and serve it from the window if possible
+  //----------------------------------------------------------------------------
+  bool ReadAhead::Read( uint64_t         offset,
+                        uint32_t         size,
+                        void            *buffer,
+                        ResponseHandler *handler,
+                        time_t           timeout )
+  {
+    XrdSysMutexHelper scopedLock( pMutex );
+    if( pStopped ) return false;
+
+    //--------------------------------------------------------------------------
+    // Detect sequential access, the window is started by the second read
+    // following the previous one (the first read at offset 0 counts)
+    //--------------------------------------------------------------------------
+    bool sequential = ( offset == pNextOffset );
+    pNextOffset = offset + size;
+    if( !sequential )
+    {
+      pSeqCount = 0;
+      Reset();
+      return false;
+    }
+    if( ++pSeqCount < 2 || size == 0 || size >= pMaxWindow )
+      return false;
+
+    //--------------------------------------------------------------------------
+    // Forget what is behind us
+    //--------------------------------------------------------------------------
+    while( !pBlocks.empty() &&
+           pBlocks.begin()->second->offset + pBlocks.begin()->second->size <= offset )
+      pBlocks.erase( pBlocks.begin() );
+
+    uint64_t end = offset + size;
+    std::vector<BlockPtr> toSend;
+
+    //--------------------------------------------------------------------------
+    // If the read is not covered by the window, send it as usual and restart
+    // the window right after it
+    //--------------------------------------------------------------------------
+    if( pBlocks.empty() || pBlocks.begin()->second->offset > offset )
+    {
+      Reset();
+      pIssued = end;
+      TopUp( end, timeout, toSend );
+      scopedLock.UnLock();
+      Send( toSend, timeout );
+      return false;
+    }
+
+    TopUp( end, timeout, toSend );
+
+    Request req;
+    req.offset  = offset;
+    req.size    = size;
+    req.buffer  = buffer;
+    req.handler = handler;
+    req.timeout = timeout;
+    for( auto itr = pBlocks.begin(); itr != pBlocks.end() && itr->first < end; ++itr )
+      req.blocks.push_back( itr->second );
+
+    bool failed = false;
+    if( IsReady( req, failed ) && !failed )
+    {
+      //------------------------------------------------------------------------
+      // Don't call the handler from the caller's context
+      //------------------------------------------------------------------------
+      AnyObject *response = Serve( req );
+      DefaultEnv::GetPostMaster()->GetJobManager()->QueueJob(
+          new ResponseJob( handler, new XRootDStatus(), response,
+                           new HostList( 1, HostInfo( pDataServer ) ) ) );
+    }
+    else
+      pWaiting.push_back( std::move( req ) );
+
+    scopedLock.UnLock();
+    Send( toSend, timeout );
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Stop reading ahead and release the buffers
+  //----------------------------------------------------------------------------
+  bool ReadAhead::Stop( std::function<void()> whenIdle )
+  {
+    XrdSysMutexHelper scopedLock( pMutex );
+    pStopped = true;
+    pBlocks.clear();
+    if( pInFlight == 0 ) return false;
+    pWhenIdle = std::move( whenIdle );
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Drop the window, the blocks waited for are kept by the requests
+  //----------------------------------------------------------------------------
+  void ReadAhead::Reset()
+  {
+    pBlocks.clear();
+    pIssued = 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Create the blocks needed to cover the window after end
+  //----------------------------------------------------------------------------
+  void ReadAhead::TopUp( uint64_t end, time_t timeout, std::vector<BlockPtr> &toSend )
+  {
+    uint64_t limit = std::min( end + pWindow, pEof );
+    while( pIssued < limit )
+    {
+      BlockPtr block = std::make_shared<Block>( pIssued, pBlockSize );
+      pBlocks[pIssued] = block;
+      pIssued += pBlockSize;
+      toSend.push_back( block );
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Send the readahead requests
+  //----------------------------------------------------------------------------
+  void ReadAhead::Send( std::vector<BlockPtr> &blocks, time_t timeout )
+  {
+    if( blocks.empty() ) return;
+    std::shared_ptr<FileStateHandler> file = pFile.lock();
+
+    for( BlockPtr &block : blocks )
+    {
+      {
+        XrdSysMutexHelper scopedLock( pMutex );
+        gettimeofday( &block->issued, 0 );
+        ++pInFlight;
+      }
+
+      XRootDStatus st( stError, errInvalidOp );
+      BlockHandler *handler = new BlockHandler( shared_from_this(), block );
+      if( file )
+        st = FileStateHandler::ReadImpl( file, block->offset, block->size,
+                                         block->buffer.get(), handler, timeout );
+      if( !st.IsOK() )
+      {
+        delete handler;
+        BlockDone( block, new XRootDStatus( st ), 0 );
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Check if all the blocks a request needs came back
+  //----------------------------------------------------------------------------
+  bool ReadAhead::IsReady( const Request &req, bool &failed ) const
+  {
+    for( const BlockPtr &block : req.blocks )
+    {
+      if( block->state == Block::Failed )
+      {
+        failed = true;
+        return true;
+      }
+      if( block->state == Block::InFlight )
+        return false;
+      if( block->length < block->size )
+        break;
+    }
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Copy the data of a request from the blocks
+  //----------------------------------------------------------------------------
+  AnyObject *ReadAhead::Serve( const Request &req ) const
+  {
+    uint64_t pos = req.offset;
+    uint64_t end = req.offset + req.size;
+    char    *out = reinterpret_cast<char*>( req.buffer );
+
+    for( const BlockPtr &block : req.blocks )
+    {
+      if( pos >= end ) break;
+      uint64_t blkEnd = block->offset + block->length;
+      if( pos < blkEnd )
+      {
+        uint64_t len = std::min( end, blkEnd ) - pos;
+        memcpy( out, block->buffer.get() + ( pos - block->offset ), len );
+        out += len;
+        pos += len;
+      }
+      if( block->length < block->size )
+        break;
+    }
+
+    AnyObject *response = new AnyObject();
+    response->Set( new ChunkInfo( req.offset, pos - req.offset, req.buffer ) );
+    return response;
+  }
+
+  //----------------------------------------------------------------------------
+  // Handle the response to a readahead request
+  //----------------------------------------------------------------------------
+  void ReadAhead::BlockDone( BlockPtr block, XRootDStatus *status, AnyObject *response )
+  {
+    std::list<Request>                              failed;
+    std::vector<std::pair<Request, AnyObject*>>     ready;
+    std::function<void()>                           whenIdle;
+
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      --pInFlight;
+
+      ChunkInfo *chunk = 0;
+      if( status->IsOK() && response )
+        response->Get( chunk );
+      if( chunk )
+      {
+        block->length = chunk->length;
+        block->state  = Block::Done;
+        if( block->length < block->size )
+          pEof = std::min( pEof, block->offset + block->length );
+
+        timeval now;
+        gettimeofday( &now, 0 );
+        UpdateWindow( *block, now );
+      }
+      else
+      {
+        block->state = Block::Failed;
+        auto itr = pBlocks.find( block->offset );
+        if( itr != pBlocks.end() && itr->second == block )
+        {
+          //--------------------------------------------------------------------
+          // Restart the window on the next read
+          //--------------------------------------------------------------------
+          pBlocks.erase( itr, pBlocks.end() );
+          pIssued = block->offset;
+        }
+      }
+
+      for( auto itr = pWaiting.begin(); itr != pWaiting.end(); )
+      {
+        bool isFailed = false;
+        if( !IsReady( *itr, isFailed ) )
+        {
+          ++itr;
+          continue;
+        }
+        if( isFailed )
+          failed.splice( failed.end(), pWaiting, itr++ );
+        else
+        {
+          ready.emplace_back( std::move( *itr ), Serve( *itr ) );
+          itr = pWaiting.erase( itr );
+        }
+      }
+
+      if( pStopped && pInFlight == 0 )
+        whenIdle.swap( pWhenIdle );
+    }
+
+    delete status;
+    delete response;
+
+    for( auto &r : ready )
+      r.first.handler->HandleResponseWithHosts( new XRootDStatus(), r.second,
+                            new HostList( 1, HostInfo( pDataServer ) ) );
+
+    for( Request &req : failed )
+      Fallback( req );
+
+    if( whenIdle )
+      whenIdle();
+  }
+
+  //----------------------------------------------------------------------------
+  // Send a request the window failed to serve as usual
+  //----------------------------------------------------------------------------
+  void ReadAhead::Fallback( Request &req )
+  {
+    Log *log = DefaultEnv::GetLog();
+    log->Debug( FileMsg, "[%p] Readahead failed, reading %u bytes at offset "
+                "%llu directly", (void*)this, req.size,
+                (unsigned long long)req.offset );
+
+    XRootDStatus st( stError, errInvalidOp );
+    std::shared_ptr<FileStateHandler> file = pFile.lock();
+    if( file )
+      st = FileStateHandler::ReadImpl( file, req.offset, req.size, req.buffer,
+                                       req.handler, req.timeout );
+    if( !st.IsOK() )
+      req.handler->HandleResponseWithHosts( new XRootDStatus( st ), 0, 0 );
+  }
+
+  //----------------------------------------------------------------------------
+  // Update the bandwidth and round trip estimates and resize the window to
+  // twice their product
+  //----------------------------------------------------------------------------
+  void ReadAhead::UpdateWindow( const Block &block, const timeval &now )
+  {
+    double rtt = Elapsed( block.issued, now );
+
+    //--------------------------------------------------------------------------
+    // The time the block occupied the link: from when it was sent or when
+    // the previous response was received, whichever came later
+    //--------------------------------------------------------------------------
+    const timeval &start = Elapsed( block.issued, pLastDone ) > 0 ? pLastDone : block.issued;
+    double busy = Elapsed( start, now );
+    pLastDone = now;
+    if( busy > 0 && block.length > 0 )
+    {
+      double bw  = block.length / busy;
+      pBandwidth = pBandwidth > 0 ? pBandwidth * 7 / 8 + bw / 8 : bw;
+    }
+
+    //--------------------------------------------------------------------------
+    // Queueing only ever adds to the round trip, so use the minimum over the
+    // last 32 samples
+    //--------------------------------------------------------------------------
+    if( pRttSamples == 0 || rtt < pRttWinMin ) pRttWinMin = rtt;
+    if( pMinRtt == 0 || rtt < pMinRtt ) pMinRtt = rtt;
+    if( ++pRttSamples == 32 )
+    {
+      pMinRtt     = pRttWinMin;
+      pRttSamples = 0;
+    }
+
+    pWindow = WindowSize( pBandwidth, pMinRtt, pBlockSize, pMaxWindow );
+  }
+
+  //----------------------------------------------------------------------------
+  // Window size for the given bandwidth and round trip
+  //----------------------------------------------------------------------------
+  uint64_t ReadAhead::WindowSize( double   bandwidth,
+                                  double   rtt,
+                                  uint32_t blockSize,
+                                  uint64_t maxWindow )
+  {
+    uint64_t minWindow = 2 * (uint64_t)blockSize;
+    double   bdp       = 2 * bandwidth * rtt;
+    if( bdp >= maxWindow ) return std::max( maxWindow, minWindow );
+    uint64_t window = ( (uint64_t)bdp + blockSize - 1 ) / blockSize * blockSize;
+    return std::min( std::max( window, minWindow ), std::max( maxWindow, minWindow ) );
+  }
+}
@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_READ_AHEAD_HH__
+#define __XRD_CL_READ_AHEAD_HH__
+
+#include "XrdCl/XrdClURL.hh"
+#include "XrdCl/XrdClXRootDResponses.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace XrdCl
+{
+  class FileStateHandler;
+
+  //----------------------------------------------------------------------------
+  //! Readahead window of a file opened for reading.
+  //!
+  //! Once sequential access is detected a window of reads ahead of the
+  //! current position is kept in flight and the subsequent reads are served
+  //! from the buffers as they come back. A read that is not covered by the
+  //! window is sent as usual (directly to the user buffer) and the window is
+  //! restarted after it. The window size follows the bandwidth-delay product
+  //! estimated from the readahead responses, within [2 blocks, max window].
+  //----------------------------------------------------------------------------
+  class ReadAhead : public std::enable_shared_from_this<ReadAhead>
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Constructor
+      //!
+      //! @param file       the file the reads are sent for
+      //! @param dataServer the data server, reported in the host list
+      //! @param blockSize  size of a single readahead request
+      //! @param maxWindow  upper limit for the bytes read ahead
+      //------------------------------------------------------------------------
+      ReadAhead( std::weak_ptr<FileStateHandler> file,
+                 const URL                      &dataServer,
+                 uint32_t                        blockSize,
+                 uint64_t                        maxWindow );
+
+      //------------------------------------------------------------------------
+      //! Account for a read and serve it from the window if possible
+      //!
+      //! @return true if the handler will be called with the response,
+      //!         false if the read has to be sent as usual
+      //------------------------------------------------------------------------
+      bool Read( uint64_t         offset,
+                 uint32_t         size,
+                 void            *buffer,
+                 ResponseHandler *handler,
+                 time_t           timeout );
+
+      //------------------------------------------------------------------------
+      //! Stop reading ahead and release the buffers
+      //!
+      //! @param whenIdle called once the readahead requests in flight came
+      //!                 back, if there are any
+      //! @return         true if whenIdle will be called, false if there is
+      //!                 nothing in flight
+      //------------------------------------------------------------------------
+      bool Stop( std::function<void()> whenIdle );
+
+      //------------------------------------------------------------------------
+      //! Window size for the given bandwidth and round trip: twice their
+      //! product rounded up to whole blocks, within [2 blocks, maxWindow]
+      //!
+      //! @param bandwidth bytes per second
+      //! @param rtt       round trip in seconds
+      //------------------------------------------------------------------------
+      static uint64_t WindowSize( double   bandwidth,
+                                  double   rtt,
+                                  uint32_t blockSize,
+                                  uint64_t maxWindow );
+
+    private:
+      class BlockHandler;
+
+      struct Block
+      {
+        enum State { InFlight, Done, Failed };
+
+        Block( uint64_t offset, uint32_t size ):
+          offset( offset ), size( size ), length( 0 ), state( InFlight ),
+          buffer( new char[size] ) { }
+
+        uint64_t                offset;
+        uint32_t                size;
+        uint32_t                length;
+        State                   state;
+        std::unique_ptr<char[]> buffer;
+        timeval                 issued;
+      };
+
+      typedef std::shared_ptr<Block> BlockPtr;
+
+      struct Request
+      {
+        uint64_t              offset;
+        uint32_t              size;
+        void                 *buffer;
+        ResponseHandler      *handler;
+        time_t                timeout;
+        std::vector<BlockPtr> blocks;
+      };
+
+      //------------------------------------------------------------------------
+      // Helpers, called with the mutex held unless stated otherwise
+      //------------------------------------------------------------------------
+      void Reset();
+      void TopUp( uint64_t end, time_t timeout, std::vector<BlockPtr> &toSend );
+      bool IsReady( const Request &req, bool &failed ) const;
+      AnyObject *Serve( const Request &req ) const;
+      void BlockDone( BlockPtr block, XRootDStatus *status, AnyObject *response );
+      void UpdateWindow( const Block &block, const timeval &now );
+
+      //------------------------------------------------------------------------
+      // Called without the mutex held
+      //------------------------------------------------------------------------
+      void Send( std::vector<BlockPtr> &blocks, time_t timeout );
+      void Fallback( Request &req );
+
+      std::weak_ptr<FileStateHandler>  pFile;
+      URL                              pDataServer;
+      uint32_t                         pBlockSize;
+      uint64_t                         pMaxWindow;
+      uint64_t                         pWindow;
+
+      XrdSysMutex                      pMutex;
+      std::map<uint64_t, BlockPtr>     pBlocks;
+      std::list<Request>               pWaiting;
+      uint64_t                         pNextOffset;
+      uint64_t                         pIssued;
+      uint64_t                         pEof;
+      int                              pSeqCount;
+      int                              pInFlight;
+      bool                             pStopped;
+      std::function<void()>            pWhenIdle;
+
+      //------------------------------------------------------------------------
+      // Bandwidth and round trip estimates
+      //------------------------------------------------------------------------
+      double                           pBandwidth;
+      double                           pMinRtt;
+      double                           pRttWinMin;
+      int                              pRttSamples;
+      timeval                          pLastDone;
+  };
+}
+
+#endif // __XRD_CL_READ_AHEAD_HH__
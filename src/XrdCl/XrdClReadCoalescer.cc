@@ -0,0 +1,288 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClReadCoalescer.hh"
+#include "XrdCl/XrdClFileStateHandler.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClPostMaster.hh"
+#include "XrdCl/XrdClResponseJob.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XProtocol/XProtocol.hh"
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Handler of a read sent on its own
+  //----------------------------------------------------------------------------
+  class ReadCoalescer::SingleHandler : public ResponseHandler
+  {
+    public:
+      SingleHandler( std::shared_ptr<ReadCoalescer> coalescer,
+                     ResponseHandler               *userHandler ):
+        pCoalescer( coalescer ), pUserHandler( userHandler )
+      {
+      }
+
+      void HandleResponseWithHosts( XRootDStatus *status,
+                                    AnyObject    *response,
+                                    HostList     *hostList )
+      {
+        pUserHandler->HandleResponseWithHosts( status, response, hostList );
+        pCoalescer->Done();
+        delete this;
+      }
+
+    private:
+      std::shared_ptr<ReadCoalescer>  pCoalescer;
+      ResponseHandler                *pUserHandler;
+  };
+
+  //----------------------------------------------------------------------------
+  // Handler of a vector read, scatters the response to the callers
+  //----------------------------------------------------------------------------
+  class ReadCoalescer::BatchHandler : public ResponseHandler
+  {
+    public:
+      BatchHandler( std::shared_ptr<ReadCoalescer> coalescer, Batch &batch ):
+        pCoalescer( coalescer )
+      {
+        pBatch.swap( batch );
+      }
+
+      void HandleResponseWithHosts( XRootDStatus *status,
+                                    AnyObject    *response,
+                                    HostList     *hostList )
+      {
+        VectorReadInfo *info = 0;
+        if( status->IsOK() && response )
+          response->Get( info );
+
+        if( !info || info->GetChunks().size() != pBatch.size() )
+        {
+          Log *log = DefaultEnv::GetLog();
+          log->Debug( FileMsg, "[%p] Vector read of %zu coalesced reads failed "
+                      "(%s), resending them one by one", (void*)pCoalescer.get(),
+                      pBatch.size(), status->ToStr().c_str() );
+          pCoalescer->SendOneByOne( pBatch );
+        }
+        else
+        {
+          ChunkList &chunks = info->GetChunks();
+          for( size_t i = 0; i < pBatch.size(); ++i )
+          {
+            AnyObject *obj = new AnyObject();
+            obj->Set( new ChunkInfo( pBatch[i].offset, chunks[i].length,
+                                     pBatch[i].buffer ) );
+            pBatch[i].handler->HandleResponseWithHosts( new XRootDStatus(), obj,
+                                 hostList ? new HostList( *hostList ) : 0 );
+          }
+        }
+
+        //----------------------------------------------------------------------
+        // Only now, so that the reads resent one by one are already counted
+        //----------------------------------------------------------------------
+        pCoalescer->Done();
+
+        delete status;
+        delete response;
+        delete hostList;
+        delete this;
+      }
+
+    private:
+      std::shared_ptr<ReadCoalescer> pCoalescer;
+      Batch                          pBatch;
+  };
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  ReadCoalescer::ReadCoalescer( std::weak_ptr<FileStateHandler> file,
+                                uint32_t                        maxInFlight,
+                                uint32_t                        maxSize ):
+    pFile( file ),
+    pMaxInFlight( maxInFlight ),
+    pMaxSize( std::min<uint32_t>( maxSize, XrdProto::maxRVdsz ) ),
+    pInFlight( 0 ),
+    pStopped( false )
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  // Take over a read
+  //----------------------------------------------------------------------------
+  bool ReadCoalescer::Read( uint64_t         offset,
+                            uint32_t         size,
+                            void            *buffer,
+                            ResponseHandler *handler,
+                            time_t           timeout )
+  {
+    if( size == 0 || size > pMaxSize || !buffer )
+      return false;
+
+    PendingRead read = { offset, size, buffer, handler, timeout };
+    Batch       batch;
+
+    XrdSysMutexHelper scopedLock( pMutex );
+    if( pStopped ) return false;
+    if( pInFlight < pMaxInFlight )
+    {
+      ++pInFlight;
+      batch.push_back( read );
+    }
+    else
+    {
+      pPending.push_back( read );
+      if( pPending.size() < (size_t)XrdProto::maxRvecsz )
+        return true;
+      ++pInFlight;
+      batch.swap( pPending );
+    }
+    scopedLock.UnLock();
+
+    Send( batch );
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Stop coalescing
+  //----------------------------------------------------------------------------
+  bool ReadCoalescer::Stop( std::function<void()> whenIdle )
+  {
+    Batch batch;
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      pStopped = true;
+      if( !pPending.empty() )
+      {
+        ++pInFlight;
+        batch.swap( pPending );
+      }
+      if( pInFlight == 0 ) return false;
+      pWhenIdle = std::move( whenIdle );
+    }
+    if( !batch.empty() )
+      Send( batch );
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // A request came back, send what has been held back meanwhile
+  //----------------------------------------------------------------------------
+  void ReadCoalescer::Done()
+  {
+    Batch                 batch;
+    std::function<void()> whenIdle;
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      --pInFlight;
+      if( pStopped && pInFlight == 0 )
+        whenIdle.swap( pWhenIdle );
+      else if( !pPending.empty() && pInFlight < pMaxInFlight )
+      {
+        ++pInFlight;
+        batch.swap( pPending );
+      }
+    }
+    if( !batch.empty() )
+      Send( batch );
+    if( whenIdle )
+      whenIdle();
+  }
+
+  //----------------------------------------------------------------------------
+  // Send a batch, as a plain read if there is only one
+  //----------------------------------------------------------------------------
+  void ReadCoalescer::Send( Batch &batch )
+  {
+    std::shared_ptr<FileStateHandler> file = pFile.lock();
+    XRootDStatus st( stError, errInvalidOp );
+
+    if( batch.size() == 1 )
+    {
+      PendingRead    &read    = batch.front();
+      SingleHandler  *handler = new SingleHandler( shared_from_this(), read.handler );
+      if( file )
+        st = FileStateHandler::ReadImpl( file, read.offset, read.size,
+                                         read.buffer, handler, read.timeout );
+      if( !st.IsOK() )
+      {
+        delete handler;
+        Done();
+        Fail( read.handler, st );
+      }
+      return;
+    }
+
+    ChunkList chunks;
+    chunks.reserve( batch.size() );
+    for( PendingRead &read : batch )
+      chunks.push_back( ChunkInfo( read.offset, read.size, read.buffer ) );
+    time_t timeout = batch.front().timeout;
+
+    Log *log = DefaultEnv::GetLog();
+    log->Dump( FileMsg, "[%p] Sending %zu coalesced reads as a vector read",
+               (void*)this, batch.size() );
+
+    BatchHandler *handler = new BatchHandler( shared_from_this(), batch );
+    if( file )
+      st = FileStateHandler::VectorRead( file, chunks, 0, handler, timeout );
+    if( !st.IsOK() )
+    {
+      //------------------------------------------------------------------------
+      // The batch is now owned by the handler, take it back
+      //------------------------------------------------------------------------
+      handler->HandleResponseWithHosts( new XRootDStatus( st ), 0, 0 );
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Resend the reads of a failed vector read individually
+  //----------------------------------------------------------------------------
+  void ReadCoalescer::SendOneByOne( Batch &batch )
+  {
+    std::shared_ptr<FileStateHandler> file = pFile.lock();
+    {
+      XrdSysMutexHelper scopedLock( pMutex );
+      pInFlight += batch.size();
+    }
+    for( PendingRead &read : batch )
+    {
+      XRootDStatus   st( stError, errInvalidOp );
+      SingleHandler *handler = new SingleHandler( shared_from_this(), read.handler );
+      if( file )
+        st = FileStateHandler::ReadImpl( file, read.offset, read.size,
+                                         read.buffer, handler, read.timeout );
+      if( !st.IsOK() )
+      {
+        delete handler;
+        Done();
+        Fail( read.handler, st );
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Report a failure, not from the caller's context
+  //----------------------------------------------------------------------------
+  void ReadCoalescer::Fail( ResponseHandler *handler, const XRootDStatus &status )
+  {
+    DefaultEnv::GetPostMaster()->GetJobManager()->QueueJob(
+        new ResponseJob( handler, new XRootDStatus( status ), 0, 0 ) );
+  }
+}
@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_READ_COALESCER_HH__
+#define __XRD_CL_READ_COALESCER_HH__
+
+#include "XrdCl/XrdClXRootDResponses.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace XrdCl
+{
+  class FileStateHandler;
+
+  //----------------------------------------------------------------------------
+  //! Merges small concurrent reads of a file into vector reads.
+  //!
+  //! Up to maxInFlight requests are sent as they come. Reads issued while
+  //! that many are outstanding are held and sent as a single kXR_readv as
+  //! soon as one of them comes back, or once a full vector is collected.
+  //! The data is read straight into the callers' buffers and each caller
+  //! gets its own response. If a vector read fails (e.g. because one of
+  //! the reads is past the end of file) its reads are resent one by one.
+  //----------------------------------------------------------------------------
+  class ReadCoalescer : public std::enable_shared_from_this<ReadCoalescer>
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Constructor
+      //!
+      //! @param file        the file the reads are sent for
+      //! @param maxInFlight number of requests outstanding before reads are
+      //!                    held back
+      //! @param maxSize     reads larger than that are not coalesced
+      //------------------------------------------------------------------------
+      ReadCoalescer( std::weak_ptr<FileStateHandler> file,
+                     uint32_t                        maxInFlight,
+                     uint32_t                        maxSize );
+
+      //------------------------------------------------------------------------
+      //! Take over a read
+      //!
+      //! @return true if the handler will be called with the response,
+      //!         false if the read has to be sent as usual
+      //------------------------------------------------------------------------
+      bool Read( uint64_t         offset,
+                 uint32_t         size,
+                 void            *buffer,
+                 ResponseHandler *handler,
+                 time_t           timeout );
+
+      //------------------------------------------------------------------------
+      //! Stop coalescing, the reads held back are sent right away
+      //!
+      //! @param whenIdle called once the requests in flight came back, if
+      //!                 there are any
+      //! @return         true if whenIdle will be called, false if there is
+      //!                 nothing in flight
+      //------------------------------------------------------------------------
+      bool Stop( std::function<void()> whenIdle );
+
+    private:
+      class SingleHandler;
+      class BatchHandler;
+
+      struct PendingRead
+      {
+        uint64_t         offset;
+        uint32_t         size;
+        void            *buffer;
+        ResponseHandler *handler;
+        time_t           timeout;
+      };
+
+      typedef std::vector<PendingRead> Batch;
+
+      //------------------------------------------------------------------------
+      // Called without the mutex held
+      //------------------------------------------------------------------------
+      void Send( Batch &batch );
+      void Done();
+      static void Fail( ResponseHandler *handler, const XRootDStatus &status );
+      void SendOneByOne( Batch &batch );
+
+      std::weak_ptr<FileStateHandler>  pFile;
+      uint32_t                         pMaxInFlight;
+      uint32_t                         pMaxSize;
+
+      XrdSysMutex                      pMutex;
+      uint32_t                         pInFlight;
+      Batch                            pPending;
+      bool                             pStopped;
+      std::function<void()>            pWhenIdle;
+  };
+}
+
+#endif // __XRD_CL_READ_COALESCER_HH__
@@ -0,0 +1,403 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#include "XrdCl/XrdClRequestStats.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClTaskManager.hh"
+#include "XrdCl/XrdClLog.hh"
+#include "XProtocol/XProtocol.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+namespace
+{
+  using namespace XrdCl;
+
+  const uint32_t NbRequests   = kXR_REQFENCE - kXR_auth;
+  const uint32_t NbSubStreams = 16;
+
+  //----------------------------------------------------------------------------
+  // Histogram updated concurrently
+  //----------------------------------------------------------------------------
+  struct AtomicHistogram
+  {
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> stalls;
+    std::atomic<uint64_t> stallTime;
+    std::atomic<uint64_t> bytesOut;
+    std::atomic<uint64_t> bytesIn;
+    std::atomic<uint64_t> latency;
+    std::atomic<uint64_t> buckets[RequestStats::NbBuckets];
+
+    AtomicHistogram()
+    {
+      Reset();
+    }
+
+    void Add( uint64_t lat, uint64_t out, uint64_t in, bool error,
+              bool stall, uint32_t stallSec )
+    {
+      bytesOut.fetch_add( out, std::memory_order_relaxed );
+      bytesIn.fetch_add( in, std::memory_order_relaxed );
+
+      //------------------------------------------------------------------------
+      // A kXR_wait answer is not a completed request, keep it out of the
+      // count and the latencies
+      //------------------------------------------------------------------------
+      if( stall )
+      {
+        stalls.fetch_add( 1, std::memory_order_relaxed );
+        stallTime.fetch_add( stallSec, std::memory_order_relaxed );
+        return;
+      }
+
+      count.fetch_add( 1, std::memory_order_relaxed );
+      if( error )
+        errors.fetch_add( 1, std::memory_order_relaxed );
+      latency.fetch_add( lat, std::memory_order_relaxed );
+      buckets[RequestStats::Bucket( lat )].fetch_add( 1,
+                                             std::memory_order_relaxed );
+    }
+
+    void Get( RequestStats::Histogram &h ) const
+    {
+      h.count     = count.load( std::memory_order_relaxed );
+      h.errors    = errors.load( std::memory_order_relaxed );
+      h.stalls    = stalls.load( std::memory_order_relaxed );
+      h.stallTime = stallTime.load( std::memory_order_relaxed );
+      h.bytesOut  = bytesOut.load( std::memory_order_relaxed );
+      h.bytesIn   = bytesIn.load( std::memory_order_relaxed );
+      h.latency   = latency.load( std::memory_order_relaxed );
+      for( uint32_t i = 0; i < RequestStats::NbBuckets; ++i )
+        h.buckets[i] = buckets[i].load( std::memory_order_relaxed );
+    }
+
+    void Reset()
+    {
+      count     = 0;
+      errors    = 0;
+      stalls    = 0;
+      stallTime = 0;
+      bytesOut  = 0;
+      bytesIn   = 0;
+      latency   = 0;
+      for( uint32_t i = 0; i < RequestStats::NbBuckets; ++i )
+        buckets[i] = 0;
+    }
+  };
+
+  //----------------------------------------------------------------------------
+  // Statistics of a server
+  //----------------------------------------------------------------------------
+  struct ServerStats
+  {
+    AtomicHistogram requests[NbRequests];
+    AtomicHistogram subStreams[NbSubStreams];
+  };
+
+  //----------------------------------------------------------------------------
+  // Registry of the servers, the entries are never removed (only reset) so
+  // that they may be updated without holding the lock. It is never destroyed
+  // so that requests may still be accounted during the static destruction.
+  //----------------------------------------------------------------------------
+  struct Registry
+  {
+    XrdSysRWLock                        lock;
+    std::map<std::string, ServerStats*> servers;
+    std::atomic<bool>                   enabled;
+
+    Registry(): enabled( false ) {}
+
+    ServerStats *Get( const std::string &server )
+    {
+      {
+        XrdSysRWLockHelper scopedLock( lock, true );
+        auto it = servers.find( server );
+        if( it != servers.end() )
+          return it->second;
+      }
+      XrdSysRWLockHelper scopedLock( lock, false );
+      ServerStats *&stats = servers[server];
+      if( !stats )
+        stats = new ServerStats();
+      return stats;
+    }
+  };
+
+  Registry &GetRegistry()
+  {
+    static Registry *registry = new Registry();
+    return *registry;
+  }
+
+  //----------------------------------------------------------------------------
+  // Periodically log the report
+  //----------------------------------------------------------------------------
+  class StatsDumpTask: public Task
+  {
+    public:
+      StatsDumpTask(): pInterval( 0 )
+      {
+        SetName( "RequestStats dump task" );
+      }
+
+      void SetInterval( time_t interval )
+      {
+        pInterval = interval;
+      }
+
+      virtual time_t Run( time_t now )
+      {
+        Log *log = DefaultEnv::GetLog();
+        std::string report = RequestStats::Report();
+        if( !report.empty() )
+          log->Info( UtilityMsg, "Request statistics:\n%s", report.c_str() );
+        return now + pInterval;
+      }
+
+    private:
+      time_t pInterval;
+  };
+}
+
+namespace XrdCl
+{
+  //----------------------------------------------------------------------------
+  // Histogram constructor
+  //----------------------------------------------------------------------------
+  RequestStats::Histogram::Histogram():
+    count( 0 ), errors( 0 ), stalls( 0 ), stallTime( 0 ), bytesOut( 0 ),
+    bytesIn( 0 ), latency( 0 )
+  {
+    memset( buckets, 0, sizeof( buckets ) );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the given percentile of the latency
+  //----------------------------------------------------------------------------
+  uint64_t RequestStats::Histogram::Percentile( double percentile ) const
+  {
+    if( !count )
+      return 0;
+
+    uint64_t rank = uint64_t( count * percentile / 100.0 + 0.5 );
+    if( rank < 1 )    rank = 1;
+    if( rank > count ) rank = count;
+
+    uint64_t seen = 0;
+    for( uint32_t i = 0; i < NbBuckets; ++i )
+    {
+      seen += buckets[i];
+      if( seen >= rank )
+        return BucketBound( i );
+    }
+    return BucketBound( NbBuckets - 1 );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the mean latency
+  //----------------------------------------------------------------------------
+  uint64_t RequestStats::Histogram::Mean() const
+  {
+    return count ? latency / count : 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Enable or disable the collection
+  //----------------------------------------------------------------------------
+  void RequestStats::Enable( bool enable )
+  {
+    GetRegistry().enabled.store( enable, std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Check if the collection is enabled
+  //----------------------------------------------------------------------------
+  bool RequestStats::IsEnabled()
+  {
+    return GetRegistry().enabled.load( std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Account for a request
+  //----------------------------------------------------------------------------
+  void RequestStats::Record( const std::string &server,
+                             uint16_t           requestId,
+                             uint16_t           subStream,
+                             uint64_t           latency,
+                             uint64_t           bytesOut,
+                             uint64_t           bytesIn,
+                             bool               error,
+                             bool               stall,
+                             uint32_t           stallTime )
+  {
+    //--------------------------------------------------------------------------
+    // Most of the time a thread talks to the same server over and over,
+    // remember the last one to skip the registry lookup
+    //--------------------------------------------------------------------------
+    thread_local std::string  lastServer;
+    thread_local ServerStats *lastStats = 0;
+
+    if( !lastStats || lastServer != server )
+    {
+      lastStats  = GetRegistry().Get( server );
+      lastServer = server;
+    }
+
+    if( requestId >= kXR_auth && requestId < kXR_REQFENCE )
+      lastStats->requests[requestId - kXR_auth].Add( latency, bytesOut, bytesIn,
+                                                     error, stall, stallTime );
+    if( subStream < NbSubStreams )
+      lastStats->subStreams[subStream].Add( latency, bytesOut, bytesIn,
+                                            error, stall, stallTime );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the statistics
+  //----------------------------------------------------------------------------
+  std::vector<RequestStats::Entry> RequestStats::GetSnapshot()
+  {
+    Registry           &registry = GetRegistry();
+    std::vector<Entry>  entries;
+
+    XrdSysRWLockHelper scopedLock( registry.lock, true );
+    for( auto &srv : registry.servers )
+    {
+      Entry entry;
+      entry.server = srv.first;
+
+      entry.subStream = -1;
+      for( uint32_t i = 0; i < NbRequests; ++i )
+      {
+        srv.second->requests[i].Get( entry.histogram );
+        if( !entry.histogram.count && !entry.histogram.stalls )
+          continue;
+        entry.requestId = kXR_auth + i;
+        entries.push_back( entry );
+      }
+
+      entry.requestId = 0;
+      for( uint32_t i = 0; i < NbSubStreams; ++i )
+      {
+        srv.second->subStreams[i].Get( entry.histogram );
+        if( !entry.histogram.count && !entry.histogram.stalls )
+          continue;
+        entry.subStream = i;
+        entries.push_back( entry );
+      }
+    }
+    return entries;
+  }
+
+  //----------------------------------------------------------------------------
+  // Get a human readable report
+  //----------------------------------------------------------------------------
+  std::string RequestStats::Report()
+  {
+    std::vector<Entry> entries = GetSnapshot();
+    std::ostringstream o;
+    for( Entry &e : entries )
+    {
+      const Histogram &h = e.histogram;
+      o << e.server << " ";
+      if( e.requestId )
+        o << "kXR_" << XProtocol::reqName( e.requestId );
+      else
+        o << "stream " << e.subStream;
+      o << ": count=" << h.count << " errors=" << h.errors;
+      o << " stalls=" << h.stalls << " stalled=" << h.stallTime << "s";
+      o << " out=" << h.bytesOut << " in=" << h.bytesIn;
+      o << " mean=" << h.Mean() << "us p50=" << h.Percentile( 50 );
+      o << "us p90=" << h.Percentile( 90 ) << "us p99=" << h.Percentile( 99 );
+      o << "us max=" << h.Percentile( 100 ) << "us\n";
+    }
+    return o.str();
+  }
+
+  //----------------------------------------------------------------------------
+  // Reset all the statistics
+  //----------------------------------------------------------------------------
+  void RequestStats::Reset()
+  {
+    Registry &registry = GetRegistry();
+    XrdSysRWLockHelper scopedLock( registry.lock, true );
+    for( auto &srv : registry.servers )
+    {
+      for( uint32_t i = 0; i < NbRequests; ++i )
+        srv.second->requests[i].Reset();
+      for( uint32_t i = 0; i < NbSubStreams; ++i )
+        srv.second->subStreams[i].Reset();
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Read the settings and register the dump task
+  //----------------------------------------------------------------------------
+  void RequestStats::Initialize( TaskManager *taskManager )
+  {
+    static StatsDumpTask *dumpTask = new StatsDumpTask();
+
+    Env *env      = DefaultEnv::GetEnv();
+    int  enable   = DefaultRequestStats;
+    int  interval = DefaultRequestStatsDumpInterval;
+    env->GetInt( "RequestStats", enable );
+    env->GetInt( "RequestStatsDumpInterval", interval );
+
+    if( enable || interval > 0 )
+      Enable( true );
+
+    if( interval > 0 && taskManager )
+    {
+      dumpTask->SetInterval( interval );
+      taskManager->RegisterTask( dumpTask, time(0) + interval, false );
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the histogram bucket of a latency: the first four microseconds have
+  // a bucket each, then every power of two is split in four
+  //----------------------------------------------------------------------------
+  uint32_t RequestStats::Bucket( uint64_t latency )
+  {
+    if( latency < 4 )
+      return latency;
+
+    uint32_t exp = 63 - __builtin_clzll( latency );
+    uint32_t sub = ( latency >> ( exp - 2 ) ) & 3;
+    uint32_t bucket = 4 * ( exp - 1 ) + sub;
+    return bucket < NbBuckets ? bucket : NbBuckets - 1;
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the upper bound of a histogram bucket
+  //----------------------------------------------------------------------------
+  uint64_t RequestStats::BucketBound( uint32_t bucket )
+  {
+    if( bucket < 4 )
+      return bucket;
+
+    uint32_t exp = bucket / 4 + 1;
+    uint32_t sub = bucket % 4;
+    return ( uint64_t( 5 + sub ) << ( exp - 2 ) ) - 1;
+  }
+}
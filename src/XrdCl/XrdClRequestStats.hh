@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2026 by European Organization for Nuclear Research (CERN)
+//------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------------
+
+#ifndef __XRD_CL_REQUEST_STATS_HH__
+#define __XRD_CL_REQUEST_STATS_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace XrdCl
+{
+  class TaskManager;
+
+  //----------------------------------------------------------------------------
+  //! Client-side latency and throughput statistics of the XRootD requests.
+  //!
+  //! For every server the round trip time of each request (from the moment
+  //! it is written to the socket to the moment the server's answer has been
+  //! received) is accounted in a histogram per request type and in one per
+  //! sub-stream the answer came in on, along with the bytes sent and
+  //! received. kXR_wait answers are only counted as stalls, they do not
+  //! enter the request count nor the latencies. The histograms are
+  //! updated with atomic operations only.
+  //!
+  //! Collection is enabled with XRD_REQUESTSTATS=1, or programmatically with
+  //! Enable(). With XRD_REQUESTSTATSDUMPINTERVAL=N the report is also written
+  //! to the log (at Info level) every N seconds.
+  //----------------------------------------------------------------------------
+  class RequestStats
+  {
+    public:
+      //------------------------------------------------------------------------
+      //! Number of histogram buckets: four per power of two microseconds
+      //------------------------------------------------------------------------
+      static const uint32_t NbBuckets = 128;
+
+      //------------------------------------------------------------------------
+      //! Snapshot of a histogram
+      //------------------------------------------------------------------------
+      struct Histogram
+      {
+        Histogram();
+
+        //----------------------------------------------------------------------
+        //! Get the given percentile (0 - 100) of the latency in microseconds,
+        //! i.e. the upper bound of the bucket it falls into
+        //----------------------------------------------------------------------
+        uint64_t Percentile( double percentile ) const;
+
+        //----------------------------------------------------------------------
+        //! Get the mean latency in microseconds
+        //----------------------------------------------------------------------
+        uint64_t Mean() const;
+
+        uint64_t count;              //!< Number of requests, kXR_wait excluded
+        uint64_t errors;             //!< Number of kXR_error answers
+        uint64_t stalls;             //!< Number of kXR_wait answers
+        uint64_t stallTime;          //!< Sum of the kXR_wait times [s]
+        uint64_t bytesOut;           //!< Bytes sent (headers and payload)
+        uint64_t bytesIn;            //!< Bytes received
+        uint64_t latency;            //!< Sum of the latencies [us]
+        uint64_t buckets[NbBuckets]; //!< Latency histogram
+      };
+
+      //------------------------------------------------------------------------
+      //! Statistics of a request type or a sub-stream of a server
+      //------------------------------------------------------------------------
+      struct Entry
+      {
+        std::string server;    //!< "host:port" of the server
+        uint16_t    requestId; //!< kXR_* request code, 0 for a sub-stream
+        int         subStream; //!< sub-stream number, -1 for a request type
+        Histogram   histogram; //!< the statistics
+      };
+
+      //------------------------------------------------------------------------
+      //! Enable or disable the collection
+      //------------------------------------------------------------------------
+      static void Enable( bool enable );
+
+      //------------------------------------------------------------------------
+      //! Check if the collection is enabled
+      //------------------------------------------------------------------------
+      static bool IsEnabled();
+
+      //------------------------------------------------------------------------
+      //! Account for a request
+      //!
+      //! @param server    "host:port" of the server
+      //! @param requestId kXR_* request code
+      //! @param subStream the sub-stream the answer was received on
+      //! @param latency   round trip time [us]
+      //! @param bytesOut  bytes sent
+      //! @param bytesIn   bytes received
+      //! @param error     true if the server answered with an error
+      //! @param stall     true if the server told us to wait
+      //! @param stallTime the time the server told us to wait [s]
+      //------------------------------------------------------------------------
+      static void Record( const std::string &server,
+                          uint16_t           requestId,
+                          uint16_t           subStream,
+                          uint64_t           latency,
+                          uint64_t           bytesOut,
+                          uint64_t           bytesIn,
+                          bool               error,
+                          bool               stall     = false,
+                          uint32_t           stallTime = 0 );
+
+      //------------------------------------------------------------------------
+      //! Get the statistics of all the request types and sub-streams that
+      //! have seen traffic
+      //------------------------------------------------------------------------
+      static std::vector<Entry> GetSnapshot();
+
+      //------------------------------------------------------------------------
+      //! Get a human readable report (one line per entry)
+      //------------------------------------------------------------------------
+      static std::string Report();
+
+      //------------------------------------------------------------------------
+      //! Reset all the statistics
+      //------------------------------------------------------------------------
+      static void Reset();
+
+      //------------------------------------------------------------------------
+      //! Read the settings from the environment and register the periodic
+      //! dump with the task manager, if configured
+      //------------------------------------------------------------------------
+      static void Initialize( TaskManager *taskManager );
+
+      //------------------------------------------------------------------------
+      //! Get the histogram bucket of a latency [us]
+      //------------------------------------------------------------------------
+      static uint32_t Bucket( uint64_t latency );
+
+      //------------------------------------------------------------------------
+      //! Get the upper bound of a histogram bucket [us]
+      //------------------------------------------------------------------------
+      static uint64_t BucketBound( uint32_t bucket );
+  };
+}
+
+#endif // __XRD_CL_REQUEST_STATS_HH__
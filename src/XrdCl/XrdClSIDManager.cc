@@ -18,7 +18,7 @@
 
 #include "XrdCl/XrdClSIDManager.hh"
 
-#include <algorithm>
+#include <cstring>
 
 namespace XrdCl
 {
@@ -31,35 +31,86 @@ namespace XrdCl
     return *instance;
   }
   //----------------------------------------------------------------------------
-  // Allocate a SID
-  //---------------------------------------------------------------------------
-  Status SIDManager::AllocateSID( uint8_t sid[2] )
+  // Constructor
+  //----------------------------------------------------------------------------
+  SIDManager::SIDManager(): pNWordsUsed( 1 ), pEpoch( time(0) ), pRefCount( 0 )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
-
-    uint16_t allocSID = 1;
+    for( int i = 0; i < pNWords; ++i )
+    {
+      pInUse[i].store( 0, std::memory_order_relaxed );
+      pTimedOut[i].store( 0, std::memory_order_relaxed );
+    }
+    for( int i = 0; i < pNPages; ++i )
+      pAllocTime[i].store( nullptr, std::memory_order_relaxed );
 
     //--------------------------------------------------------------------------
-    // Get a SID from the list of free SIDs if it's not empty
+    // SID 0 and 0xffff are never handed out
     //--------------------------------------------------------------------------
-    if( !pFreeSIDs.empty() )
-    {
-      allocSID = pFreeSIDs.front();
-      pFreeSIDs.pop_front();
-    }
+    pInUse[0].store( 1ull, std::memory_order_relaxed );
+    pInUse[pNWords - 1].store( 1ull << 63, std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Destructor
+  //----------------------------------------------------------------------------
+  SIDManager::~SIDManager()
+  {
+    for( int i = 0; i < pNPages; ++i )
+      delete [] pAllocTime[i].load( std::memory_order_relaxed );
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the allocation time page for the given SID, create it if needed
+  //----------------------------------------------------------------------------
+  std::atomic<uint32_t>* SIDManager::GetTimePage( uint16_t sid )
+  {
+    std::atomic<std::atomic<uint32_t>*> &slot = pAllocTime[sid >> pPageShift];
+    std::atomic<uint32_t> *page = slot.load( std::memory_order_acquire );
+    if( page ) return page;
+
+    std::atomic<uint32_t> *newPage = new std::atomic<uint32_t>[1 << pPageShift];
+    for( int i = 0; i < ( 1 << pPageShift ); ++i )
+      newPage[i].store( 0, std::memory_order_relaxed );
+    if( slot.compare_exchange_strong( page, newPage, std::memory_order_acq_rel ) )
+      return newPage;
+    delete [] newPage;
+    return page;
+  }
+
+  //----------------------------------------------------------------------------
+  // Allocate a SID
+  //---------------------------------------------------------------------------
+  Status SIDManager::AllocateSID( uint8_t sid[2] )
+  {
     //--------------------------------------------------------------------------
-    // Allocate a new SID if possible
+    // Take the lowest free SID so that the in-use SIDs stay dense and the
+    // scans in IsAnySIDOldAs are short
     //--------------------------------------------------------------------------
-    else
+    for( int w = 0; w < pNWords; ++w )
     {
-      if( pSIDCeiling == 0xffff )
-        return Status( stError, errNoMoreFreeSIDs );
-      allocSID = pSIDCeiling++;
-    }
+      uint64_t word = pInUse[w].load( std::memory_order_relaxed );
+      while( word != ~0ull )
+      {
+        int      bit  = __builtin_ctzll( ~word );
+        uint64_t mask = 1ull << bit;
+        if( !pInUse[w].compare_exchange_weak( word, word | mask,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_relaxed ) )
+          continue;
+
+        uint16_t allocSID = w * 64 + bit;
+        int used = pNWordsUsed.load( std::memory_order_relaxed );
+        while( used <= w &&
+               !pNWordsUsed.compare_exchange_weak( used, w + 1, std::memory_order_relaxed ) ) { }
 
-    memcpy( sid, &allocSID, 2 );
-    pAllocTime[allocSID] = time(0);
-    return Status();
+        GetTimePage( allocSID )[allocSID & ( ( 1 << pPageShift ) - 1 )]
+          .store( uint32_t( time(0) - pEpoch ) + 1, std::memory_order_release );
+
+        memcpy( sid, &allocSID, 2 );
+        return Status();
+      }
+    }
+    return Status( stError, errNoMoreFreeSIDs );
   }
 
   //----------------------------------------------------------------------------
@@ -67,11 +118,11 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   void SIDManager::ReleaseSID( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t relSID = 0;
     memcpy( &relSID, sid, 2 );
-    pFreeSIDs.push_back( relSID );
-    pAllocTime.erase( relSID );
+    GetTimePage( relSID )[relSID & ( ( 1 << pPageShift ) - 1 )]
+      .store( 0, std::memory_order_relaxed );
+    pInUse[relSID >> 6].fetch_and( ~( 1ull << ( relSID & 63 ) ), std::memory_order_release );
   }
 
   //----------------------------------------------------------------------------
@@ -79,11 +130,11 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   void SIDManager::TimeOutSID( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t tiSID = 0;
     memcpy( &tiSID, sid, 2 );
-    pTimeOutSIDs.insert( tiSID );
-    pAllocTime.erase( tiSID );
+    GetTimePage( tiSID )[tiSID & ( ( 1 << pPageShift ) - 1 )]
+      .store( 0, std::memory_order_relaxed );
+    pTimedOut[tiSID >> 6].fetch_or( 1ull << ( tiSID & 63 ), std::memory_order_release );
   }
 
   //----------------------------------------------------------------------------
@@ -91,12 +142,27 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   bool SIDManager::IsAnySIDOldAs( const time_t tlim ) const
   {
-    XrdSysMutexHelper scopedLock( pMutex );
-    return std::any_of( pAllocTime.begin(), pAllocTime.end(),
-                        [tlim](const auto& p)
+    if( tlim < pEpoch ) return false;
+    const uint32_t lim = uint32_t( tlim - pEpoch ) + 1;
+
+    const int nWords = pNWordsUsed.load( std::memory_order_relaxed );
+    for( int w = 0; w < nWords; ++w )
     {
-      return p.second <= tlim;
-    } );
+      uint64_t word = pInUse[w].load( std::memory_order_acquire ) &
+                      ~pTimedOut[w].load( std::memory_order_acquire );
+      while( word )
+      {
+        int bit = __builtin_ctzll( word );
+        word &= word - 1;
+
+        uint16_t sid = w * 64 + bit;
+        std::atomic<uint32_t> *page = pAllocTime[sid >> pPageShift].load( std::memory_order_acquire );
+        if( !page ) continue;
+        uint32_t t = page[sid & ( ( 1 << pPageShift ) - 1 )].load( std::memory_order_acquire );
+        if( t && t <= lim ) return true;
+      }
+    }
+    return false;
   }
 
   //----------------------------------------------------------------------------
@@ -104,13 +170,9 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   bool SIDManager::IsTimedOut( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t tiSID = 0;
     memcpy( &tiSID, sid, 2 );
-    std::set<uint16_t>::iterator it = pTimeOutSIDs.find( tiSID );
-    if( it != pTimeOutSIDs.end() )
-      return true;
-    return false;
+    return pTimedOut[tiSID >> 6].load( std::memory_order_acquire ) & ( 1ull << ( tiSID & 63 ) );
   }
 
   //----------------------------------------------------------------------------
@@ -118,11 +180,11 @@ namespace XrdCl
   //-----------------------------------------------------------------------------
   void SIDManager::ReleaseTimedOut( uint8_t sid[2] )
   {
-    XrdSysMutexHelper scopedLock( pMutex );
     uint16_t tiSID = 0;
     memcpy( &tiSID, sid, 2 );
-    pTimeOutSIDs.erase( tiSID );
-    pFreeSIDs.push_back( tiSID );
+    uint64_t mask = 1ull << ( tiSID & 63 );
+    if( pTimedOut[tiSID >> 6].fetch_and( ~mask, std::memory_order_acq_rel ) & mask )
+      pInUse[tiSID >> 6].fetch_and( ~mask, std::memory_order_release );
   }
 
   //------------------------------------------------------------------------
@@ -130,11 +192,25 @@ namespace XrdCl
   //------------------------------------------------------------------------
   void SIDManager::ReleaseAllTimedOut()
   {
-    XrdSysMutexHelper scopedLock( pMutex );
-    std::set<uint16_t>::iterator it;
-    for( it = pTimeOutSIDs.begin(); it != pTimeOutSIDs.end(); ++it )
-      pFreeSIDs.push_back( *it );
-    pTimeOutSIDs.clear();
+    const int nWords = pNWordsUsed.load( std::memory_order_relaxed );
+    for( int w = 0; w < nWords; ++w )
+    {
+      uint64_t word = pTimedOut[w].exchange( 0, std::memory_order_acq_rel );
+      if( word )
+        pInUse[w].fetch_and( ~word, std::memory_order_release );
+    }
+  }
+
+  //------------------------------------------------------------------------
+  // Number of timeout sids
+  //------------------------------------------------------------------------
+  uint32_t SIDManager::NumberOfTimedOutSIDs() const
+  {
+    uint32_t n = 0;
+    const int nWords = pNWordsUsed.load( std::memory_order_relaxed );
+    for( int w = 0; w < nWords; ++w )
+      n += __builtin_popcountll( pTimedOut[w].load( std::memory_order_relaxed ) );
+    return n;
   }
 
   //----------------------------------------------------------------------------
@@ -142,8 +218,16 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   uint16_t SIDManager::GetNumberOfAllocatedSIDs() const
   {
-    XrdSysMutexHelper scopedLock( pMutex );
-    return pSIDCeiling - pFreeSIDs.size() - pTimeOutSIDs.size() - 1;
+    //--------------------------------------------------------------------------
+    // The last word is always counted for the reserved SID 0xffff
+    //--------------------------------------------------------------------------
+    uint32_t n = 0;
+    const int nWords = pNWordsUsed.load( std::memory_order_relaxed );
+    for( int w = 0; w < nWords; ++w )
+      n += __builtin_popcountll( pInUse[w].load( std::memory_order_relaxed ) &
+                                 ~pTimedOut[w].load( std::memory_order_relaxed ) );
+    if( nWords < pNWords ) ++n;
+    return n - 2;
   }
 
   //----------------------------------------------------------------------------
@@ -19,12 +19,12 @@
 #ifndef __XRD_CL_SID_MANAGER_HH__
 #define __XRD_CL_SID_MANAGER_HH__
 
-#include <list>
-#include <set>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <string>
 #include <cstdint>
+#include <ctime>
 #include "XrdSys/XrdSysPthread.hh"
 #include "XrdCl/XrdClStatus.hh"
 #include "XrdCl/XrdClURL.hh"
@@ -48,7 +48,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       //! Constructor
       //------------------------------------------------------------------------
-      SIDManager(): pSIDCeiling(1), pRefCount(0) { }
+      SIDManager();
 
 #if __cplusplus < 201103L
     //------------------------------------------------------------------------
@@ -61,7 +61,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       //! Destructor
       //------------------------------------------------------------------------
-      ~SIDManager() { }
+      ~SIDManager();
 
     public:
 
@@ -106,11 +106,7 @@ namespace XrdCl
       //------------------------------------------------------------------------
       //! Number of timeout sids
       //------------------------------------------------------------------------
-      uint32_t NumberOfTimedOutSIDs() const
-      {
-        XrdSysMutexHelper scopedLock( pMutex );
-        return pTimeOutSIDs.size();
-      }
+      uint32_t NumberOfTimedOutSIDs() const;
 
       //------------------------------------------------------------------------
       //! Number of allocated streams
@@ -118,12 +114,27 @@ namespace XrdCl
       uint16_t GetNumberOfAllocatedSIDs() const;
 
     private:
-      std::unordered_map<uint16_t, time_t> pAllocTime;
-      std::list<uint16_t>  pFreeSIDs;
-      std::set<uint16_t>   pTimeOutSIDs;
-      uint16_t             pSIDCeiling;
-      mutable XrdSysMutex  pMutex;
-      mutable size_t       pRefCount;
+      //------------------------------------------------------------------------
+      // SIDs are tracked in two bitmaps of 64K bits: a bit in pInUse is set
+      // for allocated and timed out SIDs, a bit in pTimedOut only for the
+      // latter. Allocation time is kept in a flat array indexed by SID,
+      // split in pages that are created on first use, as seconds since
+      // pEpoch plus one (zero meaning not set). All of these are accessed
+      // without locking, pMutex only protects the reference count.
+      //------------------------------------------------------------------------
+      static const int pNWords     = 0x10000 / 64;
+      static const int pPageShift  = 12;
+      static const int pNPages     = 0x10000 >> pPageShift;
+
+      std::atomic<uint32_t>* GetTimePage( uint16_t sid );
+
+      std::atomic<uint64_t>               pInUse[pNWords];
+      std::atomic<uint64_t>               pTimedOut[pNWords];
+      std::atomic<std::atomic<uint32_t>*> pAllocTime[pNPages];
+      std::atomic<int>                    pNWordsUsed;
+      time_t                              pEpoch;
+      mutable XrdSysMutex                 pMutex;
+      mutable size_t                      pRefCount;
   };
 
   //----------------------------------------------------------------------------
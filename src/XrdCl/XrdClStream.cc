@@ -35,6 +35,7 @@
 #include "XrdCl/XrdClMessageUtils.hh"
 #include "XrdCl/XrdClXRootDTransport.hh"
 #include "XrdCl/XrdClXRootDMsgHandler.hh"
+#include "XrdCl/XrdClRequestStats.hh"
 #include "XrdClAsyncSocketHandler.hh"
 
 #include <sys/types.h>
@@ -74,7 +75,7 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   struct SubStreamData
   {
-    SubStreamData(): socket( 0 ), status( Socket::Disconnected )
+    SubStreamData(): socket( 0 ), status( Socket::Disconnected ), bytesReceived( 0 )
     {
       outQueue = new OutQueue();
     }
@@ -88,6 +89,7 @@ namespace XrdCl
     OutQueue::MsgHelper   outMsgHelper;
     InMessageHelper       inMsgHelper;
     Socket::SocketStatus  status;
+    std::atomic<uint64_t> bytesReceived;
   };
 
 
@@ -681,6 +683,7 @@ namespace XrdCl
   {
     msg->SetSessionId( pSessionId );
     pBytesReceived += bytesReceived;
+    pSubStreams[subStream]->bytesReceived += bytesReceived;
 
     MsgHandler *handler = nullptr;
     uint16_t action = 0;
@@ -720,6 +723,15 @@ namespace XrdCl
       return;
     }
 
+    //--------------------------------------------------------------------------
+    // Let the handler account for the traffic
+    //--------------------------------------------------------------------------
+    if( RequestStats::IsEnabled() )
+    {
+      XRootDMsgHandler *xrdHandler = dynamic_cast<XRootDMsgHandler*>( handler );
+      if( xrdHandler ) xrdHandler->OnReceived( subStream, bytesReceived );
+    }
+
     //--------------------------------------------------------------------------
     // We have a handler, so we call the callback
     //--------------------------------------------------------------------------
@@ -902,6 +914,8 @@ namespace XrdCl
       //------------------------------------------------------------------------
       pBytesSent     = 0;
       pBytesReceived = 0;
+      for( size_t i = 0; i < pSubStreams.size(); ++i )
+        pSubStreams[i]->bytesReceived = 0;
       gettimeofday( &pConnectionDone, 0 );
       Monitor *mon = DefaultEnv::GetMonitor();
       if( mon )
@@ -1229,6 +1243,23 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   void Stream::MonitorDisconnection( XRootDStatus status )
   {
+    //--------------------------------------------------------------------------
+    // Report how the received data was spread over the sub-streams
+    //--------------------------------------------------------------------------
+    if( pSubStreams.size() > 1 )
+    {
+      Log    *log   = DefaultEnv::GetLog();
+      time_t  cTime = ::time(0) - pConnectionDone.tv_sec;
+      if( cTime <= 0 ) cTime = 1;
+      for( size_t i = 0; i < pSubStreams.size(); ++i )
+      {
+        uint64_t bytes = pSubStreams[i]->bytesReceived;
+        log->Debug( PostMasterMsg, "[%s] Sub-stream %zu received %llu bytes "
+                    "(%.2f MB/s)", pStreamName.c_str(), i,
+                    (unsigned long long)bytes, bytes / 1e6 / cTime );
+      }
+    }
+
     Monitor *mon = DefaultEnv::GetMonitor();
     if( mon )
     {
@@ -1238,7 +1269,17 @@ namespace XrdCl
       i.sBytes = pBytesSent;
       i.cTime  = ::time(0) - pConnectionDone.tv_sec;
       i.status = status;
+      if( pSubStreams.size() > 1 )
+        for( size_t j = 0; j < pSubStreams.size(); ++j )
+          i.subStreamRBytes.push_back( pSubStreams[j]->bytesReceived );
       mon->Event( Monitor::EvDisconnect, &i );
+
+      BufferCache::Stats stats = BufferCache::GetStats();
+      Monitor::BufferCacheInfo c;
+      c.allocs = stats.allocs;
+      c.hits   = stats.hits;
+      c.cached = stats.cached;
+      mon->Event( Monitor::EvBufferCache, &c );
     }
   }
 
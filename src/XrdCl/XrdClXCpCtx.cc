@@ -29,6 +29,7 @@
 #include "XrdCl/XrdClConstants.hh"
 
 #include <algorithm>
+#include <vector>
 
 namespace XrdCl
 {
@@ -36,9 +37,12 @@ namespace XrdCl
 XCpCtx::XCpCtx( const std::vector<std::string> &urls, uint64_t blockSize, uint8_t parallelSrc, uint64_t chunkSize, uint64_t parallelChunks, int64_t fileSize ) :
       pUrls( std::deque<std::string>( urls.begin(), urls.end() ) ), pBlockSize( blockSize ),
       pParallelSrc( parallelSrc ), pChunkSize( chunkSize ), pParallelChunks( parallelChunks ),
-      pOffset( 0 ), pFileSize( -1 ), pFileSizeCV( 0 ), pDataReceived( 0 ), pDone( false ),
+      pDropSlowSrc( 0 ), pOffset( 0 ), pFileSize( -1 ), pFileSizeCV( 0 ), pDataReceived( 0 ), pDone( false ),
       pDoneCV( 0 ), pRefCount( 1 ), pDeleteCV( 0 ), pDelete( false )
 {
+  int val = DefaultXCpDropSlowSrc;
+  DefaultEnv::GetEnv()->GetInt( "XCpDropSlowSrc", val );
+  if( val > 0 ) pDropSlowSrc = val;
   SetFileSize( fileSize );
 }
 
@@ -92,18 +96,62 @@ void XCpCtx::PutChunk( PageInfo* chunk )
   pSink.Put( chunk );
 }
 
-std::pair<uint64_t, uint64_t> XCpCtx::GetBlock()
+std::pair<uint64_t, uint64_t> XCpCtx::GetBlock( XCpSrc *src )
 {
   XrdSysMutexHelper lck( pMtx );
 
   uint64_t blkSize = pBlockSize, offset = pOffset;
-  if( pOffset + blkSize > uint64_t( pFileSize ) )
-    blkSize = pFileSize - pOffset;
+  uint64_t remaining = uint64_t( pFileSize ) - pOffset;
+
+  // give the source the share of the remaining data that corresponds
+  // to its share of the aggregate transfer rate (sources that did not
+  // transfer anything yet get the default block size)
+  uint64_t myRate = src ? src->TransferRate() : 0;
+  if( myRate > 0 )
+  {
+    uint64_t totalRate = 0;
+    std::list<XCpSrc*>::iterator itr;
+    for( itr = pSources.begin() ; itr != pSources.end() ; ++itr )
+      if( (*itr)->IsRunning() )
+        totalRate += (*itr)->TransferRate();
+    if( totalRate < myRate ) totalRate = myRate;
+
+    uint64_t share = uint64_t( double( remaining ) * myRate / totalRate );
+    if( share < pChunkSize ) share = pChunkSize;
+    if( share < blkSize ) blkSize = share;
+  }
+
+  if( blkSize > remaining )
+    blkSize = remaining;
   pOffset += blkSize;
 
   return std::make_pair( offset, blkSize );
 }
 
+bool XCpCtx::IsTooSlow( XCpSrc *src )
+{
+  if( !pDropSlowSrc ) return false;
+
+  time_t now = time( 0 );
+  std::vector<uint64_t> rates;
+  {
+    XrdSysMutexHelper lck( pMtx );
+    std::list<XCpSrc*>::iterator itr;
+    for( itr = pSources.begin() ; itr != pSources.end() ; ++itr )
+      if( (*itr)->IsRunning() )
+        rates.push_back( (*itr)->RecentRate( now ) );
+  }
+
+  // never drop the last source
+  if( rates.size() < 2 ) return false;
+
+  // compare the recent rates, so that a source that slowed
+  // down is not kept alive by its good start (and vice versa)
+  std::vector<uint64_t>::iterator median = rates.begin() + rates.size() / 2;
+  std::nth_element( rates.begin(), median, rates.end() );
+  return src->StayedBelow( now, *median * pDropSlowSrc / 100 );
+}
+
 void XCpCtx::SetFileSize( int64_t size )
 {
   XrdSysCondVarHelper lckcv( pFileSizeCV );
@@ -192,10 +240,12 @@ void XCpCtx::NotifyIdleSrc()
 
 bool XCpCtx::AllDone()
 {
+  int timeout = HasPendingData() ? 1 : 60;
+
   XrdSysCondVarHelper lck( pDoneCV );
 
   if( !pDone )
-    pDoneCV.Wait( 60 );
+    pDoneCV.Wait( timeout );
 
   return pDone;
 }
@@ -213,5 +263,16 @@ size_t XCpCtx::GetRunning()
   return nbRunning;
 }
 
+bool XCpCtx::HasPendingData()
+{
+  std::list<XCpSrc*>::iterator itr;
+  XrdSysMutexHelper lck( pMtx );
+
+  for( itr = pSources.begin() ; itr != pSources.end() ; ++ itr)
+    if( (*itr)->HasData() )
+      return true;
+  return false;
+}
+
 
 } /* namespace XrdCl */
@@ -137,9 +137,25 @@ class XCpCtx
     /**
      * Get next block that has to be transferred
      *
-     * @return : pair of offset and block size
+     * The block is sized after the share of the source in
+     * the aggregate transfer rate of all running sources,
+     * so that the sources finish at about the same time.
+     *
+     * @param src : the source asking for the block (if known)
+     * @return    : pair of offset and block size
+     */
+    std::pair<uint64_t, uint64_t> GetBlock( XCpSrc *src = 0 );
+
+    /**
+     * Check if given source is too slow to be kept, i.e.
+     * its transfer rate over the last 10s has stayed below
+     * the configured fraction (XCpDropSlowSrc) of the median
+     * recent rate of the running sources for at least 10s
+     *
+     * @param src : the source in question
+     * @return    : true if the source should be dropped
      */
-    std::pair<uint64_t, uint64_t> GetBlock();
+    bool IsTooSlow( XCpSrc *src );
 
     /**
      * Set the file size (GetSize will block until
@@ -210,7 +226,9 @@ class XCpCtx
     /**
      * Returns true if all chunks have been transferred,
      * otherwise blocks until NotifyIdleSrc is called,
-     * or a 1 minute timeout occurs.
+     * or a timeout occurs (1 second if any source has
+     * still data to transfer, so that idle sources can
+     * take over from slow ones, 1 minute otherwise).
      *
      * @return : true is all chunks have been transferred,
      *           false otherwise.
@@ -237,6 +255,12 @@ class XCpCtx
      */
     size_t GetRunning();
 
+    /**
+     * @return : true if any of the sources has still
+     *           data to transfer
+     */
+    bool HasPendingData();
+
     /**
      * Destructor (private).
      *
@@ -270,6 +294,12 @@ class XCpCtx
      */
     uint8_t                    pParallelChunks;
 
+    /**
+     * Sources with a transfer rate below this percentage
+     * of the median are dropped (0 means never).
+     */
+    uint32_t                   pDropSlowSrc;
+
     /**
      * Offset in the file (everything before the offset
      * has been allocated, everything after the offset
@@ -157,6 +157,7 @@ void XCpSrc::StartDownloading()
 
   // start counting transfer time
   pStartTime = time( 0 );
+  pRate.Reset( pStartTime, pDataTransfered );
 
   while( pRunning )
   {
@@ -183,8 +184,10 @@ void XCpSrc::StartDownloading()
       // and now we can steal from it)
       if( !pCtx->AllDone() )
       {
-        // reset start time after pause
+        // reset start time after pause, the recent
+        // rate should not account for the idle time
         pStartTime = time( 0 );
+        pRate.Reset( pStartTime, pDataTransfered );
         continue;
       }
       // stop counting
@@ -219,6 +222,21 @@ void XCpSrc::StartDownloading()
       }
     }
     delete status;
+
+    if( pCtx->IsTooSlow( this ) )
+    {
+      Log *log = DefaultEnv::GetLog();
+      std::string myHost = URL( pUrl ).GetHostName();
+      log->Warning( UtilityMsg, "Dropping %s, transfer rate too low (%llu B/s)",
+                    myHost.c_str(), (unsigned long long)RecentRate( time( 0 ) ) );
+      // stop the source, the others will steal its block
+      // and duplicate the chunks that are still ongoing
+      pRunning = false;
+      pCtx->NotifyIdleSrc();
+      pCtx->PutChunk( 0 );
+      while( HasData() && !pCtx->AllDone() );
+      return;
+    }
   }
 }
 
@@ -341,6 +359,7 @@ XRootDStatus XCpSrc::Recover()
   pTransferTime   = 0;
   pStartTime      = time( 0 );
   pDataTransfered = 0;
+  pRate.Reset( pStartTime, 0 );
 
   return st;
 }
@@ -455,7 +474,8 @@ void XCpSrc::ReportResponse( XRootDStatus *status, PageInfo *chunk, File *handle
 
   if( chunk )
   {
-    pDataTransfered += chunk->GetLength();
+    uint64_t total = pDataTransfered += chunk->GetLength();
+    pRate.Update( time( 0 ), total );
     pCtx->PutChunk( chunk );
   }
 }
@@ -567,7 +587,7 @@ void XCpSrc::Steal( XCpSrc *src )
 
 XRootDStatus XCpSrc::GetWork()
 {
-  std::pair<uint64_t, uint64_t> p = pCtx->GetBlock();
+  std::pair<uint64_t, uint64_t> p = pCtx->GetBlock( this );
 
   if( p.second > 0 )
   {
@@ -595,8 +615,75 @@ XRootDStatus XCpSrc::GetWork()
 
 uint64_t XCpSrc::TransferRate()
 {
-  time_t duration = pTransferTime + time( 0 ) - pStartTime;
+  time_t duration = TransferTime();
   return pDataTransfered / ( duration + 1 ); // add one to avoid floating point exception
 }
 
+time_t XCpSrc::TransferTime()
+{
+  return pTransferTime + time( 0 ) - pStartTime;
+}
+
+void XCpRateWindow::Reset( time_t now, uint64_t total )
+{
+  XrdSysMutexHelper lck( pMtx );
+  pSamples.clear();
+  pSamples.push_back( std::make_pair( now, total ) );
+  pBelow = false;
+}
+
+void XCpRateWindow::Update( time_t now, uint64_t total )
+{
+  XrdSysMutexHelper lck( pMtx );
+  if( !pSamples.empty() && pSamples.back().first >= now )
+    pSamples.back().second = total;
+  else
+    pSamples.push_back( std::make_pair( now, total ) );
+  // keep a single sample from before the window as the base
+  while( pSamples.size() > 1 && pSamples[1].first <= now - pWindow )
+    pSamples.pop_front();
+}
+
+uint64_t XCpRateWindow::Rate( time_t now )
+{
+  XrdSysMutexHelper lck( pMtx );
+  return RateUnlocked( now );
+}
+
+uint64_t XCpRateWindow::RateUnlocked( time_t now )
+{
+  while( pSamples.size() > 1 && pSamples[1].first <= now - pWindow )
+    pSamples.pop_front();
+  if( pSamples.empty() ) return 0;
+  // if nothing was received lately the base may be older than
+  // the window, in this case average over the whole span
+  time_t duration = now - pSamples.front().first;
+  if( duration <= 0 ) return 0;
+  return ( pSamples.back().second - pSamples.front().second ) / duration;
+}
+
+bool XCpRateWindow::StayedBelow( time_t now, uint64_t threshold )
+{
+  XrdSysMutexHelper lck( pMtx );
+  // give the source a full window before judging its rate
+  if( pSamples.empty() || pSamples.front().first > now - pWindow )
+  {
+    pBelow = false;
+    return false;
+  }
+
+  if( RateUnlocked( now ) >= threshold )
+  {
+    pBelow = false;
+    return false;
+  }
+
+  if( !pBelow )
+  {
+    pBelow      = true;
+    pBelowSince = now;
+  }
+  return now - pBelowSince >= pWindow;
+}
+
 } /* namespace XrdCl */
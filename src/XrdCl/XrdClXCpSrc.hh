@@ -30,12 +30,77 @@
 #include "XrdSys/XrdSysPthread.hh"
 
 #include <atomic>
+#include <ctime>
+#include <deque>
 
 namespace XrdCl
 {
 
 class XCpCtx;
 
+/**
+ * Transfer rate of a source over a sliding time window,
+ * computed from samples of the amount of data received
+ * so far (at most one sample per second is kept).
+ */
+class XCpRateWindow
+{
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param window : length of the window [s]
+     */
+    XCpRateWindow( time_t window = 10 ) : pWindow( window ), pBelow( false ), pBelowSince( 0 )
+    {
+    }
+
+    /**
+     * Drop the history, e.g. after the source has been idle
+     * or has been recovered.
+     *
+     * @param now   : current time
+     * @param total : data received so far [B]
+     */
+    void Reset( time_t now, uint64_t total );
+
+    /**
+     * Record the amount of data received so far.
+     *
+     * @param now   : current time
+     * @param total : data received so far [B]
+     */
+    void Update( time_t now, uint64_t total );
+
+    /**
+     * @param now : current time
+     * @return    : transfer rate over the last window [B/s]
+     */
+    uint64_t Rate( time_t now );
+
+    /**
+     * Check whether the rate has stayed below the given threshold
+     * for at least a window length. The rate is only judged once
+     * the history covers a full window.
+     *
+     * @param now       : current time
+     * @param threshold : minimum acceptable rate [B/s]
+     * @return          : true if the rate stayed below the threshold
+     */
+    bool StayedBelow( time_t now, uint64_t threshold );
+
+  private:
+
+    uint64_t RateUnlocked( time_t now );
+
+    XrdSysMutex                              pMtx;
+    time_t                                   pWindow;
+    std::deque<std::pair<time_t, uint64_t> > pSamples;
+    bool                                     pBelow;
+    time_t                                   pBelowSince;
+};
+
 class XCpSrc
 {
     friend class ChunkHandler;
@@ -123,6 +188,38 @@ class XCpSrc
      */
     uint64_t TransferRate();
 
+    /**
+     * Get the transfer rate for current source over the
+     * last few seconds
+     *
+     * @param now : current time
+     * @return    : recent transfer rate [B/s]
+     */
+    uint64_t RecentRate( time_t now )
+    {
+      return pRate.Rate( now );
+    }
+
+    /**
+     * Check whether the recent transfer rate has stayed
+     * below the given threshold for long enough
+     *
+     * @param now       : current time
+     * @param threshold : minimum acceptable rate [B/s]
+     * @return          : true if the source is too slow
+     */
+    bool StayedBelow( time_t now, uint64_t threshold )
+    {
+      return pRate.StayedBelow( now, threshold );
+    }
+
+    /**
+     * Get the time the current source has been transferring data
+     *
+     * @return : transfer time [s]
+     */
+    time_t TransferTime();
+
     /**
      * Delete ChunkInfo object, and set the pointer to null.
      *
@@ -366,6 +463,11 @@ class XCpSrc
      */
     time_t                        pTransferTime;
 
+    /**
+     * The transfer rate over the last few seconds
+     */
+    XCpRateWindow                 pRate;
+
     /**
      * The total time we were transferring data, before
      * the restart
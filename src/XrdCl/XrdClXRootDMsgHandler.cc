@@ -36,6 +36,7 @@
 #include "XrdCl/XrdClMessageUtils.hh"
 #include "XrdCl/XrdClLocalFileHandler.hh"
 #include "XrdCl/XrdClRedirectorRegistry.hh"
+#include "XrdCl/XrdClPreWarm.hh"
 #include "XrdCl/XrdClSocket.hh"
 #include "XrdCl/XrdClTls.hh"
 #include "XrdCl/XrdClOptimizers.hh"
@@ -406,6 +407,23 @@ namespace XrdCl
     return ((uint16_t)req->header.streamid[1] << 8) | (uint16_t)req->header.streamid[0];
   }
 
+  //----------------------------------------------------------------------------
+  // Account for the round trip that has just completed
+  //----------------------------------------------------------------------------
+  void XRootDMsgHandler::RecordStats( bool error, bool stall, uint32_t stallTime )
+  {
+    uint64_t sendTime = pStatsSendTime.exchange( 0 );
+    if( !sendTime )
+      return;
+
+    ClientRequest *req      = (ClientRequest *)pRequest->GetBuffer();
+    uint64_t       bytesOut = sizeof( ClientRequestHdr ) +
+                              ntohl( req->header.dlen );
+    RequestStats::Record( pUrl.GetHostId(), ntohs( req->header.requestid ),
+                          pStatsSubStream, StatsNow() - sendTime, bytesOut,
+                          pStatsBytesIn, error, stall, stallTime );
+  }
+
   //----------------------------------------------------------------------------
   //! Process the message if it was "taken" by the examine action
   //----------------------------------------------------------------------------
@@ -461,6 +479,17 @@ namespace XrdCl
     //--------------------------------------------------------------------------
     pSendingState.fetch_or( kInFlyDone );
 
+    //--------------------------------------------------------------------------
+    // Account for the round trip, partial answers are accounted together
+    // with the final one
+    //--------------------------------------------------------------------------
+    if( rsp->hdr.status != kXR_oksofar && RequestStats::IsEnabled() )
+    {
+      bool stall = rsp->hdr.status == kXR_wait;
+      RecordStats( rsp->hdr.status == kXR_error, stall,
+                   stall && rsp->hdr.dlen >= 4 ? rsp->body.wait.seconds : 0 );
+    }
+
     //--------------------------------------------------------------------------
     // Reset the aggregated wait (used to omit wait response in case of Metalink
     // redirector)
@@ -657,6 +686,17 @@ namespace XrdCl
         if( pUrl.GetPassword() != "" && newUrl.GetPassword() == "" )
           newUrl.SetPassword( pUrl.GetPassword() );
 
+        //----------------------------------------------------------------------
+        // A manager sending an open elsewhere, the other files of the same
+        // directory are likely to be opened at the same servers
+        //----------------------------------------------------------------------
+        if( ( flags & kXR_isManager ) && !pRedirectAsAnswer )
+        {
+          ClientRequest *req = (ClientRequest*)pRequest->GetBuffer();
+          if( ntohs( req->header.requestid ) == kXR_open )
+            PreWarmer::Instance().Redirected( pUrl );
+        }
+
         //----------------------------------------------------------------------
         // Forward any "xrd.*" params from the original client request also to
         // the new redirection url
@@ -1400,6 +1440,8 @@ namespace XrdCl
         }
         delete [] nullBuffer;
 
+        PreWarmer::Instance().Located( pUrl, *data );
+
         obj->Set( data );
         response = obj;
         return Status();
@@ -32,6 +32,7 @@
 #include "XProtocol/XProtocol.hh"
 #include "XrdCl/XrdClLog.hh"
 #include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClRequestStats.hh"
 
 #include "XrdCl/XrdClAsyncPageReader.hh"
 #include "XrdCl/XrdClAsyncVectorReader.hh"
@@ -51,6 +52,7 @@
 #include <arpa/inet.h> // for network unmarshaling stuff
 
 #include <array>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <atomic>
@@ -176,7 +178,11 @@ namespace XrdCl
 
         pCV( 0 ),
 
-        pSslErrCnt( 0 )
+        pSslErrCnt( 0 ),
+
+        pStatsSendTime( 0 ),
+        pStatsBytesIn( 0 ),
+        pStatsSubStream( 0 )
       {
         pPostMaster = DefaultEnv::GetPostMaster();
         if( msg->GetSessionId() )
@@ -438,6 +444,21 @@ namespace XrdCl
       void OnReadyToSend( [[maybe_unused]] Message *msg ) override
       {
         pSendingState |= kSawReadySend;
+        if( RequestStats::IsEnabled() )
+        {
+          pStatsBytesIn  = 0;
+          pStatsSendTime = StatsNow();
+        }
+      }
+
+      //------------------------------------------------------------------------
+      //! Account for the bytes of an answer received on the given sub-stream
+      //! (only called when the request statistics are enabled)
+      //------------------------------------------------------------------------
+      void OnReceived( uint16_t subStream, uint32_t bytes )
+      {
+        pStatsSubStream  = subStream;
+        pStatsBytesIn   += bytes;
       }
 
       void OnWaitingToSend( [[maybe_unused]] Message *msg ) override
@@ -447,6 +468,21 @@ namespace XrdCl
 
     private:
 
+      //------------------------------------------------------------------------
+      //! Monotonic time used for the request statistics [us]
+      //------------------------------------------------------------------------
+      static uint64_t StatsNow()
+      {
+        using namespace std::chrono;
+        return duration_cast<microseconds>(
+                 steady_clock::now().time_since_epoch() ).count();
+      }
+
+      //------------------------------------------------------------------------
+      //! Account for the round trip that has just completed
+      //------------------------------------------------------------------------
+      void RecordStats( bool error, bool stall, uint32_t stallTime );
+
       // bit flags used with pSendingState
       static constexpr int kSendDone     = 0x0001;
       static constexpr int kSawResp      = 0x0002;
@@ -710,6 +746,14 @@ namespace XrdCl
       //------------------------------------------------------------------------
       URL                                    pRetryAtUrl;
       RedirectEntry::Type                    pRetryAtEntryType;
+
+      //------------------------------------------------------------------------
+      // Request statistics: when the request was written to the socket [us],
+      // the bytes received since and the sub-stream the answer came in on
+      //------------------------------------------------------------------------
+      std::atomic<uint64_t>                  pStatsSendTime;
+      std::atomic<uint64_t>                  pStatsBytesIn;
+      std::atomic<uint16_t>                  pStatsSubStream;
   };
 }
 
@@ -1636,6 +1636,20 @@ namespace XrdCl
       case XRootDQuery::IsEncrypted:
         result.Set( new bool( info->encrypted ), false );
         return Status();
+
+      //------------------------------------------------------------------------
+      // Number of connected data streams (not counting stream 0)
+      //------------------------------------------------------------------------
+      case XRootDQuery::DataStreams:
+      {
+        int nbConnected = 0;
+        if( info->serverFlags & kXR_isServer )
+          for( size_t i = 1; i < info->stream.size(); ++i )
+            if( info->stream[i].status == XRootDStreamInfo::Connected )
+              ++nbConnected;
+        result.Set( new int( nbConnected ), false );
+        return Status();
+      }
     };
     return Status( stError, errQueryNotSupported );
   }
@@ -33,10 +33,277 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace XrdCl
 {
   using namespace XrdZip;
 
+  //---------------------------------------------------------------------------
+  // Files prefetched and inflated ahead of the reads, the memory of the
+  // compressed and of the inflated data is accounted against a budget
+  //---------------------------------------------------------------------------
+  class ZipPrefetch
+  {
+    public:
+
+      //-----------------------------------------------------------------------
+      // A file to be prefetched
+      //-----------------------------------------------------------------------
+      struct File
+      {
+        std::string fn;       //< file name
+        uint64_t    offset;   //< offset of the data in the archive
+        uint64_t    compsize; //< compressed size
+        uint64_t    size;     //< uncompressed size
+        uint16_t    method;   //< compression method
+        uint32_t    crc32;    //< crc32 of the uncompressed data
+      };
+
+      //-----------------------------------------------------------------------
+      // Adjacent files fetched with a single read
+      //-----------------------------------------------------------------------
+      struct Range
+      {
+        uint64_t          offset;
+        uint32_t          size;
+        std::vector<File> files;
+      };
+
+      //-----------------------------------------------------------------------
+      // Files further apart than this are not fetched with the same read
+      //-----------------------------------------------------------------------
+      static const uint64_t MaxGap  = 65536;
+
+      //-----------------------------------------------------------------------
+      // Files are merged into a single read up to this size
+      //-----------------------------------------------------------------------
+      static const uint64_t MaxRead = 16777216;
+
+      ZipPrefetch( uint64_t budget ) : budget( budget ), used( 0 )
+      {
+      }
+
+      //-----------------------------------------------------------------------
+      // Reserve memory for a file, fails if the file is already there (or
+      // on its way) or if there is not enough budget left
+      //-----------------------------------------------------------------------
+      bool Reserve( const std::string &fn, uint64_t size )
+      {
+        std::unique_lock<std::mutex> lck( mtx );
+        if( files.count( fn ) || used + size > budget ) return false;
+        files[fn].reset();
+        used += size;
+        return true;
+      }
+
+      //-----------------------------------------------------------------------
+      // A file has been inflated (or failed if data is null), release the
+      // given part of its reservation
+      //-----------------------------------------------------------------------
+      void Done( const std::string &fn, std::shared_ptr<buffer_t> data, uint64_t release )
+      {
+        std::unique_lock<std::mutex> lck( mtx );
+        used -= release;
+        if( data ) files[fn] = std::move( data );
+        else files.erase( fn );
+      }
+
+      //-----------------------------------------------------------------------
+      // Get the inflated data of a file, null if it is not ready
+      //-----------------------------------------------------------------------
+      std::shared_ptr<buffer_t> Get( const std::string &fn )
+      {
+        std::unique_lock<std::mutex> lck( mtx );
+        auto itr = files.find( fn );
+        if( itr == files.end() ) return std::shared_ptr<buffer_t>();
+        return itr->second;
+      }
+
+      //-----------------------------------------------------------------------
+      // Forget the inflated data of a file
+      //-----------------------------------------------------------------------
+      void Drop( const std::string &fn )
+      {
+        std::unique_lock<std::mutex> lck( mtx );
+        auto itr = files.find( fn );
+        if( itr == files.end() || !itr->second ) return;
+        used -= itr->second->size();
+        files.erase( itr );
+      }
+
+    private:
+      std::mutex mtx;
+      uint64_t   budget;
+      uint64_t   used;
+      std::unordered_map<std::string, std::shared_ptr<buffer_t>> files;
+  };
+
+  namespace
+  {
+    //-------------------------------------------------------------------------
+    // Calls the user handler once all the files of a prefetch are done
+    //-------------------------------------------------------------------------
+    class PrefetchCtx
+    {
+      public:
+        PrefetchCtx( ResponseHandler *handler, size_t count ) : handler( handler ),
+                                                                 remaining( count )
+        {
+        }
+
+        void Done( const XRootDStatus &st )
+        {
+          std::unique_lock<std::mutex> lck( mtx );
+          if( !st.IsOK() && status.IsOK() ) status = st;
+          if( --remaining ) return;
+          lck.unlock();
+          if( handler ) handler->HandleResponse( new XRootDStatus( status ), nullptr );
+        }
+
+      private:
+        std::mutex        mtx;
+        ResponseHandler  *handler;
+        size_t            remaining;
+        XRootDStatus      status;
+    };
+
+    //-------------------------------------------------------------------------
+    // Inflates a prefetched file in the thread-pool
+    //-------------------------------------------------------------------------
+    class InflateJob : public Job
+    {
+      public:
+        InflateJob( std::shared_ptr<ZipPrefetch>  cache,
+                    std::shared_ptr<PrefetchCtx>  ctx,
+                    std::shared_ptr<buffer_t>     input,
+                    const char                   *data,
+                    const ZipPrefetch::File      &file ) : cache( std::move( cache ) ),
+                                                           ctx( std::move( ctx ) ),
+                                                           input( std::move( input ) ),
+                                                           data( data ),
+                                                           file( file )
+        {
+        }
+
+        virtual void Run( void* )
+        {
+          auto         output = std::make_shared<buffer_t>( file.size );
+          XRootDStatus st     = Inflate( *output );
+          input.reset(); // we don't need the compressed data anymore
+          if( st.IsOK() )
+            cache->Done( file.fn, std::move( output ), file.compsize );
+          else
+          {
+            Log *log = DefaultEnv::GetLog();
+            log->Error( ZipMsg, "[%p] Failed to inflate prefetched file %s: %s",
+                                (void*)cache.get(), file.fn.c_str(), st.ToString().c_str() );
+            cache->Done( file.fn, nullptr, file.compsize + file.size );
+          }
+          ctx->Done( st );
+          delete this;
+        }
+
+      private:
+
+        XRootDStatus Inflate( buffer_t &output )
+        {
+          if( file.method == Z_DEFLATED )
+          {
+            z_stream strm;
+            memset( &strm, 0, sizeof( strm ) );
+            // no gzip headers, pass negative window bits
+            if( inflateInit2( &strm, -MAX_WBITS ) != Z_OK )
+              return XRootDStatus( stError, errInternal, 0, "[zlib] inflateInit2 failed." );
+            strm.next_in   = (Bytef*)data;
+            strm.avail_in  = file.compsize;
+            strm.next_out  = (Bytef*)output.data();
+            strm.avail_out = file.size;
+            // we have all the data, inflate it in one go
+            int rc = inflate( &strm, Z_FINISH );
+            inflateEnd( &strm );
+            if( rc != Z_STREAM_END || strm.avail_out )
+              return XRootDStatus( stError, errDataError, 0, "[zlib] inflate : corrupted data." );
+          }
+          else
+          {
+            if( file.compsize != file.size )
+              return XRootDStatus( stError, errDataError, 0, "Stored file size mismatch." );
+            std::copy( data, data + file.size, output.begin() );
+          }
+
+          uint32_t cksum = crc32( 0, (const Bytef*)output.data(), output.size() );
+          if( cksum != file.crc32 )
+            return XRootDStatus( stError, errDataError, 0, "crc32 mismatch." );
+          return XRootDStatus();
+        }
+
+        std::shared_ptr<ZipPrefetch> cache;
+        std::shared_ptr<PrefetchCtx> ctx;
+        std::shared_ptr<buffer_t>    input;
+        const char                  *data;
+        ZipPrefetch::File            file;
+    };
+
+    //-------------------------------------------------------------------------
+    // Inflating is CPU bound, so it gets a thread-pool of its own rather than
+    // holding up the response handlers in the post master's job manager
+    //-------------------------------------------------------------------------
+    class InflatePool
+    {
+      public:
+        static JobManager& Instance()
+        {
+          static InflatePool pool;
+          return pool.threadpool;
+        }
+
+      private:
+        InflatePool() : threadpool( NumThreads() )
+        {
+          threadpool.Initialize();
+          threadpool.Start();
+        }
+
+        ~InflatePool()
+        {
+          threadpool.Stop();
+          threadpool.Finalize();
+        }
+
+        static uint32_t NumThreads()
+        {
+          uint32_t n = std::thread::hardware_concurrency();
+          return std::min<uint32_t>( std::max<uint32_t>( n, 2 ), 32 );
+        }
+
+        JobManager threadpool;
+    };
+
+    //-------------------------------------------------------------------------
+    // Hand the files of a range that has been read over to the thread-pool
+    //-------------------------------------------------------------------------
+    void InflateRange( std::shared_ptr<ZipPrefetch>  cache,
+                       std::shared_ptr<PrefetchCtx>  ctx,
+                       const XRootDStatus           &st,
+                       std::shared_ptr<buffer_t>     input,
+                       const ZipPrefetch::Range     &range )
+    {
+      for( auto &f : range.files )
+      {
+        if( !st.IsOK() )
+        {
+          cache->Done( f.fn, nullptr, f.compsize + f.size );
+          ctx->Done( st );
+          continue;
+        }
+        const char *data = input->data() + ( f.offset - range.offset );
+        InflatePool::Instance().QueueJob( new InflateJob( cache, ctx, input, data, f ) );
+      }
+    }
+  }
+
   //---------------------------------------------------------------------------
   // Read data from a given file
   //---------------------------------------------------------------------------
@@ -66,30 +333,34 @@ namespace XrdCl
       return XRootDStatus( stError, errNotSupported,
                            0, "The compression algorithm is not supported!" );
 
-    // Now the problem is that at the beginning of our
-    // file there is the Local-file-header, which size
-    // is not known because of the variable size 'extra'
-    // field, so we need to know the offset of the next
-    // record and shift it by the file size.
-    // The next record is either the next LFH (next file)
-    // or the start of the Central-directory.
-    uint64_t cdOffset = me.zip64eocd ? me.zip64eocd->cdOffset : me.eocd->cdOffset;
-    uint64_t nextRecordOffset = ( cditr->second + 1 < me.cdvec.size() ) ?
-                                CDFH::GetOffset( *me.cdvec[cditr->second + 1] ) : cdOffset;
-    uint64_t filesize = cdfh->compressedSize;
-    if( filesize == std::numeric_limits<uint32_t>::max() && cdfh->extra )
-      filesize = cdfh->extra->compressedSize;
-    uint16_t descsize = cdfh->HasDataDescriptor() ?
-                        DataDescriptor::GetSize( cdfh->IsZIP64() ) : 0;
-    uint64_t fileoff  = nextRecordOffset - filesize - descsize;
+    uint64_t fileoff = 0, filesize = 0, uncompressedSize = 0;
+    me.GetDataRange( cditr->second, fileoff, filesize, uncompressedSize );
     uint64_t offset   = fileoff + relativeOffset;
-    uint64_t uncompressedSize = cdfh->uncompressedSize;
-    if( uncompressedSize == std::numeric_limits<uint32_t>::max() && cdfh->extra )
-      uncompressedSize = cdfh->extra->uncompressedSize;
     uint64_t sizeTillEnd = relativeOffset > uncompressedSize ?
                            0 : uncompressedSize - relativeOffset;
     if( size > sizeTillEnd ) size = sizeTillEnd;
 
+    // check if the file has been prefetched
+    std::shared_ptr<buffer_t> prefetched;
+    if( me.prefetch ) prefetched = me.prefetch->Get( fn );
+    if( prefetched )
+    {
+      if( size )
+        memcpy( usrbuff, prefetched->data() + relativeOffset, size );
+      log->Dump( ZipMsg, "[%p] Serving read from prefetched data.", (void*)&me );
+      // the file has been read through, we don't need the data anymore
+      if( relativeOffset + size >= uncompressedSize )
+        me.prefetch->Drop( fn );
+
+      if( usrHandler )
+      {
+        XRootDStatus *st  = ZipArchive::make_status();
+        RSP          *rsp = new RSP( relativeOffset, size, usrbuff );
+        ZipArchive::Schedule( usrHandler, st, rsp );
+      }
+      return XRootDStatus();
+    }
+
     // if it is a compressed file use ZIP cache to read from the file
     if( cdfh->compressionMethod == Z_DEFLATED )
     {
@@ -274,6 +545,15 @@ namespace XrdCl
     Fwd<void*>    rdbuff; // buffer for data to be read
     uint32_t      maxrdsz = EOCD::maxCommentLength + EOCD::eocdBaseSize +
                             ZIP64_EOCDL::zip64EocdlSize;
+    // if we only read, get a bigger tail so that we have a chance to get
+    // the Central Directory with the same read
+    if( !( flags & ( OpenFlags::Update | OpenFlags::Write |
+                     OpenFlags::New    | OpenFlags::Delete ) ) )
+    {
+      int cdrdsz = DefaultZipCDReadSize;
+      DefaultEnv::GetEnv()->GetInt( "ZipCDReadSize", cdrdsz );
+      if( cdrdsz > 0 && uint32_t( cdrdsz ) > maxrdsz ) maxrdsz = cdrdsz;
+    }
 
     Pipeline open_archive = // open the archive
                             XrdCl::Open( archive, url, flags ) >>
@@ -362,10 +642,17 @@ namespace XrdCl
                                       }
 
                                       // It's not ZIP64, we already know where the CD records are
-                                      // we need to read more data
                                       cdoff     = eocd->cdOffset;
                                       orgcdsz   = eocd->cdSize;
                                       orgcdcnt  = eocd->nbCdRec;
+                                      // we might have them already
+                                      if( eocd->cdOffset >= chunk.offset )
+                                      {
+                                        buff = buffer.get() + ( eocd->cdOffset - chunk.offset );
+                                        openstage = HaveCdRecords;
+                                        continue;
+                                      }
+                                      // otherwise we need to read more data
                                       rdoff     = eocd->cdOffset;
                                       rdsize    = eocd->cdSize;
                                       buffer.reset( new char[*rdsize] );
@@ -413,10 +700,18 @@ namespace XrdCl
                                       log->Dump( ZipMsg, "[%p] ZIP64EOCD record parsed: %s",
                                                          (void*)this, zip64eocd->ToString().c_str() );
 
-                                      // now we can read the CD records, adjust the read arguments
                                       cdoff     = zip64eocd->cdOffset;
                                       orgcdsz   = zip64eocd->cdSize;
                                       orgcdcnt  = zip64eocd->nbCdRec;
+                                      // we might have the CD records already
+                                      if( zip64eocd->cdOffset >= chunk.offset &&
+                                          zip64eocd->cdOffset + zip64eocd->cdSize <= chunk.offset + chunk.length )
+                                      {
+                                        buff = buffer.get() + ( zip64eocd->cdOffset - chunk.offset );
+                                        openstage = HaveCdRecords;
+                                        continue;
+                                      }
+                                      // otherwise read the CD records, adjust the read arguments
                                       rdoff     = zip64eocd->cdOffset;
                                       rdsize    = zip64eocd->cdSize;
                                       buffer.reset( new char[*rdsize] );
@@ -598,6 +893,37 @@ namespace XrdCl
     cdexists  = true;
   }
 
+  //---------------------------------------------------------------------------
+  // Get the offset and the size of the data of a file within the ZIP archive
+  //---------------------------------------------------------------------------
+  void ZipArchive::GetDataRange( size_t    index,
+                                 uint64_t &offset,
+                                 uint64_t &compsize,
+                                 uint64_t &size )
+  {
+    CDFH *cdfh = cdvec[index].get();
+
+    // Now the problem is that at the beginning of our
+    // file there is the Local-file-header, which size
+    // is not known because of the variable size 'extra'
+    // field, so we need to know the offset of the next
+    // record and shift it by the file size.
+    // The next record is either the next LFH (next file)
+    // or the start of the Central-directory.
+    uint64_t cdOffset = zip64eocd ? zip64eocd->cdOffset : eocd->cdOffset;
+    uint64_t nextRecordOffset = ( index + 1 < cdvec.size() ) ?
+                                CDFH::GetOffset( *cdvec[index + 1] ) : cdOffset;
+    compsize = cdfh->compressedSize;
+    if( compsize == std::numeric_limits<uint32_t>::max() && cdfh->extra )
+      compsize = cdfh->extra->compressedSize;
+    uint16_t descsize = cdfh->HasDataDescriptor() ?
+                        DataDescriptor::GetSize( cdfh->IsZIP64() ) : 0;
+    offset = nextRecordOffset - compsize - descsize;
+    size   = cdfh->uncompressedSize;
+    if( size == std::numeric_limits<uint32_t>::max() && cdfh->extra )
+      size = cdfh->extra->uncompressedSize;
+  }
+
   //---------------------------------------------------------------------------
   // Create the central directory at the end of ZIP archive and close it
   //---------------------------------------------------------------------------
@@ -714,6 +1040,124 @@ namespace XrdCl
     return ReadFromImpl<PageInfo>( *this, fn, offset, size, buffer, handler, timeout );
   }
 
+  //---------------------------------------------------------------------------
+  // Prefetch the given files and inflate them in the background
+  //---------------------------------------------------------------------------
+  XRootDStatus ZipArchive::Prefetch( const std::vector<std::string> &fns,
+                                     ResponseHandler                *handler,
+                                     time_t                          timeout )
+  {
+    if( openstage != Done || !archive.IsOpen() )
+      return XRootDStatus( stError, errInvalidOp );
+
+    Log *log = DefaultEnv::GetLog();
+
+    //-------------------------------------------------------------------------
+    // Make sure all the files are there and we can inflate them
+    //-------------------------------------------------------------------------
+    std::vector<ZipPrefetch::File> files;
+    files.reserve( fns.size() );
+    for( auto &fn : fns )
+    {
+      auto cditr = cdmap.find( fn );
+      if( cditr == cdmap.end() )
+        return XRootDStatus( stError, errNotFound,
+                             errNotFound, "File not found." );
+      CDFH *cdfh = cdvec[cditr->second].get();
+      if( cdfh->compressionMethod != 0 && cdfh->compressionMethod != Z_DEFLATED )
+        return XRootDStatus( stError, errNotSupported,
+                             0, "The compression algorithm is not supported!" );
+      ZipPrefetch::File f;
+      f.fn     = fn;
+      f.method = cdfh->compressionMethod;
+      f.crc32  = cdfh->ZCRC32;
+      GetDataRange( cditr->second, f.offset, f.compsize, f.size );
+      files.emplace_back( std::move( f ) );
+    }
+
+    if( !prefetch )
+    {
+      int budget = DefaultZipPrefetchBudget;
+      DefaultEnv::GetEnv()->GetInt( "ZipPrefetchBudget", budget );
+      prefetch = std::make_shared<ZipPrefetch>( budget > 0 ? budget : 0 );
+    }
+
+    //-------------------------------------------------------------------------
+    // Skip the files we have already and those that don't fit in the budget
+    //-------------------------------------------------------------------------
+    auto skip = [this, log]( const ZipPrefetch::File &f )
+                {
+                  if( f.compsize <= ZipPrefetch::MaxRead && f.size <= std::numeric_limits<uint32_t>::max() &&
+                      prefetch->Reserve( f.fn, f.compsize + f.size ) )
+                    return false;
+                  log->Dump( ZipMsg, "[%p] Not prefetching %s.", (void*)this, f.fn.c_str() );
+                  return true;
+                };
+    files.erase( std::remove_if( files.begin(), files.end(), skip ), files.end() );
+
+    if( files.empty() )
+    {
+      if( handler ) handler->HandleResponse( make_status(), nullptr );
+      return XRootDStatus();
+    }
+
+    //-------------------------------------------------------------------------
+    // Fetch adjacent files with a single read
+    //-------------------------------------------------------------------------
+    std::sort( files.begin(), files.end(),
+               []( const ZipPrefetch::File &lhs, const ZipPrefetch::File &rhs )
+               {
+                 return lhs.offset < rhs.offset;
+               } );
+    std::vector<ZipPrefetch::Range> ranges;
+    for( auto &f : files )
+    {
+      if( ranges.empty() ||
+          f.offset > ranges.back().offset + ranges.back().size + ZipPrefetch::MaxGap ||
+          f.offset + f.compsize > ranges.back().offset + ZipPrefetch::MaxRead )
+      {
+        ranges.emplace_back();
+        ranges.back().offset = f.offset;
+      }
+      ZipPrefetch::Range &r = ranges.back();
+      r.size = f.offset + f.compsize - r.offset;
+      r.files.push_back( f );
+    }
+
+    log->Debug( ZipMsg, "[%p] Prefetching %zu files with %zu reads.",
+                        (void*)this, files.size(), ranges.size() );
+
+    auto ctx = std::make_shared<PrefetchCtx>( handler, files.size() );
+    for( auto &r : ranges )
+    {
+      // if we have the whole ZIP archive we can inflate straight away
+      if( buffer )
+      {
+        auto begin = buffer.get() + r.offset;
+        auto input = std::make_shared<buffer_t>( begin, begin + r.size );
+        InflateRange( prefetch, ctx, XRootDStatus(), std::move( input ), r );
+        continue;
+      }
+
+      auto input = std::make_shared<buffer_t>( r.size );
+      auto cache = prefetch;
+      Pipeline p = XrdCl::Read( archive, r.offset, r.size, input->data() ) >>
+                     [cache, ctx, input, r, this]( XRootDStatus &st, ChunkInfo &chunk )
+                     {
+                       Log *log = DefaultEnv::GetLog();
+                       log->Dump( ZipMsg, "[%p] Read %u bytes of prefetched data at offset %llu.",
+                                          (void*)this, chunk.length, (unsigned long long) chunk.offset );
+                       XRootDStatus status = st;
+                       if( status.IsOK() && chunk.length != r.size )
+                         status = XRootDStatus( stError, errDataError, 0, "Short read." );
+                       InflateRange( cache, ctx, status, input, r );
+                     };
+      Async( std::move( p ), timeout );
+    }
+
+    return XRootDStatus();
+  }
+
   //---------------------------------------------------------------------------
   // List files in the ZIP archive
   //---------------------------------------------------------------------------
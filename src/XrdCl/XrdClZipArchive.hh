@@ -38,6 +38,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // Forward declaration needed for friendship
@@ -50,6 +51,8 @@ namespace XrdCl
 {
   using namespace XrdZip;
 
+  class ZipPrefetch;
+
   //---------------------------------------------------------------------------
   // ZipArchive provides following functionalities:
   // - parsing of existing ZIP archive
@@ -186,6 +189,25 @@ namespace XrdCl
                                ResponseHandler   *handler,
                                time_t             timeout = 0 );
 
+      //-----------------------------------------------------------------------
+      //! Prefetch the given files and inflate them in the background
+      //!
+      //! The data of adjacent files are fetched with a single read and the
+      //! files are inflated in parallel in a thread-pool of their own, not in
+      //! the one running the response handlers. Subsequent reads of those
+      //! files are served from memory until a read reaches the end of the
+      //! file. Files that do not fit in the memory budget (see
+      //! XRD_ZIPPREFETCHBUDGET) are skipped and read as usual.
+      //!
+      //! @param fns     : the names of the files to be prefetched
+      //! @param handler : user callback (called once all files are ready)
+      //! @param timeout : operation timeout
+      //! @return        : the status of the operation
+      //-----------------------------------------------------------------------
+      XRootDStatus Prefetch( const std::vector<std::string> &fns,
+                             ResponseHandler                *handler,
+                             time_t                          timeout = 0 );
+
       //-----------------------------------------------------------------------
       //! Append data to a new file
       //!
@@ -436,6 +458,20 @@ namespace XrdCl
       //-----------------------------------------------------------------------
       void SetCD( const buffer_t &buffer );
 
+      //-----------------------------------------------------------------------
+      //! Get the offset of the data of a file within the ZIP archive and its
+      //! compressed and uncompressed size
+      //!
+      //! @param index    : index of the CDFH record of the file
+      //! @param offset   : output parameter, offset of the data
+      //! @param compsize : output parameter, compressed size
+      //! @param size     : output parameter, uncompressed size
+      //-----------------------------------------------------------------------
+      void GetDataRange( size_t    index,
+                         uint64_t &offset,
+                         uint64_t &compsize,
+                         uint64_t &size );
+
       //-----------------------------------------------------------------------
       //! Package a response into AnyObject (erase the type)
       //!
@@ -532,6 +568,7 @@ namespace XrdCl
         cdvec.clear();
         cdmap.clear();
         zip64eocd.reset();
+        prefetch.reset();
         openstage = None;
       }
 
@@ -597,6 +634,7 @@ namespace XrdCl
       std::unique_ptr<LFH>        lfh;       //> Local File Header record for the newly appended file
       bool                        ckpinit;   //> a flag indicating whether a checkpoint has been initialized
       new_files_t                 newfiles;  //> all newly appended files
+      std::shared_ptr<ZipPrefetch> prefetch; //> files prefetched and inflated ahead of the reads
   };
 
 } /* namespace XrdZip */
@@ -1772,6 +1772,8 @@ int XrdOfs::xrole(XrdOucStream &Config, XrdSysError &Eroute)
                                          [autorm] [pgm <path> [parms]]
                                          [fcreds  [?]<auth> =<evar>]
                                          [fcpath <path>] [oids]
+                                         [engine {fork | inproc}]
+                                         [xbuf <num>[,<size>]]
 
                                      tpc redirect [xdlg] <host>:<port> [<cgi>]
 
@@ -1809,6 +1811,12 @@ int XrdOfs::xrole(XrdOucStream &Config, XrdSysError &Eroute)
                      credentials to be forwarded.
              fcpath  where creds are stored (default <adminpath>/.ofs/.tpccreds).
              oids    Object ID's are acceptable for the source lfn.
+             engine  how copies are done: fork runs the pgm for each copy
+                     (the default), inproc copies inside the server using
+                     the client library. Copies inproc can't do (forwarded
+                     credentials, reproxying) still run the pgm.
+             xbuf    the number and size of the buffers shared by inproc
+                     copies (default 64,1m).
              <host>  The redirection target host which may be localhost.
              <port>  The redirection target port.
              <cgi>   Optional cgi information.
@@ -1930,6 +1938,28 @@ int XrdOfs::xtpc(XrdOucStream &Config, XrdSysError &Eroute)
              if (emsg) {Eroute.Emsg("Config",emsg,"-", val); return 1;}
              continue;
             }
+         if (!strcmp(val, "engine"))
+            {if (!(val = Config.GetWord()))
+                {Eroute.Emsg("Config","tpc engine not specified"); return 1;}
+                  if (!strcmp(val, "fork"))   Parms.inProc = false;
+             else if (!strcmp(val, "inproc")) Parms.inProc = true;
+             else {Eroute.Emsg("Config","invalid tpc engine -",val); return 1;}
+             continue;
+            }
+         if (!strcmp(val, "xbuf"))
+            {long long bsz;
+             if (!(val = Config.GetWord()))
+                {Eroute.Emsg("Config","tpc xbuf value not specified"); return 1;}
+             char *comma = index(val,',');
+             if (comma)
+                {*comma++ = 0;
+                 if (XrdOuca2x::a2sz(Eroute,"tpc xbuf size",comma,&bsz,
+                                     65536, 16777216)) return 1;
+                 Parms.xbSize = static_cast<int>(bsz);
+                }
+             if (XrdOuca2x::a2i(Eroute,"tpc xbuf",val,&Parms.xbNum,1)) return 1;
+             continue;
+            }
          if (!strcmp(val, "fcpath"))
             {if (!(val = Config.GetWord()))
                 {Eroute.Emsg("Config","tpc fcpath arg not specified"); return 1;}
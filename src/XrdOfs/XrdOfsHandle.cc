@@ -244,11 +244,8 @@ extern XrdOfsStats OfsStats;
 /*                        S t a t i c   O b j e c t s                         */
 /******************************************************************************/
   
-XrdSysMutex   XrdOfsHandle::myMutex;
-XrdOfsHanTab  XrdOfsHandle::roTable;
-XrdOfsHanTab  XrdOfsHandle::rwTable;
+XrdOfsHanShd  XrdOfsHandle::hanShard[XrdOfsHandle::hanShards];
 XrdOssDF     *XrdOfsHandle::ossDF = (XrdOssDF *)new XrdOfsHanOss;
-XrdOfsHandle *XrdOfsHandle::Free = 0;
 
 /******************************************************************************/
 /*                    c l a s s   X r d O f s H a n d l e                     */
@@ -260,33 +257,35 @@ XrdOfsHandle *XrdOfsHandle::Free = 0;
 int XrdOfsHandle::Alloc(const char *thePath, int Opts, XrdOfsHandle **Handle)
 {
    XrdOfsHandle *hP;
-   XrdOfsHanTab *theTable = (Opts & opRW ? &rwTable : &roTable);
    XrdOfsHanKey theKey(thePath, (int)strlen(thePath));
+   XrdOfsHanShd &theShard = Shard(theKey.Hash);
+   XrdOfsHanTab *theTable = (Opts & opRW ? &theShard.rwTable
+                                         : &theShard.roTable);
    int          retc;
 
-// Lock the search table and try to find the key. If found, increment the
-// the link count (can only be done with the global lock) then release the
+// Lock the shard holding the key and try to find the key. If found, increment
+// the link count (can only be done with the shard lock) then release the
 // lock and try to lock the handle. It can't escape between lock calls because
 // the link count is positive. If we can't lock the handle then it must be the
 // that a long running operation is occuring. Return the handle to its former
 // state and return a delay. Otherwise, return the handle.
 //
-   myMutex.Lock();
+   theShard.Lock();
    if ((hP = theTable->Find(theKey)))
-      {hP->Path.Links++; myMutex.UnLock();
+      {hP->Path.Links++; theShard.UnLock();
        if (hP->WaitLock()) {*Handle = hP; return 0;}
-       myMutex.Lock(); hP->Path.Links--; myMutex.UnLock();
+       theShard.Lock(); hP->Path.Links--; theShard.UnLock();
        return nolokDelay;
       }
 
 // Get a new handle
 //
-   if (!(retc = Alloc(theKey, Opts, Handle))) theTable->Add(*Handle);
-   OfsStats.Add(OfsStats.Data.numHandles);
+   if (!(retc = Alloc(theKey, Opts, Handle, theShard))) theTable->Add(*Handle);
+   theShard.UnLock();
 
 // All done
 //
-   myMutex.UnLock();
+   OfsStats.Add(OfsStats.Data.numHandles);
    return retc;
 }
 
@@ -297,12 +296,13 @@ int XrdOfsHandle::Alloc(const char *thePath, int Opts, XrdOfsHandle **Handle)
 int XrdOfsHandle::Alloc(XrdOfsHandle **Handle)
 {
     XrdOfsHanKey myKey("dummy", 5);
+    XrdOfsHanShd &theShard = Shard(myKey.Hash);
     int retc;
 
-    myMutex.Lock();
-    if (!(retc = Alloc(myKey, 0, Handle))) 
+    theShard.Lock();
+    if (!(retc = Alloc(myKey, 0, Handle, theShard)))
        {(*Handle)->Path.Links = 0; (*Handle)->UnLock();}
-    myMutex.UnLock();
+    theShard.UnLock();
     return retc;
 }
 
@@ -310,12 +310,15 @@ int XrdOfsHandle::Alloc(XrdOfsHandle **Handle)
 /* private                      A l l o c   # 3                               */
 /******************************************************************************/
   
-int XrdOfsHandle::Alloc(XrdOfsHanKey theKey, int Opts, XrdOfsHandle **Handle)
+// The shard lock must be held upon entry!
+
+int XrdOfsHandle::Alloc(XrdOfsHanKey theKey, int Opts, XrdOfsHandle **Handle,
+                        XrdOfsHanShd &theShard)
 {
    static const int minAlloc = 4096/sizeof(XrdOfsHandle);
-   XrdOfsHandle *hP;
+   XrdOfsHandle *hP, *&Free = theShard.Free;
 
-// No handle currently in the table. Get a new one off the free list
+// No handle currently in the table. Get a new one off the shard's free list
 //
    if (!Free && (hP = new XrdOfsHandle[minAlloc]))
       {int i = minAlloc; while(i--) {hP->Next = Free; Free = hP; hP++;}}
@@ -347,14 +350,44 @@ void XrdOfsHandle::Hide(const char *thePath)
 {
    XrdOfsHandle *hP;
    XrdOfsHanKey theKey(thePath, (int)strlen(thePath));
+   XrdOfsHanShd &theShard = Shard(theKey.Hash);
 
-// Lock the search table and try to find the key in each table. If found,
-// clear the length field to effectively hide the item.
+// Lock the shard and try to find the key in each table. If found, clear the
+// length field to effectively hide the item. The hash is left alone so the
+// handle stays in the same shard.
 //
-   myMutex.Lock();
-   if ((hP = roTable.Find(theKey))) hP->Path.Len = 0;
-   if ((hP = rwTable.Find(theKey))) hP->Path.Len = 0;
-   myMutex.UnLock();
+   theShard.Lock();
+   if ((hP = theShard.roTable.Find(theKey))) hP->Path.Len = 0;
+   if ((hP = theShard.rwTable.Find(theKey))) hP->Path.Len = 0;
+   theShard.UnLock();
+}
+
+/******************************************************************************/
+/* static public                 S h a r d I n f o                            */
+/******************************************************************************/
+
+void XrdOfsHandle::ShardInfo(XrdOfsHandle::ShardStats &Info)
+{
+   int numHan;
+
+// Collect the lock counters of each shard. We use the raw mutex so that
+// reporting does not show up in the counters it reports.
+//
+   memset(&Info, 0, sizeof(Info));
+   Info.numShards = hanShards;
+   for (int i = 0; i < hanShards; i++)
+       {XrdOfsHanShd &theShard = hanShard[i];
+        theShard.hsMutex.Lock();
+        Info.numLocks += theShard.numLocks;
+        Info.numWaits += theShard.numWaits;
+        if (!i || theShard.numWaits > Info.maxWaits)
+           Info.maxWaits = theShard.numWaits;
+        if (!i || theShard.numWaits < Info.minWaits)
+           Info.minWaits = theShard.numWaits;
+        numHan = theShard.roTable.Count() + theShard.rwTable.Count();
+        theShard.hsMutex.UnLock();
+        if (numHan > Info.maxHandles) Info.maxHandles = numHan;
+       }
 }
 
 /******************************************************************************/
@@ -373,7 +406,7 @@ int XrdOfsHandle::PoscGet(short &Mode, int Done)
        Mode = Posc->Mode;
        if (Done)
           {pP = Posc; Posc = 0;
-           if (pP->xprP) {myMutex.Lock(); Path.Links--; myMutex.UnLock();}
+           if (pP->xprP) {Shard().Lock(); Path.Links--; Shard().UnLock();}
            pP->Recycle();
           }
        return pnum;
@@ -457,30 +490,33 @@ const char *XrdOfsHandle::PoscUsr()
 
 int XrdOfsHandle::Retire(int &retc, long long *retsz, char *buff, int blen)
 {
+   XrdOfsHanShd &theShard = Shard();
    XrdOssDF *mySSI;
    int numLeft;
 
-// Get the global lock as the links field can only be manipulated with it.
+// Get the shard lock as the links field can only be manipulated with it.
 // Decrement the links count and if zero, remove it from the table and
-// place it on the free list. Otherwise, it is still in use.
+// place it on the shard's free list. Otherwise, it is still in use.
 //
    retc = 0;
-   myMutex.Lock();
+   theShard.Lock();
    if (Path.Links == 1)
       {if (buff) strlcpy(buff, Path.Val, blen);
        numLeft = 0; OfsStats.Dec(OfsStats.Data.numHandles);
-       if ( (isRW ? rwTable.Remove(this) : roTable.Remove(this)) )
+       if ( (isRW ? theShard.rwTable.Remove(this)
+                  : theShard.roTable.Remove(this)) )
          {if (Posc) {Posc->Recycle(); Posc = 0;}
           if (Path.Val) {free((void *)Path.Val); Path.Val = (char *)"";}
           Path.Len = 0; mySSI = ssi; ssi = ossDF;
-          Next = Free; Free = this; UnLock(); myMutex.UnLock();
+          Next = theShard.Free; theShard.Free = this;
+          UnLock(); theShard.UnLock();
           if (mySSI && mySSI != ossDF)
              {retc = mySSI->Close(retsz); delete mySSI;}
          } else {
-          UnLock(); myMutex.UnLock();
+          UnLock(); theShard.UnLock();
           OfsEroute.Emsg("Retire", "Lost handle to", buff);
         }
-      } else {numLeft = --Path.Links; UnLock(); myMutex.UnLock();}
+      } else {numLeft = --Path.Links; UnLock(); theShard.UnLock();}
    return numLeft;
 }
 
@@ -495,14 +531,14 @@ int XrdOfsHandle::Retire(XrdOfsHanCB *cbP, int hTime)
 // The handle can only be held by one reference and only if it's a POSC and
 // deferred handling was properly set up.
 //
-   myMutex.Lock();
+   Shard().Lock();
    if (!Posc || !allOK)
       {OfsEroute.Emsg("Retire", "ignoring deferred retire of", Path.Val);
-       if (Path.Links != 1 || !Posc || !cbP) myMutex.UnLock();
-          else {myMutex.UnLock(); cbP->Retired(this);}
+       if (Path.Links != 1 || !Posc || !cbP) Shard().UnLock();
+          else {Shard().UnLock(); cbP->Retired(this);}
        return Retire(retc);
       }
-   myMutex.UnLock();
+   Shard().UnLock();
 
 // If this object already has an xpr object (happens for bouncing connections)
 // then reuse that object. Otherwise create a new one and put it on the queue.
@@ -554,14 +590,15 @@ do{xP = XrdOfsHanXpr::Get(); hP = xP->Handle;
             hP->UnLock(); delete xP; continue;
            }
 
-// As the handle is locked we can get the global handle lock to prevent
-// additions and removals of handles as we need a stable reference count to
-// effect the callout, if any. Do so only if the reference count is one (for us)
-// and the handle is active. In all cases, drop the global lock.
+// As the handle is locked we can get its shard lock to prevent additions and
+// removals of handles as we need a stable reference count to effect the
+// callout, if any. Do so only if the reference count is one (for us) and the
+// handle is active. In all cases, drop the shard lock.
 //
-   myMutex.Lock();
-   if (hP->Path.Links != 1 || !xP->Call) myMutex.UnLock();
-      else {myMutex.UnLock();
+   XrdOfsHanShd &theShard = hP->Shard();
+   theShard.Lock();
+   if (hP->Path.Links != 1 || !xP->Call) theShard.UnLock();
+      else {theShard.UnLock();
             xP->Call->Retired(hP);
            }
 
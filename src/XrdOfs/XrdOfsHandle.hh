@@ -94,6 +94,8 @@ XrdOfsHandle  *Find(XrdOfsHanKey &Key);
 
 int            Remove(XrdOfsHandle *rip);
 
+int            Count() {return nashnum;}
+
 // When allocateing a new nash, specify the required starting size. Make
 // sure that the previous number is the correct Fibonocci antecedent. The
 // series is simply n[j] = n[j-1] + n[j-2].
@@ -114,6 +116,37 @@ int              nashnum;
 int              Threshold;
 };
 
+/******************************************************************************/
+/*                    C l a s s   X r d O f s H a n S h d                     */
+/******************************************************************************/
+
+// Handles are spread over a number of shards by the hash of their path. Each
+// shard has its own pair of tables, free list, and lock. The shard lock is
+// the only lock under which the link count of a handle in that shard may be
+// changed. The lock counts how often it was obtained and how often that
+// required waiting on another thread so that contention can be reported.
+//
+class XrdOfsHanShd
+{
+public:
+
+XrdSysMutex    hsMutex;
+XrdOfsHanTab   roTable;    // File handles open r/o
+XrdOfsHanTab   rwTable;    // File Handles open r/w
+XrdOfsHandle  *Free;       // List of free handles
+long long      numLocks;   // Times the lock was obtained
+long long      numWaits;   // Times the lock was obtained after waiting
+
+inline void    Lock() {if (!hsMutex.CondLock()) {hsMutex.Lock(); numWaits++;}
+                       numLocks++;
+                      }
+inline void    UnLock() {hsMutex.UnLock();}
+
+               XrdOfsHanShd() : roTable(55, 89), rwTable(55, 89), Free(0),
+                                numLocks(0), numWaits(0) {}
+              ~XrdOfsHanShd() {} // Never gets deleted
+};
+
 /******************************************************************************/
 /*                    C l a s s   X r d O f s H a n d l e                     */
 /******************************************************************************/
@@ -143,6 +176,17 @@ static       int    Alloc(                             XrdOfsHandle **Handle);
 
 static       void   Hide(const char *thePath);
 
+struct ShardStats
+      {long long numLocks;   // Shard locks obtained
+       long long numWaits;   // Shard locks obtained after waiting
+       long long maxWaits;   // Most waits in any one shard
+       long long minWaits;   // Fewest waits in any one shard
+       int       numShards;  // Number of shards
+       int       maxHandles; // Most handles in any one shard
+      };
+
+static       void   ShardInfo(ShardStats &Info);
+
 inline       int    Inactive() {return (ssi == ossDF);}
 
 inline const char  *Name() {return Path.Val;}
@@ -174,19 +218,21 @@ inline       void   UnLock() {hMutex.UnLock();}
          ~XrdOfsHandle() {int retc; Retire(retc);}
 
 private:
-static int           Alloc(XrdOfsHanKey, int Opts, XrdOfsHandle **Handle);
+static int           Alloc(XrdOfsHanKey, int Opts, XrdOfsHandle **Handle,
+                           XrdOfsHanShd &theShard);
        int           WaitLock(void);
 
 static const int     LockTries =   3; // Times to try for a lock
 static const int     LockWait  = 333; // Mills to wait between tries
 static const int     nolokDelay=   3; // Secs to delay client when lock failed
 static const int     nomemDelay=  15; // Secs to delay client when ENOMEM
+static const int     hanShards =  64; // Number of handle table shards
+
+static XrdOfsHanShd &Shard(unsigned int hval) {return hanShard[hval%hanShards];}
+inline XrdOfsHanShd &Shard() {return Shard(Path.Hash);}
 
-static XrdSysMutex   myMutex;
-static XrdOfsHanTab  roTable;    // File handles open r/o
-static XrdOfsHanTab  rwTable;    // File Handles open r/w
+static XrdOfsHanShd  hanShard[hanShards];
 static XrdOssDF     *ossDF;      // Dummy storage sysem
-static XrdOfsHandle *Free;       // List of free handles
 
        XrdSysMutex   hMutex;
        XrdOssDF     *ssi;        // Storage System Interface
@@ -29,6 +29,7 @@
 
 #include <cstdio>
 
+#include "XrdOfs/XrdOfsHandle.hh"
 #include "XrdOfs/XrdOfsStats.hh"
 
 /******************************************************************************/
@@ -42,9 +43,12 @@ int XrdOfsStats::Report(char *buff, int blen)
            "<rdr>%d</rdr><bxq>%d</bxq><rep>%d</rep><err>%d</err><dly>%d</dly>"
            "<sok>%d</sok><ser>%d</ser>"
            "<tpc><grnt>%d</grnt><deny>%d</deny><err>%d</err><exp>%d</exp></tpc>"
+           "<hsh><n>%d</n><lk>%lld</lk><wt>%lld</wt><wmax>%lld</wmax>"
+           "<wmin>%lld</wmin><hmax>%d</hmax></hsh>"
            "</stats>";
-    static const int  statsz = sizeof(stats1) + (12*10) + 64;
+    static const int  statsz = sizeof(stats1) + (12*10) + (6*20) + 64;
 
+    XrdOfsHandle::ShardStats hsData;
     StatsData myData;
 
 // If only the size is wanted, return the size
@@ -60,6 +64,7 @@ int XrdOfsStats::Report(char *buff, int blen)
    sdMutex.Lock();
    myData = Data;
    sdMutex.UnLock();
+   XrdOfsHandle::ShardInfo(hsData);
 
 // Format the buffer
 //
@@ -69,5 +74,7 @@ int XrdOfsStats::Report(char *buff, int blen)
                     myData.numErrors,   myData.numDelays,
                     myData.numSeventOK, myData.numSeventER,
                     myData.numTPCgrant, myData.numTPCdeny,
-                    myData.numTPCerrs,  myData.numTPCexpr);
+                    myData.numTPCerrs,  myData.numTPCexpr,
+                    hsData.numShards,   hsData.numLocks,   hsData.numWaits,
+                    hsData.maxWaits,    hsData.minWaits,   hsData.maxHandles);
 }
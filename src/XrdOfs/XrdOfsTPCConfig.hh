@@ -45,17 +45,22 @@ int    dflTTL;
 int    tcpSTRM;
 int    tcpSMax;
 int    xfrMax;
+int    xbNum;
+int    xbSize;
 int    errMon;
 bool   LogOK;
 bool   doEcho;
 bool   autoRM;
 bool   noids;
 bool   fCreds;
+bool   inProc;
 
        XrdOfsTPCConfig() : tpcMon(0), XfrProg(0), cksType(0), cPath(0), rPath(0),
                            maxTTL(15), dflTTL(7),  tcpSTRM(0),   tcpSMax(15),
-                           xfrMax(9),  errMon(-3), LogOK(false), doEcho(false),
-                           autoRM(false), noids(true), fCreds(false)
+                           xfrMax(9),  xbNum(64), xbSize(1048576),
+                           errMon(-3), LogOK(false), doEcho(false),
+                           autoRM(false), noids(true), fCreds(false),
+                           inProc(false)
                            {}
 
       ~XrdOfsTPCConfig() {} // Never deleted
@@ -0,0 +1,523 @@
+/******************************************************************************/
+/*                                                                            */
+/*                      X r d O f s T P C C o p y . c c                       */
+/*                                                                            */
+/* (c) 2026 by the Board of Trustees of the Leland Stanford, Jr., University  */
+/*                            All Rights Reserved                             */
+/*   Produced by Andrew Hanushevsky for Stanford University under contract    */
+/*              DE-AC02-76-SFO0515 with the Department of Energy              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <strings.h>
+#include <unistd.h>
+#include <vector>
+
+#include "XrdVersion.hh"
+#include "XrdCks/XrdCksCalc.hh"
+#include "XrdCks/XrdCksData.hh"
+#include "XrdCl/XrdClCheckSumManager.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClFile.hh"
+#include "XrdCl/XrdClURL.hh"
+#include "XrdCl/XrdClUtils.hh"
+#include "XrdCl/XrdClXRootDResponses.hh"
+#include "XrdNet/XrdNetAddr.hh"
+#include "XrdOfs/XrdOfsTPCConfig.hh"
+#include "XrdOfs/XrdOfsTPCCopy.hh"
+#include "XrdOfs/XrdOfsTPCJob.hh"
+#include "XrdOfs/XrdOfsTrace.hh"
+#include "XProtocol/XProtocol.hh"
+#include "XrdSys/XrdSysE2T.hh"
+#include "XrdSys/XrdSysError.hh"
+#include "XrdSys/XrdSysFD.hh"
+
+/******************************************************************************/
+/*                        G l o b a l   O b j e c t s                         */
+/******************************************************************************/
+  
+extern XrdSysError  OfsEroute;
+extern XrdSysTrace  OfsTrace;
+
+namespace XrdOfsTPCParms
+{
+extern XrdOfsTPCConfig Cfg;
+}
+
+using namespace XrdOfsTPCParms;
+
+/******************************************************************************/
+/*                         L o c a l   C l a s s e s                          */
+/******************************************************************************/
+
+namespace
+{
+// The buffer pool shared by all transfers. Buffers are allocated on demand up
+// to the configured number. Requests are served strictly in the order they
+// were made (ticket order) so that no transfer can starve the others.
+//
+class bufPool
+{
+public:
+
+char *Get()
+     {char *bP;
+      bpCV.Lock();
+      unsigned long long myTurn = nextTkt++;
+      while(myTurn != nowServing || (freeBuf.empty() && numBufs >= maxBufs))
+           bpCV.Wait();
+      nowServing++;
+      if (freeBuf.empty())
+         {if (posix_memalign((void **)&bP, 4096, bufSize)) bP = 0;
+             else numBufs++;
+         } else {bP = freeBuf.back(); freeBuf.pop_back();}
+      bpCV.Broadcast();
+      bpCV.UnLock();
+      return bP;
+     }
+
+void  Put(char *bP)
+         {bpCV.Lock();
+          freeBuf.push_back(bP);
+          bpCV.Broadcast();
+          bpCV.UnLock();
+         }
+
+int   Size() {return bufSize;}
+
+      bufPool(int bNum, int bSize)
+             : bpCV(0, "TPC buffer pool"), nextTkt(0), nowServing(0),
+               numBufs(0), maxBufs(bNum), bufSize(bSize) {}
+     ~bufPool() {} // Never deleted
+
+private:
+
+XrdSysCondVar       bpCV;
+std::vector<char *> freeBuf;
+unsigned long long  nextTkt;
+unsigned long long  nowServing;
+int                 numBufs;
+int                 maxBufs;
+int                 bufSize;
+};
+
+bufPool *thePool = 0;
+
+// Convert a client status to an errno value.
+//
+int xclRC(const XrdCl::XRootDStatus &Status)
+{
+   if (Status.code == XrdCl::errErrorResponse)
+      return XProtocol::toErrno(Status.errNo);
+   if (Status.code == XrdCl::errOperationExpired) return ETIMEDOUT;
+   return (Status.errNo ? static_cast<int>(Status.errNo) : EIO);
+}
+}
+
+/******************************************************************************/
+/*                           C o n s t r u c t o r                            */
+/******************************************************************************/
+
+XrdOfsTPCCopy::XrdOfsTPCCopy(XrdOfsTPCJob *jP, const char *pName)
+                : xfrCV(0, "TPC engine"), Job(jP), Pname(pName),
+                  srcFile(new XrdCl::File()), cksCalc(0), fSize(0), nxtOff(0),
+                  cksOff(0), bytesDone(0), dstFD(-1), inFlight(0), eCode(0)
+                {}
+
+/******************************************************************************/
+/*                            D e s t r u c t o r                             */
+/******************************************************************************/
+
+XrdOfsTPCCopy::~XrdOfsTPCCopy()
+{
+   if (dstFD >= 0) close(dstFD);
+   if (cksCalc) delete cksCalc;
+   delete srcFile;
+}
+
+/******************************************************************************/
+/*                                C a n c e l                                 */
+/******************************************************************************/
+
+void XrdOfsTPCCopy::Cancel()
+{
+// Stop issuing reads. The reads in flight are allowed to complete.
+//
+   xfrCV.Lock();
+   Fail(ECANCELED, "destination file prematurely closed");
+   xfrCV.Signal();
+   xfrCV.UnLock();
+}
+
+/******************************************************************************/
+/* Private:                         D o n e                                   */
+/******************************************************************************/
+
+void XrdOfsTPCCopy::Done(uint64_t offs, uint32_t blen, char *buff,
+                           XrdCl::XRootDStatus &Status, XrdCl::AnyObject &Resp)
+{
+   XrdCl::ChunkInfo *ciP = 0;
+   std::string eMsg;
+   char *bP = buff;
+   int rc = 0;
+
+// Write out what we read. The source should not change size while we copy it.
+//
+   if (!Status.IsOK())
+      {rc = xclRC(Status); eMsg = Status.ToString();}
+      else {Resp.Get(ciP);
+            if (!ciP || ciP->length != blen)
+               {rc = EIO; eMsg = "source file changed size";}
+               else {ssize_t wlen;
+                     uint32_t done = 0;
+                     while(done < blen)
+                          {if ((wlen = pwrite(dstFD, buff+done, blen-done,
+                                              offs+done)) < 0)
+                              {if (errno == EINTR) continue;
+                               rc = errno; eMsg = "unable to write destination";
+                               break;
+                              }
+                           done += wlen;
+                          }
+                    }
+           }
+
+// Account for this read. When checksumming, data must be fed to the checksum
+// in offset order, so hold on to the buffer until the preceding data is in.
+//
+   xfrCV.Lock();
+   if (rc) Fail(rc, eMsg);
+      else {bytesDone += blen;
+            if (cksCalc && !eCode)
+               {cksHeld[offs] = std::make_pair(buff, blen); bP = 0;
+                std::map<uint64_t, std::pair<char *, uint32_t> >::iterator it;
+                while((it = cksHeld.begin()) != cksHeld.end()
+                   &&  it->first == cksOff)
+                     {cksCalc->Update(it->second.first, it->second.second);
+                      cksOff += it->second.second;
+                      thePool->Put(it->second.first);
+                      cksHeld.erase(it);
+                     }
+               }
+           }
+   if (bP) thePool->Put(bP);
+   inFlight--;
+   xfrCV.Signal();
+   xfrCV.UnLock();
+}
+
+/******************************************************************************/
+/* Private:                         F a i l                                   */
+/******************************************************************************/
+
+// The xfrCV lock must be held upon entry! Only the first error is recorded.
+
+int XrdOfsTPCCopy::Fail(int rc, const std::string &eMsg)
+{
+   if (!eCode) {eCode = rc; eText = eMsg;}
+   return eCode;
+}
+
+/******************************************************************************/
+/*                                  I n i t                                   */
+/******************************************************************************/
+
+bool XrdOfsTPCCopy::Init()
+{
+   char buff[256];
+
+// The server still forks the copy program for the jobs we can't handle. The
+// client's fork handler would stop and restart all of its threads around each
+// of those forks, which is pointless as the child immediately execs.
+//
+   XrdCl::DefaultEnv::GetEnv()->PutInt("RunForkHandler", 0);
+
+// The number of streams is a client wide setting when copying in process. Use
+// the configured default for all transfers.
+//
+   if (Cfg.tcpSTRM > 1)
+      XrdCl::DefaultEnv::GetEnv()->PutInt("SubStreamsPerChannel", Cfg.tcpSTRM);
+
+// Allocate the buffer pool, the buffers themselves are allocated on demand
+//
+   thePool = new bufPool(Cfg.xbNum, Cfg.xbSize);
+
+   snprintf(buff, sizeof(buff), "%d buffers of %dK each.",
+            Cfg.xbNum, Cfg.xbSize/1024);
+   OfsEroute.Say("Config tpc copies in process using up to ", buff);
+   return true;
+}
+
+/******************************************************************************/
+/* Private:                     P r o g r e s s                               */
+/******************************************************************************/
+
+void XrdOfsTPCCopy::Progress(const char *What)
+{
+   char buff[128];
+
+   snprintf(buff, sizeof(buff), "%llu of %llu bytes",
+            static_cast<unsigned long long>(bytesDone),
+            static_cast<unsigned long long>(fSize));
+   OfsEroute.Say(Pname, What, buff);
+}
+
+/******************************************************************************/
+/*                                U s a b l e                                 */
+/******************************************************************************/
+
+bool XrdOfsTPCCopy::Usable(XrdOfsTPCJob *jP)
+{
+   const char *cksVal = (jP->Info.Cks ? jP->Info.Cks : Cfg.cksType);
+
+// Forwarded credentials are handed to the copy program in a file and a
+// reproxy target is handled by the program as well. Checksum negotiation
+// ("auto") is only done by the program.
+//
+   if (!thePool || (jP->Info.Csz > 0 && jP->Info.Crd) || jP->Info.Rpx)
+      return false;
+   if (cksVal && !strncasecmp(cksVal, "auto", 4)
+   &&  (cksVal[4] == 0 || cksVal[4] == ':')) return false;
+   return true;
+}
+
+/******************************************************************************/
+/* Private:                       V e r i f y                                 */
+/******************************************************************************/
+
+int XrdOfsTPCCopy::Verify(char *eBuff, int eBlen)
+{
+   EPNAME("Verify");
+   const char *tident = Job->Info.Org;
+   XrdCksData cksData;
+   std::string cksMine, cksSrc;
+   char cksHex[264];
+   int csz;
+
+// Compute our checksum
+//
+   cksCalc->Type(csz);
+   cksData.Set(cksType.c_str());
+   cksData.Set((void *)cksCalc->Final(), csz);
+   cksData.Get(cksHex, sizeof(cksHex));
+   cksMine = XrdCl::Utils::NormalizeChecksum(cksType, cksHex);
+
+// Get the checksum we need to match. Either it was given to us or we must
+// ask the source for it.
+//
+   if (cksWant.length())
+      cksSrc = XrdCl::Utils::NormalizeChecksum(cksType, cksWant);
+      else {XrdCl::XRootDStatus st;
+            st = XrdCl::Utils::GetRemoteCheckSum(cksSrc, cksType,
+                                                 XrdCl::URL(Job->Info.Key));
+            if (!st.IsOK())
+               {snprintf(eBuff, eBlen, "Copy failed; unable to get source "
+                         "%s checksum; %s", cksType.c_str(),
+                         st.ToString().c_str());
+                return xclRC(st);
+               }
+            cksSrc.erase(0, cksSrc.find(':')+1);
+           }
+
+// Compare the two
+//
+   DEBUG(Pname <<cksType <<" source=" <<cksSrc <<" target=" <<cksMine);
+   if (cksSrc != cksMine)
+      {snprintf(eBuff, eBlen, "Copy failed; %s checksum mismatch (source %s "
+                "target %s)", cksType.c_str(), cksSrc.c_str(), cksMine.c_str());
+       return EIO;
+      }
+   return 0;
+}
+
+/******************************************************************************/
+/*                                   X e q                                    */
+/******************************************************************************/
+
+int XrdOfsTPCCopy::Xeq(char *eBuff, int eBlen, bool &isIPv4)
+{
+   EPNAME("Xeq");
+   const char *tident = Job->Info.Org;
+   XrdCl::XRootDStatus st;
+   XrdCl::StatInfo *sP = 0;
+   XrdCl::ResponseHandler *hP;
+   std::string dstPath(Job->Info.Dst), dSrv;
+   const char *cksVal = (Job->Info.Cks ? Job->Info.Cks : Cfg.cksType);
+   const char *Colon;
+   char *bP;
+   time_t nextEcho = time(0) + echoIntv;
+   uint64_t offs;
+   uint32_t blen;
+   size_t qPos;
+   int rc;
+
+// The destination may carry cgi which is not part of the path
+//
+   isIPv4 = false;
+   if ((qPos = dstPath.find('?')) != std::string::npos) dstPath.erase(qPos);
+
+// Determine the checksum to verify: type (end-to-end), type:print (same) or
+// type:<value>. For type:source the source checksum is merely displayed by
+// the copy program, so there is nothing to verify here.
+//
+   if (cksVal)
+      {if ((Colon = index(cksVal, ':'))) cksType.assign(cksVal, Colon-cksVal);
+          else cksType = cksVal;
+       if (!Colon || strcmp(Colon+1, "source"))
+          {if (Colon && strcmp(Colon+1, "print")) cksWant = Colon+1;
+           XrdCl::CheckSumManager *ckm = XrdCl::DefaultEnv::GetCheckSumManager();
+           if (!ckm || !(cksCalc = ckm->GetCalculator(cksType)))
+              {snprintf(eBuff, eBlen, "Copy failed; %s checksum is not "
+                        "supported.", cksType.c_str());
+               return ENOTSUP;
+              }
+          }
+      }
+
+// Open the source and get its size
+//
+   st = srcFile->Open(Job->Info.Key, XrdCl::OpenFlags::Read);
+   if (st.IsOK()) st = srcFile->Stat(false, sP);
+   if (!st.IsOK())
+      {snprintf(eBuff, eBlen, "Copy failed; unable to open source; %s",
+                st.ToString().c_str());
+       return xclRC(st);
+      }
+   fSize = sP->GetSize();
+   delete sP;
+
+// Record whether we reached the source over IPv4
+//
+   if (srcFile->GetProperty("DataServer", dSrv))
+      {XrdNetAddr dAddr;
+       if (!dAddr.Set(dSrv.c_str()))
+          isIPv4 = dAddr.isIPType(XrdNetAddrInfo::IPv4) || dAddr.isMapped();
+      }
+
+// Open the destination, it has been created by the client's open
+//
+   if ((dstFD = XrdSysFD_Open(dstPath.c_str(), O_WRONLY)) < 0)
+      {rc = errno;
+       snprintf(eBuff, eBlen, "Copy failed; unable to open destination; %s",
+                XrdSysE2T(rc));
+       st = srcFile->Close();
+       return rc;
+      }
+   DEBUG(Pname <<"copying " <<fSize <<" bytes to " <<dstPath);
+
+// Issue the reads, keeping at most xfrDepth buffers in use. That includes the
+// buffers held back for the checksum, which are released as soon as the read
+// they wait for, necessarily in flight, completes. The buffer pool decides
+// when it is our turn to get more memory.
+//
+   xfrCV.Lock();
+   while(!eCode && nxtOff < fSize)
+        {while(inFlight + (int)cksHeld.size() >= xfrDepth && !eCode)
+              xfrCV.Wait();
+         if (eCode) break;
+         xfrCV.UnLock();
+         bP = thePool->Get();
+         xfrCV.Lock();
+         if (!bP) {Fail(ENOMEM, "insufficient memory"); break;}
+         if (eCode) {thePool->Put(bP); break;}
+         offs = nxtOff;
+         blen = (fSize - nxtOff < (uint64_t)thePool->Size()
+              ?  fSize - nxtOff : thePool->Size());
+         nxtOff += blen;
+         inFlight++;
+         xfrCV.UnLock();
+         hP = XrdCl::ResponseHandler::Wrap(
+              [this, offs, blen, bP](XrdCl::XRootDStatus &rst, XrdCl::AnyObject &rsp)
+                 {Done(offs, blen, bP, rst, rsp);});
+         st = srcFile->Read(offs, blen, bP, hP);
+         xfrCV.Lock();
+         if (!st.IsOK())
+            {delete hP;
+             inFlight--;
+             thePool->Put(bP);
+             Fail(xclRC(st), st.ToString());
+            }
+         if (Cfg.doEcho && time(0) >= nextEcho)
+            {Progress("copied ");
+             nextEcho = time(0) + echoIntv;
+            }
+        }
+
+// Wait for the reads in flight to complete
+//
+   while(inFlight)
+        {if (xfrCV.Wait(echoIntv) && Cfg.doEcho) Progress("copied ");}
+
+// Return any buffers that were waiting to be checksummed
+//
+   std::map<uint64_t, std::pair<char *, uint32_t> >::iterator it;
+   for (it = cksHeld.begin(); it != cksHeld.end(); ++it)
+       thePool->Put(it->second.first);
+   cksHeld.clear();
+   rc = eCode;
+   xfrCV.UnLock();
+
+// Close the source, errors do not matter as we have all the data
+//
+   st = srcFile->Close();
+
+// Complete the destination
+//
+   if (!rc)
+      {if (ftruncate(dstFD, fSize)) rc = errno;
+       if (close(dstFD) && !rc) rc = errno;
+       dstFD = -1;
+       if (rc) snprintf(eBuff, eBlen, "Copy failed; unable to complete "
+                        "destination; %s", XrdSysE2T(rc));
+      } else snprintf(eBuff, eBlen, "Copy failed; %s", eText.c_str());
+
+// Verify the checksum if need be
+//
+   if (!rc && cksCalc) rc = Verify(eBuff, eBlen);
+
+// All done
+//
+   if (!rc && Cfg.doEcho) Progress("completed; ");
+   return rc;
+}
+
+/******************************************************************************/
+/*                    P l u g i n   E n t r y   P o i n t s                   */
+/******************************************************************************/
+
+extern "C"
+{
+bool XrdOfsTPCEngineInit() {return XrdOfsTPCCopy::Init();}
+
+XrdOfsTPCEngine *XrdOfsTPCEngineNew(XrdOfsTPCJob *jP, const char *pName)
+{
+   return (XrdOfsTPCCopy::Usable(jP) ? new XrdOfsTPCCopy(jP, pName) : 0);
+}
+}
+
+XrdVERSIONINFO(XrdOfsTPCEngineNew,TPCEngine);
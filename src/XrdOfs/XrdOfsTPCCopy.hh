@@ -0,0 +1,104 @@
+#ifndef __XRDOFSTPCCOPY_HH__
+#define __XRDOFSTPCCOPY_HH__
+/******************************************************************************/
+/*                                                                            */
+/*                      X r d O f s T P C C o p y . h h                       */
+/*                                                                            */
+/* (c) 2026 by the Board of Trustees of the Leland Stanford, Jr., University  */
+/*                            All Rights Reserved                             */
+/*   Produced by Andrew Hanushevsky for Stanford University under contract    */
+/*              DE-AC02-76-SFO0515 with the Department of Energy              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "XrdOfs/XrdOfsTPCEngine.hh"
+#include "XrdSys/XrdSysPthread.hh"
+
+class XrdCksCalc;
+class XrdOfsTPCJob;
+
+namespace XrdCl
+{
+class AnyObject;
+class File;
+class XRootDStatus;
+}
+
+/******************************************************************************/
+/*                   C l a s s   X r d O f s T P C C o p y                    */
+/******************************************************************************/
+
+// The engine's copy of a single job. The source is read with the XrdCl client
+// and the destination pfn is written directly. Reads are issued asynchronously
+// into buffers taken from a pool shared by all transfers. The pool hands out
+// buffers in request order so that concurrent transfers get an even share of
+// the memory and of the bandwidth it stands for.
+//
+class XrdOfsTPCCopy : public XrdOfsTPCEngine
+{
+public:
+
+       void   Cancel() override;
+
+static bool   Init();
+
+static bool   Usable(XrdOfsTPCJob *jP);
+
+       int    Xeq(char *eBuff, int eBlen, bool &isIPv4) override;
+
+              XrdOfsTPCCopy(XrdOfsTPCJob *jP, const char *pName);
+
+             ~XrdOfsTPCCopy();
+
+private:
+
+void          Done(uint64_t offs, uint32_t blen, char *buff,
+                   XrdCl::XRootDStatus &Status, XrdCl::AnyObject &Resp);
+int           Fail(int rc, const std::string &eMsg);
+void          Progress(const char *What);
+int           Verify(char *eBuff, int eBlen);
+
+static const int    xfrDepth = 8;  // Maximum buffers in use per transfer
+static const int    echoIntv = 30; // Seconds between progress messages
+
+XrdSysCondVar       xfrCV;
+XrdOfsTPCJob       *Job;
+const char         *Pname;
+XrdCl::File        *srcFile;
+XrdCksCalc         *cksCalc;
+std::map<uint64_t, std::pair<char *, uint32_t> > cksHeld; // Out of order
+std::string         cksType;
+std::string         cksWant;
+std::string         eText;
+uint64_t            fSize;
+uint64_t            nxtOff;
+uint64_t            cksOff;
+uint64_t            bytesDone;
+int                 dstFD;
+int                 inFlight;
+int                 eCode;
+};
+#endif
@@ -0,0 +1,74 @@
+#ifndef __XRDOFSTPCENGINE_HH__
+#define __XRDOFSTPCENGINE_HH__
+/******************************************************************************/
+/*                                                                            */
+/*                    X r d O f s T P C E n g i n e . h h                     */
+/*                                                                            */
+/* (c) 2026 by the Board of Trustees of the Leland Stanford, Jr., University  */
+/*                            All Rights Reserved                             */
+/*   Produced by Andrew Hanushevsky for Stanford University under contract    */
+/*              DE-AC02-76-SFO0515 with the Department of Energy              */
+/*                                                                            */
+/* This file is part of the XRootD software suite.                            */
+/*                                                                            */
+/* XRootD is free software: you can redistribute it and/or modify it under    */
+/* the terms of the GNU Lesser General Public License as published by the     */
+/* Free Software Foundation, either version 3 of the License, or (at your     */
+/* option) any later version.                                                 */
+/*                                                                            */
+/* XRootD is distributed in the hope that it will be useful, but WITHOUT      */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public       */
+/* License for more details.                                                  */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with XRootD in a file called COPYING.LESSER (LGPL license) and file  */
+/* COPYING (GPL license).  If not, see <http://www.gnu.org/licenses/>.        */
+/*                                                                            */
+/* The copyright holder's institutional names and contributor's names may not */
+/* be used to endorse or promote products derived from this software without  */
+/* specific prior written permission of the institution or contributor.       */
+/******************************************************************************/
+
+class XrdOfsTPCJob;
+
+/******************************************************************************/
+/*                 C l a s s   X r d O f s T P C E n g i n e                  */
+/******************************************************************************/
+
+// The in-process copy engine. Instead of forking the copy program, a job is
+// copied by the XrdCl client inside the server. The engine lives in its own
+// library (libXrdOfsTPCEngine.so) which is only loaded when "ofs.tpc engine
+// inproc" is configured, so the server does not otherwise depend on the
+// client. Jobs the engine can't handle (e.g. forwarded credentials or
+// reproxying) still use the program.
+//
+// The library provides the following entry points:
+//
+// extern "C" bool             XrdOfsTPCEngineInit();
+//
+//            Initializes the engine. Returns false upon failure.
+//
+// extern "C" XrdOfsTPCEngine *XrdOfsTPCEngineNew(XrdOfsTPCJob *jP,
+//                                                const char   *pName);
+//
+//            Returns an engine object to copy the job or nil if the job must
+//            be handed to the copy program. The caller deletes the object.
+//
+class XrdOfsTPCEngine
+{
+public:
+
+// Cancel the copy, it is called while Xeq() runs in another thread.
+//
+virtual void   Cancel() = 0;
+
+// Copy the job. Returns 0 upon success or an errno value with the reason in
+// eBuff. isIPv4 is set when the source was reached over IPv4.
+//
+virtual int    Xeq(char *eBuff, int eBlen, bool &isIPv4) = 0;
+
+               XrdOfsTPCEngine() {}
+virtual       ~XrdOfsTPCEngine() {}
+};
+#endif
@@ -36,15 +36,18 @@
 #include "XrdNet/XrdNetIdentity.hh"
 #include "XrdOfs/XrdOfsTPC.hh"
 #include "XrdOfs/XrdOfsTPCConfig.hh"
+#include "XrdOfs/XrdOfsTPCEngine.hh"
 #include "XrdOfs/XrdOfsTPCJob.hh"
 #include "XrdOfs/XrdOfsTPCProg.hh"
 #include "XrdOfs/XrdOfsTrace.hh"
 #include "XrdOss/XrdOss.hh"
 #include "XrdOuc/XrdOucCallBack.hh"
+#include "XrdOuc/XrdOucPinLoader.hh"
 #include "XrdOuc/XrdOucProg.hh"
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysFD.hh"
 #include "XrdSys/XrdSysHeaders.hh"
+#include "XrdVersion.hh"
 
 #include "XrdXrootd/XrdXrootdTpcMon.hh"
 
@@ -70,6 +73,15 @@ using namespace XrdOfsTPCParms;
 XrdSysMutex        XrdOfsTPCProg::pgmMutex;
 XrdOfsTPCProg     *XrdOfsTPCProg::pgmIdle  = 0;
 
+namespace
+{
+// The in process engine, only set when its library has been loaded
+//
+XrdOfsTPCEngine *(*engNew)(XrdOfsTPCJob *, const char *) = 0;
+}
+
+XrdVERSIONINFOREF(XrdOfs);
+
 /******************************************************************************/
 /*                     E x t e r n a l   L i n k a g e s                      */
 /******************************************************************************/
@@ -122,10 +134,24 @@ int         credFile::cSeq = 0;
 XrdOfsTPCProg::XrdOfsTPCProg(XrdOfsTPCProg *Prev, int num, int errMon)
              : Prog(&OfsEroute, errMon),
                JobStream(&OfsEroute),
-               Next(Prev), Job(0)
+               Next(Prev), Job(0), xfrP(0)
              {snprintf(Pname, sizeof(Pname), "TPC job %d: ", num);
               Pname[sizeof(Pname)-1] = 0;
              }
+
+/******************************************************************************/
+/*                                C a n c e l                                 */
+/******************************************************************************/
+
+void XrdOfsTPCProg::Cancel()
+{
+// Stop the in process transfer or, if the job runs the program, drain it
+//
+   xfrMutex.Lock();
+   if (xfrP) xfrP->Cancel();
+      else JobStream.Drain();
+   xfrMutex.UnLock();
+}
   
 /******************************************************************************/
 /*                           E x p o r t C r e d s                            */
@@ -160,6 +186,103 @@ int fd, rc;
    return rc;
 }
 
+/******************************************************************************/
+/*                                  F o r k                                   */
+/******************************************************************************/
+
+int XrdOfsTPCProg::Fork(bool &isIPv4, char *credEnv)
+{
+   EPNAME("Fork");
+   const char *Args[6], *eVec[6], **envArg;
+   char *lP, *Colon, *cksVal, sBuff[8], *tident = Job->Info.Org;
+   int i, rc, aNum = 0;
+
+// Determine checksum option
+//
+   cksVal = (Job->Info.Cks ? Job->Info.Cks : Cfg.cksType);
+   if (cksVal)
+      {Args[aNum++] = "-C";
+       Args[aNum++] = cksVal;
+      }
+
+// Set streams option if need be
+//
+   if (Job->Info.Str)
+      {sprintf(sBuff, "%d", static_cast<int>(Job->Info.Str));
+       Args[aNum++] = "-S";
+       Args[aNum++] = sBuff;
+      }
+
+// Set remaining arguments
+//
+   Args[aNum++] = Job->Info.Key;
+   Args[aNum++] = Job->Info.Dst;
+
+// Always export the trace identifier of the original issuer
+//
+   char tidBuff[512];
+   snprintf(tidBuff, sizeof(tidBuff), "XRD_TIDENT=%s", tident);
+   eVec[0] = tidBuff;
+   envArg = eVec;
+   i = 1;
+
+// Export source protocol if present
+//
+   char sprBuff[128];
+   if (Job->Info.Spr)
+      {snprintf(sprBuff, sizeof(sprBuff), "XRDTPC_SPROT=%s", Job->Info.Spr);
+       eVec[i++] = sprBuff;
+      }
+
+// Export target protocol if present
+//
+   char tprBuff[128];
+   if (Job->Info.Tpr)
+      {snprintf(tprBuff, sizeof(tprBuff), "XRDTPC_TPROT=%s", Job->Info.Tpr);
+       eVec[i++] = tprBuff;
+      }
+
+// If we need to reproxy, export the path
+//
+   char rpxBuff[1024];
+   if (Job->Info.Rpx)
+      {snprintf(rpxBuff, sizeof(rpxBuff), "XRD_CPTARGET=%s", Job->Info.Rpx);
+       eVec[i++] = rpxBuff;
+      }
+
+// Determine if credentials are being passed, If so, pass where it is.
+//
+   if (credEnv) eVec[i++] = credEnv;
+   eVec[i] = 0;
+
+// Start the job.
+//
+   if ((rc = Prog.Run(&JobStream, Args, aNum, envArg)))
+      {strcpy(eRec, "Copy failed; unable to start job.");
+       return rc;
+      }
+
+// Now we drain the output looking for an end of run line. This line should
+// be printed as an error message should the copy fail.
+//
+   *eRec = 0;
+   isIPv4 = false;
+   while((lP = JobStream.GetLine()))
+        {if (!strcmp(lP, "!-!IPv4")) isIPv4 = true;
+         if ((Colon = index(lP, ':')) && *(Colon+1) == ' ')
+            {strncpy(eRec, Colon+2, sizeof(eRec)-1); 
+             eRec[sizeof(eRec)-1] = 0;
+            }
+         if (Cfg.doEcho && *lP) OfsEroute.Say(Pname, lP);
+        }
+
+// The job has completed. So, we must get the ending status.
+//
+   if ((rc = Prog.RunDone(JobStream)) < 0) rc = -rc;
+   DEBUG(Pname <<"ended with rc=" <<rc);
+   return rc;
+}
+  
 /******************************************************************************/
 /*                                  I n i t                                   */
 /******************************************************************************/
@@ -175,6 +298,18 @@ int XrdOfsTPCProg::Init()
         if (pgmIdle->Prog.Setup(Cfg.XfrProg, &OfsEroute)) return 0;
        }
 
+// Set up the in process engine if so wanted. The programs are still needed
+// for jobs that the engine can't handle.
+//
+   if (Cfg.inProc)
+      {XrdOucPinLoader engLib(&OfsEroute, &XrdVERSIONINFOVAR(XrdOfs),
+                              "tpc engine", "libXrdOfsTPCEngine.so");
+       bool (*engInit)() = (bool (*)())engLib.Resolve("XrdOfsTPCEngineInit");
+       engNew = (XrdOfsTPCEngine *(*)(XrdOfsTPCJob *, const char *))
+                engLib.Resolve("XrdOfsTPCEngineNew");
+       if (!engInit || !engNew || !engInit()) return 0;
+      }
+
 // All done
 //
    Cfg.doEcho = Cfg.doEcho || GTRACE(debug);
@@ -279,12 +414,9 @@ XrdOfsTPCProg *XrdOfsTPCProg::Start(XrdOfsTPCJob *jP, int &rc)
 
 int XrdOfsTPCProg::Xeq(bool &isIPv4)
 {
-   EPNAME("Xeq");
    credFile cFile(Job);
-   const char *Args[6], *eVec[6], **envArg;
-   char *lP, *Colon, *cksVal, sBuff[8], *tident = Job->Info.Org;
    char *Quest = index(Job->Info.Key, '?');
-   int i, rc, aNum = 0;
+   int rc;
 
 // If we have credentials, write them out to a file
 //
@@ -297,94 +429,22 @@ int XrdOfsTPCProg::Xeq(bool &isIPv4)
 //
    if (Cfg.doEcho)
       {if (Quest) *Quest = 0;
-       OfsEroute.Say(Pname,tident," copying ",Job->Info.Key," to ",Job->Info.Dst);
+       OfsEroute.Say(Pname,Job->Info.Org," copying ",Job->Info.Key," to ",
+                     Job->Info.Dst);
        if (Quest) *Quest = '?';
       }
 
-// Determine checksum option
-//
-   cksVal = (Job->Info.Cks ? Job->Info.Cks : Cfg.cksType);
-   if (cksVal)
-      {Args[aNum++] = "-C";
-       Args[aNum++] = cksVal;
-      }
-
-// Set streams option if need be
-//
-   if (Job->Info.Str)
-      {sprintf(sBuff, "%d", static_cast<int>(Job->Info.Str));
-       Args[aNum++] = "-S";
-       Args[aNum++] = sBuff;
-      }
-
-// Set remaining arguments
-//
-   Args[aNum++] = Job->Info.Key;
-   Args[aNum++] = Job->Info.Dst;
-
-// Always export the trace identifier of the original issuer
-//
-   char tidBuff[512];
-   snprintf(tidBuff, sizeof(tidBuff), "XRD_TIDENT=%s", tident);
-   eVec[0] = tidBuff;
-   envArg = eVec;
-   i = 1;
-
-// Export source protocol if present
-//
-   char sprBuff[128];
-   if (Job->Info.Spr)
-      {snprintf(sprBuff, sizeof(sprBuff), "XRDTPC_SPROT=%s", Job->Info.Spr);
-       eVec[i++] = sprBuff;
-      }
-
-// Export target protocol if present
-//
-   char tprBuff[128];
-   if (Job->Info.Tpr)
-      {snprintf(tprBuff, sizeof(tprBuff), "XRDTPC_TPROT=%s", Job->Info.Tpr);
-       eVec[i++] = tprBuff;
-      }
-
-// If we need to reproxy, export the path
-//
-   char rpxBuff[1024];
-   if (Job->Info.Rpx)
-      {snprintf(rpxBuff, sizeof(rpxBuff), "XRD_CPTARGET=%s", Job->Info.Rpx);
-       eVec[i++] = rpxBuff;
-      }
-
-// Determine if credentials are being passed, If so, pass where it is.
-//
-   if (cFile.Path) eVec[i++] = cFile.pEnv;
-   eVec[i] = 0;
-
-// Start the job.
-//
-   if ((rc = Prog.Run(&JobStream, Args, aNum, envArg)))
-      {strcpy(eRec, "Copy failed; unable to start job.");
-       OfsEroute.Emsg("TPC", Job->Info.Org, Job->Info.Lfn, eRec);
-       return rc;
-      }
-
-// Now we drain the output looking for an end of run line. This line should
-// be printed as an error message should the copy fail.
+// Copy the file in process if we can. Otherwise, run the copy program.
 //
    *eRec = 0;
    isIPv4 = false;
-   while((lP = JobStream.GetLine()))
-        {if (!strcmp(lP, "!-!IPv4")) isIPv4 = true;
-         if ((Colon = index(lP, ':')) && *(Colon+1) == ' ')
-            {strncpy(eRec, Colon+2, sizeof(eRec)-1); 
-             eRec[sizeof(eRec)-1] = 0;
-            }
-         if (Cfg.doEcho && *lP) OfsEroute.Say(Pname, lP);
-        }
-
-// The job has completed. So, we must get the ending status.
-//
-   if ((rc = Prog.RunDone(JobStream)) < 0) rc = -rc;
-   DEBUG(Pname <<"ended with rc=" <<rc);
+   XrdOfsTPCEngine *theXfr = (engNew ? engNew(Job, Pname) : 0);
+   if (theXfr)
+      {Engage(theXfr);
+       rc = theXfr->Xeq(eRec, sizeof(eRec), isIPv4);
+       Engage(0);
+       delete theXfr;
+      } else rc = Fork(isIPv4, (cFile.Path ? cFile.pEnv : 0));
 
 // Check if we should generate a message
 //
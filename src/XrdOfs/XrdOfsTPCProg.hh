@@ -34,6 +34,7 @@
 #include "XrdOuc/XrdOucStream.hh"
 #include "XrdSys/XrdSysPthread.hh"
   
+class XrdOfsTPCEngine;
 class XrdOfsTPCJob;
 class XrdOucProg;
   
@@ -41,7 +42,7 @@ class XrdOfsTPCProg
 {
 public:
 
-       void      Cancel() {JobStream.Drain();}
+       void      Cancel();
 
 static int       Init();
 
@@ -56,7 +57,10 @@ XrdOfsTPCProg   *Start(XrdOfsTPCJob *jP, int &rc);
 
                 ~XrdOfsTPCProg() {}
 private:
+       void           Engage(XrdOfsTPCEngine *xP)
+                            {xfrMutex.Lock(); xfrP = xP; xfrMutex.UnLock();}
        int            ExportCreds(const char *path);
+       int            Fork(bool &isIPv4, char *credEnv);
 static XrdSysMutex    pgmMutex;
 static XrdOfsTPCProg *pgmIdle;
 
@@ -64,6 +68,8 @@ static XrdOfsTPCProg *pgmIdle;
        XrdOucStream   JobStream;
        XrdOfsTPCProg *Next;
        XrdOfsTPCJob  *Job;
+       XrdSysMutex    xfrMutex;
+       XrdOfsTPCEngine *xfrP;   // In process transfer, if any
        char           Pname[32];
        char           eRec[1024];
 };
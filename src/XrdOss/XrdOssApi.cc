@@ -947,6 +947,14 @@ ssize_t XrdOssFile::Read(off_t offset, size_t blen)
 
      if (fd < 0) return (ssize_t)-XRDOSS_E8004;
 
+// Windowed memory mapped files map the range and advise the kernel which also
+// warms the page cache for sendfile(). Otherwise, simply advise the kernel.
+//
+     if (mmFile && mmFile->isWindowed())
+        {XrdOssMio::Prefetch(mmFile, fd, offset, blen);
+         return 0;
+        }
+
 #if defined(__linux__) || (defined(__FreeBSD_kernel__) && defined(__GLIBC__))
      posix_fadvise(fd, offset, blen, POSIX_FADV_WILLNEED);
 #endif
@@ -973,10 +981,22 @@ ssize_t XrdOssFile::Read(off_t offset, size_t blen)
 
 ssize_t XrdOssFile::Read(void *buff, off_t offset, size_t blen)
 {
-     ssize_t retval;
+     ssize_t retval, mmlen;
 
      if (fd < 0) return (ssize_t)-XRDOSS_E8004;
 
+// Copy what we can out of a windowed memory mapping. Should the memory budget
+// be exhausted we read the rest of the data the usual way.
+//
+     if (mmFile && mmFile->isWindowed())
+        {mmlen = XrdOssMio::Read(mmFile, fd, buff, offset, blen);
+         if (mmlen == (ssize_t)blen) return mmlen;
+         do {retval = pread(fd, (char *)buff+mmlen, blen-mmlen, offset+mmlen);}
+            while(retval < 0 && errno == EINTR);
+         if (retval < 0) return (mmlen ? mmlen : (ssize_t)-errno);
+         return mmlen + retval;
+        }
+
 #ifdef XRDOSSCX
      if (cxobj)  
         if (XrdOssSS->DirFlags & XrdOssNOSSDEC) return (ssize_t)-XRDOSS_E8021;
@@ -1011,6 +1031,18 @@ ssize_t XrdOssFile::ReadV(XrdOucIOVec *readV, int n)
    ssize_t rdsz, totBytes = 0;
    int i;
 
+// Windowed memory mapped files are read a segment at a time from the mapping
+//
+   if (mmFile && mmFile->isWindowed())
+      {for (i = 0; i < n; i++)
+           {rdsz = Read(readV[i].data, readV[i].offset, readV[i].size);
+            if (rdsz < 0 || rdsz != readV[i].size)
+               return (rdsz < 0 ? rdsz : -ESPIPE);
+            totBytes += rdsz;
+           }
+       return totBytes;
+      }
+
 // For platforms that support fadvise, pre-advise what we will be reading
 //
 #if (defined(__linux__) || (defined(__FreeBSD_kernel__) && defined(__GLIBC__))) && defined(HAVE_ATOMICS)
@@ -1265,7 +1297,8 @@ int XrdOssFile::Fsync(void)
 */
 off_t XrdOssFile::getMmap(void **addr)
 {
-   if (mmFile) return (addr ? mmFile->Export(addr) : 1);
+   if (mmFile && !mmFile->isWindowed())
+      return (addr ? mmFile->Export(addr) : 1);
    if (addr) *addr = 0;
    return 0;
 }
@@ -297,7 +297,9 @@ protected:
 long long minalloc;          //    Minimum allocation
 int       ovhalloc;          //    Allocation overage
 int       fuzalloc;          //    Allocation fuzz
+int       selalloc;          //    Allocation partition selection policy
 int       cscanint;          //    Seconds between cache scans
+int       cscanrfr;          //    Seconds between reservation refreshes
 int       xfrspeed;          //    Average transfer speed (bytes/second)
 int       xfrovhd;           //    Minimum seconds to get a file
 int       xfrhold;           //    Second hold limit on failing requests
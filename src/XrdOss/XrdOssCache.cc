@@ -34,6 +34,7 @@
 #include <fcntl.h>
 #include <map>
 #include <cstdio>
+#include <random>
 #include <string>
 #include <strings.h>
 #include <ctime>
@@ -68,6 +69,7 @@ XrdOssCache_Group  *XrdOssCache_Group::PubGroup = 0;
 long long           XrdOssCache_Group::PubQuota = -1;
 
 XrdSysMutex         XrdOssCache::Mutex;
+XrdSysMutex         XrdOssCache::rfrMutex;
 long long           XrdOssCache::fsTotal = 0;
 long long           XrdOssCache::fsLarge = 0;
 long long           XrdOssCache::fsTotFr = 0;
@@ -80,6 +82,8 @@ double              XrdOssCache::fuzAlloc= 0.0;
 long long           XrdOssCache::minAlloc= 0;
 int                 XrdOssCache::fsCount = 0;
 int                 XrdOssCache::ovhAlloc= 0;
+int                 XrdOssCache::selAlloc= XrdOssCache::selLargest;
+int                 XrdOssCache::rfrAlloc= 0;
 int                 XrdOssCache::Quotas  = 0;
 int                 XrdOssCache::Usage   = 0;
 
@@ -112,6 +116,8 @@ XrdOssCache_FSData::XrdOssCache_FSData(const char *fsp,
           * static_cast<long long>(fsbuff.FS_BLKSZ);
      frsz = static_cast<long long>(fsbuff.f_bavail)
           * static_cast<long long>(fsbuff.FS_BLKSZ);
+     rsvd = 0;
+     rsvdMark = 0;
      XrdOssCache::fsTotal += size;
      XrdOssCache::fsTotFr += frsz;
      XrdOssCache::fsCount++;
@@ -370,15 +376,16 @@ int  XrdOssCache_FS::getSpace(XrdOssCache_Space &Space, XrdOssCache_Group *fsg,
    for (int i = 0; i < fsg->fsNum; i++)
        {fsd = fsg->fsVec[i].fsP;
         Space.Total +=  fsd->size;
-        Space.Free  +=  fsd->frsz;
-        if (fsd->frsz > Space.Maxfree) Space.Maxfree = fsd->frsz;
+        long long fsFree = fsd->Avail();
+        Space.Free  +=  fsFree;
+        if (fsFree > Space.Maxfree) Space.Maxfree = fsFree;
         if (fsd->size > Space.Largest) Space.Largest = fsd->size;
 
         if (pVec)
            {pVec[i].pPath = fsd->path;
             pVec[i].aPath = fsg->fsVec[i].apVec;
             pVec[i].Total = fsd->size;
-            pVec[i].Free  = fsd->frsz;
+            pVec[i].Free  = fsFree;
             pVec[i].bdevID= fsd->bdevID;
             pVec[i].partID= fsd->partID;
            }
@@ -493,12 +500,10 @@ int XrdOssCache::Alloc(XrdOssCache::allocInfo &aInfo)
 {
    EPNAME("Alloc");
    static const mode_t theMode = S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH;
-   XrdSysMutexHelper myMutex(&Mutex);
-   double diffree;
    XrdOssPath::fnInfo Info;
-   XrdOssCache_FS *fsp, *fspend, *fsp_sel;
+   XrdOssCache_FS *fsp_sel = 0;
    XrdOssCache_Group *cgp = 0;
-   long long size, maxfree, curfree;
+   long long size;
    int rc, madeDir, datfd = 0;
 
 // Compute appropriate allocation size
@@ -513,31 +518,14 @@ int XrdOssCache::Alloc(XrdOssCache::allocInfo &aInfo)
    while(cgp && strcmp(aInfo.cgName, cgp->group)) cgp = cgp->next;
    if (!cgp) return -ENOENT;
 
-// Find a cache that will fit this allocation request. We start with the next
-// entry past the last one we selected and go full round looking for a
-// compatable entry (enough space and in the right space group).
-//
-   fsp_sel = 0; maxfree = 0;
-   fsp = cgp->curr->next; fspend = fsp; // End when we hit the start again
-   do {
-       if (strcmp(aInfo.cgName, fsp->group)
-       || (aInfo.cgPath && (aInfo.cgPlen > fsp->plen
-                        ||  strncmp(aInfo.cgPath,fsp->path,aInfo.cgPlen)))) continue;
-       curfree = fsp->fsdata->frsz;
-       if (size > curfree) continue;
-
-             if (fuzAlloc > 0.999) {fsp_sel = fsp; break;}
-       else  if (!fuzAlloc || !fsp_sel)
-                {if (curfree > maxfree) {fsp_sel = fsp; maxfree = curfree;}}
-       else {diffree = (!(curfree + maxfree) ? 0.0
-                     : static_cast<double>(XRDABS(maxfree - curfree)) /
-                       static_cast<double>(       maxfree + curfree));
-             if (diffree > fuzAlloc) {fsp_sel = fsp; maxfree = curfree;}
-            }
-      } while((fsp = fsp->next) != fspend);
-
-// Check if we can realy fit this file. If so, update current scan pointer
+// Select a partition and reserve the space in it. No lock is held here; the
+// selection works off the published free space and a concurrent allocation
+// may beat us to the space. In that case we simply select again.
 //
+   for (int i = 0; i < 4 && !fsp_sel; i++)
+       {if (!(fsp_sel = Select(cgp, aInfo, size))) return -ENOSPC;
+        if (!fsp_sel->fsdata->Reserve(size)) fsp_sel = 0;
+       }
    if (!fsp_sel) return -ENOSPC;
    cgp->curr = fsp_sel;
 
@@ -551,7 +539,10 @@ int XrdOssCache::Alloc(XrdOssCache::allocInfo &aInfo)
 
 // Verify that target name was constructed
 //
-   if (!(*aInfo.cgPFbf)) return -ENAMETOOLONG;
+   if (!(*aInfo.cgPFbf))
+      {fsp_sel->fsdata->rsvd -= size;
+       return -ENAMETOOLONG;
+      }
 
 // Simply open the file in the local filesystem, creating it if need be.
 //
@@ -561,17 +552,21 @@ int XrdOssCache::Alloc(XrdOssCache::allocInfo &aInfo)
                while(datfd < 0 && errno == EINTR);
            if (datfd >= 0 || errno != ENOENT || madeDir) break;
            *Info.Slash='\0'; rc=mkdir(aInfo.cgPFbf,theMode); *Info.Slash='/';
+           if (rc && errno == EEXIST) rc = 0; // Someone else just made it
            madeDir = 1;
           } while(!rc);
-       if (datfd < 0) return (errno ? -errno : -EFAULT);
+       if (datfd < 0)
+          {rc = (errno ? -errno : -EFAULT);
+           fsp_sel->fsdata->rsvd -= size;
+           return rc;
+          }
       }
 
-// All done (temporarily adjust down the free space)x
+// All done (the reservation is retired once the refresher has seen it)
 //
-   DEBUG("free=" <<fsp_sel->fsdata->frsz <<'-' <<size <<" path=" 
-                 <<fsp_sel->fsdata->path);
-   fsp_sel->fsdata->frsz -= size;
-   fsp_sel->fsdata->stat |= XrdOssFSData_REFRESH;
+   DEBUG("free=" <<fsp_sel->fsdata->frsz <<" rsvd=" <<fsp_sel->fsdata->rsvd
+                 <<" (+" <<size <<") path=" <<fsp_sel->fsdata->path);
+   fsp_sel->fsdata->stat |= XrdOssFSData_RESERVED;
    aInfo.cgFSp  = fsp_sel;
    return datfd;
 }
@@ -665,13 +660,15 @@ int XrdOssCache::Init(const char *UPath, const char *Qfile, int isSOL, int us)
 
 /******************************************************************************/
 
-int XrdOssCache::Init(long long aMin, int ovhd, int aFuzz)
+int XrdOssCache::Init(long long aMin, int ovhd, int aFuzz, int aSel, int rInt)
 {
 // Set values
 //
    minAlloc = aMin;
    ovhAlloc = ovhd;
    fuzAlloc = static_cast<double>(aFuzz)/100.0;
+   selAlloc = aSel;
+   rfrAlloc = rInt;
    return 0;
 }
 
@@ -837,17 +834,85 @@ char *XrdOssCache::Parse(const char *token, char *cbuff, int cblen)
 }
 
 /******************************************************************************/
-/*                                  S c a n                                   */
+/* Private:                      R e f r e s h                                */
 /******************************************************************************/
 
-void *XrdOssCache::Scan(int cscanint)
+// Refresh the free space of the file systems and publish it. A full refresh
+// stat's every file system except those recently adjusted (to avoid statfs
+// latency problems); these are done on the following full refresh. A partial
+// refresh only stat's file systems where space was reserved by Alloc(). The
+// statfs calls are made without holding the cache context lock; the new free
+// space is stored under it, carrying over any Adjust() made in the meantime.
+//
+// Reservations are retired one refresh after the one that first saw them so
+// that space being written right now is not handed out twice on account of
+// the snapshot lagging behind.
+  
+void XrdOssCache::Refresh(bool full, bool force, bool dbgMsg)
 {
    EPNAME("CacheScan")
+   XrdSysMutexHelper rfrHelper(rfrMutex);
    XrdOssCache_FSData *fsdp;
+   long long frsz, frsz0, inFlight, llT; // llT is a dummy temporary
+   int fsStat;
+
+// Scan through all filesystems
+//
+   fsdp = fsdata;
+   while(fsdp)
+        {fsStat = fsdp->stat;
+         if (fsStat & (XrdOssFSData_REFRESH | XrdOssFSData_RESERVED)
+         || (full && (!(fsStat & XrdOssFSData_ADJUSTED) || force)))
+            {fsdp->stat &= ~XrdOssFSData_RESERVED;
+             inFlight = fsdp->rsvd;
+             Mutex.Lock(); frsz0 = fsdp->frsz; Mutex.UnLock();
+             frsz = XrdOssCache_FS::freeSpace(llT,fsdp->path);
+             if (frsz < 0) OssEroute.Emsg("CacheScan", errno ,
+                           "state file system ",(char *)fsdp->path);
+                else {// Keep adjustments made while statfs() was running
+                      Mutex.Lock();
+                      if ((frsz += fsdp->frsz - frsz0) < 0) frsz = 0;
+                      fsdp->frsz = frsz;
+                      Mutex.UnLock();
+                      if (fsdp->rsvdMark > inFlight) fsdp->rsvdMark = inFlight;
+                      fsdp->rsvd  -= fsdp->rsvdMark;
+                      fsdp->rsvdMark = inFlight - fsdp->rsvdMark;
+                      fsdp->stat &= ~(XrdOssFSData_REFRESH |
+                                      XrdOssFSData_ADJUSTED);
+                      if (dbgMsg)
+                         {DEBUG("New free=" <<frsz <<" rsvd=" <<fsdp->rsvd
+                                <<" path=" <<fsdp->path);
+                         }
+                     }
+             if (fsdp->rsvdMark) fsdp->stat |= XrdOssFSData_RESERVED;
+            } else if (full) fsdp->stat |= XrdOssFSData_REFRESH;
+         fsdp = fsdp->next;
+        }
+
+// Recompute the overall values
+//
+   Mutex.Lock();
+   fsSize =  0;
+   fsTotFr=  0;
+   fsFree =  0;
+   fsdp = fsdata;
+   while(fsdp)
+        {frsz = fsdp->Avail();
+         if (frsz > fsFree) {fsFree = frsz; fsSize = fsdp->size;}
+         fsTotFr += frsz;
+         fsdp = fsdp->next;
+        }
+   Mutex.UnLock();
+}
+
+/******************************************************************************/
+/*                                  S c a n                                   */
+/******************************************************************************/
+
+void *XrdOssCache::Scan(int cscanint)
+{
    XrdOssCache_Group  *fsgp;
-   const struct timespec naptime = {cscanint, 0};
-   long long frsz, llT; // llT is a dummy temporary
-   int retc, dbgMsg, dbgNoMsg, dbgDoMsg;
+   int dbgMsg, dbgNoMsg, dbgDoMsg, tick, waited = 0;
 
 // Try to prevent floodingthe log with scan messages
 //
@@ -855,49 +920,32 @@ void *XrdOssCache::Scan(int cscanint)
       else dbgMsg = 1;
    dbgNoMsg = dbgMsg;
 
+// Between full scans we wake up every so often to refresh the file systems
+// in which space was allocated so that the reservations do not linger.
+//
+   tick = (rfrAlloc > 0 && rfrAlloc < cscanint ? rfrAlloc : cscanint);
+   const struct timespec naptime = {tick, 0};
+
 // Loop scanning the cache
 //
    while(1)
-        {if (cscanint > 0) nanosleep(&naptime, 0);
+        {if (cscanint > 0)
+            {nanosleep(&naptime, 0);
+             if ((waited += tick) < cscanint)
+                {Refresh(false, false, false);
+                 continue;
+                }
+             waited = 0;
+            }
          dbgDoMsg = !dbgNoMsg--;
          if (dbgDoMsg) dbgNoMsg = dbgMsg;
 
-        // Get the cache context lock
-        //
-           Mutex.Lock();
-
-        // Scan through all filesystems skip filesystem that have been
-        // recently adjusted to avoid fs statstics latency problems.
+        // Refresh all filesystems
         //
-           fsSize =  0;
-           fsTotFr=  0;
-           fsFree =  0;
-           fsdp = fsdata;
-           while(fsdp)
-                {retc = 0;
-                 if ((fsdp->stat & XrdOssFSData_REFRESH)
-                 || !(fsdp->stat & XrdOssFSData_ADJUSTED) || cscanint <= 0)
-                     {frsz = XrdOssCache_FS::freeSpace(llT,fsdp->path);
-                      if (frsz < 0) OssEroute.Emsg("CacheScan", errno ,
-                                    "state file system ",(char *)fsdp->path);
-                         else {fsdp->frsz = frsz;
-                               fsdp->stat &= ~(XrdOssFSData_REFRESH |
-                                               XrdOssFSData_ADJUSTED);
-                               if (dbgDoMsg)
-                                  {DEBUG("New free=" <<fsdp->frsz <<" path=" <<fsdp->path);}
-                               }
-                     } else fsdp->stat |= XrdOssFSData_REFRESH;
-                 if (!retc)
-                    {if (fsdp->frsz > fsFree)
-                        {fsFree = fsdp->frsz; fsSize = fsdp->size;}
-                     fsTotFr += fsdp->frsz;
-                    }
-                 fsdp = fsdp->next;
-                }
+           Refresh(true, cscanint <= 0, dbgDoMsg);
 
-        // Unlock the cache and if we have quotas check them out
+        // If we have quotas check them out
         //
-           Mutex.UnLock();
            if (cscanint <= 0) return (void *)0;
            if (Quotas) XrdOssSpace::Quotas();
 
@@ -917,3 +965,90 @@ void *XrdOssCache::Scan(int cscanint)
 //
    return (void *)0;
 }
+
+/******************************************************************************/
+/* Private:                       S e l e c t                                 */
+/******************************************************************************/
+
+// Select a partition for an allocation of size bytes without taking a lock.
+// This is safe as the file system list is only changed during configuration.
+//
+XrdOssCache_FS *XrdOssCache::Select(XrdOssCache_Group *cgp,
+                                    XrdOssCache::allocInfo &aInfo,
+                                    long long size)
+{
+   static thread_local std::mt19937_64
+                    rng(static_cast<unsigned long long>(time(0))
+                      ^ reinterpret_cast<unsigned long long>(&aInfo));
+   XrdOssCache_FS *fsp, *fspend, *fsp_sel = 0, *fsp_alt = 0;
+   long long curfree, maxfree = 0, altfree = 0, totfree = 0, pick = 0;
+   double diffree;
+   int n = 0, pick1 = 0, pick2 = 0;
+
+// Return the free space in a partition if it is eligible for this request
+//
+   auto Avail = [&](XrdOssCache_FS *fP) -> long long
+               {if (strcmp(aInfo.cgName, fP->group)
+                || (aInfo.cgPath && (aInfo.cgPlen > fP->plen
+                ||  strncmp(aInfo.cgPath, fP->path, aInfo.cgPlen)))) return -1;
+                long long fsFree = fP->fsdata->Avail();
+                return (size > fsFree ? -1 : fsFree);
+               };
+
+// Find a cache that will fit this allocation request. We start with the next
+// entry past the last one we selected and go full round looking for a
+// compatable entry (enough space and in the right space group).
+//
+   fsp = ((XrdOssCache_FS *)cgp->curr)->next; fspend = fsp;
+   do {if ((curfree = Avail(fsp)) < 0) continue;
+       n++; totfree += curfree;
+       if (selAlloc != selLargest) continue;
+
+             if (fuzAlloc > 0.999) {fsp_sel = fsp; break;}
+       else  if (!fuzAlloc || !fsp_sel)
+                {if (curfree > maxfree) {fsp_sel = fsp; maxfree = curfree;}}
+       else {diffree = (!(curfree + maxfree) ? 0.0
+                     : static_cast<double>(XRDABS(maxfree - curfree)) /
+                       static_cast<double>(       maxfree + curfree));
+             if (diffree > fuzAlloc) {fsp_sel = fsp; maxfree = curfree;}
+            }
+      } while((fsp = fsp->next) != fspend);
+
+// The largest free space policy is done in a single pass
+//
+   if (selAlloc == selLargest || n < 2) 
+      {if (n == 1 && !fsp_sel)
+          do {if (Avail(fsp) >= 0) {fsp_sel = fsp; break;}
+             } while((fsp = fsp->next) != fspend);
+       return fsp_sel;
+      }
+
+// For the other policies pick the candidate(s) now
+//
+   if (selAlloc == selWeighted)
+      pick = (totfree ? static_cast<long long>(rng() % totfree) : 0);
+      else {pick1 = rng() % n;
+            pick2 = rng() % (n-1);
+            if (pick2 >= pick1) pick2++;
+           }
+
+// Do the second pass. Free space may have changed in the meantime but that
+// only skews the choice; we always end up with an eligible partition if
+// there still is one.
+//
+   n = 0;
+   do {if ((curfree = Avail(fsp)) < 0) continue;
+       if (selAlloc == selWeighted)
+          {fsp_sel = fsp;
+           if ((pick -= curfree) < 0) break;
+          } else {
+           if (n == pick1 || n == pick2)
+              {if (!fsp_sel) {fsp_sel = fsp; maxfree = curfree;}
+                  else {fsp_alt = fsp; altfree = curfree; break;}
+              }
+           n++;
+          }
+      } while((fsp = fsp->next) != fspend);
+
+   return (fsp_alt && altfree > maxfree ? fsp_alt : fsp_sel);
+}
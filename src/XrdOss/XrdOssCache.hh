@@ -36,6 +36,7 @@
 #include "XrdOss/XrdOssVS.hh"
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysPthread.hh"
+#include "XrdSys/XrdSysRAtomic.hh"
 
 /******************************************************************************/
 /*              O S   D e p e n d e n t   D e f i n i t i o n s               */
@@ -102,23 +103,40 @@ long long          Quota;
 #define XrdOssFSData_OFFLINE  0x0001
 #define XrdOssFSData_ADJUSTED 0x0002
 #define XrdOssFSData_REFRESH  0x0004
+#define XrdOssFSData_RESERVED 0x0008
 
+// The free space and reservations are published atomically so that space can
+// be allocated without holding the cache context lock. The free space is the
+// last statfs() snapshot less any adjustments since then. Reservations are the
+// space handed out by Alloc() that may not yet show up in the snapshot; they
+// are retired by the refresher (see XrdOssCache::Refresh()).
+//
 class XrdOssCache_FSData
 {
 public:
 
 XrdOssCache_FSData *next;
 long long           size;
-long long           frsz;
+RAtomic_llong       frsz;
+RAtomic_llong       rsvd;
+long long           rsvdMark;  // Reservations as of the previous refresh
 dev_t               fsid;
 const char         *path;
 const char         *pact;
 const char         *devN;
 time_t              updt;
-int                 stat;
+RAtomic_int         stat;
 unsigned short      bdevID;
 unsigned short      partID;
 
+inline long long    Avail() {long long n = frsz - rsvd; return (n < 0 ? 0 : n);}
+
+inline bool         Reserve(long long bytes)
+                           {if ((rsvd += bytes) <= frsz) return true;
+                            rsvd -= bytes;
+                            return false;
+                           }
+
        XrdOssCache_FSData(const char *, STATFS_t &, dev_t);
       ~XrdOssCache_FSData() {if (path) free((void *)path);}
 };
@@ -185,7 +203,7 @@ public:
 
 XrdOssCache_Group   *next;
 char                *group;
-XrdOssCache_FS      *curr;
+XrdSys::RAtomic<XrdOssCache_FS*> curr;
 XrdOssCache_FSAP    *fsVec; // Partitions where space may be allocated
 long long            Usage;
 long long            Quota;
@@ -246,7 +264,15 @@ static XrdOssCache_FS *Find(const char *Path, int lklen=0);
 static int             Init(const char *UDir, const char *Qfile,
                             int isSOL, int usync=0);
 
-static int             Init(long long aMin, int ovhd, int aFuzz);
+// Partition selection policies for Alloc()
+//
+enum allocSel {selLargest = 0, // Most free space, subject to the fuzz
+               selP2C,         // Best of two random choices
+               selWeighted     // Random, weighted by free space
+              };
+
+static int             Init(long long aMin, int ovhd, int aFuzz,
+                            int aSel=selLargest, int rInt=0);
 
 static void            List(const char *lname, XrdSysError &Eroute);
 
@@ -273,10 +299,16 @@ static int                 fsCount;  // Number of file systems
 
 private:
 static bool MapDM(const char *ldm, char *buff, int blen);
+static void Refresh(bool full, bool force, bool dbgMsg);
+static XrdOssCache_FS *Select(XrdOssCache_Group *cgp, allocInfo &aInfo,
+                              long long size);
 
+static XrdSysMutex         rfrMutex; // Serializes free space refreshes
 static long long           minAlloc;
 static double              fuzAlloc;
 static int                 ovhAlloc;
+static int                 selAlloc;
+static int                 rfrAlloc; // Seconds between reservation refreshes
 static int                 Quotas;
 static int                 Usage;
 };
@@ -216,12 +216,14 @@ XrdOssSys::XrdOssSys()
    LocalRoot     = 0;
    RemoteRoot    = 0;
    cscanint      = 600;
+   cscanrfr      = 30;
    FDFence       = -1;
    FDLimit       = -1;
    MaxSize       = 0;
    minalloc      = 0;
    ovhalloc      = 0;
    fuzalloc      = 0;
+   selalloc      = XrdOssCache::selLargest;
    xfrspeed      = 9*1024*1024;
    xfrovhd       = 30;
    xfrhold       =  3*60*60;
@@ -372,7 +374,7 @@ int XrdOssSys::Configure(const char *configfn, XrdSysError &Eroute,
    if (m1 || m2) Eroute.Say("++++++ Configuring ", m1, m2, "mode . . .");
   }
    NoGo |= XrdOssCache::Init(UDir, QFile, Solitary, USync)
-          |XrdOssCache::Init(minalloc, ovhalloc, fuzalloc);
+          |XrdOssCache::Init(minalloc, ovhalloc, fuzalloc, selalloc, cscanrfr);
 
 // Configure the MSS interface including staging
 //
@@ -472,8 +474,8 @@ void XrdOssSys::Config_Display(XrdSysError &Eroute)
         else cloc = ConfigFN;
 
      snprintf(buff, sizeof(buff), "Config effective %s oss configuration:\n"
-                                  "       oss.alloc        %lld %d %d\n"
-                                  "       oss.spacescan    %d\n"
+                                  "       oss.alloc        %lld %d %d select %s\n"
+                                  "       oss.spacescan    %d refresh %d\n"
                                   "       oss.fdlimit      %d %d\n"
                                   "       oss.maxsize      %lld\n"
                                   "%s%s%s"
@@ -486,7 +488,9 @@ void XrdOssSys::Config_Display(XrdSysError &Eroute)
                                   "       oss.xfr          %d deny %d keep %d",
              cloc,
              minalloc, ovhalloc, fuzalloc,
-             cscanint,
+             (selalloc == XrdOssCache::selP2C ? "p2c"
+             : selalloc == XrdOssCache::selWeighted ? "weighted" : "largest"),
+             cscanint, cscanrfr,
              FDFence, FDLimit, MaxSize,
              XrdOssConfig_Val(N2N_Lib,    namelib),
              XrdOssConfig_Val(LocalRoot,  localroot),
@@ -1181,6 +1185,7 @@ int XrdOssSys::ConfigXeq(char *var, XrdOucStream &Config, XrdSysError &Eroute)
 /* Function: aalloc
 
    Purpose:  To parse the directive: alloc <min> [<headroom> [<fuzz>]]
+                                           [select {largest | p2c | weighted}]
 
              <min>       minimum amount of free space needed in a partition.
                          (asterisk uses default).
@@ -1190,6 +1195,13 @@ int XrdOssSys::ConfigXeq(char *var, XrdOucStream &Config, XrdSysError &Eroute)
                          quantities that may be ignored when selecting a space
                            0 - reduces to finding the largest free space
                          100 - reduces to simple round-robin allocation
+             select      how a partition is selected among those that fit:
+                         largest  - the one with the most free space subject
+                                    to <fuzz> (the default).
+                         p2c      - the one with more free space of two picked
+                                    at random.
+                         weighted - one picked at random weighted by its
+                                    free space.
 
    Output: 0 upon success or !0 upon failure.
 */
@@ -1200,25 +1212,43 @@ int XrdOssSys::xalloc(XrdOucStream &Config, XrdSysError &Eroute)
     long long mina = 0;
     int       fuzz = 0;
     int       hdrm = 0;
+    int       asel = XrdOssCache::selLargest;
 
     if (!(val = Config.GetWord()))
        {Eroute.Emsg("Config", "alloc minfree not specified"); return 1;}
     if (strcmp(val, "*") &&
         XrdOuca2x::a2sz(Eroute, "alloc minfree", val, &mina, 0)) return 1;
 
-    if ((val = Config.GetWord()))
+    if ((val = Config.GetWord()) && strcmp(val, "select"))
        {if (strcmp(val, "*") &&
             XrdOuca2x::a2i(Eroute,"alloc headroom",val,&hdrm,0,100)) return 1;
 
-        if ((val = Config.GetWord()))
+        if ((val = Config.GetWord()) && strcmp(val, "select"))
            {if (strcmp(val, "*") &&
             XrdOuca2x::a2i(Eroute, "alloc fuzz", val, &fuzz, 0, 100)) return 1;
+            val = Config.GetWord();
            }
        }
 
+    if (val)
+       {if (strcmp(val, "select"))
+           {Eroute.Emsg("Config", "invalid alloc option -", val); return 1;}
+        if (!(val = Config.GetWord()))
+           {Eroute.Emsg("Config", "alloc select policy not specified");
+            return 1;
+           }
+             if (!strcmp(val, "largest"))  asel = XrdOssCache::selLargest;
+        else if (!strcmp(val, "p2c"))      asel = XrdOssCache::selP2C;
+        else if (!strcmp(val, "weighted")) asel = XrdOssCache::selWeighted;
+        else {Eroute.Emsg("Config", "invalid alloc select policy -", val);
+              return 1;
+             }
+       }
+
     minalloc = mina;
     ovhalloc = hdrm;
     fuzalloc = fuzz;
+    selalloc = asel;
     return 0;
 }
 
@@ -1261,20 +1291,32 @@ int XrdOssSys::xcache(XrdOucStream &Config, XrdSysError &Eroute)
 
 /* Function: xcachescan
 
-   Purpose:  To parse the directive: cachescan <num>
+   Purpose:  To parse the directive: cachescan <num> [refresh <rnum>]
 
              <num>     number of seconds between cache scans.
+             <rnum>    number of seconds between refreshes of the partitions
+                       where space was recently allocated. Zero only
+                       refreshes them during the cache scan.
 
    Output: 0 upon success or !0 upon failure.
 */
 int XrdOssSys::xcachescan(XrdOucStream &Config, XrdSysError &Eroute)
-{   int cscan = 0;
+{   int cscan = 0, rscan = cscanrfr;
     char *val;
 
     if (!(val = Config.GetWord()))
        {Eroute.Emsg("Config", "cachescan not specified"); return 1;}
     if (XrdOuca2x::a2tm(Eroute, "cachescan", val, &cscan, 30)) return 1;
+    if ((val = Config.GetWord()))
+       {if (strcmp(val, "refresh"))
+           {Eroute.Emsg("Config", "invalid cachescan option -", val); return 1;}
+        if (!(val = Config.GetWord()))
+           {Eroute.Emsg("Config", "cachescan refresh not specified"); return 1;}
+        if (XrdOuca2x::a2tm(Eroute, "cachescan refresh", val, &rscan, 0))
+           return 1;
+       }
     cscanint = cscan;
+    cscanrfr = rscan;
     return 0;
 }
 
@@ -1367,6 +1409,8 @@ int XrdOssSys::xmaxsz(XrdOucStream &Config, XrdSysError &Eroute)
 
    Purpose:  Parse the directive: memfile [off] [max <msz>]
                                           [check xattr] [preload]
+                                          [window <wsz> [readahead <n>]
+                                          [hugepages]]
 
              check      Applies memory mapping options based on file's xattrs.
                         For backward compatibility, we also accept:
@@ -1374,8 +1418,14 @@ int XrdOssSys::xmaxsz(XrdOucStream &Config, XrdSysError &Eroute)
              all        Preloads the complete file into memory.
              off        Disables memory mapping regardless of other options.
              on         Enables memory mapping
+             hugepages  Advises the kernel to back windows with huge pages.
              preload    Preloads the file after every opn reference.
+             readahead  The number of windows to read ahead when a file is
+                        read sequentially (default 1, 0 disables it).
+             window     Maps files larger than <wsz> in windows of <wsz> bytes
+                        as they are read instead of mapping the whole file.
              <msz>      Maximum amount of memory to use (can be n% or real mem).
+                        Windows are evicted to stay within this amount.
 
    Output: 0 upon success or !0 upon failure.
 */
@@ -1383,16 +1433,19 @@ int XrdOssSys::xmaxsz(XrdOucStream &Config, XrdSysError &Eroute)
 int XrdOssSys::xmemf(XrdOucStream &Config, XrdSysError &Eroute)
 {
     char *val;
-    int i, j, V_check=-1, V_preld = -1, V_on=-1;
-    long long V_max = 0;
+    int i, j, V_check=-1, V_preld = -1, V_on=-1, V_huge=-1, V_rdahd=-1;
+    long long V_max = 0, V_winsz = 0;
 
     static struct mmapopts {const char *opname; int otyp;
                             const char *opmsg;} mmopts[] =
        {
         {"off",        0, ""},
         {"preload",    1, "memfile preload"},
-        {"check",      2, "memfile check"},
-        {"max",        3, "memfile max"}};
+        {"hugepages",  2, "memfile hugepages"},
+        {"check",      3, "memfile check"},
+        {"max",        4, "memfile max"},
+        {"window",     5, "memfile window"},
+        {"readahead",  6, "memfile readahead"}};
     int numopts = sizeof(mmopts)/sizeof(struct mmapopts);
 
     if (!(val = Config.GetWord()))
@@ -1403,7 +1456,7 @@ int XrdOssSys::xmemf(XrdOucStream &Config, XrdSysError &Eroute)
               if (!strcmp(val, mmopts[i].opname)) break;
           if (i >= numopts)
              Eroute.Say("Config warning: ignoring invalid memfile option '",val,"'.");
-             else {if (mmopts[i].otyp >  1 && !(val = Config.GetWord()))
+             else {if (mmopts[i].otyp >  2 && !(val = Config.GetWord()))
                       {Eroute.Emsg("Config","memfile",mmopts[i].opname,
                                    "value not specified");
                        return 1;
@@ -1411,7 +1464,9 @@ int XrdOssSys::xmemf(XrdOucStream &Config, XrdSysError &Eroute)
                    switch(mmopts[i].otyp)
                          {case 1: V_preld = 1;
                                   break;
-                          case 2: if (!strcmp("xattr",val)
+                          case 2: V_huge  = 1;
+                                  break;
+                          case 3: if (!strcmp("xattr",val)
                                   ||  !strcmp("lock", val)
                                   ||  !strcmp("map",  val)
                                   ||  !strcmp("keep", val)) V_check=1;
@@ -1420,7 +1475,7 @@ int XrdOssSys::xmemf(XrdOucStream &Config, XrdSysError &Eroute)
                                        return 1;
                                       }
                                   break;
-                          case 3: j = strlen(val);
+                          case 4: j = strlen(val);
                                   if (val[j-1] == '%')
                                      {val[j-1] = '\0';
                                       if (XrdOuca2x::a2i(Eroute,mmopts[i].opmsg,
@@ -1430,6 +1485,13 @@ int XrdOssSys::xmemf(XrdOucStream &Config, XrdSysError &Eroute)
                                                 mmopts[i].opmsg, val, &V_max,
                                                 10*1024*1024)) return 1;
                                   break;
+                          case 5: if (XrdOuca2x::a2sz(Eroute, mmopts[i].opmsg,
+                                                val, &V_winsz, 64*1024))
+                                     return 1;
+                                  break;
+                          case 6: if (XrdOuca2x::a2i(Eroute, mmopts[i].opmsg,
+                                                val, &V_rdahd, 0, 64)) return 1;
+                                  break;
                           default: V_on = 0; break;
                          }
                   val = Config.GetWord();
@@ -1440,6 +1502,7 @@ int XrdOssSys::xmemf(XrdOucStream &Config, XrdSysError &Eroute)
 //
    XrdOssMio::Set(V_on, V_preld, V_check);
    XrdOssMio::Set(V_max);
+   XrdOssMio::SetWindow(V_winsz, V_rdahd, V_huge);
    return 0;
 }
 
@@ -30,6 +30,7 @@
 
 #include <unistd.h>
 #include <cstdio>
+#include <cstring>
 #include <sys/param.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -55,11 +56,16 @@ XrdSysMutex    XrdOssMio::MM_Mutex;
 XrdOssMioFile *XrdOssMio::MM_Perm     = 0;
 XrdOssMioFile *XrdOssMio::MM_Idle     = 0;
 XrdOssMioFile *XrdOssMio::MM_IdleLast = 0;
+XrdOssMioWin  *XrdOssMio::MM_Hand     = 0;
 
 char           XrdOssMio::MM_on       = 1;
 char           XrdOssMio::MM_chk      = 0;
 char           XrdOssMio::MM_okmlock  = 1;
 char           XrdOssMio::MM_preld    = 0;
+char           XrdOssMio::MM_huge     = 0;
+int            XrdOssMio::MM_rdahd    = 1;
+int            XrdOssMio::MM_wins     = 0;
+long long      XrdOssMio::MM_winsz    = 0;
 long long      XrdOssMio::MM_pagsz    = (long long)sysconf(_SC_PAGESIZE);
 #ifdef __APPLE__
 long long      XrdOssMio::MM_pages    = 1024*1024*1024;
@@ -79,14 +85,166 @@ extern XrdSysTrace OssTrace;
 
 void XrdOssMio::Display(XrdSysError &Eroute)
 {
-     char buff[1080];
-     snprintf(buff, sizeof(buff), "       oss.memfile %s%s%s max %lld",
+     char buff[1080], wbuff[128];
+
+     if (!MM_winsz) *wbuff = 0;
+        else snprintf(wbuff, sizeof(wbuff), " window %lld readahead %d%s",
+                      MM_winsz, MM_rdahd, (MM_huge ? " hugepages" : ""));
+     snprintf(buff, sizeof(buff), "       oss.memfile %s%s%s max %lld%s",
              (MM_on      ? ""            : "off "),
              (MM_preld   ? "preload"     : ""),
-             (MM_chk     ? "check xattr" : ""), MM_max);
+             (MM_chk     ? "check xattr" : ""), MM_max, wbuff);
      Eroute.Say(buff);
 }
 
+/******************************************************************************/
+/*                                 E v i c t                                  */
+/******************************************************************************/
+
+// Evict() can only be called if the caller has the MM_Mutex lock! Windows are
+// evicted in clock order: a window referenced since the hand last passed it
+// gets a second chance and windows being copied from are skipped.
+//
+bool XrdOssMio::Evict(long long amount)
+{
+   EPNAME("MioEvict");
+   XrdOssMioWin  *wP;
+   XrdOssMioFile *mp;
+   int numLeft = MM_wins*2;
+
+// Sweep the ring until we freed enough or every window was looked at twice
+//
+   while(amount > 0 && MM_Hand && numLeft-- > 0)
+        {wP = MM_Hand; MM_Hand = wP->Next;
+         if (wP->Used) {wP->Used = false; continue;}
+         mp = wP->File;
+         mp->winMutex.Lock();
+         if (wP->Refs.load(std::memory_order_acquire))
+            {mp->winMutex.UnLock();
+             continue;
+            }
+         mp->winMap.erase(wP->Offset / MM_winsz);
+         mp->winMutex.UnLock();
+         Unlink(wP);
+         mp->winBytes -= wP->Size;
+         MM_inuse     -= wP->Size;
+         amount       -= wP->Size;
+#if defined(_POSIX_MAPPED_FILES)
+         munmap(wP->Base, wP->Size);
+#endif
+         DEBUG("Evicted window at " <<wP->Offset <<" of " <<mp->HashName);
+         delete wP;
+        }
+
+// Indicate whether we cleared enough
+//
+   return amount <= 0;
+}
+
+/******************************************************************************/
+/*                                g e t W i n                                 */
+/******************************************************************************/
+
+// getWin() returns the window with a reference that the caller must drop.
+//
+XrdOssMioWin *XrdOssMio::getWin(XrdOssMioFile *mp, int fd, off_t wNum,
+                                bool isSeq)
+{
+#if defined(_POSIX_MAPPED_FILES)
+   EPNAME("MioWin");
+   std::map<off_t, XrdOssMioWin*>::iterator it;
+   XrdOssMioWin *wP, *oP;
+   off_t  wOff = wNum * MM_winsz;
+   size_t wLen;
+   void  *wAddr;
+
+// Most of the time the window will already be mapped
+//
+   mp->winMutex.Lock();
+   if ((it = mp->winMap.find(wNum)) != mp->winMap.end())
+      {wP = it->second;
+       wP->Refs++;
+       wP->Used = true;
+       mp->winMutex.UnLock();
+       return wP;
+      }
+   mp->winMutex.UnLock();
+
+// Compute the size of the window, the last one may be short
+//
+   if (wOff >= mp->Size) return 0;
+   wLen = (mp->Size - wOff < MM_winsz ? mp->Size - wOff : MM_winsz);
+
+// Charge the window against the memory budget, reclaiming what we must
+//
+   MM_Mutex.Lock();
+   if (MM_inuse + (long long)wLen > MM_max
+   &&  !Reclaim(MM_inuse + wLen - MM_max))
+      {MM_Mutex.UnLock();
+       DEBUG("Unable to reclaim storage for window " <<wNum <<" of "
+             <<mp->HashName);
+       return 0;
+      }
+   MM_inuse += wLen;
+   MM_Mutex.UnLock();
+
+// Map the window. We do not hold any locks here as this may take a while.
+//
+   if ((wAddr = mmap(0, wLen, PROT_READ, MAP_PRIVATE, fd, wOff)) == MAP_FAILED)
+      {OssEroute.Emsg("Mio", errno, "mmap window of file", mp->HashName);
+       MM_Mutex.Lock(); MM_inuse -= wLen; MM_Mutex.UnLock();
+       return 0;
+      }
+#ifdef MADV_HUGEPAGE
+   if (MM_huge) madvise(wAddr, wLen, MADV_HUGEPAGE);
+#endif
+   if (isSeq) madvise(wAddr, wLen, MADV_SEQUENTIAL);
+
+// Get a new window object
+//
+   wP = new XrdOssMioWin;
+   wP->File   = mp;
+   wP->Base   = (char *)wAddr;
+   wP->Offset = wOff;
+   wP->Size   = wLen;
+   wP->Refs   = 1;
+   wP->Used   = true;
+
+// Add the window unless another thread beat us to it
+//
+   MM_Mutex.Lock();
+   mp->winMutex.Lock();
+   if ((it = mp->winMap.find(wNum)) != mp->winMap.end())
+      {oP = it->second;
+       oP->Refs++;
+       oP->Used = true;
+       mp->winMutex.UnLock();
+       MM_inuse -= wLen;
+       MM_Mutex.UnLock();
+       munmap(wAddr, wLen);
+       delete wP;
+       return oP;
+      }
+   mp->winMap[wNum] = wP;
+   mp->winMutex.UnLock();
+   mp->winBytes += wLen;
+
+// Place the window just behind the clock hand, it will be looked at last
+//
+   if (!MM_Hand) {wP->Next = wP->Prev = wP; MM_Hand = wP;}
+      else {wP->Next = MM_Hand; wP->Prev = MM_Hand->Prev;
+            MM_Hand->Prev->Next = wP; MM_Hand->Prev = wP;
+           }
+   MM_wins++;
+   MM_Mutex.UnLock();
+
+   DEBUG("mmap " <<wLen <<" bytes at " <<wOff <<" for " <<mp->HashName);
+   return wP;
+#else
+   return 0;
+#endif
+}
+
 /******************************************************************************/
 /*                                   M a p                                    */
 /******************************************************************************/
@@ -130,6 +288,29 @@ XrdOssMioFile *XrdOssMio::Map(char *path, int fd, int opts)
        return mp;
       }
 
+// Large files are mapped in windows as they are read unless the whole file
+// must stay resident. This does not use any memory until we actually read.
+//
+   if (MM_winsz && statb.st_size > MM_winsz
+   &&  !(opts & (OSSMIO_MLOK | OSSMIO_MPRM)))
+      {if (!(mp = new XrdOssMioFile(hashname)))
+          {OssEroute.Emsg("Mio", "Unable to allocate mmap file object for", path);
+           return 0;
+          }
+       mp->Windowed = true;
+       mp->Size     = statb.st_size;
+       mp->Dev      = statb.st_dev;
+       mp->Ino      = statb.st_ino;
+       mp->Status   = opts;
+       if (MM_Hash.Add(hashname, mp))
+          {OssEroute.Emsg("Mio", "Hash add failed for", path);
+           delete mp;
+           return 0;
+          }
+       DEBUG("Windowed mmap of " <<statb.st_size <<" bytes for " <<path);
+       return mp;
+      }
+
 // Check if memory will be over committed
 //
    if (MM_inuse + statb.st_size > MM_max)
@@ -216,6 +397,39 @@ XrdOssMioFile *XrdOssMio::Map(char *path, int fd, int opts)
 #endif
 }
 
+/******************************************************************************/
+/*                              P r e f e t c h                               */
+/******************************************************************************/
+
+// Prefetch() maps the windows covering the range and asks the kernel to start
+// reading them in. This also warms the page cache for any sendfile() path.
+//
+void XrdOssMio::Prefetch(XrdOssMioFile *mp, int fd, off_t offset, size_t blen)
+{
+#if defined(_POSIX_MAPPED_FILES)
+   XrdOssMioWin *wP;
+   off_t wNum, wEnd, begOff, endOff;
+
+// Trim the range to the file, ignoring anything that is not windowed
+//
+   if (!mp->Windowed || offset >= mp->Size || !blen) return;
+   if ((off_t)blen > mp->Size - offset) blen = mp->Size - offset;
+   wEnd = (offset + blen - 1) / MM_winsz;
+
+// Advise the kernel about the part of each window we will need
+//
+   for (wNum = offset / MM_winsz; wNum <= wEnd; wNum++)
+       {if (!(wP = getWin(mp, fd, wNum, false))) break;
+        begOff = (offset > wP->Offset ? offset - wP->Offset : 0);
+        begOff &= ~(MM_pagsz - 1);
+        endOff = offset + blen - wP->Offset;
+        if (endOff > (off_t)wP->Size) endOff = wP->Size;
+        madvise(wP->Base + begOff, endOff - begOff, MADV_WILLNEED);
+        wP->Refs.fetch_sub(1, std::memory_order_release);
+       }
+#endif
+}
+
 /******************************************************************************/
 /*                               p r e L o a d                                */
 /******************************************************************************/
@@ -238,6 +452,61 @@ void *XrdOssMio::preLoad(void *arg)
    return (void *)0;
 }
 
+/******************************************************************************/
+/*                                  R e a d                                   */
+/******************************************************************************/
+
+ssize_t XrdOssMio::Read(XrdOssMioFile *mp, int fd, void *buff,
+                        off_t offset, size_t blen)
+{
+   XrdOssMioWin *wP;
+   char   *bP = (char *)buff;
+   off_t   endOff, wNum, raBeg, raEnd;
+   size_t  wOff, dlen;
+   ssize_t bytes = 0;
+   bool    isSeq;
+
+// Trim the request to the size of the file
+//
+   if (offset >= mp->Size) return 0;
+   if ((off_t)blen > mp->Size - offset) blen = mp->Size - offset;
+   endOff = offset + blen;
+
+// A read that starts where the previous one ended is taken to be sequential.
+// The check is racy but all it does is drive advice to the kernel.
+//
+   isSeq = (mp->nextOff == offset);
+   mp->nextOff = endOff;
+
+// Copy the data out window by window
+//
+   while(blen)
+        {wNum = offset / MM_winsz;
+         if (!(wP = getWin(mp, fd, wNum, isSeq))) break;
+         wOff = offset - wP->Offset;
+         dlen = wP->Size - wOff;
+         if (dlen > blen) dlen = blen;
+         memcpy(bP, wP->Base + wOff, dlen);
+         wP->Refs.fetch_sub(1, std::memory_order_release);
+         bP += dlen; offset += dlen; blen -= dlen; bytes += dlen;
+        }
+
+// For sequential access, read ahead the windows we will need next
+//
+   if (isSeq && MM_rdahd && !blen)
+      {wNum  = (endOff - 1) / MM_winsz;
+       raEnd = wNum + MM_rdahd;
+       raBeg = mp->raWin;
+       if (raBeg < wNum || raBeg > raEnd) raBeg = wNum;
+       if (raBeg < raEnd)
+          {mp->raWin = raEnd;
+           Prefetch(mp, fd, (raBeg+1)*MM_winsz, (raEnd-raBeg)*MM_winsz);
+          }
+      }
+
+   return bytes;
+}
+
 /******************************************************************************/
 /*                               R e c l a i m                                */
 /******************************************************************************/
@@ -248,20 +517,33 @@ int XrdOssMio::Reclaim(off_t amount)
 {
    EPNAME("MioReclaim");
    XrdOssMioFile *mp;
+   long long freed;
    DEBUG("Trying to reclaim " <<amount <<" bytes.");
 
-// Try to reclaim memory
+// Try to reclaim memory from files no one is using. Windows of idle files are
+// unmapped here as no one can be reading from them.
 //
    while((mp = MM_Idle) && amount > 0)
-        {MM_Idle = mp->Next;
-         MM_inuse -= mp->Size;
-         amount   -= mp->Size;
+        {if (!(MM_Idle = mp->Next)) MM_IdleLast = 0;
+         if (!mp->Windowed) freed = mp->Size;
+            else {freed = mp->winBytes;
+                  for (auto &wEnt : mp->winMap)
+                      {Unlink(wEnt.second);
+#if defined(_POSIX_MAPPED_FILES)
+                       munmap(wEnt.second->Base, wEnt.second->Size);
+#endif
+                       delete wEnt.second;
+                      }
+                  mp->winMap.clear();
+                 }
+         MM_inuse -= freed;
+         amount   -= freed;
          MM_Hash.Del(mp->HashName);  // This will delete the object
         }
 
-// Indicate whether we cleared enough
+// Indicate whether we cleared enough, evicting windows if need be
 //
-   return amount <= 0;
+   return amount <= 0 || Evict(amount);
 }
 
 /******************************************************************************/
@@ -329,6 +611,41 @@ void XrdOssMio::Set(long long V_max)
    if (V_max > 0) MM_max = V_max;
       else if (V_max < 0) MM_max = MM_pagsz*MM_pages*(-V_max)/100;
 }
+
+/******************************************************************************/
+/*                             S e t W i n d o w                              */
+/******************************************************************************/
+
+void XrdOssMio::SetWindow(long long V_winsz, int V_rdahd, int V_huge)
+{
+   long long wAlign;
+
+   if (V_huge    >= 0) MM_huge    = (char)V_huge;
+   if (V_rdahd   >= 0) MM_rdahd   = V_rdahd;
+
+// Windows must be page aligned and, for huge pages, huge page aligned
+//
+   if (V_winsz   >  0)
+      {wAlign   = (MM_huge ? 2*1024*1024 : MM_pagsz);
+       MM_winsz = (V_winsz + wAlign - 1) / wAlign * wAlign;
+      }
+}
+
+/******************************************************************************/
+/*                                U n l i n k                                 */
+/******************************************************************************/
+
+// Unlink() can only be called if the caller has the MM_Mutex lock!
+//
+void XrdOssMio::Unlink(XrdOssMioWin *wP)
+{
+   if (wP->Next == wP) MM_Hand = 0;
+      else {wP->Prev->Next = wP->Next;
+            wP->Next->Prev = wP->Prev;
+            if (MM_Hand == wP) MM_Hand = wP->Next;
+           }
+   MM_wins--;
+}
  
 /******************************************************************************/
 /*             X r d O s s d M i o F i l e   D e s t r u c t o r              */
@@ -337,6 +654,6 @@ void XrdOssMio::Set(long long V_max)
 XrdOssMioFile::~XrdOssMioFile()
 {
 #if defined(_POSIX_MAPPED_FILES)
-    munmap((char *)Base, Size);
+    if (Base) munmap((char *)Base, Size);
 #endif
 }
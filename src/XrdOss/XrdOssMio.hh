@@ -52,17 +52,33 @@ static char           isOn()   {return MM_on;}
 
 static XrdOssMioFile *Map(char *path, int fd, int opts);
 
+static void           Prefetch(XrdOssMioFile *mp, int fd, off_t offset,
+                               size_t blen);
+
 static void          *preLoad(void *arg);
 
+// Read() copies data out of a windowed mapping. It returns the number of
+// bytes copied, which may be short should the memory budget be exhausted;
+// the caller must then read the remainder from the file.
+//
+static ssize_t        Read(XrdOssMioFile *mp, int fd, void *buff,
+                           off_t offset, size_t blen);
+
 static void           Recycle(XrdOssMioFile *mp);
 
 static void           Set(int V_off, int V_preld, int V_check);
 
 static void           Set(long long V_max);
 
+static void           SetWindow(long long V_winsz, int V_rdahd, int V_huge);
+
 private:
-static int  Reclaim(off_t amount);
-static int  Reclaim(XrdOssMioFile *mp);
+static bool          Evict(long long amount);
+static XrdOssMioWin *getWin(XrdOssMioFile *mp, int fd, off_t wNum,
+                            bool isSeq);
+static int           Reclaim(off_t amount);
+static int           Reclaim(XrdOssMioFile *mp);
+static void          Unlink(XrdOssMioWin *wP);
 
 static XrdOucHash<XrdOssMioFile> MM_Hash;
 
@@ -70,11 +86,16 @@ static XrdSysMutex    MM_Mutex;
 static XrdOssMioFile *MM_Perm;
 static XrdOssMioFile *MM_Idle;
 static XrdOssMioFile *MM_IdleLast;
+static XrdOssMioWin  *MM_Hand;
 
 static char       MM_on;
 static char       MM_chk;
 static char       MM_okmlock;
 static char       MM_preld;
+static char       MM_huge;
+static int        MM_rdahd;
+static int        MM_wins;
+static long long  MM_winsz;
 static long long  MM_max;
 static long long  MM_pagsz;
 static long long  MM_pages;
@@ -30,19 +30,47 @@
 /* specific prior written permission of the institution or contributor.       */
 /******************************************************************************/
 
+#include <atomic>
 #include <ctime>
+#include <map>
 #include <sys/types.h>
+
+#include "XrdSys/XrdSysPthread.hh"
+#include "XrdSys/XrdSysRAtomic.hh"
+
+class XrdOssMioFile;
+
+// A window is a fixed size, independently mapped piece of a large file. All
+// windows are on a single clock ring used to evict them under the memory
+// budget; the ring is protected by the XrdOssMio global mutex.
+//
+struct XrdOssMioWin
+{
+XrdOssMioWin    *Next;   // Clock ring
+XrdOssMioWin    *Prev;
+XrdOssMioFile   *File;
+char            *Base;
+off_t            Offset;
+size_t           Size;
+std::atomic<int> Refs;   // Readers copying out of the window
+RAtomic_bool     Used;   // Referenced since the clock hand last passed
+};
   
 class XrdOssMioFile
 {
 public:
 friend class XrdOssMio;
 
-off_t Export(void **Addr) {*Addr = Base; return Size;}
+off_t Export(void **Addr) {if (Windowed) {*Addr = 0; return 0;}
+                           *Addr = Base; return Size;
+                          }
+
+bool  isWindowed() {return Windowed;}
 
        XrdOssMioFile(char *hname)
                     {strcpy(HashName, hname); 
-                     inUse = 1; Next = 0; Size = 0;
+                     inUse = 1; Next = 0; Size = 0; Base = 0;
+                     Windowed = false; winBytes = 0; nextOff = -1; raWin = -1;
                     }
       ~XrdOssMioFile();
 
@@ -55,6 +83,17 @@ int            Status;
 int            inUse;
 void          *Base;
 off_t          Size;
+
+// The following are only used when the file is mapped in windows. The map
+// is keyed by window number and protected by winMutex which, when both are
+// needed, is always obtained after the XrdOssMio global mutex.
+//
+XrdSysMutex                    winMutex;
+std::map<off_t, XrdOssMioWin*> winMap;
+long long                      winBytes; // Mapped bytes (global mutex)
+RAtomic_llong                  nextOff;  // Offset following the last read
+RAtomic_llong                  raWin;    // Last window read ahead
+bool                           Windowed;
 char           HashName[64];
 };
 #endif
@@ -32,6 +32,7 @@
 #include "XrdOssCsiConfig.hh"
 #include "XrdOss/XrdOss.hh"
 #include "XrdOssCsiTrace.hh"
+#include "XrdOuc/XrdOuca2x.hh"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -86,6 +87,12 @@ int XrdOssCsiConfig::Init(XrdSysError &Eroute, const char *config_fn, const char
       {
          disableLooseWrite_ = true;
       }
+      else if (item == "tagcache")
+      {
+         int n;
+         if (XrdOuca2x::a2i(Eroute, "tagcache", value.c_str(), &n, 0, 16384)) NoGo = 1;
+         else tagCachePages_ = n;
+      }
    }
 
    if (NoGo) return NoGo;
@@ -99,6 +106,7 @@ int XrdOssCsiConfig::Init(XrdSysError &Eroute, const char *config_fn, const char
    Eroute.Say("       allow files without CRCs: ", allowMissingTags_ ? "yes" : "no");
    Eroute.Say("       pgWrite can extend      : ", disablePgExtend_ ? "no" : "yes");
    Eroute.Say("       loose writes            : ", disableLooseWrite_ ? "no" : "yes");
+   Eroute.Say("       tag cache pages per file: ", std::to_string((long long int)tagCachePages_).c_str());
    Eroute.Say("       trace level             : ", std::to_string((long long int)OssCsiTrace.What).c_str());
    Eroute.Say("       prefix                  : ", tagParam_.prefix_.empty() ? "[empty]" : tagParam_.prefix_.c_str());
 
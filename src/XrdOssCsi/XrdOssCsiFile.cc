@@ -258,7 +258,7 @@ int XrdOssCsiFile::createPageUpdater(const int Oflag, XrdOucEnv &Env)
 
    std::unique_ptr<XrdOssDF> integFile(parentOss_->newFile(tident));
    std::unique_ptr<XrdOssCsiTagstore> ts(new
-      XrdOssCsiTagstoreFile(pmi_->dpath, std::move(integFile), tident));
+      XrdOssCsiTagstoreFile(pmi_->dpath, std::move(integFile), tident, config_.tagCachePages()));
    std::unique_ptr<XrdOssCsiPages> pages(new
       XrdOssCsiPages(pmi_->dpath, std::move(ts), config_.fillFileHole(), config_.allowMissingTags(),
                      config_.disablePgExtend(), config_.disableLooseWrite(), tident));
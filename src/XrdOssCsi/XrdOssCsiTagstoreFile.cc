@@ -36,6 +36,9 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <vector>
+
 extern XrdOucTrace  OssCsiTrace;
 
 int XrdOssCsiTagstoreFile::Open(const char *path, const off_t dsize, const int Oflag, XrdOucEnv &Env)
@@ -134,11 +137,15 @@ int XrdOssCsiTagstoreFile::ResetSizes(const off_t size)
 {
    EPNAME("ResetSizes");
    if (!isOpen) return -EBADF;
+   std::unique_lock<std::mutex> lck(cmtx_);
+   const int dret = DropCache(lck);
+   if (dret<0) return dret;
    actualsize_ = size;
    struct stat sb;
    const int ssret = fd_->Fstat(&sb);
    if (ssret<0) return ssret;
    const off_t expected_tagfile_size = 20LL + 4*((trackinglen_+XrdSys::PageSize-1)/XrdSys::PageSize);
+   tagcount_ = (sb.st_size>20) ? (sb.st_size - 20)/4 : 0;
    // truncate can be relatively slow
    if (expected_tagfile_size < sb.st_size)
    {
@@ -146,6 +153,7 @@ int XrdOssCsiTagstoreFile::ResetSizes(const off_t size)
          ", from current size " << sb.st_size << " for " << fn_);
       const int tret = fd_->Ftruncate(expected_tagfile_size);
       if (tret<0) return tret;
+      tagcount_ = (expected_tagfile_size - 20)/4;
    }
    else if (expected_tagfile_size > sb.st_size)
    {
@@ -157,6 +165,7 @@ int XrdOssCsiTagstoreFile::ResetSizes(const off_t size)
       if (stret<0) return stret;
       const int tret = fd_->Ftruncate(20LL + 4*nb);
       if (tret<0) return tret;
+      tagcount_ = nb;
    }
    return 0;
 }
@@ -164,25 +173,50 @@ int XrdOssCsiTagstoreFile::ResetSizes(const off_t size)
 int XrdOssCsiTagstoreFile::Fsync()
 {
    if (!isOpen) return -EBADF;
+   {
+      std::lock_guard<std::mutex> guard(cmtx_);
+      const int wret = WriteBack();
+      if (wret<0) return wret;
+   }
    return fd_->Fsync();
 }
 
 void XrdOssCsiTagstoreFile::Flush()
 {
    if (!isOpen) return;
+   {
+      std::lock_guard<std::mutex> guard(cmtx_);
+      (void)WriteBack();
+   }
    fd_->Flush();
 }
 
 int XrdOssCsiTagstoreFile::Close()
 {
+   EPNAME("TagstoreFile::Close");
    if (!isOpen) return -EBADF;
+   int wret;
+   {
+      std::unique_lock<std::mutex> lck(cmtx_);
+      ccv_.wait(lck, [this]{ return tcloads_ == 0; });
+      wret = WriteBack();
+      if (wret<0)
+      {
+         TRACE(Warn, "Lost unwritten tags of " << fn_ << " (" << wret << ")");
+      }
+      cache_.clear();
+      lru_.clear();
+      nexttag_ = -1;
+   }
    isOpen = false;
-   return fd_->Close();
+   const int cret = fd_->Close();
+   return (wret<0) ? wret : cret;
 }
 
 ssize_t XrdOssCsiTagstoreFile::WriteTags(const uint32_t *const buf, const off_t off, const size_t n)
 {
    if (!isOpen) return -EBADF;
+   if (tcmax_) return CachedWriteTags(buf, off, n);
    if (machineIsBige_ != fileIsBige_) return WriteTags_swap(buf, off, n);
 
    const ssize_t nwritten = XrdOssCsiTagstoreFile::fullwrite(*fd_, buf, 20LL+4*off, 4*n);
@@ -193,6 +227,7 @@ ssize_t XrdOssCsiTagstoreFile::WriteTags(const uint32_t *const buf, const off_t
 ssize_t XrdOssCsiTagstoreFile::ReadTags(uint32_t *const buf, const off_t off, const size_t n)
 {
    if (!isOpen) return -EBADF;
+   if (tcmax_) return CachedReadTags(buf, off, n);
    if (machineIsBige_ != fileIsBige_) return ReadTags_swap(buf, off, n);
 
    const ssize_t nread = XrdOssCsiTagstoreFile::fullread(*fd_, buf, 20LL+4*off, 4*n);
@@ -207,12 +242,18 @@ int XrdOssCsiTagstoreFile::Truncate(const off_t size, bool datatoo)
       return -EBADF;
    }
 
+   // write back and forget any cached tags before changing the length
+   std::unique_lock<std::mutex> lck(cmtx_);
+   const int dret = DropCache(lck);
+   if (dret<0) return dret;
+
    // set tag file to correct length for value of size
    const off_t expected_tagfile_size = 20LL + 4*((size+XrdSys::PageSize-1)/XrdSys::PageSize);
    const int tret = fd_->Ftruncate(expected_tagfile_size);
 
    // if failed to set the tagfile length return error before updating header
    if (tret != XrdOssOK) return tret;
+   tagcount_ = (expected_tagfile_size - 20)/4;
 
    // truncating down to zero, so reset to content verified
    if (datatoo && size==0) hflags_ |= XrdOssCsiTagstore::csVer;
@@ -265,3 +306,308 @@ ssize_t XrdOssCsiTagstoreFile::ReadTags_swap(uint32_t *const buf, const off_t of
    }
    return n;
 }
+
+ssize_t XrdOssCsiTagstoreFile::CachedWriteTags(const uint32_t *const buf, const off_t off, const size_t n)
+{
+   std::unique_lock<std::mutex> lck(cmtx_);
+   size_t nwritten = 0;
+   while(nwritten<n)
+   {
+      const off_t t = off + nwritten;
+      const off_t pg = t / tpTags_;
+      const size_t pi = t % tpTags_;
+      const size_t cnt = std::min(n - nwritten, tpTags_ - pi);
+
+      // a page which is completely overwritten does not need to be read first
+      std::shared_ptr<TagPage> tp;
+      const int gret = GetPage(lck, pg, cnt != tpTags_, false, tp);
+      if (gret<0) return gret;
+
+      if (machineIsBige_ != fileIsBige_)
+      {
+         for(size_t i=0;i<cnt;i++)
+         {
+            tp->tags[pi+i] = bswap_32(buf[nwritten+i]);
+         }
+      }
+      else
+      {
+         memcpy(&tp->tags[pi], &buf[nwritten], 4*cnt);
+      }
+
+      if (tp->dlo == tp->dhi)
+      {
+         tp->dlo = pi;
+         tp->dhi = pi + cnt;
+      }
+      else
+      {
+         tp->dlo = std::min(tp->dlo, pi);
+         tp->dhi = std::max(tp->dhi, pi + cnt);
+      }
+      nwritten += cnt;
+   }
+   if (off + (off_t)n > tagcount_) tagcount_ = off + n;
+   return n;
+}
+
+ssize_t XrdOssCsiTagstoreFile::CachedReadTags(uint32_t *const buf, const off_t off, const size_t n)
+{
+   std::unique_lock<std::mutex> lck(cmtx_);
+
+   // as for an uncached read, asking for tags past the end is an error
+   if (off + (off_t)n > tagcount_) return -EDOM;
+
+   const bool seq = (off == nexttag_);
+   size_t nread = 0;
+   while(nread<n)
+   {
+      const off_t t = off + nread;
+      const off_t pg = t / tpTags_;
+      const size_t pi = t % tpTags_;
+      const size_t cnt = std::min(n - nread, tpTags_ - pi);
+
+      std::shared_ptr<TagPage> tp;
+      const int gret = GetPage(lck, pg, true, seq, tp);
+      if (gret<0) return gret;
+
+      if (machineIsBige_ != fileIsBige_)
+      {
+         for(size_t i=0;i<cnt;i++)
+         {
+            buf[nread+i] = bswap_32(tp->tags[pi+i]);
+         }
+      }
+      else
+      {
+         memcpy(&buf[nread], &tp->tags[pi], 4*cnt);
+      }
+      nread += cnt;
+   }
+   nexttag_ = off + n;
+   return n;
+}
+
+//
+// Find page pg in the cache, adding it if needed. If fill is set a new page
+// is read from the tag file, together with following pages if seq is set.
+// Otherwise a new page starts zeroed. Called with cmtx_ held through lck,
+// which is released while waiting for or reading pages.
+//
+int XrdOssCsiTagstoreFile::GetPage(std::unique_lock<std::mutex> &lck, const off_t pg, const bool fill, const bool seq, std::shared_ptr<TagPage> &tp)
+{
+   while(true)
+   {
+      auto it = cache_.find(pg);
+      if (it != cache_.end())
+      {
+         if (it->second->loading)
+         {
+            ccv_.wait(lck);
+            continue;
+         }
+         tp = it->second;
+         lru_.splice(lru_.begin(), lru_, tp->lru);
+         return 0;
+      }
+
+      // number of pages to read: the following ones are added as long as
+      // they would hold tags and are not cached yet
+      size_t np = 1;
+      if (fill)
+      {
+         const size_t count = std::min(seq ? tpPrefetch_ : 1, tcmax_);
+         while(np < count && (pg+(off_t)np)*(off_t)tpTags_ < tagcount_ &&
+               cache_.find(pg+np) == cache_.end())
+         {
+            np++;
+         }
+      }
+
+      // making room may release the lock, so start over afterwards
+      if (cache_.size() + np > tcmax_)
+      {
+         const int eret = Evict(lck);
+         if (eret<0) return eret;
+         continue;
+      }
+
+      if (!fill)
+      {
+         tp = AddPage(pg);
+         return 0;
+      }
+
+      const int fret = FillPages(lck, pg, np);
+      if (fret<0) return fret;
+   }
+}
+
+//
+// Read the np pages starting at pg with a single read, without holding
+// cmtx_. The pages are added to the cache beforehand, marked as loading.
+// Anything past the end of the tag file reads as zero.
+//
+int XrdOssCsiTagstoreFile::FillPages(std::unique_lock<std::mutex> &lck, const off_t pg, const size_t np)
+{
+   std::vector<std::shared_ptr<TagPage>> pages;
+   for(size_t i=0;i<np;i++)
+   {
+      pages.push_back(AddPage(pg+i));
+      pages.back()->loading = true;
+   }
+   tcloads_++;
+   lck.unlock();
+
+   std::vector<uint32_t> b(np*tpTags_);
+   const off_t boff = 20LL + 4*pg*(off_t)tpTags_;
+   size_t toread = 4*b.size(), nread = 0;
+   uint8_t *p = (uint8_t*)b.data();
+   ssize_t rret = 0;
+   while(toread>0)
+   {
+      rret = fd_->Read(&p[nread], boff+nread, toread);
+      if (rret<=0) break;
+      toread -= rret;
+      nread += rret;
+   }
+   memset(&p[nread], 0, toread);
+
+   lck.lock();
+   tcloads_--;
+   for(size_t i=0;i<np;i++)
+   {
+      pages[i]->loading = false;
+      if (rret<0)
+      {
+         lru_.erase(pages[i]->lru);
+         cache_.erase(pg+i);
+      }
+      else
+      {
+         memcpy(pages[i]->tags, &b[i*tpTags_], sizeof(pages[i]->tags));
+      }
+   }
+   ccv_.notify_all();
+   return (rret<0) ? rret : 0;
+}
+
+//
+// Add a zeroed page to the cache as the most recently used one. Called with
+// cmtx_ held.
+//
+std::shared_ptr<XrdOssCsiTagstoreFile::TagPage> XrdOssCsiTagstoreFile::AddPage(const off_t pg)
+{
+   std::shared_ptr<TagPage> tp(new TagPage);
+   memset(tp->tags, 0, sizeof(tp->tags));
+   tp->dlo = tp->dhi = 0;
+   tp->loading = false;
+   tp->lru = lru_.insert(lru_.begin(), pg);
+   cache_.emplace(pg, tp);
+   return tp;
+}
+
+//
+// Remove the least recently used page, writing it back first if dirty.
+// Pages being loaded can't be removed, if there are only such pages wait
+// for one of them to complete. Called with cmtx_ held through lck.
+//
+int XrdOssCsiTagstoreFile::Evict(std::unique_lock<std::mutex> &lck)
+{
+   for(auto lit = lru_.rbegin(); lit != lru_.rend(); ++lit)
+   {
+      auto victim = cache_.find(*lit);
+      if (victim->second->loading) continue;
+      if (victim->second->dlo != victim->second->dhi)
+      {
+         const int wret = WriteRun(victim, 1);
+         if (wret<0) return wret;
+      }
+      lru_.erase(victim->second->lru);
+      cache_.erase(victim);
+      return 0;
+   }
+   ccv_.wait(lck);
+   return 0;
+}
+
+//
+// Write all dirty pages to the tag file. Consecutive pages whose dirty
+// ranges meet are written with a single write. Called with cmtx_ held.
+//
+int XrdOssCsiTagstoreFile::WriteBack()
+{
+   auto it = cache_.begin();
+   while(it != cache_.end())
+   {
+      if (it->second->dlo == it->second->dhi)
+      {
+         ++it;
+         continue;
+      }
+      size_t np = 1;
+      auto last = it, next = std::next(it);
+      while(next != cache_.end() && next->first == last->first+1 &&
+            last->second->dhi == tpTags_ && next->second->dlo == 0 &&
+            next->second->dhi != 0)
+      {
+         np++;
+         last = next;
+         ++next;
+      }
+      const int wret = WriteRun(it, np);
+      if (wret<0) return wret;
+      it = next;
+   }
+   return 0;
+}
+
+//
+// Write the dirty ranges of the np pages starting at it, which WriteBack
+// has checked form a contiguous range of tags, and mark the pages clean.
+//
+int XrdOssCsiTagstoreFile::WriteRun(TagCache::iterator it, const size_t np)
+{
+   const TagPage *first = it->second.get();
+   const off_t woff = 20LL + 4*(it->first*(off_t)tpTags_ + first->dlo);
+   ssize_t wret;
+
+   if (np == 1)
+   {
+      wret = XrdOssCsiTagstoreFile::fullwrite(*fd_, &first->tags[first->dlo], woff, 4*(first->dhi - first->dlo));
+   }
+   else
+   {
+      std::vector<uint32_t> b;
+      b.reserve(np*tpTags_);
+      auto cur = it;
+      for(size_t i=0;i<np;i++,++cur)
+      {
+         const TagPage *tp = cur->second.get();
+         b.insert(b.end(), &tp->tags[tp->dlo], &tp->tags[tp->dhi]);
+      }
+      wret = XrdOssCsiTagstoreFile::fullwrite(*fd_, b.data(), woff, 4*b.size());
+   }
+   if (wret<0) return wret;
+
+   for(size_t i=0;i<np;i++,++it)
+   {
+      it->second->dlo = it->second->dhi = 0;
+   }
+   return 0;
+}
+
+//
+// Write back and forget all cached pages, once the pages being read came in.
+// Called with cmtx_ held through lck.
+//
+int XrdOssCsiTagstoreFile::DropCache(std::unique_lock<std::mutex> &lck)
+{
+   ccv_.wait(lck, [this]{ return tcloads_ == 0; });
+   const int wret = WriteBack();
+   if (wret<0) return wret;
+   cache_.clear();
+   lru_.clear();
+   nexttag_ = -1;
+   return 0;
+}
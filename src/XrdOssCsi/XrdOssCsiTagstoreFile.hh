@@ -36,13 +36,16 @@
 #include "XrdOuc/XrdOucCRC.hh"
 #include "XrdSys/XrdSysPlatform.hh"
 
+#include <condition_variable>
+#include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 
 class XrdOssCsiTagstoreFile : public XrdOssCsiTagstore
 {
 public:
-   XrdOssCsiTagstoreFile(const std::string &fn, std::unique_ptr<XrdOssDF> fd, const char *tid) : fn_(fn), fd_(std::move(fd)), trackinglen_(0), isOpen(false), tident_(tid), tident(tident_.c_str()) { }
+   XrdOssCsiTagstoreFile(const std::string &fn, std::unique_ptr<XrdOssDF> fd, const char *tid, size_t tcpages=0) : fn_(fn), fd_(std::move(fd)), trackinglen_(0), isOpen(false), tident_(tid), tident(tident_.c_str()), tcmax_(tcpages), tcloads_(0), tagcount_(0), nexttag_(-1) { }
    virtual ~XrdOssCsiTagstoreFile() { if (isOpen) { (void)Close(); } }
 
    virtual int Open(const char *, off_t, int, XrdOucEnv &) /* override */;
@@ -149,6 +152,47 @@ private:
    ssize_t WriteTags_swap(const uint32_t *, off_t, size_t);
    ssize_t ReadTags_swap(uint32_t *, off_t, size_t);
 
+   // Optional cache of tag pages: each page holds the tags of
+   // XrdSys::PageSize/4 data pages, as stored in the tag file. Written
+   // tags are kept dirty in the cache and written back, with adjacent
+   // pages merged into single writes, on Flush, Fsync, Close, Truncate
+   // or when the least recently used page is evicted. A failed write-back
+   // leaves the pages dirty so that it is retried. Sequential reads
+   // prefetch the next pages. Pages are read from the tag file without
+   // holding cmtx_, in the meantime they are marked as loading and anyone
+   // needing them waits on ccv_.
+   static const size_t tpTags_ = XrdSys::PageSize/4;
+   static const size_t tpPrefetch_ = 4;
+
+   struct TagPage
+   {
+      uint32_t tags[tpTags_];
+      size_t   dlo, dhi;      // dirty range of tags, none if dlo==dhi
+      bool     loading;       // being read from the tag file
+      std::list<off_t>::iterator lru; // position in lru_
+   };
+
+   typedef std::map<off_t, std::shared_ptr<TagPage>> TagCache;
+
+   ssize_t CachedWriteTags(const uint32_t *, off_t, size_t);
+   ssize_t CachedReadTags(uint32_t *, off_t, size_t);
+   int GetPage(std::unique_lock<std::mutex> &, off_t, bool, bool, std::shared_ptr<TagPage> &);
+   int FillPages(std::unique_lock<std::mutex> &, off_t, size_t);
+   std::shared_ptr<TagPage> AddPage(off_t);
+   int Evict(std::unique_lock<std::mutex> &);
+   int WriteBack();
+   int WriteRun(TagCache::iterator, size_t);
+   int DropCache(std::unique_lock<std::mutex> &);
+
+   std::mutex cmtx_;
+   std::condition_variable ccv_;
+   TagCache cache_;
+   std::list<off_t> lru_; // cached pages, most recently used first
+   const size_t tcmax_;   // maximum number of cached pages, 0 to disable
+   int tcloads_;          // reads of pages from the tag file in progress
+   off_t tagcount_;       // tags in the tag file, including unwritten ones
+   off_t nexttag_;        // tag following the last one read
+
    int WriteTrackedTagSize(const off_t size)
    {
       if (!isOpen) return -EBADF;
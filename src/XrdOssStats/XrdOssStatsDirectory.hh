@@ -8,6 +8,7 @@
 #include "XrdSys/XrdSysError.hh"
 
 #include <memory>
+#include <string>
 
 namespace XrdOssStats {
 
@@ -27,13 +28,14 @@ public:
     Opendir(const char *path,
             XrdOucEnv &env) override 
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_dirlist_ops, m_oss.m_slow_ops.m_dirlist_ops, m_oss.m_times.m_dirlist, m_oss.m_slow_times.m_dirlist, m_oss.m_slow_duration);
+        if (m_oss.m_slowlog) m_path = path;
+        FileSystem::OpTimer op(m_oss, FileSystem::OpDirlist, m_oss.m_ops.m_dirlist_ops, m_oss.m_slow_ops.m_dirlist_ops, path);
         return wrapDF.Opendir(path, env);
     }
 
     int Readdir(char *buff, int blen) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_dirlist_entries, m_oss.m_slow_ops.m_dirlist_entries, m_oss.m_times.m_dirlist, m_oss.m_slow_times.m_dirlist, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpDirlist, m_oss.m_ops.m_dirlist_entries, m_oss.m_slow_ops.m_dirlist_entries, m_path.c_str());
         return wrapDF.Readdir(buff, blen);
     }
 
@@ -42,6 +44,7 @@ private:
     std::unique_ptr<XrdOssDF> m_wrappedDir;
     XrdSysError m_log;
     FileSystem &m_oss;
+    std::string m_path; // Only kept when the slow operation log is enabled
 };
 
 } // namespace XrdOssStats
@@ -3,6 +3,8 @@
 #define __XRDOSSSTATS_FILE_H
 
 #include "XrdOss/XrdOssWrapper.hh"
+#include "XrdOuc/XrdOucIOVec.hh"
+#include "XrdSfs/XrdSfsAio.hh"
 #include "XrdSys/XrdSysError.hh"
 #include "XrdOssStatsFileSystem.hh"
 
@@ -26,75 +28,76 @@ public:
 
     int     Open(const char *path, int Oflag, mode_t Mode, XrdOucEnv &env) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_open_ops, m_oss.m_slow_ops.m_open_ops, m_oss.m_times.m_open, m_oss.m_slow_times.m_open, m_oss.m_slow_duration);
+        if (m_oss.m_slowlog) m_path = path;
+        FileSystem::OpTimer op(m_oss, FileSystem::OpOpen, m_oss.m_ops.m_open_ops, m_oss.m_slow_ops.m_open_ops, path);
         return wrapDF.Open(path, Oflag, Mode, env);
     }
 
     int     Fchmod(mode_t mode) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_chmod_ops, m_oss.m_slow_ops.m_chmod_ops, m_oss.m_times.m_chmod, m_oss.m_slow_times.m_chmod, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpChmod, m_oss.m_ops.m_chmod_ops, m_oss.m_slow_ops.m_chmod_ops, m_path.c_str());
         return wrapDF.Fchmod(mode);
     }
 
     int     Fstat(struct stat *buf) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_stat_ops, m_oss.m_slow_ops.m_stat_ops, m_oss.m_times.m_stat, m_oss.m_slow_times.m_stat, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpStat, m_oss.m_ops.m_stat_ops, m_oss.m_slow_ops.m_stat_ops, m_path.c_str());
         return wrapDF.Fstat(buf);
     }
 
     int     Ftruncate(unsigned long long size) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_truncate_ops, m_oss.m_slow_ops.m_truncate_ops, m_oss.m_times.m_truncate, m_oss.m_slow_times.m_truncate, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpTruncate, m_oss.m_ops.m_truncate_ops, m_oss.m_slow_ops.m_truncate_ops, m_path.c_str(), -1, size);
         return wrapDF.Ftruncate(size);
     }
 
     ssize_t pgRead (void* buffer, off_t offset, size_t rdlen,
                         uint32_t* csvec, uint64_t opts) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_pgread_ops, m_oss.m_slow_ops.m_pgread_ops, m_oss.m_times.m_pgread, m_oss.m_slow_times.m_pgread, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpPgRead, m_oss.m_ops.m_pgread_ops, m_oss.m_slow_ops.m_pgread_ops, m_path.c_str(), offset, rdlen);
         return wrapDF.pgRead(buffer, offset, rdlen, csvec, opts);
     }
 
     int     pgRead (XrdSfsAio* aioparm, uint64_t opts) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_pgread_ops, m_oss.m_slow_ops.m_pgread_ops, m_oss.m_times.m_pgread, m_oss.m_slow_times.m_pgread, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpPgRead, m_oss.m_ops.m_pgread_ops, m_oss.m_slow_ops.m_pgread_ops, m_path.c_str(), aioparm->sfsAio.aio_offset, aioparm->sfsAio.aio_nbytes);
         return wrapDF.pgRead(aioparm, opts);
     }
 
     ssize_t pgWrite(void* buffer, off_t offset, size_t wrlen,
                         uint32_t* csvec, uint64_t opts) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_pgwrite_ops, m_oss.m_slow_ops.m_pgwrite_ops, m_oss.m_times.m_pgwrite, m_oss.m_slow_times.m_pgwrite, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpPgWrite, m_oss.m_ops.m_pgwrite_ops, m_oss.m_slow_ops.m_pgwrite_ops, m_path.c_str(), offset, wrlen);
         return wrapDF.pgWrite(buffer, offset, wrlen, csvec, opts);
     }
 
     int     pgWrite(XrdSfsAio* aioparm, uint64_t opts) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_pgwrite_ops, m_oss.m_slow_ops.m_pgwrite_ops, m_oss.m_times.m_pgwrite, m_oss.m_slow_times.m_pgwrite, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpPgWrite, m_oss.m_ops.m_pgwrite_ops, m_oss.m_slow_ops.m_pgwrite_ops, m_path.c_str(), aioparm->sfsAio.aio_offset, aioparm->sfsAio.aio_nbytes);
         return wrapDF.pgWrite(aioparm, opts);
     }
 
     ssize_t Read(off_t offset, size_t size) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_oss.m_times.m_read, m_oss.m_slow_times.m_read, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpRead, m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_path.c_str(), offset, size);
         return wrapDF.Read(offset, size);
     }
 
     ssize_t Read(void *buffer, off_t offset, size_t size) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_oss.m_times.m_read, m_oss.m_slow_times.m_read, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpRead, m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_path.c_str(), offset, size);
         return wrapDF.Read(buffer, offset, size);
     }
 
     int     Read(XrdSfsAio *aiop) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_oss.m_times.m_read, m_oss.m_slow_times.m_read, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpRead, m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_path.c_str(), aiop->sfsAio.aio_offset, aiop->sfsAio.aio_nbytes);
         return wrapDF.Read(aiop);
     }
 
     ssize_t ReadRaw(void *buffer, off_t offset, size_t size) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_oss.m_times.m_read, m_oss.m_slow_times.m_read, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpRead, m_oss.m_ops.m_read_ops, m_oss.m_slow_ops.m_read_ops, m_path.c_str(), offset, size);
         return wrapDF.ReadRaw(buffer, offset, size);
     }
 
@@ -107,29 +110,36 @@ public:
         m_oss.m_ops.m_readv_segs += rdvcnt;
         auto ns = std::chrono::nanoseconds(dur).count();
         m_oss.m_times.m_readv += ns;
+        m_oss.m_hist[FileSystem::OpReadV].Record(dur);
         if (dur > m_oss.m_slow_duration) {
             m_oss.m_slow_ops.m_readv_ops++;
             m_oss.m_slow_ops.m_readv_segs += rdvcnt;
-            m_oss.m_times.m_readv += std::chrono::nanoseconds(dur).count();
+            m_oss.m_slow_times.m_readv += ns;
+            if (m_oss.m_slowlog) {
+                int64_t size = 0;
+                for (int i = 0; i < rdvcnt; i++) size += readV[i].size;
+                m_oss.m_slowlog->Record(FileSystem::OpName(FileSystem::OpReadV), m_path.c_str(),
+                                        rdvcnt ? readV[0].offset : -1, size, dur);
+            }
         }
         return result;
     }
 
     ssize_t Write(const void *buffer, off_t offset, size_t size) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_write_ops, m_oss.m_slow_ops.m_write_ops, m_oss.m_times.m_write, m_oss.m_slow_times.m_write, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpWrite, m_oss.m_ops.m_write_ops, m_oss.m_slow_ops.m_write_ops, m_path.c_str(), offset, size);
         return wrapDF.Write(buffer, offset, size);
     }
 
     int     Write(XrdSfsAio *aiop) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_write_ops, m_oss.m_slow_ops.m_write_ops, m_oss.m_times.m_write, m_oss.m_slow_times.m_write, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpWrite, m_oss.m_ops.m_write_ops, m_oss.m_slow_ops.m_write_ops, m_path.c_str(), aiop->sfsAio.aio_offset, aiop->sfsAio.aio_nbytes);
         return wrapDF.Write(aiop);
     }
 
     ssize_t WriteV(XrdOucIOVec *writeV, int wrvcnt) override
     {
-        FileSystem::OpTimer op(m_oss.m_ops.m_write_ops, m_oss.m_slow_ops.m_write_ops, m_oss.m_times.m_write, m_oss.m_slow_times.m_write, m_oss.m_slow_duration);
+        FileSystem::OpTimer op(m_oss, FileSystem::OpWrite, m_oss.m_ops.m_write_ops, m_oss.m_slow_ops.m_write_ops, m_path.c_str());
         return wrapDF.WriteV(writeV, wrvcnt);
     }
 
@@ -138,6 +148,7 @@ private:
     XrdSysError &m_log;
     const XrdSecEntity* m_client;
     FileSystem &m_oss;
+    std::string m_path; // Only kept when the slow operation log is enabled
 
 };
 
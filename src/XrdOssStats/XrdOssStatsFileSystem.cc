@@ -19,13 +19,18 @@ FileSystem::FileSystem(XrdOss *oss, XrdSysLogger *lp, const char *configfn, XrdO
     m_oss(oss),
     m_env(envP),
     m_log(lp, "fsstat_"),
-    m_slow_duration(std::chrono::seconds(1))
+    m_slow_duration(std::chrono::seconds(1)),
+    m_hist_interval(std::chrono::seconds(10)),
+    m_hist_last(std::chrono::steady_clock::now())
 {
     m_log.Say("------ Initializing the storage statistics plugin.");
     if (!Config(configfn)) {
         m_failure = "Failed to configure the storage statistics plugin.";
         return;
     }
+    if (m_slowlog_size) {
+        m_slowlog.reset(new SlowLog(m_slowlog_size));
+    }
 
     // While the plugin _does_ print its activity to the debugging facility (if enabled), its relatively useless
     // unless the g-stream is available.  Hence, if it's _not_ available, we stop the OSS initialization but do
@@ -79,6 +84,12 @@ FileSystem::AggregateBootstrap(void *me) {
     while (1) {
         std::this_thread::sleep_for(std::chrono::seconds(1));
         myself->AggregateStats();
+        myself->AggregateSlowOps();
+        if (myself->m_hist_interval.count() &&
+            std::chrono::steady_clock::now() - myself->m_hist_last >= myself->m_hist_interval) {
+            myself->m_hist_last = std::chrono::steady_clock::now();
+            myself->AggregateHistograms();
+        }
     }
     return nullptr;
 }
@@ -88,7 +99,7 @@ FileSystem::Config(const char *configfn)
 {
     m_log.setMsgMask(LogMask::Error | LogMask::Warning);
 
-    XrdOucGatherConf statsConf("fsstats.trace fsstats.slowop", &m_log);
+    XrdOucGatherConf statsConf("fsstats.trace fsstats.slowop fsstats.histogram fsstats.slowlog", &m_log);
     int result;
     if ((result = statsConf.Gather(configfn, XrdOucGatherConf::trim_lines)) < 0) {
         m_log.Emsg("Config", -result, "parsing config file", configfn);
@@ -122,6 +133,36 @@ FileSystem::Config(const char *configfn)
                 m_log.Emsg("Config", "fsstats.slowop couldn't parse duration", val, errmsg.c_str());
                 return false;
             }
+        } else if (!strcmp(val, "histogram")) {
+            if (!(val = statsConf.GetToken())) {
+                m_log.Emsg("Config", "fsstats.histogram requires an argument.  Usage: fsstats.histogram [interval|off]");
+                return false;
+            }
+            if (!strcmp(val, "off")) {
+                m_hist_interval = std::chrono::steady_clock::duration(0);
+            } else {
+                std::string errmsg;
+                if (!ParseDuration(val, m_hist_interval, errmsg)) {
+                    m_log.Emsg("Config", "fsstats.histogram couldn't parse duration", val, errmsg.c_str());
+                    return false;
+                }
+            }
+        } else if (!strcmp(val, "slowlog")) {
+            if (!(val = statsConf.GetToken())) {
+                m_log.Emsg("Config", "fsstats.slowlog requires an argument.  Usage: fsstats.slowlog [entries|off]");
+                return false;
+            }
+            if (!strcmp(val, "off")) {
+                m_slowlog_size = 0;
+            } else {
+                char *eol;
+                auto entries = strtol(val, &eol, 10);
+                if (*eol || entries < 0 || entries > 65536) {
+                    m_log.Emsg("Config", "fsstats.slowlog value is invalid (must be between 0 and 65536)", val);
+                    return false;
+                }
+                m_slowlog_size = entries;
+            }
         }
     }
     m_log.Emsg("Config", "Logging levels enabled", LogMaskToString(m_log.getMsgMask()).c_str());
@@ -145,80 +186,80 @@ XrdOssDF *FileSystem::newFile(const char *user)
 
 int FileSystem::Chmod(const char * path, mode_t mode, XrdOucEnv *env)
 {
-    OpTimer op(m_ops.m_chmod_ops, m_slow_ops.m_chmod_ops, m_times.m_chmod, m_slow_times.m_chmod, m_slow_duration);
+    OpTimer op(*this, OpChmod, m_ops.m_chmod_ops, m_slow_ops.m_chmod_ops, path);
     return wrapPI.Chmod(path, mode, env);
 }
 
 int       FileSystem::Rename(const char *oPath, const char *nPath,
                         XrdOucEnv  *oEnvP, XrdOucEnv *nEnvP)
 {
-    OpTimer op(m_ops.m_rename_ops, m_slow_ops.m_rename_ops, m_times.m_rename, m_slow_times.m_rename, m_slow_duration);
+    OpTimer op(*this, OpRename, m_ops.m_rename_ops, m_slow_ops.m_rename_ops, oPath);
     return wrapPI.Rename(oPath, nPath, oEnvP, nEnvP);
 }
 
 int       FileSystem::Stat(const char *path, struct stat *buff,
                     int opts, XrdOucEnv *env)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.Stat(path, buff, opts, env);
 }
 
 int       FileSystem::StatFS(const char *path, char *buff, int &blen,
                         XrdOucEnv  *env)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.StatFS(path, buff, blen, env);
 }
 
 int       FileSystem::StatLS(XrdOucEnv &env, const char *path,
                         char *buff, int &blen)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.StatLS(env, path, buff, blen);
 }
 
 int       FileSystem::StatPF(const char *path, struct stat *buff, int opts)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.StatPF(path, buff, opts);
 }
 
 int       FileSystem::StatPF(const char *path, struct stat *buff)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.StatPF(path, buff, 0);
 }
 
 int       FileSystem::StatVS(XrdOssVSInfo *vsP, const char *sname, int updt)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, sname);
     return wrapPI.StatVS(vsP, sname, updt);
 }
 
 int       FileSystem::StatXA(const char *path, char *buff, int &blen,
                         XrdOucEnv *env)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.StatXA(path, buff, blen, env);
 }
 
 int       FileSystem::StatXP(const char *path, unsigned long long &attr,
                         XrdOucEnv  *env)
 {
-    OpTimer op(m_ops.m_stat_ops, m_slow_ops.m_stat_ops, m_times.m_stat, m_slow_times.m_stat, m_slow_duration);
+    OpTimer op(*this, OpStat, m_ops.m_stat_ops, m_slow_ops.m_stat_ops, path);
     return wrapPI.StatXP(path, attr, env);
 }
 
 int       FileSystem::Truncate(const char *path, unsigned long long fsize,
                         XrdOucEnv *env)
 {
-    OpTimer op(m_ops.m_truncate_ops, m_slow_ops.m_truncate_ops, m_times.m_truncate, m_slow_times.m_truncate, m_slow_duration);
+    OpTimer op(*this, OpTruncate, m_ops.m_truncate_ops, m_slow_ops.m_truncate_ops, path);
     return wrapPI.Truncate(path, fsize, env);
 }
 
 int       FileSystem::Unlink(const char *path, int Opts, XrdOucEnv *env)
 {
-    OpTimer op(m_ops.m_unlink_ops, m_slow_ops.m_unlink_ops, m_times.m_unlink, m_slow_times.m_unlink, m_slow_duration);
+    OpTimer op(*this, OpUnlink, m_ops.m_unlink_ops, m_slow_ops.m_unlink_ops, path);
     return wrapPI.Unlink(path, Opts, env);
 }
 
@@ -279,22 +320,144 @@ void FileSystem::AggregateStats()
     }
 }
 
-FileSystem::OpTimer::OpTimer(RAtomic_uint64_t &op_count, RAtomic_uint64_t &slow_op_count, RAtomic_uint64_t &timing, RAtomic_uint64_t &slow_timing, std::chrono::steady_clock::duration duration)
-    : m_op_count(op_count),
+void FileSystem::AggregateHistograms()
+{
+    // One record per operation type that has been seen at all; the bucket
+    // array is at most a few kilobytes, well within a g-stream record.
+    char buckets[8192];
+    char buf[8192 + 256];
+    for (int op = 0; op < OpCount; op++) {
+        uint64_t total;
+        if (m_hist[op].Format(buckets, sizeof(buckets), total) < 0) {
+            m_log.Log(LogMask::Error, "Aggregate", "Failed to format histogram for", OpName(static_cast<OpType>(op)));
+            continue;
+        }
+        if (!total) continue;
+        auto len = snprintf(buf, sizeof(buf),
+            "{\"event\":\"oss_hist%s\",\"op\":\"%s\",\"count\":%" PRIu64 ",\"buckets\":%s}",
+            m_runmode.empty() ? "" : ("_" + m_runmode).c_str(),
+            OpName(static_cast<OpType>(op)), total, buckets);
+        if (len >= static_cast<int>(sizeof(buf))) {
+            m_log.Log(LogMask::Error, "Aggregate", "Failed to generate g-stream histogram packet");
+            continue;
+        }
+        m_log.Log(LogMask::Debug, "Aggregate", buf);
+        if (m_gstream && !m_gstream->Insert(buf, len + 1)) {
+            m_log.Log(LogMask::Error, "Aggregate", "Failed to send g-stream histogram packet");
+            return;
+        }
+    }
+}
+
+namespace {
+
+// Copy `in` into `out` escaping it for use as a JSON string
+void
+JSONEscape(const char *in, char *out, size_t olen)
+{
+    size_t len = 0;
+    for (; *in && len + 7 < olen; in++) {
+        auto c = static_cast<unsigned char>(*in);
+        if (c == '"' || c == '\\') {
+            out[len++] = '\\';
+            out[len++] = c;
+        } else if (c < 0x20) {
+            len += snprintf(out + len, olen - len, "\\u%04x", c);
+        } else {
+            out[len++] = c;
+        }
+    }
+    out[len] = '\0';
+}
+
+}
+
+void FileSystem::AggregateSlowOps()
+{
+    if (!m_slowlog) return;
+
+    const std::string event = "oss_slowop" + (m_runmode.empty() ? "" : ("_" + m_runmode));
+    auto lost = m_slowlog->Drain([&](const SlowLog::Entry &entry) {
+        char path[sizeof(entry.m_path) * 6 + 1];
+        char extra[64] = "";
+        char buf[2048];
+        JSONEscape(entry.m_path, path, sizeof(path));
+        int elen = 0;
+        if (entry.m_offset >= 0) {
+            elen = snprintf(extra, sizeof(extra), ",\"offset\":%" PRId64, entry.m_offset);
+        }
+        if (entry.m_size >= 0) {
+            snprintf(extra + elen, sizeof(extra) - elen, ",\"size\":%" PRId64, entry.m_size);
+        }
+        auto len = snprintf(buf, sizeof(buf),
+            "{\"event\":\"%s\",\"op\":\"%s\",\"path\":\"%s\"%s,\"dur\":%.6f,\"time\":%lld}",
+            event.c_str(), entry.m_op, path, extra,
+            static_cast<double>(entry.m_dur_ns)/1e9, static_cast<long long>(entry.m_when));
+        if (len >= static_cast<int>(sizeof(buf))) {
+            m_log.Log(LogMask::Error, "Aggregate", "Failed to generate g-stream slow operation packet");
+            return;
+        }
+        m_log.Log(LogMask::Info, "SlowOp", buf);
+        if (m_gstream && !m_gstream->Insert(buf, len + 1)) {
+            m_log.Log(LogMask::Error, "Aggregate", "Failed to send g-stream slow operation packet");
+        }
+    });
+    if (lost) {
+        m_log.Log(LogMask::Warning, "SlowOp", "Slow operation log overflowed; entries lost:", std::to_string(lost).c_str());
+    }
+}
+
+const char *
+FileSystem::OpName(OpType op)
+{
+    static const char *names[OpCount] = {"open", "read", "readv", "pgread", "write", "pgwrite",
+        "dirlist", "stat", "truncate", "unlink", "rename", "chmod"};
+    return op < OpCount ? names[op] : "unknown";
+}
+
+RAtomic_uint64_t &
+FileSystem::OpTiming::Get(OpType op)
+{
+    switch (op) {
+        case OpOpen:     return m_open;
+        case OpRead:     return m_read;
+        case OpReadV:    return m_readv;
+        case OpPgRead:   return m_pgread;
+        case OpWrite:    return m_write;
+        case OpPgWrite:  return m_pgwrite;
+        case OpDirlist:  return m_dirlist;
+        case OpTruncate: return m_truncate;
+        case OpUnlink:   return m_unlink;
+        case OpRename:   return m_rename;
+        case OpChmod:    return m_chmod;
+        default:         return m_stat;
+    }
+}
+
+FileSystem::OpTimer::OpTimer(FileSystem &fs, OpType op, RAtomic_uint64_t &op_count, RAtomic_uint64_t &slow_op_count,
+                             const char *path, off_t offset, int64_t size)
+    : m_fs(fs),
+    m_op(op),
+    m_op_count(op_count),
     m_slow_op_count(slow_op_count),
-    m_timing(timing),
-    m_slow_timing(slow_timing),
-    m_start(std::chrono::steady_clock::now()),
-    m_slow_duration(duration)
+    m_path(path),
+    m_offset(offset),
+    m_size(size),
+    m_start(std::chrono::steady_clock::now())
 {}
 
 FileSystem::OpTimer::~OpTimer()
 {
     auto dur = std::chrono::steady_clock::now() - m_start;
+    auto ns = std::chrono::nanoseconds(dur).count();
     m_op_count++;
-    m_timing += std::chrono::nanoseconds(dur).count();
-    if (dur > m_slow_duration) {
+    m_fs.m_times.Get(m_op) += ns;
+    m_fs.m_hist[m_op].Record(dur);
+    if (dur > m_fs.m_slow_duration) {
         m_slow_op_count++;
-        m_slow_timing += std::chrono::nanoseconds(dur).count();
+        m_fs.m_slow_times.Get(m_op) += ns;
+        if (m_fs.m_slowlog) {
+            m_fs.m_slowlog->Record(OpName(m_op), m_path, m_offset, m_size, dur);
+        }
     }
 }
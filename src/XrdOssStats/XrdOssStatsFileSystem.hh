@@ -3,6 +3,8 @@
 #define __XRDOSSSTATS_FILESYSTEM_H
 
 #include "XrdOss/XrdOssWrapper.hh"
+#include "XrdOssStatsHistogram.hh"
+#include "XrdOssStatsSlowLog.hh"
 #include "XrdSys/XrdSysError.hh"
 #include "XrdSys/XrdSysRAtomic.hh"
 
@@ -18,7 +20,8 @@ namespace XrdOssStats {
 // about the performance of the underlying storage.
 //
 // It allows one to accumulate time spent in I/O, the number of operations,
-// and information about "slow" operations
+// the latency distribution of each type of operation, and information about
+// "slow" operations (including, optionally, the individual slow operations)
 class FileSystem : public XrdOssWrapper {
     friend class File;
     friend class Directory;
@@ -65,6 +68,8 @@ public:
 private:
     static void * AggregateBootstrap(void *instance);
     void AggregateStats();
+    void AggregateHistograms();
+    void AggregateSlowOps();
 
     XrdXrootdGStream* m_gstream{nullptr};
 
@@ -85,18 +90,42 @@ private:
     XrdOucEnv *m_env;
     XrdSysError m_log;
 
+    // The types of operations that are timed
+    enum OpType {
+        OpOpen = 0,
+        OpRead,
+        OpReadV,
+        OpPgRead,
+        OpWrite,
+        OpPgWrite,
+        OpDirlist,
+        OpStat,
+        OpTruncate,
+        OpUnlink,
+        OpRename,
+        OpChmod,
+        OpCount
+    };
+    static const char *OpName(OpType op);
+
     class OpTimer {
         public:
-            OpTimer(RAtomic_uint64_t &op_count, RAtomic_uint64_t &slow_op_count, RAtomic_uint64_t &timing, RAtomic_uint64_t &slow_timing, std::chrono::steady_clock::duration duration);
+            // The path, offset and size are only used to describe the operation in
+            // the slow operation log; pass a negative offset or size if they do not
+            // apply to the operation.
+            OpTimer(FileSystem &fs, OpType op, RAtomic_uint64_t &op_count, RAtomic_uint64_t &slow_op_count,
+                    const char *path=nullptr, off_t offset=-1, int64_t size=-1);
             ~OpTimer();
 
         private:
+            FileSystem &m_fs;
+            OpType m_op;
             RAtomic_uint64_t &m_op_count;
             RAtomic_uint64_t &m_slow_op_count;
-            RAtomic_uint64_t &m_timing;
-            RAtomic_uint64_t &m_slow_timing;
+            const char *m_path;
+            off_t m_offset;
+            int64_t m_size;
             std::chrono::steady_clock::time_point m_start;
-            std::chrono::steady_clock::duration m_slow_duration;
     };
 
     struct OpRecord {
@@ -129,6 +158,8 @@ private:
         RAtomic_uint64_t m_unlink{0};
         RAtomic_uint64_t m_rename{0};
         RAtomic_uint64_t m_chmod{0};
+
+        RAtomic_uint64_t &Get(OpType op);
     };
 
     OpRecord m_ops;
@@ -136,6 +167,16 @@ private:
     OpRecord m_slow_ops;
     OpTiming m_slow_times;
     std::chrono::steady_clock::duration m_slow_duration;
+
+    // Per-operation latency histograms, sent every m_hist_interval (never if zero)
+    Histogram m_hist[OpCount];
+    std::chrono::steady_clock::duration m_hist_interval;
+    std::chrono::steady_clock::time_point m_hist_last;
+
+    // Ring of the most recent slow operations; only allocated when
+    // enabled via fsstats.slowlog
+    unsigned m_slowlog_size{0};
+    std::unique_ptr<SlowLog> m_slowlog;
 };
 
 } // XrdOssStats
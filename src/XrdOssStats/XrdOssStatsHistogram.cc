@@ -0,0 +1,28 @@
+
+#include "XrdOssStatsHistogram.hh"
+
+#include <cinttypes>
+#include <cstdio>
+
+using namespace XrdOssStats;
+
+int Histogram::Format(char *buff, int blen, uint64_t &total)
+{
+    int len = 0;
+    total = 0;
+    if (blen < 3) return -1;
+    buff[len++] = '[';
+    for (unsigned idx = 0; idx < Buckets; idx++) {
+        uint64_t count = m_buckets[idx];
+        if (!count) continue;
+        total += count;
+        auto n = snprintf(buff + len, blen - len, "%s[%" PRIu64 ",%" PRIu64 "]",
+                          len > 1 ? "," : "", UpperBound(idx), count);
+        if (n < 0 || n >= blen - len) return -1;
+        len += n;
+    }
+    if (len + 2 > blen) return -1;
+    buff[len++] = ']';
+    buff[len] = '\0';
+    return len;
+}
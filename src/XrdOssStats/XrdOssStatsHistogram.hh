@@ -0,0 +1,63 @@
+#ifndef __XRDOSSSTATS_HISTOGRAM_H
+#define __XRDOSSSTATS_HISTOGRAM_H
+
+#include "XrdSys/XrdSysRAtomic.hh"
+
+#include <chrono>
+#include <cstdint>
+
+namespace XrdOssStats {
+
+// A log-linear latency histogram.
+//
+// Durations are recorded in microseconds; each power of two is split into
+// four linear sub-buckets, giving a relative error of at most 25% over a
+// range of one microsecond to a couple of hours (anything longer lands in
+// the last bucket).  Recording is a single relaxed atomic increment, so the
+// histogram may be updated concurrently from any number of I/O threads
+// without taking a lock.
+class Histogram {
+public:
+    static constexpr unsigned SubBits = 2;
+    static constexpr unsigned Buckets = 132;
+
+    Histogram() {for (auto &bucket : m_buckets) bucket = 0;}
+
+    void Record(std::chrono::steady_clock::duration dur)
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(dur).count();
+        m_buckets[Index(us > 0 ? static_cast<uint64_t>(us) : 0)]++;
+    }
+
+    // Bucket holding a duration of `us` microseconds
+    static unsigned Index(uint64_t us)
+    {
+        if (us < (1 << SubBits)) return us;
+        unsigned msb = 63 - __builtin_clzll(us);
+        unsigned idx = ((msb - SubBits + 1) << SubBits) +
+                       ((us >> (msb - SubBits)) & ((1 << SubBits) - 1));
+        return idx < Buckets ? idx : Buckets - 1;
+    }
+
+    // Exclusive upper bound, in microseconds, of bucket `idx`
+    static uint64_t UpperBound(unsigned idx)
+    {
+        if (idx < (1 << SubBits)) return idx + 1;
+        unsigned msb = (idx >> SubBits) + SubBits - 1;
+        uint64_t sub = idx & ((1 << SubBits) - 1);
+        return ((1 << SubBits) + sub + 1) << (msb - SubBits);
+    }
+
+    // Format the non-empty buckets as a JSON array of [upper_us, count]
+    // pairs into `buff`.  Returns the number of characters written (not
+    // counting the null byte), or -1 if the buffer is too small.  `total`
+    // is set to the number of recorded operations.
+    int Format(char *buff, int blen, uint64_t &total);
+
+private:
+    RAtomic_uint64_t m_buckets[Buckets];
+};
+
+} // namespace XrdOssStats
+
+#endif // __XRDOSSSTATS_HISTOGRAM_H
@@ -0,0 +1,95 @@
+
+#include "XrdOssStatsSlowLog.hh"
+
+#include <cstring>
+#include <ctime>
+
+using namespace XrdOssStats;
+
+SlowLog::SlowLog(unsigned size) :
+    m_size(size ? size : 1),
+    m_slots(new Slot[m_size])
+{}
+
+void
+SlowLog::Record(const char *op, const char *path, off_t offset, int64_t size,
+                std::chrono::steady_clock::duration dur)
+{
+    auto pos = m_next.fetch_add(1, std::memory_order_relaxed);
+    auto &slot = m_slots[pos % m_size];
+
+    // Should a writer that lapped the ring still be filling this slot, drop
+    // the record rather than wait for it.
+    auto seq = slot.m_seq.load(std::memory_order_relaxed);
+    if (seq == Slot::Busy ||
+        !slot.m_seq.compare_exchange_strong(seq, Slot::Busy, std::memory_order_acquire)) {
+        // Leave a mark so the reader can step over the position.
+        auto drop = slot.m_drop.load(std::memory_order_relaxed);
+        while (drop < pos + 1 &&
+               !slot.m_drop.compare_exchange_weak(drop, pos + 1, std::memory_order_release)) {}
+        return;
+    }
+
+    auto &entry = slot.m_entry;
+    entry.m_op = op;
+    if (path) {
+        strncpy(entry.m_path, path, sizeof(entry.m_path) - 1);
+        entry.m_path[sizeof(entry.m_path) - 1] = '\0';
+    } else {
+        entry.m_path[0] = '\0';
+    }
+    entry.m_offset = offset;
+    entry.m_size = size;
+    entry.m_dur_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dur).count();
+    entry.m_when = time(0);
+
+    slot.m_seq.store(pos + 1, std::memory_order_release);
+}
+
+uint64_t
+SlowLog::Drain(const std::function<void(const Entry &)> &cb)
+{
+    uint64_t lost = 0;
+    auto end = m_next.load(std::memory_order_acquire);
+    if (end - m_read > m_size) {
+        lost += end - m_size - m_read;
+        m_read = end - m_size;
+    }
+
+    Entry entry;
+    while (m_read < end) {
+        auto &slot = m_slots[m_read % m_size];
+        auto seq = slot.m_seq.load(std::memory_order_acquire);
+
+        // The writer has not finished yet; pick the entry up next time.
+        if (seq == Slot::Busy) break;
+
+        // Either the writer has not started yet or it dropped the record
+        // as the slot was busy.  A drop from a later lap also means the
+        // position is gone.
+        if (seq < m_read + 1) {
+            if (slot.m_drop.load(std::memory_order_acquire) < m_read + 1) break;
+            lost++;
+            m_read++;
+            continue;
+        }
+
+        // Overwritten by a writer that lapped the ring.
+        if (seq > m_read + 1) {
+            lost++;
+            m_read++;
+            continue;
+        }
+
+        memcpy(&entry, &slot.m_entry, sizeof(entry));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.m_seq.load(std::memory_order_relaxed) != seq) {
+            lost++;
+            m_read++;
+            continue;
+        }
+        m_read++;
+        cb(entry);
+    }
+    return lost;
+}
@@ -0,0 +1,58 @@
+#ifndef __XRDOSSSTATS_SLOWLOG_H
+#define __XRDOSSSTATS_SLOWLOG_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <sys/types.h>
+
+namespace XrdOssStats {
+
+// A fixed-size ring of the most recent "slow" operations.
+//
+// Writers claim a slot with a single atomic increment and publish it with
+// a per-slot sequence number, so recording never blocks an I/O thread.
+// The ring is drained by a single reader (the statistics thread); entries
+// that were overwritten before they could be read are counted as dropped.
+class SlowLog {
+public:
+    struct Entry {
+        const char *m_op;      // Static operation name
+        char        m_path[256];
+        int64_t     m_offset;  // -1 if not applicable
+        int64_t     m_size;    // -1 if not applicable
+        uint64_t    m_dur_ns;
+        time_t      m_when;    // Wall-clock time the operation finished
+    };
+
+    SlowLog(unsigned size);
+
+    // Record a slow operation; `path` may be null and is truncated to
+    // fit the entry.
+    void Record(const char *op, const char *path, off_t offset, int64_t size,
+                std::chrono::steady_clock::duration dur);
+
+    // Hand every entry recorded since the previous call to `cb`.  Returns
+    // the number of entries lost since the previous call.  Must only be
+    // called from a single thread.
+    uint64_t Drain(const std::function<void(const Entry &)> &cb);
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> m_seq{0}; // Position + 1 of the entry; 0 if unused
+        std::atomic<uint64_t> m_drop{0}; // Position + 1 of the latest record dropped as busy
+        static constexpr uint64_t Busy = ~uint64_t(0);
+        Entry                 m_entry;
+    };
+
+    const unsigned          m_size;
+    std::unique_ptr<Slot[]> m_slots;
+    std::atomic<uint64_t>   m_next{0};  // Next position to be claimed by a writer
+    uint64_t                m_read{0};  // Next position to be drained
+};
+
+} // namespace XrdOssStats
+
+#endif // __XRDOSSSTATS_SLOWLOG_H
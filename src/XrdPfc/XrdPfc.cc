@@ -43,6 +43,8 @@
 #include "XrdPfcTrace.hh"
 #include "XrdPfcFSctl.hh"
 #include "XrdPfcInfo.hh"
+#include "XrdPfcInfoStore.hh"
+#include "XrdPfcAdmission.hh"
 #include "XrdPfcIOFile.hh"
 #include "XrdPfcIOFileBlock.hh"
 #include "XrdPfcResourceMonitor.hh"
@@ -156,6 +158,36 @@ bool Cache::Decide(XrdOucCacheIO* io)
       }
    }
 
+   if (m_admission)
+   {
+      XrdCl::URL url(io->Path());
+      std::string filename = url.GetPath();
+
+      // Files that already have data in the cache are always admitted.
+      bool already_cached;
+      {
+         XrdSysCondVarHelper lock(&m_active_cond);
+         already_cached = m_active.find(filename) != m_active.end();
+      }
+      if ( ! already_cached)
+      {
+         // Only look for the cinfo file the first time the file is seen,
+         // opens and removals keep the remembered state up to date.
+         int known = m_admission->KnownCached(filename);
+         if (known < 0)
+         {
+            already_cached = InfoExists(filename);
+            m_admission->SetCached(filename, already_cached);
+         }
+         else
+         {
+            already_cached = known;
+         }
+      }
+
+      return m_admission->Admit(filename, io->FSize(), already_cached);
+   }
+
    return true;
 }
 
@@ -167,6 +199,8 @@ Cache::Cache(XrdSysLogger *logger, XrdOucEnv *env) :
    m_traceID("Cache"),
    m_oss(0),
    m_gstream(0),
+   m_info_store(0),
+   m_admission(0),
    m_purge_pin(0),
    m_prefetch_condVar(0),
    m_prefetch_enabled(false),
@@ -827,9 +861,8 @@ int Cache::LocalFilePath(const char *curl, char *buff, int blen,
       m_purge_delay_set.insert(f_name);
    }
 
-   struct stat sbuff, sbuff2;
-   if (m_oss->Stat(f_name.c_str(), &sbuff)  == XrdOssOK &&
-       m_oss->Stat(i_name.c_str(), &sbuff2) == XrdOssOK)
+   struct stat sbuff;
+   if (m_oss->Stat(f_name.c_str(), &sbuff) == XrdOssOK && InfoExists(f_name))
    {
       if (S_ISDIR(sbuff.st_mode))
       {
@@ -857,28 +890,47 @@ int Cache::LocalFilePath(const char *curl, char *buff, int blen,
 
          if (is_active) m_active_cond.UnLock();
 
-         XrdOssDF* infoFile = m_oss->newFile(m_configuration.m_username.c_str());
-         XrdOucEnv myEnv;
-         int res = infoFile->Open(i_name.c_str(), O_RDWR, 0600, myEnv);
-         if (res >= 0)
+         if (m_info_store)
          {
             Info info(m_trace, 0);
-            if (info.Read(infoFile, i_name.c_str()))
+            if (m_info_store->Get(f_name, info))
             {
                read_ok = true;
 
                is_complete = info.IsComplete();
 
-               // Add full-size access if reason is for access.
                if ( ! is_active && is_complete && why == ForAccess)
                {
                   info.WriteIOStatSingle(info.GetFileSize());
-                  info.Write(infoFile, i_name.c_str());
+                  m_info_store->Put(f_name, info);
                }
             }
-            infoFile->Close();
          }
-         delete infoFile;
+         else
+         {
+            XrdOssDF* infoFile = m_oss->newFile(m_configuration.m_username.c_str());
+            XrdOucEnv myEnv;
+            int res = infoFile->Open(i_name.c_str(), O_RDWR, 0600, myEnv);
+            if (res >= 0)
+            {
+               Info info(m_trace, 0);
+               if (info.Read(infoFile, i_name.c_str()))
+               {
+                  read_ok = true;
+
+                  is_complete = info.IsComplete();
+
+                  // Add full-size access if reason is for access.
+                  if ( ! is_active && is_complete && why == ForAccess)
+                  {
+                     info.WriteIOStatSingle(info.GetFileSize());
+                     info.Write(infoFile, i_name.c_str());
+                  }
+               }
+               infoFile->Close();
+            }
+            delete infoFile;
+         }
 
          if ( ! is_active) m_active_cond.UnLock();
 
@@ -948,6 +1000,14 @@ void Cache::WriteFileSizeXAttr(int cinfo_fd, long long file_size)
 //------------------------------------------------------------------------------
 long long Cache::DetermineFullFileSize(const std::string &cinfo_fname)
 {
+   if (m_info_store)
+   {
+      Info info(m_trace, 0);
+      if ( ! m_info_store->Get(cinfo_fname.substr(0, cinfo_fname.size() - Info::s_infoExtensionLen), info))
+         return -ENOENT;
+      return info.GetFileSize();
+   }
+
    if (m_metaXattr) {
       char pfn[4096];
       m_oss->Lfn2Pfn(cinfo_fname.c_str(), pfn, 4096);
@@ -990,8 +1050,12 @@ int Cache::GetCacheControlXAttr(const std::string &cinfo_fname, std::string& iva
 {
    if (m_metaXattr) {
 
+      // Without cinfo files the attribute is kept on the data file.
       char pfn[4096];
-      m_oss->Lfn2Pfn(cinfo_fname.c_str(), pfn, 4096);
+      if (m_info_store)
+         m_oss->Lfn2Pfn(cinfo_fname.substr(0, cinfo_fname.size() - Info::s_infoExtensionLen).c_str(), pfn, 4096);
+      else
+         m_oss->Lfn2Pfn(cinfo_fname.c_str(), pfn, 4096);
 
       char cc[512];
       int res = XrdSysXAttrActive->Get("pfc.cache-control", &cc, 512, pfn, -1);
@@ -1162,8 +1226,7 @@ int Cache::Prepare(const char *curl, int oflags, mode_t mode)
       m_purge_delay_set.insert(f_name);
    }
 
-   struct stat sbuff;
-   if (m_oss->Stat(i_name.c_str(), &sbuff) == XrdOssOK)
+   if (InfoExists(f_name))
    {
 
       if (m_configuration.m_httpcc && !is_http_cache_valid(f_name, i_name, url))
@@ -1310,7 +1373,9 @@ int Cache::UnlinkFile(const std::string& f_name, bool fail_if_open)
 
    // Unlink file & cinfo
    int f_ret = m_oss->Unlink(f_name.c_str());
-   int i_ret = m_oss->Unlink(i_name.c_str());
+   int i_ret = m_info_store ? XrdOssOK : m_oss->Unlink(i_name.c_str());
+
+   ForgetFile(f_name);
 
    if (st_blocks_to_purge)
       m_res_mon->register_file_purge(f_name, st_blocks_to_purge);
@@ -1326,6 +1391,32 @@ int Cache::UnlinkFile(const std::string& f_name, bool fail_if_open)
    return std::min(f_ret, i_ret);
 }
 
+//---------------------------------------------------------------------
+//! Check if the cache holds cinfo for the given file, either as a cinfo
+//! file or as a record in the consolidated cinfo store.
+//---------------------------------------------------------------------
+bool Cache::InfoExists(const std::string &f_name) const
+{
+   if (m_info_store)
+      return m_info_store->Contains(f_name);
+
+   struct stat sbuff;
+   std::string i_name = f_name + Info::s_infoExtension;
+   return m_oss->Stat(i_name.c_str(), &sbuff) == XrdOssOK;
+}
+
+//---------------------------------------------------------------------
+//! Drop everything that is remembered about a file that has been removed
+//! from the cache. Called on every path that unlinks data or cinfo files.
+//---------------------------------------------------------------------
+void Cache::ForgetFile(const std::string &f_name) const
+{
+   if (m_info_store)
+      m_info_store->Remove(f_name);
+   if (m_admission)
+      m_admission->SetCached(f_name, false);
+}
+
 //---------------------------------------------------------------------
 //! Test validity of http cache.
 //! Compare FS query results with cinfo xattr.
@@ -1377,7 +1468,7 @@ bool Cache::is_http_cache_valid(const std::string& f_name,const std::string& i_n
             time_t ma = cc_json["max-age"];
             cc_json["expire"] = ma + time(NULL);
             char pfn[4096];
-            m_oss->Lfn2Pfn(i_name.c_str(), pfn, 4096);
+            m_oss->Lfn2Pfn(m_info_store ? f_name.c_str() : i_name.c_str(), pfn, 4096);
             WriteCacheControlXAttr(-1, pfn, cc_json.dump());
          }
       }
@@ -42,7 +42,9 @@ class XrdXrootdGStream;
 namespace XrdPfc
 {
 class File;
+class Admission;
 class IO;
+class InfoStore;
 class PurgePin;
 class ResourceMonitor;
 
@@ -71,6 +73,7 @@ struct Configuration
    bool is_uvkeep_purge_in_effect()    const { return m_cs_UVKeep >= 0; }
    bool is_dir_stat_reporting_on()     const { return m_dirStatsStoreDepth >= 0 || ! m_dirStatsDirs.empty() || ! m_dirStatsDirGlobs.empty(); }
    bool is_purge_plugin_set_up()       const { return false; }
+   bool is_meta_store_in_use()         const { return ! m_metaStorePath.empty(); }
 
    CkSumCheck_e get_cs_Chk() const { return (CkSumCheck_e) m_cs_Chk; }
 
@@ -100,8 +103,20 @@ struct Configuration
    int       m_purgeInterval;           //!< sleep interval between cache purges
    int       m_purgeColdFilesAge;       //!< purge files older than this age
    int       m_purgeAgeBasedPeriod;     //!< peform cold file / uvkeep purge every this many purge cycles
+   bool      m_purgeIndex;              //!< select purge candidates from in-memory index instead of traversal
+   int       m_purgeIndexCrossCheck;    //!< with purge index, do full traversal every this many purge tasks
    int       m_accHistorySize;          //!< max number of entries in access history part of cinfo file
 
+   std::string m_metaStorePath;         //!< path of consolidated cinfo store, empty if not used
+   double      m_metaStoreCompact;      //!< fraction of dead records in cinfo store that triggers compaction
+   bool        m_metaStoreSync;         //!< msync appended cinfo store records
+
+   bool      m_admission;               //!< frequency-based admission policy enabled
+   int       m_admMinFreq;              //!< admission - opens needed for a file of reference size
+   long long m_admSizeRef;              //!< admission - reference size, each doubling adds one to threshold
+   int       m_admSketchWidthLog2;      //!< admission - log2 of counters per frequency sketch row
+   int       m_admPurgeCredit;          //!< admission - purge-order age credit per estimated open in seconds
+
    std::set<std::string> m_dirStatsDirs;     //!< directories for which stat reporting was requested
    std::set<std::string> m_dirStatsDirGlobs; //!< directory globs for which stat reporting was requested
    int       m_dirStatsInterval;        //!< time between resource monitor statistics dump in seconds
@@ -121,6 +136,10 @@ struct Configuration
    bool      m_cgi_blocksize_allowed = false;   //!< allow cgi setting of blocksize
    bool      m_cgi_prefetch_allowed  = false;   //!< allow cgi setting of prefetch
 
+   bool      m_miss_merge;              //!< issue missing blocks of a read request as vector reads
+   int       m_miss_max_gap;            //!< max number of blocks between two missing blocks to fill in
+   int       m_miss_max_overfetch;      //!< max number of gap blocks fetched per read request, 0 for no limit
+
    long long m_hdfsbsize;               //!< used with m_hdfsmode, default 128MB
    long long m_flushCnt;                //!< nuber of unsynced blcoks on disk before flush is called
 
@@ -259,6 +278,17 @@ public:
    //---------------------------------------------------------------------
    int  UnlinkFile(const std::string& f_name, bool fail_if_open);
 
+   //---------------------------------------------------------------------
+   //! Check if cinfo for the file exists, in cinfo store or as a file.
+   //---------------------------------------------------------------------
+   bool InfoExists(const std::string& f_name) const;
+
+   //---------------------------------------------------------------------
+   //! Forget cinfo store record and admission presence of a removed file.
+   //! Must be called on every path that unlinks a data/cinfo pair.
+   //---------------------------------------------------------------------
+   void ForgetFile(const std::string& f_name) const;
+
    //---------------------------------------------------------------------
    //! Add downloaded block in write queue.
    //---------------------------------------------------------------------
@@ -289,6 +319,10 @@ public:
 
    XrdOss* GetOss() const { return m_oss; }
 
+   InfoStore* GetInfoStore() const { return m_info_store; }
+
+   Admission* GetAdmission() const { return m_admission; }
+
    bool IsFileActiveOrPurgeProtected(const std::string&) const;
    void ClearPurgeProtectedSet();
    PurgePin* GetPurgePin() const { return m_purge_pin; }
@@ -340,6 +374,10 @@ private:
 
    ResourceMonitor  *m_res_mon;
 
+   InfoStore        *m_info_store;      //!< consolidated cinfo store, optional
+
+   Admission        *m_admission;       //!< frequency-based admission policy, optional
+
    std::vector<Decision*> m_decisionpoints; //!< decision plugins
    PurgePin*              m_purge_pin;      //!< purge plugin
 
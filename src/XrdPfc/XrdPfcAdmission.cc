@@ -0,0 +1,146 @@
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include "XrdPfcAdmission.hh"
+#include "XrdPfcTrace.hh"
+
+#include "XrdXrootd/XrdXrootdGStream.hh"
+
+#include <cstdio>
+
+using namespace XrdPfc;
+
+const char *Admission::m_traceID = "Admission";
+
+Admission::Admission(const Parameters &p, XrdSysTrace *trace) :
+   m_params(p),
+   m_trace(trace),
+   m_sketch(p.m_width_log2),
+   m_cached_max(size_t(1) << std::min(p.m_width_log2, 20))
+{}
+
+//------------------------------------------------------------------------------
+
+int Admission::Threshold(long long size) const
+{
+   int thr = m_params.m_min_freq;
+   if (m_params.m_size_ref > 0)
+   {
+      for (long long s = m_params.m_size_ref; size > s && thr < FrequencySketch::s_max_count; s <<= 1)
+         ++thr;
+   }
+   return thr;
+}
+
+bool Admission::Admit(const std::string &lfn, long long size, bool already_cached)
+{
+   const uint64_t h = FrequencySketch::Hash(lfn);
+   if (size < 0) size = 0;
+
+   XrdSysMutexHelper _lck(m_mutex);
+
+   int freq = m_sketch.Increment(h);
+
+   if (already_cached)
+   {
+      ++m_stats.m_n_cached;
+      return true;
+   }
+
+   bool admit = freq >= Threshold(size);
+   if (admit)
+   {
+      ++m_stats.m_n_admitted;
+      m_stats.m_bytes_admitted += size;
+   }
+   else
+   {
+      ++m_stats.m_n_rejected;
+      m_stats.m_bytes_rejected += size;
+   }
+   _lck.UnLock();
+
+   TRACE(Debug, "Admit() " << lfn << " size=" << size << " freq=" << freq << " -> " << (admit ? "admit" : "pass-through"));
+
+   return admit;
+}
+
+int Admission::Estimate(const std::string &lfn) const
+{
+   const uint64_t h = FrequencySketch::Hash(lfn);
+
+   XrdSysMutexHelper _lck(m_mutex);
+
+   return m_sketch.Estimate(h);
+}
+
+int Admission::KnownCached(const std::string &lfn) const
+{
+   const uint64_t h = FrequencySketch::Hash(lfn);
+
+   XrdSysMutexHelper _lck(m_mutex);
+
+   auto i = m_cached.find(h);
+   return i != m_cached.end() ? (int) i->second : -1;
+}
+
+void Admission::SetCached(const std::string &lfn, bool cached)
+{
+   const uint64_t h = FrequencySketch::Hash(lfn);
+
+   XrdSysMutexHelper _lck(m_mutex);
+
+   if (m_cached.size() >= m_cached_max && m_cached.find(h) == m_cached.end())
+      m_cached.clear();
+   m_cached[h] = cached;
+}
+
+time_t Admission::PurgeTimeCredit(const std::string &lfn) const
+{
+   if (m_params.m_purge_credit <= 0) return 0;
+
+   return (time_t) Estimate(lfn) * m_params.m_purge_credit;
+}
+
+Admission::Stats Admission::GetStats() const
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   return m_stats;
+}
+
+//------------------------------------------------------------------------------
+
+void Admission::Report(XrdXrootdGStream *gstream) const
+{
+   Stats s = GetStats();
+
+   TRACE(Info, "Report() admitted=" << s.m_n_admitted << " (" << s.m_bytes_admitted << " bytes), rejected="
+               << s.m_n_rejected << " (" << s.m_bytes_rejected << " bytes), already_cached=" << s.m_n_cached);
+
+   if (gstream)
+   {
+      char buf[512];
+      int  len = snprintf(buf, sizeof(buf), "{\"event\":\"admission\",\"n_admitted\":%lld,\"n_rejected\":%lld,"
+                          "\"n_cached\":%lld,\"b_admitted\":%lld,\"b_rejected\":%lld}",
+                          s.m_n_admitted, s.m_n_rejected, s.m_n_cached, s.m_bytes_admitted, s.m_bytes_rejected);
+      if (len >= (int) sizeof(buf) || ! gstream->Insert(buf, len + 1))
+      {
+         TRACE(Error, "Failed g-stream insertion of admission record, len=" << len);
+      }
+   }
+}
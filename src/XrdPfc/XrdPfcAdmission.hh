@@ -0,0 +1,214 @@
+#ifndef __XRDPFC_ADMISSION_HH__
+#define __XRDPFC_ADMISSION_HH__
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class XrdSysTrace;
+class XrdXrootdGStream;
+
+namespace XrdPfc
+{
+
+//----------------------------------------------------------------------------
+//! Count-min sketch with 4-bit counters and periodic aging, as used by
+//! TinyLFU. Four rows of 2^width_log2 counters, packed 16 per 64-bit word.
+//! After a sample of 10 * width increments all counters are halved so that
+//! the estimate follows recent popularity. Not thread-safe.
+//----------------------------------------------------------------------------
+
+class FrequencySketch
+{
+public:
+   static constexpr int s_max_count = 15;
+
+   FrequencySketch(int width_log2 = 16) :
+      m_width_log2(width_log2 < 4 ? 4 : width_log2),
+      m_table((size_t(4) << m_width_log2) / 16, 0),
+      m_sample_size(10ll << m_width_log2),
+      m_additions(0)
+   {}
+
+   //! Increment counters for key hash, conservative update. Returns the new estimate.
+   int Increment(uint64_t h)
+   {
+      size_t idx[4];
+      int    min = s_max_count;
+      for (int r = 0; r < 4; ++r)
+      {
+         idx[r] = index(h, r);
+         min = std::min(min, get(idx[r]));
+      }
+      if (min < s_max_count)
+      {
+         for (int r = 0; r < 4; ++r)
+            if (get(idx[r]) == min) inc(idx[r]);
+         ++min;
+      }
+      if (++m_additions >= m_sample_size)
+         reset();
+      return min;
+   }
+
+   int Estimate(uint64_t h) const
+   {
+      int min = s_max_count;
+      for (int r = 0; r < 4; ++r)
+         min = std::min(min, get(index(h, r)));
+      return min;
+   }
+
+   //! Halve all counters.
+   void reset()
+   {
+      for (auto &w : m_table)
+         w = (w >> 1) & 0x7777777777777777ull;
+      m_additions /= 2;
+   }
+
+   long long GetSampleSize() const { return m_sample_size; }
+
+   static uint64_t Hash(const std::string &key) { return mix(std::hash<std::string>()(key)); }
+
+private:
+   static uint64_t mix(uint64_t x)
+   {
+      // splitmix64 finalizer
+      x += 0x9e3779b97f4a7c15ull;
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+      return x ^ (x >> 31);
+   }
+
+   size_t index(uint64_t h, int row) const
+   {
+      uint64_t rh  = mix(h + 0x632be59bd9b4e019ull * (row + 1));
+      size_t   col = rh & ((size_t(1) << m_width_log2) - 1);
+      return (size_t(row) << m_width_log2) + col;
+   }
+
+   int get(size_t i) const { return (m_table[i >> 4] >> ((i & 15) << 2)) & 0xf; }
+   void inc(size_t i)      { m_table[i >> 4] += 1ull << ((i & 15) << 2); }
+
+   int                    m_width_log2;
+   std::vector<uint64_t>  m_table;
+   long long              m_sample_size;
+   long long              m_additions;
+};
+
+//----------------------------------------------------------------------------
+//! Frequency-based admission policy. Every open is recorded in the sketch;
+//! a file that is not yet in the cache is admitted only once its recent
+//! open frequency reaches a threshold that grows with log2 of the file size
+//! relative to a reference size. Rejected files are served in pass-through
+//! mode. The frequency estimate also postpones purging of popular files.
+//! Whether a file has data in the cache is remembered, so that the cinfo
+//! file only needs to be looked up the first time a file is seen.
+//----------------------------------------------------------------------------
+
+class Admission
+{
+public:
+   struct Parameters
+   {
+      int       m_min_freq     = 2;               //!< opens needed to admit a file of reference size
+      long long m_size_ref     = 1024*1024*1024;  //!< reference size, each doubling above it adds one
+      int       m_width_log2   = 16;              //!< log2 of counters per sketch row
+      int       m_purge_credit = 600;             //!< purge-order age credit per estimated open, seconds
+   };
+
+   struct Stats
+   {
+      long long m_n_admitted     = 0;
+      long long m_n_rejected     = 0;
+      long long m_n_cached       = 0;  //!< admitted because data was already in cache
+      long long m_bytes_admitted = 0;
+      long long m_bytes_rejected = 0;
+   };
+
+   Admission(const Parameters &p, XrdSysTrace *trace);
+
+   //---------------------------------------------------------------------
+   //! Record an open and decide whether the file should be cached.
+   //! @param lfn            logical file name
+   //! @param size           file size, or <= 0 if unknown
+   //! @param already_cached true if some data for the file is in the cache
+   //---------------------------------------------------------------------
+   bool Admit(const std::string &lfn, long long size, bool already_cached);
+
+   //---------------------------------------------------------------------
+   //! Frequency threshold for a file of given size.
+   //---------------------------------------------------------------------
+   int Threshold(long long size) const;
+
+   int Estimate(const std::string &lfn) const;
+
+   //---------------------------------------------------------------------
+   //! Remembered presence of the file in the cache.
+   //! @return 1 if cached, 0 if not, -1 if not known
+   //---------------------------------------------------------------------
+   int KnownCached(const std::string &lfn) const;
+
+   //---------------------------------------------------------------------
+   //! Remember whether the file has data in the cache. Called when the
+   //! presence was looked up, when a file is opened in the cache and
+   //! when it is removed from it.
+   //---------------------------------------------------------------------
+   void SetCached(const std::string &lfn, bool cached);
+
+   //---------------------------------------------------------------------
+   //! Seconds to add to the last-access time when ordering purge
+   //! candidates; popular files are thus evicted later.
+   //---------------------------------------------------------------------
+   time_t PurgeTimeCredit(const std::string &lfn) const;
+
+   Stats GetStats() const;
+
+   //---------------------------------------------------------------------
+   //! Log the statistics and send them as a json record to the g-stream.
+   //---------------------------------------------------------------------
+   void Report(XrdXrootdGStream *gstream) const;
+
+   const Parameters& RefParameters() const { return m_params; }
+
+   XrdSysTrace* GetTrace() const { return m_trace; }
+
+   static const char *m_traceID;
+
+private:
+   Parameters           m_params;
+   XrdSysTrace         *m_trace;
+   mutable XrdSysMutex  m_mutex;     //!< protects sketch and stats
+   FrequencySketch      m_sketch;
+   Stats                m_stats;
+
+   std::unordered_map<uint64_t, bool> m_cached;     //!< lfn hash -> has data in cache
+   size_t                             m_cached_max; //!< forget everything when exceeded
+};
+
+}
+
+#endif
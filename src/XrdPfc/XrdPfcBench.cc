@@ -0,0 +1,957 @@
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+//==============================================================================
+// xrdpfc_bench -- trace-driven benchmark of the proxy file cache.
+//
+// Loads the XrdPfc plugin with a given configuration and replays file access
+// traces against it. The origin is simulated by a local stand-in with
+// configurable latency and bandwidth; data is served from a local directory
+// or synthesized. Traces come either from XrdClRecorder csv files or from the
+// access records in cinfo files of an existing cache.
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "XrdPfcInfo.hh"
+
+#include "XrdCl/XrdClURL.hh"
+#include "XrdOfs/XrdOfsConfigPI.hh"
+#include "XrdOss/XrdOss.hh"
+#include "XrdOuc/XrdOucArgs.hh"
+#include "XrdOuc/XrdOucCache.hh"
+#include "XrdOuc/XrdOucEnv.hh"
+#include "XrdOuc/XrdOucPgrwUtils.hh"
+#include "XrdOuc/XrdOucPinLoader.hh"
+#include "XrdOuc/XrdOucStream.hh"
+#include "XrdSys/XrdSysError.hh"
+#include "XrdSys/XrdSysLogger.hh"
+#include "XrdSys/XrdSysPthread.hh"
+#include "XrdSys/XrdSysTrace.hh"
+
+using namespace XrdPfc;
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+double Seconds(Clock::time_point t0, Clock::time_point t1)
+{
+   return std::chrono::duration<double>(t1 - t0).count();
+}
+
+//==============================================================================
+// Trace
+//==============================================================================
+
+struct TraceRead
+{
+   double                   m_time;    //!< seconds since start of trace
+   std::vector<XrdOucIOVec> m_chunks;  //!< one chunk for plain reads
+};
+
+struct TraceSession
+{
+   std::string            m_lfn;
+   double                 m_open_time  = 0;
+   double                 m_close_time = 0;
+   std::vector<TraceRead> m_reads;
+};
+
+struct Trace
+{
+   std::vector<TraceSession>                  m_sessions;  //!< ordered by open time
+   std::unordered_map<std::string, long long> m_extent;    //!< max offset read per lfn
+
+   long long m_n_reads = 0;
+   long long m_n_bytes = 0;
+
+   void Finalize()
+   {
+      std::stable_sort(m_sessions.begin(), m_sessions.end(),
+                       [](const TraceSession &a, const TraceSession &b) { return a.m_open_time < b.m_open_time; });
+      for (auto &s : m_sessions)
+      {
+         long long &ext = m_extent[s.m_lfn];
+         for (auto &r : s.m_reads)
+         {
+            ++m_n_reads;
+            for (auto &c : r.m_chunks)
+            {
+               ext = std::max(ext, c.offset + c.size);
+               m_n_bytes += c.size;
+            }
+         }
+      }
+   }
+};
+
+//------------------------------------------------------------------------------
+// XrdClRecorder csv: "id","action","start","args;timeout","stop","status","response"
+//------------------------------------------------------------------------------
+
+std::vector<std::string> SplitCsv(const std::string &line)
+{
+   std::vector<std::string> cols;
+   std::string cur;
+   bool        quoted = false;
+   for (char c : line)
+   {
+      if (c == '"')                 quoted = ! quoted;
+      else if (c == ',' && ! quoted) { cols.push_back(cur); cur.clear(); }
+      else                           cur += c;
+   }
+   cols.push_back(cur);
+   return cols;
+}
+
+std::vector<long long> SplitArgs(const std::string &args)
+{
+   std::vector<long long> v;
+   size_t pos = 0;
+   while (pos < args.size())
+   {
+      size_t end = args.find(';', pos);
+      if (end == std::string::npos) end = args.size();
+      v.push_back(atoll(args.substr(pos, end - pos).c_str()));
+      pos = end + 1;
+   }
+   return v;
+}
+
+bool ReadRecorderTrace(const char *path, Trace &trace)
+{
+   std::ifstream in(path);
+   if ( ! in)
+   {
+      fprintf(stderr, "xrdpfc_bench: cannot open trace %s\n", path);
+      return false;
+   }
+
+   std::unordered_map<std::string, int> open_sessions; // file id -> index in m_sessions
+   double      t0 = -1;
+   std::string line;
+   while (std::getline(in, line))
+   {
+      if (line.empty()) continue;
+      std::vector<std::string> cols = SplitCsv(line);
+      if (cols.size() < 6 || cols[5] != "[SUCCESS]") continue;
+
+      const std::string &id = cols[0], &action = cols[1], &args = cols[3];
+      double start = atof(cols[2].c_str());
+      if (t0 < 0) t0 = start;
+      start -= t0;
+
+      if (action == "Open")
+      {
+         std::string url = args.substr(0, args.find(';'));
+         XrdCl::URL  xurl(url);
+         TraceSession s;
+         s.m_lfn       = xurl.IsValid() ? xurl.GetPath() : url;
+         if (s.m_lfn.empty() || s.m_lfn[0] != '/') s.m_lfn.insert(0, "/");
+         s.m_open_time = s.m_close_time = start;
+         open_sessions[id] = (int) trace.m_sessions.size();
+         trace.m_sessions.push_back(s);
+         continue;
+      }
+
+      auto si = open_sessions.find(id);
+      if (si == open_sessions.end()) continue;
+      TraceSession &s = trace.m_sessions[si->second];
+
+      if (action == "Read" || action == "PgRead" || action == "VectorRead")
+      {
+         // Last argument is the timeout.
+         std::vector<long long> a = SplitArgs(args);
+         TraceRead r;
+         r.m_time = start;
+         for (size_t i = 0; i + 1 < a.size(); i += 2)
+         {
+            if (action != "VectorRead" && i > 0) break;
+            if (a[i + 1] > 0)
+               r.m_chunks.push_back({ a[i], (int) a[i + 1], 0, nullptr });
+         }
+         if ( ! r.m_chunks.empty())
+            s.m_reads.push_back(r);
+         s.m_close_time = start;
+      }
+      else if (action == "Close")
+      {
+         s.m_close_time = start;
+         open_sessions.erase(si);
+      }
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// cinfo access records: each record becomes a session that reads the
+// recorded number of bytes sequentially, spread over its duration. Offsets
+// of the original reads are not stored in cinfo files.
+//------------------------------------------------------------------------------
+
+class FileDF : public XrdOssDF
+{
+public:
+   FileDF(int fd) : XrdOssDF("", DF_isFile, fd) {}
+
+   using XrdOssDF::Read;
+
+   ssize_t Read(void *buffer, off_t offset, size_t size) override
+   {
+      ssize_t n = pread(fd, buffer, size, offset);
+      return n < 0 ? -errno : n;
+   }
+
+   int Close(long long *retsz = 0) override { return 0; }
+};
+
+void AddCinfoSessions(const std::string &path, const std::string &lfn, int chunk, XrdSysTrace *trc,
+                      std::vector<TraceSession> &sessions, time_t &t_min)
+{
+   int fd = open(path.c_str(), O_RDONLY);
+   if (fd < 0) return;
+
+   FileDF df(fd);
+   Info   info(trc);
+   bool   ok = info.Read(&df, path.c_str());
+   close(fd);
+   if ( ! ok) return;
+
+   for (const Info::AStat &a : info.RefAStats())
+   {
+      long long bytes = a.BytesHit + a.BytesMissed + a.BytesBypassed;
+      if (bytes <= 0) continue;
+
+      TraceSession s;
+      s.m_lfn        = lfn;
+      s.m_open_time  = a.AttachTime;
+      s.m_close_time = a.DetachTime > a.AttachTime ? a.DetachTime : a.AttachTime + a.Duration;
+      long long n_reads = (bytes + chunk - 1) / chunk;
+      double    step    = (s.m_close_time - s.m_open_time) / (double) n_reads;
+      long long fsize   = info.GetFileSize() > 0 ? info.GetFileSize() : bytes;
+      long long off     = 0;
+      for (long long i = 0; i < n_reads; ++i)
+      {
+         if (off >= fsize) off = 0;
+         int len = (int) std::min({ (long long) chunk, bytes, fsize - off });
+         s.m_reads.push_back({ s.m_open_time + i * step, { { off, len, 0, nullptr } } });
+         off   += len;
+         bytes -= len;
+      }
+      t_min = std::min(t_min, a.AttachTime);
+      sessions.push_back(s);
+   }
+}
+
+void ScanCinfoDir(const std::string &root, const std::string &rel, int chunk, XrdSysTrace *trc,
+                  std::vector<TraceSession> &sessions, time_t &t_min)
+{
+   DIR *d = opendir((root + rel).c_str());
+   if ( ! d) return;
+
+   struct dirent *e;
+   while ((e = readdir(d)))
+   {
+      std::string name = e->d_name;
+      if (name == "." || name == "..") continue;
+
+      std::string rpath = rel + "/" + name;
+      struct stat st;
+      if (stat((root + rpath).c_str(), &st)) continue;
+
+      if (S_ISDIR(st.st_mode))
+      {
+         ScanCinfoDir(root, rpath, chunk, trc, sessions, t_min);
+      }
+      else if (name.size() > (size_t) Info::s_infoExtensionLen &&
+               name.compare(name.size() - Info::s_infoExtensionLen, Info::s_infoExtensionLen, Info::s_infoExtension) == 0)
+      {
+         AddCinfoSessions(root + rpath, rpath.substr(0, rpath.size() - Info::s_infoExtensionLen), chunk, trc, sessions, t_min);
+      }
+   }
+   closedir(d);
+}
+
+bool ReadCinfoTrace(const char *dir, int chunk, XrdSysTrace *trc, Trace &trace)
+{
+   time_t t_min = time(0);
+   ScanCinfoDir(dir, "", chunk, trc, trace.m_sessions, t_min);
+
+   for (auto &s : trace.m_sessions)
+   {
+      s.m_open_time  -= t_min;
+      s.m_close_time -= t_min;
+      for (auto &r : s.m_reads) r.m_time -= t_min;
+   }
+   return ! trace.m_sessions.empty();
+}
+
+//==============================================================================
+// Origin stand-in
+//==============================================================================
+
+class Origin
+{
+public:
+   struct Source
+   {
+      std::string m_lfn;
+      int         m_fd     = -1;
+      long long   m_size   = 0;
+      long long   m_bytes  = 0;  //!< fetched by the cache, protected by Origin::m_mutex
+   };
+
+   Origin(const std::string &dir, double latency, double bandwidth, int n_streams) :
+      m_dir(dir), m_latency(latency), m_bandwidth(bandwidth), m_cond(0)
+   {
+      for (int i = 0; i < n_streams; ++i)
+      {
+         pthread_t tid;
+         XrdSysThread::Run(&tid, WorkerThread, this, 0, "xrdpfc_bench origin");
+      }
+   }
+
+   Source* GetSource(const std::string &lfn, long long size_hint)
+   {
+      XrdSysMutexHelper _lck(m_mutex);
+
+      auto i = m_sources.find(lfn);
+      if (i != m_sources.end()) return i->second.get();
+
+      Source *s = new Source;
+      s->m_lfn  = lfn;
+      s->m_size = size_hint;
+      if ( ! m_dir.empty())
+      {
+         struct stat st;
+         s->m_fd = open((m_dir + lfn).c_str(), O_RDONLY);
+         if (s->m_fd >= 0 && fstat(s->m_fd, &st) == 0)
+            s->m_size = st.st_size;
+      }
+      m_sources[lfn].reset(s);
+      return s;
+   }
+
+   //! Reads with delay in the calling thread.
+   int Execute(Source *src, long long bytes, const std::function<int()> &op)
+   {
+      std::this_thread::sleep_until(Schedule(src, bytes));
+      return op();
+   }
+
+   //! Reads with delay in one of the origin streams, then calls back.
+   void Enqueue(Source *src, long long bytes, std::function<int()> op, XrdOucCacheIOCB *cb)
+   {
+      Clock::time_point due = Schedule(src, bytes);
+      m_cond.Lock();
+      m_queue.insert(std::make_pair(due, Request{ std::move(op), cb }));
+      m_cond.Signal();
+      m_cond.UnLock();
+   }
+
+   int RawRead(Source *src, char *buff, long long offs, int rlen)
+   {
+      if (offs >= src->m_size) return 0;
+      int n = (int) std::min((long long) rlen, src->m_size - offs);
+      if (src->m_fd >= 0)
+      {
+         ssize_t r = pread(src->m_fd, buff, n, offs);
+         return r < 0 ? -errno : (int) r;
+      }
+      // Synthetic data, stable for a given offset.
+      for (int i = 0; i < n; ++i) buff[i] = (char) ((offs + i) * 2654435761u >> 24);
+      return n;
+   }
+
+   void GetStats(long long &n_requests, long long &n_bytes)
+   {
+      XrdSysMutexHelper _lck(m_mutex);
+      n_requests = m_n_requests;
+      n_bytes    = m_n_bytes;
+   }
+
+   long long GetSourceBytes(Source *src)
+   {
+      XrdSysMutexHelper _lck(m_mutex);
+      return src->m_bytes;
+   }
+
+private:
+   struct Request
+   {
+      std::function<int()>  m_op;
+      XrdOucCacheIOCB      *m_cb;
+   };
+
+   // Single link model: a request is served after the latency and once the
+   // link has transferred everything requested before it.
+   Clock::time_point Schedule(Source *src, long long bytes)
+   {
+      XrdSysMutexHelper _lck(m_mutex);
+
+      ++m_n_requests;
+      m_n_bytes     += bytes;
+      src->m_bytes  += bytes;
+
+      Clock::time_point now   = Clock::now();
+      Clock::time_point start = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_latency));
+      if (m_bandwidth <= 0) return start;
+
+      if (m_link_free > start) start = m_link_free;
+      m_link_free = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(bytes / m_bandwidth));
+      return m_link_free;
+   }
+
+   static void* WorkerThread(void *arg)
+   {
+      Origin &o = *(Origin*) arg;
+      o.m_cond.Lock();
+      while (true)
+      {
+         if (o.m_queue.empty())
+         {
+            o.m_cond.Wait();
+            continue;
+         }
+         auto i = o.m_queue.begin();
+         Clock::time_point now = Clock::now();
+         if (i->first > now)
+         {
+            int ms = (int) std::ceil(Seconds(now, i->first) * 1000);
+            o.m_cond.WaitMS(std::max(ms, 1));
+            continue;
+         }
+         Request r = std::move(i->second);
+         o.m_queue.erase(i);
+         o.m_cond.UnLock();
+
+         r.m_cb->Done(r.m_op());
+
+         o.m_cond.Lock();
+      }
+      return 0;
+   }
+
+   std::string       m_dir;
+   double            m_latency;
+   double            m_bandwidth;
+
+   XrdSysMutex       m_mutex;
+   std::map<std::string, std::unique_ptr<Source>> m_sources;
+   Clock::time_point m_link_free;
+   long long         m_n_requests = 0;
+   long long         m_n_bytes    = 0;
+
+   XrdSysCondVar                             m_cond;
+   std::multimap<Clock::time_point, Request> m_queue;
+};
+
+//------------------------------------------------------------------------------
+
+class OriginIO : public XrdOucCacheIO
+{
+public:
+   OriginIO(Origin &o, Origin::Source *src) :
+      m_origin(o), m_src(src), m_url("root://bench.origin/" + src->m_lfn)
+   {}
+
+   bool Detach(XrdOucCacheIOCD &iocd) override { return true; }
+
+   long long FSize() override { return m_src->m_size; }
+
+   int Fstat(struct stat &sbuff) override
+   {
+      sbuff.st_size   = m_src->m_size;
+      sbuff.st_blocks = (m_src->m_size + 511) / 512;
+      sbuff.st_mode   = S_IFREG | 0644;
+      sbuff.st_mtime  = sbuff.st_atime = sbuff.st_ctime = 1;
+      sbuff.st_ino    = std::hash<std::string>()(m_src->m_lfn);
+      return 0;
+   }
+
+   const char *Location(bool refresh=false) override { return "bench.origin:1094"; }
+
+   const char *Path() override { return m_url.c_str(); }
+
+   using XrdOucCacheIO::Read;
+   using XrdOucCacheIO::ReadV;
+   using XrdOucCacheIO::pgRead;
+
+   int Read(char *buff, long long offs, int rlen) override
+   {
+      return m_origin.Execute(m_src, rlen, [this, buff, offs, rlen]() { return m_origin.RawRead(m_src, buff, offs, rlen); });
+   }
+
+   void Read(XrdOucCacheIOCB &iocb, char *buff, long long offs, int rlen) override
+   {
+      m_origin.Enqueue(m_src, rlen, [this, buff, offs, rlen]() { return m_origin.RawRead(m_src, buff, offs, rlen); }, &iocb);
+   }
+
+   void pgRead(XrdOucCacheIOCB &iocb, char *buff, long long offs, int rdlen,
+               std::vector<uint32_t> &csvec, uint64_t opts=0, int *csfix=0) override
+   {
+      std::vector<uint32_t> *csv = &csvec;
+      m_origin.Enqueue(m_src, rdlen, [this, buff, offs, rdlen, opts, csv]()
+      {
+         int bytes = m_origin.RawRead(m_src, buff, offs, rdlen);
+         if (bytes > 0 && (opts & forceCS))
+            XrdOucPgrwUtils::csCalc((const char *) buff, (ssize_t) offs, (size_t) bytes, *csv);
+         return bytes;
+      }, &iocb);
+   }
+
+   void ReadV(XrdOucCacheIOCB &iocb, const XrdOucIOVec *readV, int rnum) override
+   {
+      long long bytes = 0;
+      for (int i = 0; i < rnum; ++i) bytes += readV[i].size;
+      std::vector<XrdOucIOVec> iov(readV, readV + rnum);
+      m_origin.Enqueue(m_src, bytes, [this, iov]()
+      {
+         int total = 0;
+         for (auto &v : iov)
+         {
+            int n = m_origin.RawRead(m_src, v.data, v.offset, v.size);
+            if (n < 0) return n;
+            total += n;
+         }
+         return total;
+      }, &iocb);
+   }
+
+   int Sync() override { return 0; }
+   int Trunc(long long offs) override { return -EROFS; }
+   int Write(char *buff, long long offs, int wlen) override { return -EROFS; }
+
+private:
+   Origin          &m_origin;
+   Origin::Source  *m_src;
+   std::string      m_url;
+};
+
+//==============================================================================
+// Replay
+//==============================================================================
+
+class DetachWait : public XrdOucCacheIOCD
+{
+public:
+   void DetachDone() override { m_sem.Post(); }
+   void Wait() { m_sem.Wait(); }
+private:
+   XrdSysSemaphore m_sem {0};
+};
+
+struct Results
+{
+   XrdSysMutex            m_mutex;
+   std::vector<float>     m_latencies;      //!< per client read, seconds
+   long long              m_n_bytes     = 0;
+   long long              m_n_reads     = 0;
+   long long              m_n_req_hits  = 0;  //!< reads that did not touch the origin
+   long long              m_n_cached    = 0;  //!< sessions attached to the cache
+   long long              m_n_passthru  = 0;
+   long long              m_n_errors    = 0;
+};
+
+struct Replayer
+{
+   XrdOucCache       *m_cache;
+   Origin            &m_origin;
+   const Trace       &m_trace;
+   double             m_speed;
+   Clock::time_point  m_t0;
+   Results            m_res;
+
+   XrdSysCondVar      m_cond {0};
+   int                m_n_active = 0;
+   int                m_max_active;
+
+   Replayer(XrdOucCache *c, Origin &o, const Trace &t, double speed, int max_active) :
+      m_cache(c), m_origin(o), m_trace(t), m_speed(speed), m_max_active(max_active)
+   {}
+
+   void WaitUntil(double trace_time)
+   {
+      if (m_speed <= 0) return;
+      std::this_thread::sleep_until(m_t0 + std::chrono::duration_cast<Clock::duration>(
+                                   std::chrono::duration<double>(trace_time / m_speed)));
+   }
+
+   struct Job { Replayer *m_rep; const TraceSession *m_session; };
+
+   static void* SessionThread(void *arg)
+   {
+      Job *job = (Job*) arg;
+      job->m_rep->RunSession(*job->m_session);
+      job->m_rep->m_cond.Lock();
+      --job->m_rep->m_n_active;
+      job->m_rep->m_cond.Signal();
+      job->m_rep->m_cond.UnLock();
+      delete job;
+      return 0;
+   }
+
+   void RunSession(const TraceSession &s)
+   {
+      Origin::Source *src = m_origin.GetSource(s.m_lfn, m_trace.m_extent.at(s.m_lfn));
+      OriginIO       *oio = new OriginIO(m_origin, src);
+      XrdOucCacheIO  *io  = m_cache->Attach(oio);
+
+      std::vector<float> lat;
+      lat.reserve(s.m_reads.size());
+      std::vector<char>  buf;
+      long long n_bytes = 0, n_hits = 0, n_errors = 0;
+
+      for (const TraceRead &r : s.m_reads)
+      {
+         WaitUntil(r.m_time);
+
+         std::vector<XrdOucIOVec> iov = r.m_chunks;
+         long long total = 0;
+         for (auto &c : iov) total += c.size;
+         if ((long long) buf.size() < total) buf.resize(total);
+         char *p = buf.data();
+         for (auto &c : iov) { c.data = p; p += c.size; }
+
+         long long         before = m_origin.GetSourceBytes(src);
+         Clock::time_point t      = Clock::now();
+         int res = iov.size() == 1 ? io->Read(iov[0].data, iov[0].offset, iov[0].size)
+                                   : io->ReadV(iov.data(), (int) iov.size());
+         lat.push_back(Seconds(t, Clock::now()));
+
+         if (res < 0) ++n_errors;
+         else         n_bytes += res;
+         if (m_origin.GetSourceBytes(src) == before) ++n_hits;
+      }
+
+      WaitUntil(s.m_close_time);
+
+      bool cached = io != oio;
+      if (cached)
+      {
+         DetachWait dw;
+         if ( ! io->Detach(dw)) dw.Wait();
+      }
+      delete oio;
+
+      XrdSysMutexHelper _lck(m_res.m_mutex);
+      m_res.m_latencies.insert(m_res.m_latencies.end(), lat.begin(), lat.end());
+      m_res.m_n_bytes    += n_bytes;
+      m_res.m_n_reads    += lat.size();
+      m_res.m_n_req_hits += n_hits;
+      m_res.m_n_errors   += n_errors;
+      if (cached) ++m_res.m_n_cached; else ++m_res.m_n_passthru;
+   }
+
+   void Run()
+   {
+      m_t0 = Clock::now();
+      for (const TraceSession &s : m_trace.m_sessions)
+      {
+         WaitUntil(s.m_open_time);
+
+         m_cond.Lock();
+         while (m_n_active >= m_max_active) m_cond.Wait();
+         ++m_n_active;
+         m_cond.UnLock();
+
+         pthread_t tid;
+         XrdSysThread::Run(&tid, SessionThread, new Job{ this, &s }, 0, "xrdpfc_bench session");
+      }
+      m_cond.Lock();
+      while (m_n_active > 0) m_cond.Wait();
+      m_cond.UnLock();
+   }
+};
+
+//------------------------------------------------------------------------------
+
+long long ProcWriteBytes()
+{
+   // Bytes passed to write syscalls by this process; includes cache data,
+   // cinfo files and log output.
+   std::ifstream in("/proc/self/io");
+   std::string key;
+   long long   val;
+   while (in >> key >> val)
+   {
+      if (key == "wchar:") return val;
+   }
+   return -1;
+}
+
+double Percentile(std::vector<float> &v, double q)
+{
+   if (v.empty()) return 0;
+   size_t k = std::min(v.size() - 1, (size_t) (q * (v.size() - 1) + 0.5));
+   std::nth_element(v.begin(), v.begin() + k, v.end());
+   return v[k];
+}
+
+} // end anonymous namespace
+
+//==============================================================================
+// main
+//==============================================================================
+
+int main(int argc, char *argv[])
+{
+   static const char* usage =
+      "Usage: xrdpfc_bench -c config_file {-r recorder.csv | -i cinfo_dir} [-h]\n"
+      "          [-l cachelib] [-o origin_dir] [-L latency_ms] [-B bandwidth_MBps] [-n origin_streams]\n"
+      "          [-s speed] [-t max_sessions] [-k cinfo_read_kB] [-w drain_sec] [-g logfile] [-j]\n";
+
+   const char *cfgn = 0, *rec_trace = 0, *cinfo_trace = 0, *logfn = "/dev/null";
+   std::string cachelib = "libXrdPfc.so", origin_dir;
+   double latency = 0.020, bandwidth = 100e6, speed = 1;
+   int    n_streams = 16, max_sessions = 256, chunk = 1024 * 1024, drain = 5;
+   bool   json = false;
+
+   XrdSysLogger log;
+   XrdSysError  err(&log);
+   XrdOucArgs   Spec(&err, "xrdpfc_bench: ", "",
+                     "help",      1, "h",
+                     "config",    1, "c:",
+                     "recording", 1, "r:",
+                     "cinfo",     1, "i:",
+                     "cachelib",  1, "l:",
+                     "origin",    1, "o:",
+                     "latency",   1, "L:",
+                     "bandwidth", 1, "B:",
+                     "streams",   1, "n:",
+                     "speed",     1, "s:",
+                     "sessions",  1, "t:",
+                     "chunk",     1, "k:",
+                     "wait",      1, "w:",
+                     "log",       1, "g:",
+                     "json",      1, "j",
+                     (const char *) 0);
+
+   Spec.Set(argc-1, &argv[1]);
+   char theOpt;
+
+   while ((theOpt = Spec.getopt()) != (char)-1)
+   {
+      switch (theOpt)
+      {
+      case 'c': cfgn         = Spec.argval;                 break;
+      case 'r': rec_trace    = Spec.argval;                 break;
+      case 'i': cinfo_trace  = Spec.argval;                 break;
+      case 'l': cachelib     = Spec.argval;                 break;
+      case 'o': origin_dir   = Spec.argval;                 break;
+      case 'L': latency      = atof(Spec.argval) / 1000;    break;
+      case 'B': bandwidth    = atof(Spec.argval) * 1e6;     break;
+      case 'n': n_streams    = std::max(1, atoi(Spec.argval)); break;
+      case 's': speed        = atof(Spec.argval);           break;
+      case 't': max_sessions = std::max(1, atoi(Spec.argval)); break;
+      case 'k': chunk        = std::max(1, atoi(Spec.argval)) * 1024; break;
+      case 'w': drain        = std::max(0, atoi(Spec.argval)); break;
+      case 'g': logfn        = Spec.argval;                 break;
+      case 'j': json         = true;                        break;
+      case 'h':
+      default:
+         printf("%s", usage);
+         exit(1);
+      }
+   }
+   if ( ! cfgn || ( ! rec_trace == ! cinfo_trace))
+   {
+      printf("%s", usage);
+      exit(1);
+   }
+
+   XrdSysTrace trc("XrdPfcBench");
+   trc.What = 0;
+
+   // Trace
+
+   Trace trace;
+   bool  trace_ok = rec_trace ? ReadRecorderTrace(rec_trace, trace) : ReadCinfoTrace(cinfo_trace, chunk, &trc, trace);
+   if ( ! trace_ok || trace.m_sessions.empty())
+   {
+      fprintf(stderr, "xrdpfc_bench: no file accesses found in trace\n");
+      exit(1);
+   }
+   trace.Finalize();
+
+   // Cache plugin, logging goes to logfn
+
+   int lfd = open(logfn, O_WRONLY | O_CREAT | O_APPEND, 0644);
+   if (lfd < 0)
+   {
+      fprintf(stderr, "xrdpfc_bench: cannot open log file %s\n", logfn);
+      exit(1);
+   }
+   XrdSysLogger   pfcLog(lfd);
+   XrdSysError    pfcErr(&pfcLog, "bench");
+   XrdOucEnv      pfcEnv;
+   XrdOucPinLoader pfcLib(&pfcErr, 0, "cachelib", cachelib.c_str());
+
+   typedef XrdOucCache *(*GetCache_t)(XrdSysLogger *, const char *, const char *, XrdOucEnv *);
+   GetCache_t getCache = (GetCache_t) pfcLib.Resolve("XrdOucGetCache");
+   if ( ! getCache)
+   {
+      fprintf(stderr, "xrdpfc_bench: cannot load %s: %s\n", cachelib.c_str(), pfcLib.LastMsg());
+      exit(1);
+   }
+   XrdOucCache *cache = getCache(&pfcLog, cfgn, 0, &pfcEnv);
+   if ( ! cache)
+   {
+      fprintf(stderr, "xrdpfc_bench: cache initialization failed, see %s\n", logfn);
+      exit(1);
+   }
+
+   // Our own oss on the cache space, for reading back cinfo files.
+
+   XrdOucEnv      ossEnv;
+   XrdOucStream   Config(&pfcErr, getenv("XRDINSTANCE"), &ossEnv, "=====> ");
+   Config.Attach(open(cfgn, O_RDONLY, 0));
+   XrdOss         *oss = 0;
+   XrdOfsConfigPI *ofsCfg = XrdOfsConfigPI::New(cfgn, &Config, &pfcErr);
+   if ( ! ofsCfg || ! ofsCfg->Load(XrdOfsConfigPI::theOssLib) || ! (ofsCfg->Plugin(oss), oss))
+   {
+      fprintf(stderr, "xrdpfc_bench: cannot load oss for config %s\n", cfgn);
+      exit(1);
+   }
+
+   // Replay
+
+   Origin   origin(origin_dir, latency, bandwidth, n_streams);
+   Replayer rep(cache, origin, trace, speed, max_sessions);
+
+   long long         wchar0 = ProcWriteBytes();
+   Clock::time_point t0     = Clock::now();
+   rep.Run();
+   double            replay_time = Seconds(t0, Clock::now());
+
+   // Let the write queue drain and the detached files sync their cinfo.
+   sleep(drain);
+   long long wchar1 = ProcWriteBytes();
+
+   // Collect access statistics from cinfo files in the cache.
+
+   time_t    t_start = time(0) - (time_t) replay_time - drain - 1;
+   long long b_hit = 0, b_miss = 0, b_bypass = 0, disk_usage = 0;
+   int       n_files = 0, n_missing = 0;
+   std::set<std::string> lfns;
+   for (auto &s : trace.m_sessions) lfns.insert(s.m_lfn);
+   for (auto &lfn : lfns)
+   {
+      ++n_files;
+      std::string ifn = lfn + Info::s_infoExtension;
+      XrdOssDF   *df  = oss->newFile("bench");
+      Info        info(&trc);
+      if (df->Open(ifn.c_str(), O_RDONLY, 0600, ossEnv) != XrdOssOK || ! info.Read(df, ifn.c_str()))
+      {
+         ++n_missing;
+      }
+      else
+      {
+         for (const Info::AStat &a : info.RefAStats())
+         {
+            if (a.AttachTime < t_start) continue;
+            b_hit    += a.BytesHit;
+            b_miss   += a.BytesMissed;
+            b_bypass += a.BytesBypassed;
+         }
+         struct stat st;
+         if (oss->Stat(lfn.c_str(), &st) == XrdOssOK) disk_usage += 512ll * st.st_blocks;
+      }
+      df->Close();
+      delete df;
+   }
+
+   // Report
+
+   long long origin_reqs, origin_bytes;
+   origin.GetStats(origin_reqs, origin_bytes);
+
+   Results &R = rep.m_res;
+   double mean = 0;
+   for (float l : R.m_latencies) mean += l;
+   if ( ! R.m_latencies.empty()) mean /= R.m_latencies.size();
+   double p50 = Percentile(R.m_latencies, 0.50);
+   double p99 = Percentile(R.m_latencies, 0.99);
+
+   long long b_all       = b_hit + b_miss + b_bypass;
+   double    hit_ratio   = b_all ? (double) b_hit / b_all : 0;
+   double    req_hits    = R.m_n_reads ? (double) R.m_n_req_hits / R.m_n_reads : 0;
+   long long disk_write  = (wchar0 >= 0 && wchar1 >= 0) ? wchar1 - wchar0 : -1;
+   double    write_ampl  = (disk_write >= 0 && origin_bytes > 0) ? (double) disk_write / origin_bytes : 0;
+
+   if (json)
+   {
+      printf("{\"sessions\":%zu,\"files\":%d,\"reads\":%lld,\"bytes_read\":%lld,\"errors\":%lld,"
+             "\"sessions_cached\":%lld,\"sessions_passthrough\":%lld,\"replay_time\":%.3f,"
+             "\"latency_mean\":%.6f,\"latency_p50\":%.6f,\"latency_p99\":%.6f,"
+             "\"request_hit_ratio\":%.4f,\"byte_hit_ratio\":%.4f,\"bytes_hit\":%lld,\"bytes_missed\":%lld,"
+             "\"bytes_bypassed\":%lld,\"files_without_cinfo\":%d,\"origin_requests\":%lld,\"origin_bytes\":%lld,"
+             "\"disk_written\":%lld,\"write_amplification\":%.3f,\"disk_usage\":%lld}\n",
+             trace.m_sessions.size(), n_files, R.m_n_reads, R.m_n_bytes, R.m_n_errors,
+             R.m_n_cached, R.m_n_passthru, replay_time, mean, p50, p99,
+             req_hits, hit_ratio, b_hit, b_miss, b_bypass, n_missing, origin_reqs, origin_bytes,
+             disk_write, write_ampl, disk_usage);
+   }
+   else
+   {
+      printf("# =============================================\n"
+             "# xrdpfc_bench summary\n"
+             "# =============================================\n"
+             "# Sessions        : %zu (cached %lld, pass-through %lld), files %d\n"
+             "# Replay time     : %.3f s (speed %.2f)\n"
+             "# Client reads    : %lld, %lld bytes, %lld errors\n"
+             "# Read latency    : mean %.3f ms, p50 %.3f ms, p99 %.3f ms\n"
+             "# Request hits    : %.2f%% (reads that did not reach the origin)\n"
+             "# Byte hit ratio  : %.2f%% (hit %lld, missed %lld, bypassed %lld bytes)\n"
+             "# Origin fetched  : %lld bytes in %lld requests\n"
+             "# Disk written    : %lld bytes, write amplification %.3f\n"
+             "# Cache usage     : %lld bytes, %d files without cinfo\n",
+             trace.m_sessions.size(), R.m_n_cached, R.m_n_passthru, n_files,
+             replay_time, speed,
+             R.m_n_reads, R.m_n_bytes, R.m_n_errors,
+             1e3 * mean, 1e3 * p50, 1e3 * p99,
+             100 * req_hits,
+             100 * hit_ratio, b_hit, b_miss, b_bypass,
+             origin_bytes, origin_reqs,
+             disk_write, write_ampl,
+             disk_usage, n_missing);
+   }
+   fflush(stdout);
+
+   // The cache has no shutdown procedure; leave without running destructors.
+   _exit(R.m_n_errors ? 2 : 0);
+}
@@ -0,0 +1,63 @@
+#ifndef __XRDPFC_BLOCKGAPS_HH__
+#define __XRDPFC_BLOCKGAPS_HH__
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include <vector>
+
+namespace XrdPfc
+{
+
+//----------------------------------------------------------------------------
+//! Select the blocks lying in the holes between the missing blocks of a read
+//! request, given by their sorted indices. Holes longer than max_gap blocks
+//! are left alone, as are holes with a block for which is_free(idx) returns
+//! false (already cached or being fetched). Holes are filled in whole, and
+//! with max_overfetch > 0 only as long as the total stays within it; 0 means
+//! no limit. Returns the number of blocks appended to out.
+//----------------------------------------------------------------------------
+template<typename FREE>
+int SelectGapBlocks(const std::vector<int> &idcs, int max_gap, int max_overfetch,
+                    FREE is_free, std::vector<int> &out)
+{
+   int n_sel = 0;
+   for (size_t i = 1; i < idcs.size(); ++i)
+   {
+      const int gap = idcs[i] - idcs[i - 1] - 1;
+      if (gap <= 0 || gap > max_gap || (max_overfetch > 0 && n_sel + gap > max_overfetch))
+         continue;
+
+      bool fillable = true;
+      for (int g = idcs[i - 1] + 1; g < idcs[i] && fillable; ++g)
+      {
+         fillable = is_free(g);
+      }
+      if ( ! fillable)
+         continue;
+
+      for (int g = idcs[i - 1] + 1; g < idcs[i]; ++g)
+      {
+         out.push_back(g);
+         ++n_sel;
+      }
+   }
+   return n_sel;
+}
+
+}
+
+#endif
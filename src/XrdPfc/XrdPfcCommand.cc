@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------------
 
 #include "XrdPfcInfo.hh"
+#include "XrdPfcInfoStore.hh"
 #include "XrdPfc.hh"
 #include "XrdPfcTrace.hh"
 #include "XrdPfcPathParseTools.hh"
@@ -170,8 +171,7 @@ void Cache::ExecuteCommandUrl(const std::string& command_url)
 
       // Check if cinfo exists ... bail out if it does.
       {
-         struct stat infoStat;
-         if (GetOss()->Stat(cinfo_path.c_str(), &infoStat) == XrdOssOK)
+         if (InfoExists(file_path))
          {
             TRACE(Error, err_prefix << "cinfo file already exists for '" << file_path << "'. Refusing to overwrite.");
             return;
@@ -204,24 +204,28 @@ void Cache::ExecuteCommandUrl(const std::string& command_url)
             return;
          }
 
-         // Create the info file.
+         // Create the info file. With the cinfo store, only a record is added.
 
-         myEnv.Put("oss.asize", "64k"); // TODO: Calculate? Get it from configuration? Do not know length of access lists ...
-         myEnv.Put("oss.cgroup", conf.m_meta_space.c_str());
-         if ((cret = GetOss()->Create(myUser, cinfo_path.c_str(), 0600, myEnv, XRDOSS_mkpath)) != XrdOssOK)
+         XrdOssDF *myInfoFile = 0;
+         if ( ! m_info_store)
          {
-            TRACE(Error, err_prefix << "Create failed for info file " << cinfo_path << ERRNO_AND_ERRSTR(-cret));
-            myFile->Close(); delete myFile;
-            return;
-         }
+            myEnv.Put("oss.asize", "64k"); // TODO: Calculate? Get it from configuration? Do not know length of access lists ...
+            myEnv.Put("oss.cgroup", conf.m_meta_space.c_str());
+            if ((cret = GetOss()->Create(myUser, cinfo_path.c_str(), 0600, myEnv, XRDOSS_mkpath)) != XrdOssOK)
+            {
+               TRACE(Error, err_prefix << "Create failed for info file " << cinfo_path << ERRNO_AND_ERRSTR(-cret));
+               myFile->Close(); delete myFile;
+               return;
+            }
 
-         XrdOssDF *myInfoFile = GetOss()->newFile(myUser);
-         if ((cret = myInfoFile->Open(cinfo_path.c_str(), O_RDWR, 0600, myEnv)) != XrdOssOK)
-         {
-            TRACE(Error, err_prefix << "Open failed for info file " << cinfo_path << ERRNO_AND_ERRSTR(-cret));
-            delete myInfoFile;
-            myFile->Close(); delete myFile;
-            return;
+            myInfoFile = GetOss()->newFile(myUser);
+            if ((cret = myInfoFile->Open(cinfo_path.c_str(), O_RDWR, 0600, myEnv)) != XrdOssOK)
+            {
+               TRACE(Error, err_prefix << "Open failed for info file " << cinfo_path << ERRNO_AND_ERRSTR(-cret));
+               delete myInfoFile;
+               myFile->Close(); delete myFile;
+               return;
+            }
          }
 
          // Allocate space for the data file.
@@ -244,18 +248,28 @@ void Cache::ExecuteCommandUrl(const std::string& command_url)
             myInfo.WriteIOStatSingle(file_size, att_time, att_time + access_duration[i]);
          }
 
-         myInfo.Write(myInfoFile, cinfo_path.c_str());
-
-         // Fake last modified time to the last access_time
+         if (m_info_store)
          {
-            time_t last_detach;
-            myInfo.GetLatestDetachTime(last_detach);
-            struct timespec acc_mod_time[2] = { {last_detach, UTIME_OMIT}, {last_detach, 0} };
-
-            futimens(myInfoFile->getFD(), acc_mod_time);
+            if ( ! m_info_store->Put(file_path, myInfo))
+            {
+               TRACE(Error, err_prefix << "Adding cinfo store record failed for " << file_path);
+            }
          }
+         else
+         {
+            myInfo.Write(myInfoFile, cinfo_path.c_str());
 
-         myInfoFile->Close(); delete myInfoFile;
+            // Fake last modified time to the last access_time
+            {
+               time_t last_detach;
+               myInfo.GetLatestDetachTime(last_detach);
+               struct timespec acc_mod_time[2] = { {last_detach, UTIME_OMIT}, {last_detach, 0} };
+
+               futimens(myInfoFile->getFD(), acc_mod_time);
+            }
+
+            myInfoFile->Close(); delete myInfoFile;
+         }
          myFile->Close();     delete myFile;
 
          struct stat dstat;
@@ -1,6 +1,8 @@
 #include "XrdPfc.hh"
 #include "XrdPfcTrace.hh"
 #include "XrdPfcInfo.hh"
+#include "XrdPfcInfoStore.hh"
+#include "XrdPfcAdmission.hh"
 
 #include "XrdPfcResourceMonitor.hh"
 #include "XrdPfcPurgePin.hh"
@@ -45,7 +47,16 @@ Configuration::Configuration() :
    m_purgeInterval(300),
    m_purgeColdFilesAge(-1),
    m_purgeAgeBasedPeriod(10),
+   m_purgeIndex(false),
+   m_purgeIndexCrossCheck(24),
    m_accHistorySize(20),
+   m_metaStoreCompact(0.5),
+   m_metaStoreSync(true),
+   m_admission(false),
+   m_admMinFreq(2),
+   m_admSizeRef(1024*1024*1024),
+   m_admSketchWidthLog2(16),
+   m_admPurgeCredit(600),
    m_dirStatsInterval(900),
    m_dirStatsStoreDepth(1),
    m_bufferSize(128*1024),
@@ -54,6 +65,9 @@ Configuration::Configuration() :
    m_wqueue_blocks(16),
    m_wqueue_threads(4),
    m_prefetch_max_blocks(10),
+   m_miss_merge(false),
+   m_miss_max_gap(0),
+   m_miss_max_overfetch(0),
    m_hdfsbsize(128*1024*1024),
    m_flushCnt(2000),
    m_cs_UVKeep(-1),
@@ -738,6 +752,10 @@ bool Cache::Config(const char *config_filename, const char *parameters, XrdOucEn
 
       loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.writethrough %s\n", m_configuration.m_write_through ? "on" : "off");
 
+      loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.misscoalesce merge %s maxgap %d overfetch %d\n",
+                       m_configuration.m_miss_merge ? "on" : "off",
+                       m_configuration.m_miss_max_gap, m_configuration.m_miss_max_overfetch);
+
       if (m_configuration.m_username.empty())
       {
          char unameBuff[256];
@@ -749,6 +767,26 @@ bool Cache::Config(const char *config_filename, const char *parameters, XrdOucEn
          loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.user %s\n", m_configuration.m_username.c_str());
       }
 
+      if (m_configuration.m_purgeIndex)
+      {
+         loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.purgeindex on crosscheck %d\n",
+                          m_configuration.m_purgeIndexCrossCheck);
+      }
+
+      if (m_configuration.is_meta_store_in_use())
+      {
+         loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.metastore %s compact %.2f sync %s\n",
+                          m_configuration.m_metaStorePath.c_str(), m_configuration.m_metaStoreCompact,
+                          m_configuration.m_metaStoreSync ? "on" : "off");
+      }
+
+      if (m_configuration.m_admission)
+      {
+         loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.admission tinylfu minfreq %d sizeref %lld sketchsize %d purgecredit %d\n",
+                          m_configuration.m_admMinFreq, m_configuration.m_admSizeRef,
+                          m_configuration.m_admSketchWidthLog2, m_configuration.m_admPurgeCredit);
+      }
+
       if (m_configuration.m_httpcc)
       {
          loff += snprintf(buff + loff, sizeof(buff) - loff, "       pfc.httpcc on\n");
@@ -771,6 +809,29 @@ bool Cache::Config(const char *config_filename, const char *parameters, XrdOucEn
 
    m_log.Say("       pfc g-stream has", m_gstream ? "" : " NOT", " been configured via xrootd.monitor directive\n");
 
+   // Open the consolidated cinfo store, if requested.
+   if (aOK && m_configuration.is_meta_store_in_use())
+   {
+      m_info_store = new InfoStore(m_trace);
+      if ( ! m_info_store->Open(m_configuration.m_metaStorePath, m_configuration.m_metaStoreCompact,
+                                m_configuration.m_metaStoreSync))
+      {
+         m_log.Emsg("Config", "Error: failed opening pfc.metastore", m_configuration.m_metaStorePath.c_str());
+         delete m_info_store; m_info_store = 0;
+         aOK = false;
+      }
+   }
+
+   if (aOK && m_configuration.m_admission)
+   {
+      Admission::Parameters ap;
+      ap.m_min_freq     = m_configuration.m_admMinFreq;
+      ap.m_size_ref     = m_configuration.m_admSizeRef;
+      ap.m_width_log2   = m_configuration.m_admSketchWidthLog2;
+      ap.m_purge_credit = m_configuration.m_admPurgeCredit;
+      m_admission = new Admission(ap, m_trace);
+   }
+
    // Create the ResourceMonitor and get it ready for starting the main thread function.
    if (aOK)
    {
@@ -880,6 +941,32 @@ bool Cache::ConfigParameters(std::string part, XrdOucStream& config, TmpConfigur
          }
       }
    }
+   else if ( part == "purgeindex" )
+   {
+      //  pfc.purgeindex {on | off} [crosscheck <n>]
+      const char *val = cwg.GetWord();
+      if      (cwg.HasLast() && strcmp(val, "on")  == 0) CFG.m_purgeIndex = true;
+      else if (cwg.HasLast() && strcmp(val, "off") == 0) CFG.m_purgeIndex = false;
+      else
+      {
+         m_log.Emsg("Config", "Error: pfc.purgeindex requires a parameter [off|on]");
+         return false;
+      }
+      const char *p = 0;
+      while ((p = cwg.GetWord()) && cwg.HasLast())
+      {
+         if (strcmp(p, "crosscheck") == 0)
+         {
+            if (XrdOuca2x::a2i(m_log, "Error getting pfc.purgeindex crosscheck", cwg.GetWord(), &CFG.m_purgeIndexCrossCheck, 1, 10000))
+               return false;
+         }
+         else
+         {
+            m_log.Emsg("Config", "Error: pfc.purgeindex stanza contains unknown directive", p);
+            return false;
+         }
+      }
+   }
    else if ( part == "acchistorysize" )
    {
       if ( XrdOuca2x::a2i(m_log, "Error getting access-history-size", cwg.GetWord(), &m_configuration.m_accHistorySize, 20, 200))
@@ -1195,6 +1282,135 @@ bool Cache::ConfigParameters(std::string part, XrdOucStream& config, TmpConfigur
          }
       }
    }
+   else if ( part == "misscoalesce" )
+   {
+      //  pfc.misscoalesce [merge {on | off}] [maxgap <nblocks>] [overfetch <nblocks>]
+      //  merge is off by default; overfetch 0, the default, puts no limit on gap filling
+      const char *p = 0;
+      while ((p = cwg.GetWord()) && cwg.HasLast())
+      {
+         if (strcmp(p, "merge") == 0)
+         {
+            const char *val = cwg.GetWord();
+            if      (strcmp(val, "on")  == 0) CFG.m_miss_merge = true;
+            else if (strcmp(val, "off") == 0) CFG.m_miss_merge = false;
+            else
+            {
+               m_log.Emsg("Config", "Error: pfc.misscoalesce merge can only have values [off|on]", val);
+               return false;
+            }
+         }
+         else if (strcmp(p, "maxgap") == 0)
+         {
+            if (XrdOuca2x::a2i(m_log, "Error getting pfc.misscoalesce maxgap", cwg.GetWord(), &CFG.m_miss_max_gap, 0, 64))
+               return false;
+         }
+         else if (strcmp(p, "overfetch") == 0)
+         {
+            if (XrdOuca2x::a2i(m_log, "Error getting pfc.misscoalesce overfetch", cwg.GetWord(), &CFG.m_miss_max_overfetch, 0, 1024))
+               return false;
+         }
+         else
+         {
+            m_log.Emsg("Config", "Error: pfc.misscoalesce stanza contains unknown directive", p);
+            return false;
+         }
+      }
+   }
+   else if ( part == "admission" )
+   {
+      //  pfc.admission {off | tinylfu [minfreq <n>] [sizeref <bytes>] [sketchsize <log2>] [purgecredit <sec>]}
+      const char *val = cwg.GetWord();
+      if ( ! cwg.HasLast() || ! val[0])
+      {
+         m_log.Emsg("Config", "Error: pfc.admission requires a parameter.");
+         return false;
+      }
+      if (strcmp(val, "off") == 0)
+      {
+         CFG.m_admission = false;
+         return true;
+      }
+      if (strcmp(val, "tinylfu") != 0)
+      {
+         m_log.Emsg("Config", "Error: pfc.admission policy can only be [off|tinylfu]", val);
+         return false;
+      }
+      CFG.m_admission = true;
+
+      const char *p = 0;
+      while ((p = cwg.GetWord()) && cwg.HasLast())
+      {
+         if (strcmp(p, "minfreq") == 0)
+         {
+            if (XrdOuca2x::a2i(m_log, "Error getting pfc.admission minfreq", cwg.GetWord(), &CFG.m_admMinFreq, 1, 15))
+               return false;
+         }
+         else if (strcmp(p, "sizeref") == 0)
+         {
+            if (XrdOuca2x::a2sz(m_log, "Error getting pfc.admission sizeref", cwg.GetWord(), &CFG.m_admSizeRef, 0))
+               return false;
+         }
+         else if (strcmp(p, "sketchsize") == 0)
+         {
+            if (XrdOuca2x::a2i(m_log, "Error getting pfc.admission sketchsize", cwg.GetWord(), &CFG.m_admSketchWidthLog2, 8, 24))
+               return false;
+         }
+         else if (strcmp(p, "purgecredit") == 0)
+         {
+            if (XrdOuca2x::a2tm(m_log, "Error getting pfc.admission purgecredit", cwg.GetWord(), &CFG.m_admPurgeCredit, 0))
+               return false;
+         }
+         else
+         {
+            m_log.Emsg("Config", "Error: pfc.admission stanza contains unknown directive", p);
+            return false;
+         }
+      }
+   }
+   else if ( part == "metastore" )
+   {
+      //  pfc.metastore <path> [compact <fraction>] [sync {on | off}]
+      CFG.m_metaStorePath = cwg.GetWord();
+      if ( ! cwg.HasLast() || CFG.m_metaStorePath.empty() || CFG.m_metaStorePath[0] != '/')
+      {
+         m_log.Emsg("Config", "Error: pfc.metastore requires an absolute path.");
+         return false;
+      }
+      const char *p = 0;
+      while ((p = cwg.GetWord()) && cwg.HasLast())
+      {
+         if (strcmp(p, "compact") == 0)
+         {
+            const char *val = cwg.GetWord();
+            char *eP;
+            errno = 0;
+            double frac = strtod(val, &eP);
+            if (errno || eP == val || frac < 0 || frac > 1)
+            {
+               m_log.Emsg("Config", "Error: pfc.metastore compact requires a fraction between 0 and 1.");
+               return false;
+            }
+            CFG.m_metaStoreCompact = frac;
+         }
+         else if (strcmp(p, "sync") == 0)
+         {
+            const char *val = cwg.GetWord();
+            if      (strcmp(val, "on")  == 0) CFG.m_metaStoreSync = true;
+            else if (strcmp(val, "off") == 0) CFG.m_metaStoreSync = false;
+            else
+            {
+               m_log.Emsg("Config", "Error: pfc.metastore sync can only have values [off|on]", val);
+               return false;
+            }
+         }
+         else
+         {
+            m_log.Emsg("Config", "Error: pfc.metastore stanza contains unknown directive", p);
+            return false;
+         }
+      }
+   }
    else if ( part == "httpcc" )
    {
       const char* val = cwg.GetWord();
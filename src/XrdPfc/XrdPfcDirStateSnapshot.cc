@@ -1,6 +1,7 @@
 #include "XrdPfcDirStateSnapshot.hh"
 #include "XrdPfcPathParseTools.hh"
 #include "XrdPfc.hh"
+#include "XrdPfcInfoStore.hh"
 #include "XrdPfcTrace.hh"
 
 #include "XrdOuc/XrdOucJson.hh"
@@ -119,6 +120,21 @@ void DataFsSnapshot::write_json_file(const std::string &file_path, XrdOss& oss,
    myFile->Write(os.str().c_str(), 0, os.str().size());
    myFile->Close();     delete myFile;
 
+   // With the cinfo store, only a record is added.
+
+   if (InfoStore *info_store = Cache::GetInstance().GetInfoStore())
+   {
+      Info myInfo(GetTrace(), false);
+      myInfo.SetBufferSizeFileSizeAndCreationTime(512*1024, os.str().size());
+      myInfo.SetAllBitsSynced();
+
+      if ( ! info_store->Put(file_path, myInfo))
+      {
+         TRACE(Error, "Adding cinfo store record failed for " << file_path);
+      }
+      return;
+   }
+
    // Create the info file.
 
    std::string cinfo_path(file_path + Info::s_infoExtension);
@@ -1,6 +1,8 @@
 #include "XrdPfcFPurgeState.hh"
 #include "XrdPfcFsTraversal.hh"
 #include "XrdPfcInfo.hh"
+#include "XrdPfcInfoStore.hh"
+#include "XrdPfcAdmission.hh"
 #include "XrdPfc.hh"
 #include "XrdPfcTrace.hh"
 
@@ -18,6 +20,11 @@ using namespace XrdPfc;
 
 const char *FPurgeState::m_traceID = "Purge";
 
+namespace
+{
+   XrdSysTrace* GetTrace() { return Cache::GetInstance().GetTrace(); }
+}
+
 //----------------------------------------------------------------------------
 //! Constructor.
 //----------------------------------------------------------------------------
@@ -52,9 +59,13 @@ void FPurgeState::MoveListEntriesToMap()
 //----------------------------------------------------------------------------
 void FPurgeState::CheckFile(const FsTraversal &fst, const char *fname, time_t atime, struct stat &fstat)
 {
-   long long nblocks = fstat.st_blocks;
    // TRACE(Dump, trc_pfx << "FPurgeState::CheckFile checking " << fname << " accessTime  " << atime);
 
+   CheckFile(fst.m_current_path + fname, atime, fstat.st_blocks);
+}
+
+void FPurgeState::CheckFile(const std::string &info_path, time_t atime, long long nblocks)
+{
    m_nStBlocksTotal += nblocks;
 
    // Could remove aged-out / uv-keep-failed files here ... or in the calling function that
@@ -65,12 +76,21 @@ void FPurgeState::CheckFile(const FsTraversal &fst, const char *fname, time_t at
 
    if (m_tMinTimeStamp > 0 && atime < m_tMinTimeStamp)
    {
-      m_flist.push_back(PurgeCandidate(fst.m_current_path, fname, nblocks, 0));
+      m_flist.push_back(PurgeCandidate(info_path, nblocks, 0));
       m_nStBlocksAccum += nblocks;
+      return;
    }
-   else if (m_nStBlocksAccum < m_nStBlocksReq || (!m_fmap.empty() && atime < m_fmap.rbegin()->first))
+
+   // With the admission policy in effect, frequently opened files get their
+   // access time shifted forward so that they are evicted later.
+   if (const Admission *adm = Cache::TheOne().GetAdmission())
+   {
+      atime += adm->PurgeTimeCredit(info_path.substr(0, info_path.size() - Info::s_infoExtensionLen));
+   }
+
+   if (m_nStBlocksAccum < m_nStBlocksReq || (!m_fmap.empty() && atime < m_fmap.rbegin()->first))
    {
-      m_fmap.insert(std::make_pair(atime, PurgeCandidate(fst.m_current_path, fname, nblocks, atime)));
+      m_fmap.insert(std::make_pair(atime, PurgeCandidate(info_path, nblocks, atime)));
       m_nStBlocksAccum += nblocks;
 
       // remove newest files from map if necessary
@@ -82,6 +102,19 @@ void FPurgeState::CheckFile(const FsTraversal &fst, const char *fname, time_t at
    }
 }
 
+//----------------------------------------------------------------------------
+//! Add purge candidates selected from the purge index instead of traversing
+//! the namespace. Cold files and the admission policy are handled as for
+//! the files found during traversal.
+//----------------------------------------------------------------------------
+void FPurgeState::AddCandidates(const std::vector<PurgeIndex::Candidate> &cands)
+{
+   for (auto &c : cands)
+   {
+      CheckFile(c.m_lfn + Info::s_infoExtension, c.m_atime, c.m_st_blocks);
+   }
+}
+
 void FPurgeState::ProcessDirAndRecurse(FsTraversal &fst)
 {
    for (auto it = fst.m_current_files.begin(); it != fst.m_current_files.end(); ++it)
@@ -101,6 +134,9 @@ void FPurgeState::ProcessDirAndRecurse(FsTraversal &fst)
       time_t atime = it->second.stat_cinfo.st_mtime;
       CheckFile(fst, i_name.c_str(), atime, it->second.stat_data);
 
+      if (m_index_files)
+         m_index_files->push_back({ fst.m_current_path + f_name, it->second.stat_data.st_blocks, atime });
+
       // Protected top-directories are skipped.
    }
 
@@ -116,10 +152,54 @@ void FPurgeState::ProcessDirAndRecurse(FsTraversal &fst)
    }
 }
 
+//----------------------------------------------------------------------------
+//! Collect purge candidates from the records of the cinfo store instead of
+//! traversing the namespace, only the data files get stat-ed. Records of
+//! files whose data file is gone are dropped.
+//----------------------------------------------------------------------------
+void FPurgeState::CollectFromInfoStore(InfoStore &store, const char *root_path)
+{
+   std::string root(root_path);
+   if (root.empty() || root.back() != '/')
+      root += '/';
+
+   std::vector<InfoStore::Entry> entries;
+   store.Inventory(entries);
+
+   const Cache &cache = Cache::TheOne();
+   for (auto &e : entries)
+   {
+      if (e.m_lfn.compare(0, root.size(), root) != 0 || e.m_lfn.compare(0, 11, "/pfc-stats/") == 0)
+         continue;
+
+      struct stat fstat;
+      if (m_oss.Stat(e.m_lfn.c_str(), &fstat) != XrdOssOK)
+      {
+         if ( ! cache.IsFileActiveOrPurgeProtected(e.m_lfn))
+         {
+            TRACE(Info, "CollectFromInfoStore dropping record of missing data file " << e.m_lfn);
+            cache.ForgetFile(e.m_lfn);
+         }
+         continue;
+      }
+
+      CheckFile(e.m_lfn + Info::s_infoExtension, e.m_atime, fstat.st_blocks);
+
+      if (m_index_files)
+         m_index_files->push_back({ e.m_lfn, fstat.st_blocks, e.m_atime });
+   }
+}
+
 bool FPurgeState::TraverseNamespace(const char *root_path)
 {
    bool success_p = true;
 
+   if (InfoStore *store = Cache::TheOne().GetInfoStore())
+   {
+      CollectFromInfoStore(*store, root_path);
+      return success_p;
+   }
+
    FsTraversal fst(m_oss);
    fst.m_protected_top_dirs.insert("pfc-stats"); // XXXX This should come from config. Also: N2N?
                                                  // Also ... this onoly applies to /, not any root_path
@@ -1,6 +1,8 @@
 #ifndef __XRDPFC_FPURGESTATE_HH__
 #define __XRDPFC_FPURGESTATE_HH__
 
+#include "XrdPfcPurgeIndex.hh"
+
 #include <ctime>
 #include <list>
 #include <map>
@@ -13,6 +15,7 @@ class XrdOss;
 namespace XrdPfc {
 
 class Info;
+class InfoStore;
 class FsTraversal;
 
 //==============================================================================
@@ -31,6 +34,9 @@ public:
       PurgeCandidate(const std::string &dname, const char *fname, long long n, time_t t) :
          path(dname + fname), nStBlocks(n), time(t)
       {}
+      PurgeCandidate(const std::string &p, long long n, time_t t) :
+         path(p), nStBlocks(n), time(t)
+      {}
    };
 
    using list_t = std::list<PurgeCandidate>;
@@ -52,6 +58,8 @@ private:
    list_t  m_flist; // list of files to be removed unconditionally
    map_t   m_fmap; // map of files that are purge candidates
 
+   std::vector<PurgeIndex::Candidate> *m_index_files = nullptr; // all files found, for purge index reconcile
+
 public:
    FPurgeState(long long iNBytesReq, XrdOss &oss);
 
@@ -61,14 +69,19 @@ public:
    void      setMinTime(time_t min_time) { m_tMinTimeStamp = min_time; }
    time_t    getMinTime()          const { return m_tMinTimeStamp; }
    void      setUVKeepMinTime(time_t min_time) { m_tMinUVKeepTimeStamp = min_time; }
+   void      setIndexFiles(std::vector<PurgeIndex::Candidate> *v) { m_index_files = v; }
    long long getNStBlocksTotal() const { return m_nStBlocksTotal; }
    long long getNBytesTotal() const { return 512ll * m_nStBlocksTotal; }
 
    void MoveListEntriesToMap();
 
    void CheckFile(const FsTraversal &fst, const char *fname, time_t atime, struct stat &fstat);
+   void CheckFile(const std::string &info_path, time_t atime, long long nblocks);
+
+   void AddCandidates(const std::vector<PurgeIndex::Candidate> &cands);
 
    void ProcessDirAndRecurse(FsTraversal &fst);
+   void CollectFromInfoStore(InfoStore &store, const char *root_path);
    bool TraverseNamespace(const char *root_path);
 };
 
@@ -20,7 +20,10 @@
 #include "XrdPfcFile.hh"
 #include "XrdPfc.hh"
 #include "XrdPfcResourceMonitor.hh"
+#include "XrdPfcAdmission.hh"
 #include "XrdPfcIO.hh"
+#include "XrdPfcInfoStore.hh"
+#include "XrdPfcBlockGaps.hh"
 #include "XrdPfcTrace.hh"
 
 #include "XProtocol/XProtocol.hh"
@@ -444,10 +447,15 @@ bool File::Open(XrdOucCacheIO *inputIO)
    XrdOucEnv   myEnv;
    struct stat data_stat, info_stat;
 
+   // When the consolidated cinfo store is in use, its record is authoritative
+   // and no cinfo file is kept.
+   InfoStore *info_store = Cache::GetInstance().GetInfoStore();
+
    std::string ifn = m_filename + Info::s_infoExtension;
 
    bool data_existed = (myOss.Stat(m_filename.c_str(), &data_stat) == XrdOssOK);
-   bool info_existed = (myOss.Stat(ifn.c_str(),        &info_stat) == XrdOssOK);
+   bool info_existed = info_store ? info_store->Contains(m_filename)
+                                  : (myOss.Stat(ifn.c_str(), &info_stat) == XrdOssOK);
 
    // Create the data file itself.
    char size_str[32]; sprintf(size_str, "%lld", m_file_size);
@@ -472,29 +480,45 @@ bool File::Open(XrdOucCacheIO *inputIO)
       return false;
    }
 
-   myEnv.Put("oss.asize", "64k"); // Advisory, block-map and access list lengths vary.
-   myEnv.Put("oss.cgroup", conf.m_meta_space.c_str());
-   if ((res = myOss.Create(myUser, ifn.c_str(), 0600, myEnv, XRDOSS_mkpath)) != XrdOssOK)
+   if ( ! info_store)
    {
-      TRACE(Error, tpfx << "Create failed for info file " << ifn << ERRNO_AND_ERRSTR(-res));
-      errno = -res;
-      m_data_file->Close(); delete m_data_file; m_data_file = 0;
-      return false;
-   }
+      myEnv.Put("oss.asize", "64k"); // Advisory, block-map and access list lengths vary.
+      myEnv.Put("oss.cgroup", conf.m_meta_space.c_str());
+      if ((res = myOss.Create(myUser, ifn.c_str(), 0600, myEnv, XRDOSS_mkpath)) != XrdOssOK)
+      {
+         TRACE(Error, tpfx << "Create failed for info file " << ifn << ERRNO_AND_ERRSTR(-res));
+         errno = -res;
+         m_data_file->Close(); delete m_data_file; m_data_file = 0;
+         return false;
+      }
 
-   m_info_file = myOss.newFile(myUser);
-   if ((res = m_info_file->Open(ifn.c_str(), O_RDWR, 0600, myEnv)) != XrdOssOK)
-   {
-      TRACEF(Error, tpfx << "Failed for info file " << ifn  << ERRNO_AND_ERRSTR(-res));
-      errno = -res;
-      delete m_info_file; m_info_file = 0;
-      m_data_file->Close(); delete m_data_file;   m_data_file   = 0;
-      return false;
+      m_info_file = myOss.newFile(myUser);
+      if ((res = m_info_file->Open(ifn.c_str(), O_RDWR, 0600, myEnv)) != XrdOssOK)
+      {
+         TRACEF(Error, tpfx << "Failed for info file " << ifn  << ERRNO_AND_ERRSTR(-res));
+         errno = -res;
+         delete m_info_file; m_info_file = 0;
+         m_data_file->Close(); delete m_data_file;   m_data_file   = 0;
+         return false;
+      }
+
+      // The cinfo file exists now, the admission policy need not look for it.
+      if (Admission *admission = Cache::GetInstance().GetAdmission())
+         admission->SetCached(m_filename, true);
    }
 
    bool initialize_info_file = true;
 
-   if (info_existed && m_cfi.Read(m_info_file, ifn.c_str()))
+   bool info_read = false;
+   if (info_existed)
+   {
+      if (info_store)
+         info_read = info_store->Get(m_filename, m_cfi);
+      else
+         info_read = m_cfi.Read(m_info_file, ifn.c_str());
+   }
+
+   if (info_read)
    {
       TRACEF(Debug, tpfx << "Reading existing info file. (data_existed=" << data_existed  <<
              ", data_size_stat=" << (data_existed ? data_stat.st_size : -1ll) <<
@@ -545,9 +569,22 @@ bool File::Open(XrdOucCacheIO *inputIO)
       m_cfi.SetBufferSizeFileSizeAndCreationTime(pfc_blocksize, m_file_size);
       m_cfi.SetCkSumState(conf.get_cs_Chk());
       m_cfi.ResetNoCkSumTime();
-      m_cfi.Write(m_info_file, ifn.c_str());
-      m_info_file->Fsync();
-      cache()->WriteFileSizeXAttr(m_info_file->getFD(), m_file_size);
+      if (info_store)
+      {
+         if ( ! info_store->Put(m_filename, m_cfi))
+         {
+            TRACEF(Error, tpfx << "Failed adding record to cinfo store");
+            errno = EIO;
+            m_data_file->Close(); delete m_data_file; m_data_file = 0;
+            return false;
+         }
+      }
+      else
+      {
+         m_cfi.Write(m_info_file, ifn.c_str());
+         m_info_file->Fsync();
+         cache()->WriteFileSizeXAttr(m_info_file->getFD(), m_file_size);
+      }
 
       if (cache()->RefConfiguration().m_httpcc)
       {
@@ -565,7 +602,8 @@ bool File::Open(XrdOucCacheIO *inputIO)
                cc_str = cc_json.dump();
             }
             TRACE(Error, "GetFile() XrdCl::File::Fcntl value " << cc_str);
-            cache()->WriteCacheControlXAttr(m_info_file->getFD(), nullptr, cc_str);
+            // Without cinfo files the cache-control attribute goes to the data file.
+            cache()->WriteCacheControlXAttr(info_store ? m_data_file->getFD() : m_info_file->getFD(), nullptr, cc_str);
          }
          else if (resFctl != kXR_Unsupported)
          {
@@ -579,7 +617,7 @@ bool File::Open(XrdOucCacheIO *inputIO)
    }
    else
    {
-      if (futimens(m_info_file->getFD(), NULL)) {
+      if ( ! info_store && futimens(m_info_file->getFD(), NULL)) {
          TRACEF(Error, tpfx << "failed setting modification time " << ERRNO_AND_ERRSTR(errno));
       }
       if (pfc_blocksize != conf.m_bufferSize) {
@@ -786,14 +824,129 @@ void File::ProcessBlockRequest(Block *b)
    }
 }
 
-void File::ProcessBlockRequests(BlockList_t& blks)
+void File::ProcessBlockRequests(BlockList_t& blks, bool coalesce)
+{
+   // This *must not* be called with block_map locked.
+   //
+   // With coalesce, blocks requested through the same IO are sent out as
+   // vector reads, ordered by offset, so that a scattered miss costs one
+   // round-trip per XrdProto::maxRvecsz elements instead of one per block.
+   // Blocks that need network checksums still go out as individual pgReads.
+
+   if ( ! coalesce || blks.size() < 2)
+   {
+      for (BlockList_i bi = blks.begin(); bi != blks.end(); ++bi)
+      {
+         ProcessBlockRequest(*bi);
+      }
+      return;
+   }
+
+   std::vector<Block*> sorted;
+   sorted.reserve(blks.size());
+   for (Block *b : blks)
+   {
+      if (b->req_cksum_net())
+         ProcessBlockRequest(b);
+      else
+         sorted.push_back(b);
+   }
+   std::sort(sorted.begin(), sorted.end(), [](const Block *a, const Block *b)
+   {
+      return a->get_io() != b->get_io() ? a->get_io() < b->get_io() : a->get_offset() < b->get_offset();
+   });
+
+   std::vector<Block*> grp;
+   int                 grp_n_iov = 0;
+   for (Block *b : sorted)
+   {
+      int n_iov = (b->get_size() - 1) / XrdProto::maxRVdsz + 1;
+      if ( ! grp.empty() && (grp.back()->get_io() != b->get_io() || grp_n_iov + n_iov > XrdProto::maxRvecsz))
+      {
+         ProcessBlockRequestGroup(grp);
+         grp.clear();
+         grp_n_iov = 0;
+      }
+      grp.push_back(b);
+      grp_n_iov += n_iov;
+   }
+   if ( ! grp.empty())
+      ProcessBlockRequestGroup(grp);
+}
+
+void File::ProcessBlockRequestGroup(std::vector<Block*> &grp)
 {
    // This *must not* be called with block_map locked.
 
-   for (BlockList_i bi = blks.begin(); bi != blks.end(); ++bi)
+   if (grp.size() == 1)
+   {
+      ProcessBlockRequest(grp.front());
+      return;
+   }
+
+   MultiBlockResponseHandler *mbrh = new MultiBlockResponseHandler;
+   mbrh->m_blocks.swap(grp);
+
+   for (Block *b : mbrh->m_blocks)
+   {
+      long long off  = b->get_offset();
+      char     *buf  = b->get_buff();
+      int       left = b->get_size();
+      while (left > 0)
+      {
+         int size = std::min(left, XrdProto::maxRVdsz);
+         mbrh->m_iovec.push_back( { off, size, 0, buf } );
+         off  += size;
+         buf  += size;
+         left -= size;
+      }
+   }
+
+   TRACEF(Dump, "ProcessBlockRequestGroup() n_blocks=" << mbrh->m_blocks.size() << ", n_chunks=" << mbrh->m_iovec.size()
+          << ", first_idx=" << mbrh->m_blocks.front()->get_offset() / m_block_size
+          << ", last_idx=" << mbrh->m_blocks.back()->get_offset() / m_block_size << ", handler=" << (void*) mbrh);
+
+   mbrh->m_blocks.front()->get_io()->GetInput()->ReadV(*mbrh, mbrh->m_iovec.data(), (int) mbrh->m_iovec.size());
+}
+
+//------------------------------------------------------------------------------
+
+int File::FillBlockRequestGaps(IO *io, BlockList_t& blks)
+{
+   // Must be called w/ state_cond locked.
+   //
+   // Requests blocks that lie in small holes between the missing blocks of a
+   // single read request so that the origin sees fewer, longer ranges. Gap
+   // blocks are handled as prefetched blocks: they have no chunk requests
+   // and go to the write queue once they arrive.
+
+   const Configuration &conf = cache()->RefConfiguration();
+
+   std::vector<int> idcs;
+   idcs.reserve(blks.size());
+   for (Block *b : blks)
+      idcs.push_back(b->get_offset() / m_block_size);
+   std::sort(idcs.begin(), idcs.end());
+
+   std::vector<int> gaps;
+   SelectGapBlocks(idcs, conf.m_miss_max_gap, conf.m_miss_max_overfetch,
+                   [&](int g) { return m_block_map.find(g) == m_block_map.end() && ! m_cfi.TestBitWritten(offsetIdx(g)); },
+                   gaps);
+
+   int n_filled = 0;
+   for (int g : gaps)
    {
-      ProcessBlockRequest(*bi);
+      Block *b = PrepareBlockRequest(g, io, nullptr, true);
+      if ( ! b)
+         break;
+
+      blks.push_back(b);
+      ++io->m_active_prefetches;
+      inc_prefetch_read_cnt(1);
+      ++n_filled;
    }
+
+   return n_filled;
 }
 
 //------------------------------------------------------------------------------
@@ -1060,12 +1213,21 @@ int File::ReadOpusCoalescere(IO *io, const XrdOucIOVec *readV, int readVnum,
 
    inc_prefetch_hit_cnt(prefetch_cnt);
 
+   const Configuration &conf = cache()->RefConfiguration();
+
+   if (conf.m_miss_max_gap > 0 && blks_to_request.size() > 1)
+   {
+      int n_filled = FillBlockRequestGaps(io, blks_to_request);
+      if (n_filled)
+         TRACEF(Dump, tpfx << "filled gaps between missing blocks with " << n_filled << " additional blocks");
+   }
+
    m_state_cond.UnLock();
 
    // First, send out remote requests for new blocks.
    if ( ! blks_to_request.empty())
    {
-      ProcessBlockRequests(blks_to_request);
+      ProcessBlockRequests(blks_to_request, conf.m_miss_merge);
       blks_to_request.clear();
    }
 
@@ -1263,12 +1425,26 @@ void File::Sync()
          loc_stats = m_stats;
       }
       m_cfi.WriteIOStat(loc_stats);
-      m_cfi.Write(m_info_file, m_filename.c_str());
-      int cret = m_info_file->Fsync();
-      if (cret != XrdOssOK)
+      // With the cinfo store in use there is no cinfo file, durability comes
+      // from the store record.
+      InfoStore *info_store = Cache::GetInstance().GetInfoStore();
+      if (info_store)
+      {
+         if ( ! info_store->Put(m_filename, m_cfi))
+         {
+            TRACEF(Error, "Sync cinfo store update failed");
+            errorp = true;
+         }
+      }
+      else
       {
-         TRACEF(Error, "Sync cinfo file sync error " << cret);
-         errorp = true;
+         m_cfi.Write(m_info_file, m_filename.c_str());
+         int cret = m_info_file->Fsync();
+         if (cret != XrdOssOK)
+         {
+            TRACEF(Error, "Sync cinfo file sync error " << cret);
+            errorp = true;
+         }
       }
    }
    else
@@ -1786,6 +1962,32 @@ void BlockResponseHandler::Done(int res)
 
 //------------------------------------------------------------------------------
 
+void MultiBlockResponseHandler::Done(int res)
+{
+   // The vector read only reports the total; on a short read, bytes are
+   // attributed to blocks in offset order and the remaining blocks see an
+   // incomplete read.
+
+   int left = res;
+   for (Block *b : m_blocks)
+   {
+      int b_res;
+      if (res < 0)
+      {
+         b_res = res;
+      }
+      else
+      {
+         b_res = std::min(left, b->get_size());
+         left -= b_res;
+      }
+      b->m_file->ProcessBlockResponse(b, b_res);
+   }
+   delete this;
+}
+
+//------------------------------------------------------------------------------
+
 void DirectResponseHandler::Done(int res)
 {
    m_mutex.Lock();
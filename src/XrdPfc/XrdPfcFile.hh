@@ -180,6 +180,17 @@ public:
 
 // ----------------------------------------------------------------
 
+class MultiBlockResponseHandler : public XrdOucCacheIOCB
+{
+public:
+   std::vector<Block*>      m_blocks;
+   std::vector<XrdOucIOVec> m_iovec;
+
+   void Done(int result) override;
+};
+
+// ----------------------------------------------------------------
+
 class DirectResponseHandler : public XrdOucCacheIOCB
 {
 public:
@@ -203,6 +214,7 @@ class File
 {
    friend class Cache;
    friend class BlockResponseHandler;
+   friend class MultiBlockResponseHandler;
    friend class DirectResponseHandler;
 public:
    // Constructor, destructor, Open() and Close() are private.
@@ -392,7 +404,9 @@ private:
    Block* PrepareBlockRequest(int i, IO *io, void *req_id, bool prefetch);
 
    void   ProcessBlockRequest (Block       *b);
-   void   ProcessBlockRequests(BlockList_t& blks);
+   void   ProcessBlockRequests(BlockList_t& blks, bool coalesce = false);
+   void   ProcessBlockRequestGroup(std::vector<Block*> &grp);
+   int    FillBlockRequestGaps(IO *io, BlockList_t& blks);
 
    void   RequestBlocksDirect(IO *io, ReadRequest *read_req, std::vector<XrdOucIOVec>& ioVec, int expected_size);
 
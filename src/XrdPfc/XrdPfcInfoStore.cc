@@ -0,0 +1,521 @@
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include "XrdPfcInfoStore.hh"
+#include "XrdPfcInfo.hh"
+#include "XrdPfcTrace.hh"
+
+#include "XrdOss/XrdOss.hh"
+#include "XrdOuc/XrdOucCRC32C.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace XrdPfc;
+
+const char *InfoStore::m_traceID = "InfoStore";
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Minimal in-memory XrdOssDF so that Info::Read()/Write() can be used as-is
+// to (de)serialize cinfo images stored in the log.
+//------------------------------------------------------------------------------
+
+class MemDF : public XrdOssDF
+{
+public:
+   MemDF(const char *buf, size_t len) : XrdOssDF("", DF_isFile), m_rbuf(buf), m_rlen(len), m_wbuf(0) {}
+   MemDF(std::string &out)            : XrdOssDF("", DF_isFile), m_rbuf(0),   m_rlen(0),   m_wbuf(&out) {}
+
+   using XrdOssDF::Read;
+   using XrdOssDF::Write;
+
+   ssize_t Read(void *buffer, off_t offset, size_t size) override
+   {
+      if (offset < 0 || (size_t) offset >= m_rlen) return 0;
+      size_t n = std::min(size, m_rlen - (size_t) offset);
+      memcpy(buffer, m_rbuf + offset, n);
+      return n;
+   }
+
+   ssize_t Write(const void *buffer, off_t offset, size_t size) override
+   {
+      if ( ! m_wbuf) return -EBADF;
+      if (m_wbuf->size() < (size_t) offset + size) m_wbuf->resize(offset + size);
+      memcpy(&(*m_wbuf)[offset], buffer, size);
+      return size;
+   }
+
+   int Close(long long *retsz = 0) override { return 0; }
+
+private:
+   const char  *m_rbuf;
+   size_t       m_rlen;
+   std::string *m_wbuf;
+};
+
+const char      s_fileMagic[8] = { 'P', 'F', 'C', 'I', 'S', 'T', 'R', '\0' };
+const uint32_t  s_fileVersion  = 1;
+const uint32_t  s_recMagic     = 0x52636650; // "PfcR"
+const long long s_fileHdrSize  = 16;
+const long long s_growQuantum  = 1024 * 1024;
+
+inline long long align8(long long x) { return (x + 7) & ~7ll; }
+}
+
+struct InfoStore::RecHdr
+{
+   uint32_t m_magic;
+   uint32_t m_cksum;        //!< crc32c over lengths, lfn and payload
+   uint32_t m_lfn_len;
+   uint32_t m_payload_len;  //!< zero for a tombstone
+
+   long long total_size() const { return align8(sizeof(RecHdr) + m_lfn_len + m_payload_len); }
+   const char* lfn()      const { return (const char*) this + sizeof(RecHdr); }
+   const char* payload()  const { return lfn() + m_lfn_len; }
+
+   uint32_t calc_cksum() const
+   {
+      uint32_t cks = crc32c(0, &m_lfn_len, 2 * sizeof(uint32_t));
+      return crc32c(cks, lfn(), m_lfn_len + m_payload_len);
+   }
+};
+
+//------------------------------------------------------------------------------
+
+InfoStore::InfoStore(XrdSysTrace *trace) :
+   m_trace(trace),
+   m_fd(-1),
+   m_map(0),
+   m_map_size(0),
+   m_end(0),
+   m_dead_bytes(0),
+   m_compact_ratio(0.5),
+   m_sync(true),
+   m_compactions(0)
+{}
+
+InfoStore::~InfoStore()
+{
+   Close();
+}
+
+//------------------------------------------------------------------------------
+
+bool InfoStore::Open(const std::string &path, double compact_ratio, bool sync)
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   m_path          = path;
+   m_compact_ratio = compact_ratio;
+   m_sync          = sync;
+
+   m_fd = open(m_path.c_str(), O_RDWR | O_CREAT, 0600);
+   if (m_fd < 0)
+   {
+      TRACE(Error, "Open() failed opening " << m_path << ERRNO_AND_ERRSTR(errno));
+      return false;
+   }
+
+   struct stat st;
+   if (fstat(m_fd, &st))
+   {
+      TRACE(Error, "Open() failed stat of " << m_path << ERRNO_AND_ERRSTR(errno));
+      close(m_fd); m_fd = -1;
+      return false;
+   }
+
+   bool is_new = st.st_size < s_fileHdrSize;
+   long long size = is_new ? s_growQuantum : st.st_size;
+
+   if (is_new && ftruncate(m_fd, size))
+   {
+      TRACE(Error, "Open() failed sizing " << m_path << ERRNO_AND_ERRSTR(errno));
+      close(m_fd); m_fd = -1;
+      return false;
+   }
+
+   if ( ! map_file(size))
+   {
+      close(m_fd); m_fd = -1;
+      return false;
+   }
+
+   if (is_new)
+   {
+      memcpy(m_map, s_fileMagic, sizeof(s_fileMagic));
+      memcpy(m_map + sizeof(s_fileMagic), &s_fileVersion, sizeof(s_fileVersion));
+      sync_range(0, s_fileHdrSize);
+      m_end = s_fileHdrSize;
+      return true;
+   }
+
+   if (memcmp(m_map, s_fileMagic, sizeof(s_fileMagic)) ||
+       memcmp(m_map + sizeof(s_fileMagic), &s_fileVersion, sizeof(s_fileVersion)))
+   {
+      TRACE(Error, "Open() " << m_path << " is not a cinfo store or has unsupported version");
+      unmap_file();
+      close(m_fd); m_fd = -1;
+      return false;
+   }
+
+   return replay();
+}
+
+void InfoStore::Close()
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   if (m_map)
+   {
+      if (m_sync) msync(m_map, m_end, MS_SYNC);
+      unmap_file();
+   }
+   if (m_fd >= 0)
+   {
+      close(m_fd);
+      m_fd = -1;
+   }
+   m_index.clear();
+}
+
+//------------------------------------------------------------------------------
+
+bool InfoStore::map_file(long long size)
+{
+   void *p = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+   if (p == MAP_FAILED)
+   {
+      TRACE(Error, "map_file() mmap of " << m_path << " failed, size=" << size << ERRNO_AND_ERRSTR(errno));
+      return false;
+   }
+   m_map      = (char*) p;
+   m_map_size = size;
+   return true;
+}
+
+void InfoStore::unmap_file()
+{
+   munmap(m_map, m_map_size);
+   m_map      = 0;
+   m_map_size = 0;
+}
+
+bool InfoStore::ensure_capacity(long long need)
+{
+   if (m_end + need <= m_map_size) return true;
+
+   long long new_size = std::max(2 * m_map_size, m_end + need);
+   new_size = (new_size + s_growQuantum - 1) / s_growQuantum * s_growQuantum;
+
+   if (ftruncate(m_fd, new_size))
+   {
+      TRACE(Error, "ensure_capacity() failed extending " << m_path << " to " << new_size << ERRNO_AND_ERRSTR(errno));
+      return false;
+   }
+   unmap_file();
+   return map_file(new_size);
+}
+
+void InfoStore::sync_range(long long off, long long len)
+{
+   if ( ! m_sync) return;
+
+   static const long long pg = sysconf(_SC_PAGESIZE);
+   long long beg = off / pg * pg;
+   if (msync(m_map + beg, off + len - beg, MS_SYNC))
+   {
+      TRACE(Warning, "sync_range() msync failed" << ERRNO_AND_ERRSTR(errno));
+   }
+}
+
+//------------------------------------------------------------------------------
+
+bool InfoStore::replay()
+{
+   long long off = s_fileHdrSize;
+
+   while (off + (long long) sizeof(RecHdr) <= m_map_size)
+   {
+      const RecHdr *h = (const RecHdr*) (m_map + off);
+
+      if (h->m_magic != s_recMagic || off + h->total_size() > m_map_size ||
+          h->m_lfn_len == 0 || h->calc_cksum() != h->m_cksum)
+      {
+         break;
+      }
+
+      std::string lfn(h->lfn(), h->m_lfn_len);
+      auto it = m_index.find(lfn);
+      if (it != m_index.end())
+      {
+         m_dead_bytes += ((const RecHdr*) (m_map + it->second))->total_size();
+      }
+      if (h->m_payload_len == 0)
+      {
+         if (it != m_index.end()) m_index.erase(it);
+         m_dead_bytes += h->total_size();
+      }
+      else
+      {
+         m_index[lfn] = off;
+      }
+
+      off += h->total_size();
+   }
+
+   m_end = off;
+
+   // Clear a partially written record, if any, so it is not mistaken for a
+   // valid one once the following appends are in place.
+   if (m_end < m_map_size)
+   {
+      memset(m_map + m_end, 0, std::min((long long) sizeof(RecHdr), m_map_size - m_end));
+   }
+
+   TRACE(Info, "Open() " << m_path << " recovered " << m_index.size() << " records, log size "
+                         << m_end << ", dead bytes " << m_dead_bytes);
+   return true;
+}
+
+bool InfoStore::append(const std::string &lfn, const char *payload, uint32_t plen)
+{
+   long long rec_size = align8(sizeof(RecHdr) + lfn.size() + plen);
+
+   if ( ! ensure_capacity(rec_size + sizeof(RecHdr))) return false;
+
+   long long off = m_end;
+   RecHdr   *h   = (RecHdr*) (m_map + off);
+
+   h->m_lfn_len     = lfn.size();
+   h->m_payload_len = plen;
+   memcpy(m_map + off + sizeof(RecHdr), lfn.data(), lfn.size());
+   if (plen) memcpy(m_map + off + sizeof(RecHdr) + lfn.size(), payload, plen);
+   h->m_cksum = h->calc_cksum();
+   h->m_magic = s_recMagic;
+
+   // Zero the header slot after the record so replay stops there.
+   memset(m_map + off + rec_size, 0, sizeof(RecHdr));
+
+   sync_range(off, rec_size);
+
+   auto it = m_index.find(lfn);
+   if (it != m_index.end())
+   {
+      m_dead_bytes += ((const RecHdr*) (m_map + it->second))->total_size();
+   }
+   if (plen)
+   {
+      m_index[lfn] = off;
+   }
+   else
+   {
+      if (it != m_index.end()) m_index.erase(it);
+      m_dead_bytes += rec_size;
+   }
+
+   m_end += rec_size;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool InfoStore::Get(const std::string &lfn, Info &info)
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   auto it = m_index.find(lfn);
+   if (it == m_index.end()) return false;
+
+   const RecHdr *h = (const RecHdr*) (m_map + it->second);
+   MemDF df(h->payload(), h->m_payload_len);
+
+   return info.Read(&df, lfn.c_str());
+}
+
+bool InfoStore::Put(const std::string &lfn, Info &info)
+{
+   std::string img;
+   MemDF df(img);
+   if ( ! info.Write(&df, lfn.c_str()))
+      return false;
+
+   XrdSysMutexHelper _lck(m_mutex);
+
+   if ( ! m_map) return false;
+
+   if ( ! append(lfn, img.data(), img.size()))
+   {
+      // The previous record is out of date now, do not serve it again.
+      drop(lfn);
+      return false;
+   }
+
+   if (m_compact_ratio > 0 && m_dead_bytes > s_growQuantum && m_dead_bytes > m_compact_ratio * m_end)
+   {
+      _lck.UnLock();
+      Compact();
+   }
+   return true;
+}
+
+bool InfoStore::Remove(const std::string &lfn)
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   if ( ! m_map || m_index.find(lfn) == m_index.end()) return false;
+
+   if ( ! append(lfn, 0, 0))
+   {
+      // Forget the record anyway, the caller removed the files already.
+      drop(lfn);
+   }
+   return true;
+}
+
+void InfoStore::drop(const std::string &lfn)
+{
+   auto it = m_index.find(lfn);
+   if (it == m_index.end()) return;
+
+   if (m_map) m_dead_bytes += ((const RecHdr*) (m_map + it->second))->total_size();
+   m_index.erase(it);
+   TRACE(Warning, "drop() " << lfn << ", record could not be updated and is no longer used");
+}
+
+bool InfoStore::Contains(const std::string &lfn)
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   return m_index.find(lfn) != m_index.end();
+}
+
+//------------------------------------------------------------------------------
+
+bool InfoStore::Compact()
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   if ( ! m_map) return false;
+
+   std::string tmp_path = m_path + ".compact";
+
+   int fd = open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+   if (fd < 0)
+   {
+      TRACE(Error, "Compact() failed creating " << tmp_path << ERRNO_AND_ERRSTR(errno));
+      return false;
+   }
+
+   std::unordered_map<std::string, long long> new_index;
+   new_index.reserve(m_index.size());
+
+   char      hdr[s_fileHdrSize] = { 0 };
+   long long off = s_fileHdrSize;
+   bool      ok  = true;
+
+   memcpy(hdr, s_fileMagic, sizeof(s_fileMagic));
+   memcpy(hdr + sizeof(s_fileMagic), &s_fileVersion, sizeof(s_fileVersion));
+   ok = pwrite(fd, hdr, s_fileHdrSize, 0) == s_fileHdrSize;
+
+   for (auto it = m_index.begin(); ok && it != m_index.end(); ++it)
+   {
+      const RecHdr *h  = (const RecHdr*) (m_map + it->second);
+      long long     sz = h->total_size();
+      ok = pwrite(fd, h, sz, off) == sz;
+      new_index[it->first] = off;
+      off += sz;
+   }
+
+   long long new_size = std::max(s_growQuantum, (off + s_growQuantum) / s_growQuantum * s_growQuantum);
+
+   if ( ! ok || ftruncate(fd, new_size) || fsync(fd) || rename(tmp_path.c_str(), m_path.c_str()))
+   {
+      TRACE(Error, "Compact() failed writing " << tmp_path << ERRNO_AND_ERRSTR(errno));
+      close(fd);
+      unlink(tmp_path.c_str());
+      return false;
+   }
+
+   std::string dir = m_path.substr(0, m_path.rfind('/') + 1);
+   int dfd = open(dir.empty() ? "." : dir.c_str(), O_RDONLY);
+   if (dfd >= 0) { fsync(dfd); close(dfd); }
+
+   long long old_end = m_end;
+
+   unmap_file();
+   close(m_fd);
+   m_fd = fd;
+   if ( ! map_file(new_size))
+   {
+      close(m_fd); m_fd = -1;
+      m_index.clear();
+      return false;
+   }
+
+   m_index.swap(new_index);
+   m_end        = off;
+   m_dead_bytes = 0;
+   ++m_compactions;
+
+   TRACE(Info, "Compact() " << m_path << " reduced from " << old_end << " to " << m_end << " bytes, "
+                            << m_index.size() << " records");
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+void InfoStore::ForEach(std::function<void(const std::string &lfn, const char *buf, size_t len)> func)
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   for (auto &e : m_index)
+   {
+      const RecHdr *h = (const RecHdr*) (m_map + e.second);
+      func(e.first, h->payload(), h->m_payload_len);
+   }
+}
+
+void InfoStore::Inventory(std::vector<Entry> &entries)
+{
+   ForEach([&](const std::string &lfn, const char *buf, size_t len)
+   {
+      Info   info(m_trace, false);
+      MemDF  df(buf, len);
+      time_t atime;
+      if (info.Read(&df, lfn.c_str()) && info.GetLatestDetachTime(atime))
+         entries.push_back({ lfn, atime });
+   });
+}
+
+InfoStore::Stats InfoStore::GetStats()
+{
+   XrdSysMutexHelper _lck(m_mutex);
+
+   Stats s;
+   s.m_num_records = m_index.size();
+   s.m_log_size    = m_end;
+   s.m_dead_bytes  = m_dead_bytes;
+   s.m_map_size    = m_map_size;
+   s.m_compactions = m_compactions;
+   return s;
+}
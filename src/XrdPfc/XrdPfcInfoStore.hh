@@ -0,0 +1,152 @@
+#ifndef __XRDPFC_INFOSTORE_HH__
+#define __XRDPFC_INFOSTORE_HH__
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include "XrdSys/XrdSysPthread.hh"
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class XrdSysTrace;
+
+namespace XrdPfc
+{
+class Info;
+
+//----------------------------------------------------------------------------
+//! Consolidated store of cinfo records kept in a single memory-mapped
+//! append log. Each record holds the lfn of the data file and the cinfo
+//! image exactly as Info::Write() would put it into the .cinfo file.
+//!
+//! An in-memory index maps lfn to the offset of the latest record. Removal
+//! appends a tombstone. Every record carries a crc32c; on open, the log is
+//! replayed up to the first invalid record, so a torn append after a crash
+//! is simply dropped. When dead records exceed the configured fraction of
+//! the log, live records are rewritten into a new file that atomically
+//! replaces the old one.
+//----------------------------------------------------------------------------
+
+class InfoStore
+{
+public:
+   struct Stats
+   {
+      long long m_num_records = 0;  //!< number of live records
+      long long m_log_size    = 0;  //!< bytes used in the log, including header
+      long long m_dead_bytes  = 0;  //!< bytes taken by stale records and tombstones
+      long long m_map_size    = 0;  //!< size of the mapped file
+      int       m_compactions = 0;  //!< number of compactions since open
+   };
+
+   InfoStore(XrdSysTrace *trace);
+   ~InfoStore();
+
+   //---------------------------------------------------------------------
+   //! Open or create the store at the given path and build the index.
+   //! @param path           file name of the log
+   //! @param compact_ratio  fraction of dead bytes that triggers compaction
+   //! @param sync           msync appended records before returning
+   //! @return true on success
+   //---------------------------------------------------------------------
+   bool Open(const std::string &path, double compact_ratio, bool sync);
+
+   void Close();
+
+   //---------------------------------------------------------------------
+   //! Fill info from the latest record for lfn.
+   //! @return true if a valid record was found
+   //---------------------------------------------------------------------
+   bool Get(const std::string &lfn, Info &info);
+
+   //---------------------------------------------------------------------
+   //! Append the current state of info as the latest record for lfn.
+   //---------------------------------------------------------------------
+   bool Put(const std::string &lfn, Info &info);
+
+   //---------------------------------------------------------------------
+   //! Append a tombstone for lfn if it has a live record. The record is
+   //! forgotten even if the tombstone can not be written.
+   //! @return true if lfn had a live record
+   //---------------------------------------------------------------------
+   bool Remove(const std::string &lfn);
+
+   bool Contains(const std::string &lfn);
+
+   //---------------------------------------------------------------------
+   //! Rewrite live records into a fresh log.
+   //---------------------------------------------------------------------
+   bool Compact();
+
+   //---------------------------------------------------------------------
+   //! Call func for every live record, with the raw cinfo image. The store
+   //! is locked for the duration of the call.
+   //---------------------------------------------------------------------
+   void ForEach(std::function<void(const std::string &lfn, const char *buf, size_t len)> func);
+
+   struct Entry
+   {
+      std::string m_lfn;
+      time_t      m_atime;  //!< latest access, as the mtime of the cinfo file would be
+   };
+
+   //---------------------------------------------------------------------
+   //! Collect the lfn and the latest access time of every live record.
+   //! Used instead of the namespace traversal for purge and startup scan.
+   //---------------------------------------------------------------------
+   void Inventory(std::vector<Entry> &entries);
+
+   Stats GetStats();
+
+   XrdSysTrace* GetTrace() const { return m_trace; }
+
+   static const char *m_traceID;
+
+private:
+   struct RecHdr;
+
+   bool   map_file(long long size);
+   void   unmap_file();
+   bool   ensure_capacity(long long need);
+   bool   append(const std::string &lfn, const char *payload, uint32_t plen);
+   void   drop(const std::string &lfn);
+   bool   replay();
+   void   sync_range(long long off, long long len);
+
+   XrdSysTrace *m_trace;
+   XrdSysMutex  m_mutex;
+
+   std::string  m_path;
+   int          m_fd;
+   char        *m_map;
+   long long    m_map_size;
+   long long    m_end;            //!< offset of the first free byte in the log
+   long long    m_dead_bytes;
+   double       m_compact_ratio;
+   bool         m_sync;
+   int          m_compactions;
+
+   std::unordered_map<std::string, long long> m_index;  //!< lfn -> record offset
+};
+
+}
+
+#endif
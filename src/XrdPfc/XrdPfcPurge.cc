@@ -2,6 +2,7 @@
 #include "XrdPfcDirStatePurgeshot.hh"
 #include "XrdPfcResourceMonitor.hh"
 #include "XrdPfcFPurgeState.hh"
+#include "XrdPfcInfoStore.hh"
 #include "XrdPfcPurgePin.hh"
 #include "XrdPfcTrace.hh"
 
@@ -36,6 +37,7 @@ long long UnlinkPurgeStateFilesInMap(FPurgeState& purgeState, long long bytes_to
    const auto &cache = Cache::TheOne();
    auto &resmon = Cache::ResMon();
    auto &oss = *cache.GetOss();
+   auto *info_store = cache.GetInfoStore();
 
    TRACE(Info, trc_pfx << "Started, root_path = " << root_path << ", bytes_to_remove = " << bytes_to_remove);
 
@@ -60,8 +62,12 @@ long long UnlinkPurgeStateFilesInMap(FPurgeState& purgeState, long long bytes_to
          continue;
       }
 
-      // remove info file
-      if (oss.Stat(infoPath.c_str(), &fstat) == XrdOssOK)
+      // remove info file, with the cinfo store there is only the record
+      if (info_store)
+      {
+         TRACE(Dump, trc_pfx << "Removing cinfo store record of '" << dataPath << "'");
+      }
+      else if (oss.Stat(infoPath.c_str(), &fstat) == XrdOssOK)
       {
          oss.Unlink(infoPath.c_str());
          TRACE(Dump, trc_pfx << "Removed file: '" << infoPath << "' size: " << 512ll * fstat.st_size);
@@ -70,6 +76,7 @@ long long UnlinkPurgeStateFilesInMap(FPurgeState& purgeState, long long bytes_to
       {
          TRACE(Error, trc_pfx << "Can't locate file " << dataPath);
       }
+      cache.ForgetFile(dataPath);
 
       // remove data file
       if (oss.Stat(dataPath.c_str(), &fstat) == XrdOssOK)
@@ -83,6 +90,11 @@ long long UnlinkPurgeStateFilesInMap(FPurgeState& purgeState, long long bytes_to
 
          resmon.register_file_purge(dataPath, it->second.nStBlocks);
       }
+      else if (resmon.has_purge_index())
+      {
+         // Removed since it was selected, make sure it does not stay in the purge index.
+         resmon.register_purge_index_drop(dataPath, time(0));
+      }
    }
    if (protected_cnt > 0)
    {
@@ -96,7 +108,7 @@ long long UnlinkPurgeStateFilesInMap(FPurgeState& purgeState, long long bytes_to
 
 // -------------------------------------------------------------------------------------
 
-void OldStylePurgeDriver(DataFsPurgeshot &ps)
+void OldStylePurgeDriver(DataFsPurgeshot &ps, const std::vector<PurgeIndex::Candidate> *index_candidates)
 {
    static const char *trc_pfx = "OldStylePurgeDriver ";
    const auto &cache = Cache::TheOne();
@@ -159,15 +171,35 @@ void OldStylePurgeDriver(DataFsPurgeshot &ps)
          purgeState.setUVKeepMinTime(time(0) - conf.m_cs_UVKeep);
       }
 
-      // Make a map of file paths, sorted by access time.
-      bool scan_ok = purgeState.TraverseNamespace("/");
-      if (!scan_ok)
+      if (index_candidates)
       {
-         TRACE(Error, trc_pfx << "default purge namespace traversal failed at top-directory, this should not happen.");
-         return;
+         // Candidates were selected from the purge index by the ResourceMonitor.
+         purgeState.AddCandidates(*index_candidates);
+         TRACE(Debug, trc_pfx << "default purge using " << index_candidates->size() << " candidates from purge index.");
       }
+      else
+      {
+         // Make a map of file paths, sorted by access time.
+         // With the purge index, this is the cross-check and all files found are
+         // passed on for reconciliation of the index.
+         auto &resmon = Cache::ResMon();
+         std::vector<PurgeIndex::Candidate> index_files;
+         time_t scan_start = time(0);
+         if (resmon.has_purge_index())
+            purgeState.setIndexFiles(&index_files);
+
+         bool scan_ok = purgeState.TraverseNamespace("/");
+         if (!scan_ok)
+         {
+            TRACE(Error, trc_pfx << "default purge namespace traversal failed at top-directory, this should not happen.");
+            return;
+         }
+         if (resmon.has_purge_index())
+            resmon.register_purge_index_reconcile(index_files, scan_start);
 
-      TRACE(Debug, trc_pfx << "default purge usage measured from cinfo files " << purgeState.getNBytesTotal() << " bytes.");
+         TRACE(Info, trc_pfx << "default purge usage measured from cinfo files " << purgeState.getNBytesTotal()
+                     << " bytes, accounted file usage " << ps.m_file_usage << " bytes.");
+      }
 
       purgeState.MoveListEntriesToMap();
       default_purge_blocks_removed = UnlinkPurgeStateFilesInMap(purgeState, bytes_to_remove, "/");
@@ -0,0 +1,207 @@
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include "XrdPfcPurgeIndex.hh"
+
+using namespace XrdPfc;
+
+namespace
+{
+   std::string dir_of(const std::string &lfn)
+   {
+      return lfn.substr(0, lfn.rfind('/') + 1);
+   }
+}
+
+void PurgeIndex::set_time(std::unordered_map<std::string, Entry>::iterator i, time_t atime)
+{
+   // Keys of the unordered_map are node-based and do not move, the time
+   // map can thus refer to them by pointer.
+   if (i->second.m_time_pos != m_by_time.end())
+   {
+      if (i->second.m_time_pos->first == atime)
+         return;
+      m_by_time.erase(i->second.m_time_pos);
+   }
+   i->second.m_time_pos = m_by_time.insert(std::make_pair(atime, &i->first));
+}
+
+void PurgeIndex::add_to_dir(const std::string &lfn)
+{
+   m_by_dir[dir_of(lfn)].insert(&lfn);
+}
+
+void PurgeIndex::remove_from_dir(const std::string &lfn)
+{
+   auto d = m_by_dir.find(dir_of(lfn));
+   if (d == m_by_dir.end())
+      return;
+   d->second.erase(&lfn);
+   if (d->second.empty())
+      m_by_dir.erase(d);
+}
+
+std::unordered_map<std::string, PurgeIndex::Entry>::iterator
+PurgeIndex::erase(std::unordered_map<std::string, Entry>::iterator i)
+{
+   m_n_st_blocks -= i->second.m_st_blocks;
+   m_by_time.erase(i->second.m_time_pos);
+   remove_from_dir(i->first);
+   return m_files.erase(i);
+}
+
+void PurgeIndex::Insert(const std::string &lfn, time_t atime, long long st_blocks)
+{
+   auto ins = m_files.insert(std::make_pair(lfn, Entry{ 0, m_by_time.end() }));
+   auto i   = ins.first;
+   if (ins.second)
+      add_to_dir(i->first);
+
+   m_n_st_blocks += st_blocks - i->second.m_st_blocks;
+   i->second.m_st_blocks = st_blocks;
+   set_time(i, atime);
+}
+
+void PurgeIndex::Touch(const std::string &lfn, time_t atime)
+{
+   auto ins = m_files.insert(std::make_pair(lfn, Entry{ 0, m_by_time.end() }));
+   auto i   = ins.first;
+   if (ins.second)
+      add_to_dir(i->first);
+
+   if (ins.second || i->second.m_time_pos->first < atime)
+      set_time(i, atime);
+}
+
+void PurgeIndex::AddBlocks(const std::string &lfn, long long st_blocks)
+{
+   auto i = m_files.find(lfn);
+   if (i == m_files.end())
+      return;
+
+   i->second.m_st_blocks += st_blocks;
+   m_n_st_blocks         += st_blocks;
+}
+
+bool PurgeIndex::Remove(const std::string &lfn)
+{
+   auto i = m_files.find(lfn);
+   if (i == m_files.end())
+      return false;
+
+   erase(i);
+   return true;
+}
+
+bool PurgeIndex::RemoveIfNotAccessedSince(const std::string &lfn, time_t t)
+{
+   auto i = m_files.find(lfn);
+   if (i == m_files.end() || i->second.m_time_pos->first > t)
+      return false;
+
+   return Remove(lfn);
+}
+
+void PurgeIndex::Clear()
+{
+   m_by_time.clear();
+   m_by_dir.clear();
+   m_files.clear();
+   m_n_st_blocks = 0;
+}
+
+void PurgeIndex::ListDir(const std::string &dir, std::vector<std::string> &out) const
+{
+   std::string pfx = dir;
+   if (pfx.empty() || pfx.back() != '/')
+      pfx += '/';
+
+   auto d = m_by_dir.find(pfx);
+   if (d == m_by_dir.end())
+      return;
+
+   out.reserve(out.size() + d->second.size());
+   for (auto *lfn : d->second)
+      out.push_back(*lfn);
+}
+
+int PurgeIndex::Reconcile(const std::vector<Candidate> &files, time_t scan_start)
+{
+   int n_changed = 0;
+   std::unordered_set<const std::string*> seen;
+   seen.reserve(files.size());
+
+   for (auto &c : files)
+   {
+      auto ins = m_files.insert(std::make_pair(c.m_lfn, Entry{ 0, m_by_time.end() }));
+      auto i   = ins.first;
+      seen.insert(&i->first);
+      if (ins.second)
+      {
+         add_to_dir(i->first);
+         m_n_st_blocks += c.m_st_blocks;
+         i->second.m_st_blocks = c.m_st_blocks;
+         set_time(i, c.m_atime);
+         ++n_changed;
+      }
+      else if (i->second.m_time_pos->first < scan_start && i->second.m_st_blocks != c.m_st_blocks)
+      {
+         m_n_st_blocks += c.m_st_blocks - i->second.m_st_blocks;
+         i->second.m_st_blocks = c.m_st_blocks;
+         ++n_changed;
+      }
+   }
+
+   for (auto i = m_files.begin(); i != m_files.end(); )
+   {
+      if (i->second.m_time_pos->first < scan_start && seen.find(&i->first) == seen.end())
+      {
+         i = erase(i);
+         ++n_changed;
+      }
+      else
+      {
+         ++i;
+      }
+   }
+
+   return n_changed;
+}
+
+//------------------------------------------------------------------------------
+
+long long PurgeIndex::Collect(long long st_blocks_req, time_t cold_time, std::vector<Candidate> &out) const
+{
+   long long accum = 0;
+
+   for (auto i = m_by_time.begin(); i != m_by_time.end(); ++i)
+   {
+      if (accum >= st_blocks_req && i->first >= cold_time)
+         break;
+
+      const std::string &lfn = *i->second;
+      auto f = m_files.find(lfn);
+      if (f == m_files.end())
+         continue;
+      long long blocks = f->second.m_st_blocks;
+
+      out.push_back({ lfn, blocks, i->first });
+      accum += blocks;
+   }
+
+   return accum;
+}
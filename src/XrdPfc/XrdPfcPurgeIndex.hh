@@ -0,0 +1,110 @@
+#ifndef __XRDPFC_PURGEINDEX_HH__
+#define __XRDPFC_PURGEINDEX_HH__
+//----------------------------------------------------------------------------------
+// Copyright (c) 2026 by Board of Trustees of the Leland Stanford, Jr., University
+//----------------------------------------------------------------------------------
+// XRootD is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// XRootD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with XRootD.  If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------------
+
+#include <ctime>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace XrdPfc
+{
+
+//----------------------------------------------------------------------------
+//! Eviction index of all cached files, ordered by last access time.
+//! Populated by the initial scan and kept up to date from the file open,
+//! update-stats, close and purge records processed by the ResourceMonitor,
+//! so that purge candidates can be selected without a namespace traversal.
+//! Not thread-safe, only used from the ResourceMonitor heart-beat thread.
+//----------------------------------------------------------------------------
+
+class PurgeIndex
+{
+public:
+   struct Candidate
+   {
+      std::string m_lfn;
+      long long   m_st_blocks;
+      time_t      m_atime;
+   };
+
+   //! Insert a file or reset its access time and usage.
+   void Insert(const std::string &lfn, time_t atime, long long st_blocks);
+
+   //! Record an access, inserting the file with no usage if it is not known.
+   void Touch(const std::string &lfn, time_t atime);
+
+   //! Account for blocks written to a file already in the index.
+   void AddBlocks(const std::string &lfn, long long st_blocks);
+
+   bool Remove(const std::string &lfn);
+
+   //! Remove a file found missing at time t unless it was accessed since.
+   bool RemoveIfNotAccessedSince(const std::string &lfn, time_t t);
+
+   void Clear();
+
+   //! List files indexed directly in directory dir, looking only at that
+   //! directory's bucket.
+   void ListDir(const std::string &dir, std::vector<std::string> &out) const;
+
+   //---------------------------------------------------------------------
+   //! Bring the index in line with the files found by a namespace
+   //! traversal started at scan_start. Entries not accessed since then are
+   //! dropped if not found and get their usage from the traversal.
+   //! Returns the number of entries added, dropped or resized.
+   //---------------------------------------------------------------------
+   int Reconcile(const std::vector<Candidate> &files, time_t scan_start);
+
+   int       GetNFiles()    const { return (int) m_files.size(); }
+   long long GetNStBlocks() const { return m_n_st_blocks; }
+
+   //---------------------------------------------------------------------
+   //! Select purge candidates, oldest first: all files last accessed
+   //! before cold_time and then further files until their usage reaches
+   //! st_blocks_req. Returns the usage of the selected files.
+   //---------------------------------------------------------------------
+   long long Collect(long long st_blocks_req, time_t cold_time, std::vector<Candidate> &out) const;
+
+private:
+   using time_map_t = std::multimap<time_t, const std::string*>;
+   using dir_map_t  = std::unordered_map<std::string, std::unordered_set<const std::string*>>;
+
+   struct Entry
+   {
+      long long            m_st_blocks;
+      time_map_t::iterator m_time_pos;
+   };
+
+   std::unordered_map<std::string, Entry> m_files;
+   time_map_t                             m_by_time;
+   dir_map_t                              m_by_dir;  // dir path with trailing '/' -> files in it
+   long long                              m_n_st_blocks = 0;
+
+   void set_time(std::unordered_map<std::string, Entry>::iterator i, time_t atime);
+   void add_to_dir(const std::string &lfn);
+   void remove_from_dir(const std::string &lfn);
+   std::unordered_map<std::string, Entry>::iterator
+        erase(std::unordered_map<std::string, Entry>::iterator i);
+};
+
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include "XrdPfcDirStatePurgeshot.hh"
 #include "XrdPfcTrace.hh"
 #include "XrdPfcPurgePin.hh"
+#include "XrdPfcAdmission.hh"
 
 #include "XrdOss/XrdOss.hh"
 
@@ -36,6 +37,7 @@ ResourceMonitor::ResourceMonitor(XrdOss& oss) :
 
 ResourceMonitor::~ResourceMonitor()
 {
+   delete m_purge_index;
    delete &m_fs_state;
 }
 
@@ -96,6 +98,18 @@ void ResourceMonitor::cross_check_or_process_oob_lfn(const std::string &lfn, FsT
    size_t pos = lfn.find_last_of("/");
    std::string dir = (pos == std::string::npos) ? "" : lfn.substr(0, pos);
 
+   if (Cache::GetInstance().GetInfoStore())
+   {
+      auto it = m_store_dirs.find(dir);
+      if (it != m_store_dirs.end())
+      {
+         scan_store_dir(ds, it->second);
+         m_store_dirs.erase(it);
+      }
+      ds->m_scanned = true;
+      return;
+   }
+
    XrdOssDF *dhp = m_oss.newDir(trc_pfx);
    if (dhp->Opendir(dir.c_str(), fst.default_env()) == XrdOssOK)
    {
@@ -108,6 +122,8 @@ void ResourceMonitor::cross_check_or_process_oob_lfn(const std::string &lfn, FsT
          if (it->second.has_data && it->second.has_cinfo) {
             here.m_StBlocks += it->second.stat_data.st_blocks;
             here.m_NFiles   += 1;
+            if (m_purge_index)
+               m_purge_index->Insert(dir + "/" + it->first, it->second.stat_cinfo.st_mtime, it->second.stat_data.st_blocks);
          }
       }
    }
@@ -140,6 +156,8 @@ void ResourceMonitor::scan_dir_and_recurse(FsTraversal &fst)
          if (it->second.has_data && it->second.has_cinfo) {
             here.m_StBlocks += it->second.stat_data.st_blocks;
             here.m_NFiles   += 1;
+            if (m_purge_index)
+               m_purge_index->Insert(fst.m_current_path + it->first, it->second.stat_cinfo.st_mtime, it->second.stat_data.st_blocks);
          }
       }
       fst.m_dir_state->m_scanned = true;
@@ -168,6 +186,64 @@ void ResourceMonitor::scan_dir_and_recurse(FsTraversal &fst)
    }
 }
 
+void ResourceMonitor::scan_store_dir(DirState *ds, const std::vector<InfoStore::Entry> &entries)
+{
+   // Counterpart of the per-directory part of scan_dir_and_recurse(), only the data
+   // files of the store records are stat-ed. Records without a data file are dropped.
+   DirUsage &here = ds->m_here_usage;
+   for (auto &e : entries)
+   {
+      struct stat fstat;
+      if (m_oss.Stat(e.m_lfn.c_str(), &fstat) != XrdOssOK)
+      {
+         TRACE(Info, "scan_store_dir() dropping record of missing data file " << e.m_lfn);
+         Cache::GetInstance().ForgetFile(e.m_lfn);
+         continue;
+      }
+      here.m_StBlocks += fstat.st_blocks;
+      here.m_NFiles   += 1;
+      if (m_purge_index)
+         m_purge_index->Insert(e.m_lfn, e.m_atime, fstat.st_blocks);
+   }
+}
+
+bool ResourceMonitor::perform_initial_store_scan(InfoStore &store)
+{
+   std::vector<InfoStore::Entry> entries;
+   store.Inventory(entries);
+
+   for (auto &e : entries)
+   {
+      if (e.m_lfn.compare(0, 11, "/pfc-stats/") == 0)
+         continue;
+      size_t pos = e.m_lfn.find_last_of("/");
+      m_store_dirs[e.m_lfn.substr(0, pos)].push_back(std::move(e));
+   }
+   TRACE(Info, "perform_initial_store_scan() " << entries.size() << " cinfo store records in "
+               << m_store_dirs.size() << " directories");
+
+   // Directories get removed from the map when processed out of band.
+   FsTraversal fst(m_oss);
+   while ( ! m_store_dirs.empty())
+   {
+      auto it = m_store_dirs.begin();
+      DirState *ds = m_fs_state.find_dirstate_for_lfn(it->second.front().m_lfn);
+      if ( ! ds->m_scanned)
+      {
+         scan_store_dir(ds, it->second);
+         ds->m_scanned = true;
+      }
+      m_store_dirs.erase(it);
+
+      if (++m_dir_scan_check_counter >= 100)
+      {
+         process_inter_dir_scan_open_requests(fst);
+         m_dir_scan_check_counter = 0;
+      }
+   }
+   return true;
+}
+
 bool ResourceMonitor::perform_initial_scan()
 {
    // Called after PFC configuration is complete, but before full startup of the daemon.
@@ -175,20 +251,32 @@ bool ResourceMonitor::perform_initial_scan()
 
    update_vs_and_file_usage_info();
 
-   DirState   *root_ds = m_fs_state.get_root();
-   FsTraversal fst(m_oss);
-   fst.m_protected_top_dirs.insert("pfc-stats"); // XXXX This should come from config. Also: N2N?
+   if (Cache::Conf().m_purgeIndex)
+      m_purge_index = new PurgeIndex;
 
-   if ( ! fst.begin_traversal(root_ds, "/"))
-      return false;
+   DirState   *root_ds = m_fs_state.get_root();
 
    // The following are initialized in ResourceMonitor.hh to avoid a race at startup:
    //   m_dir_scan_in_progress = true;
    //   m_dir_scan_check_counter = 0;
 
-   scan_dir_and_recurse(fst);
+   if (InfoStore *store = Cache::GetInstance().GetInfoStore())
+   {
+      // With the cinfo store, the files are known from its records.
+      perform_initial_store_scan(*store);
+   }
+   else
+   {
+      FsTraversal fst(m_oss);
+      fst.m_protected_top_dirs.insert("pfc-stats"); // XXXX This should come from config. Also: N2N?
+
+      if ( ! fst.begin_traversal(root_ds, "/"))
+         return false;
 
-   fst.end_traversal();
+      scan_dir_and_recurse(fst);
+
+      fst.end_traversal();
+   }
 
    // We have all directories scanned, available in DirState tree, let all remaining files go
    // and then we shall do the upward propagation of usages.
@@ -233,6 +321,8 @@ int ResourceMonitor::process_queues()
    // of files in a directory and do not deal with any persistent file id tokens.
 
    int n_records = 0;
+   std::vector<PurgeIndex::Candidate> reconcile_files;
+   time_t reconcile_time;
    {
       XrdSysMutexHelper _lock(&m_queue_mutex);
       n_records += m_file_open_q.swap_queues();
@@ -241,9 +331,24 @@ int ResourceMonitor::process_queues()
       n_records += m_file_purge_q1.swap_queues();
       n_records += m_file_purge_q2.swap_queues();
       n_records += m_file_purge_q3.swap_queues();
+      n_records += m_index_drop_q.swap_queues();
+      reconcile_files.swap(m_index_reconcile_files);
+      reconcile_time = m_index_reconcile_time;
+      m_index_reconcile_time = 0;
       ++m_queue_swap_u1;
    }
 
+   // The cross-check traversal is handed over before its purge records are
+   // queued, so files purged right after it are removed again below.
+   if (m_purge_index && reconcile_time > 0)
+   {
+      int n_files_before = m_purge_index->GetNFiles();
+      int n_changed = m_purge_index->Reconcile(reconcile_files, reconcile_time);
+      TRACE(Info, trc_pfx << "purge index reconciled with namespace traversal, n_files=" << reconcile_files.size()
+            << ", index n_files " << n_files_before << " -> " << m_purge_index->GetNFiles()
+            << ", entries changed " << n_changed);
+   }
+
    for (auto &i : m_file_open_q.read_queue())
    {
       // i.id: LFN, i.record: OpenRecord
@@ -270,6 +375,9 @@ int ResourceMonitor::process_queues()
       }
 
       ds->m_here_usage.m_LastOpenTime = i.record.m_open_time;
+
+      if (m_purge_index)
+         m_purge_index->Touch(at.m_filename, i.record.m_open_time);
    }
 
    for (auto &i : m_file_update_stats_q.read_queue())
@@ -283,6 +391,9 @@ int ResourceMonitor::process_queues()
 
       ds->m_here_stats.AddUp(i.record);
       m_current_usage_in_st_blocks += i.record.m_StBlocksAdded;
+
+      if (m_purge_index)
+         m_purge_index->AddBlocks(at.m_filename, i.record.m_StBlocksAdded);
    }
 
    for (auto &i : m_file_close_q.read_queue())
@@ -296,6 +407,9 @@ int ResourceMonitor::process_queues()
       ds->m_here_stats.m_NFilesClosed += 1;
       ds->m_here_usage.m_LastCloseTime = i.record.m_close_time;
 
+      if (m_purge_index)
+         m_purge_index->Touch(at.m_filename, i.record.m_close_time);
+
       at.clear();
    }
    { // Release the AccessToken slots under lock.
@@ -311,6 +425,13 @@ int ResourceMonitor::process_queues()
       ds->m_here_stats.m_StBlocksRemoved += i.record.m_size_in_st_blocks;
       ds->m_here_stats.m_NFilesRemoved   += i.record.m_n_files;
       m_current_usage_in_st_blocks       -= i.record.m_size_in_st_blocks;
+
+      if (m_purge_index)
+      {
+         std::string dir;
+         ds->generate_dir_path(dir);
+         purge_index_check_dir(dir, i.record.m_n_files);
+      }
    }
    for (auto &i : m_file_purge_q2.read_queue())
    {
@@ -324,6 +445,9 @@ int ResourceMonitor::process_queues()
       ds->m_here_stats.m_StBlocksRemoved += i.record.m_size_in_st_blocks;
       ds->m_here_stats.m_NFilesRemoved   += i.record.m_n_files;
       m_current_usage_in_st_blocks       -= i.record.m_size_in_st_blocks;
+
+      if (m_purge_index)
+         purge_index_check_dir(i.id, i.record.m_n_files);
    }
    for (auto &i : m_file_purge_q3.read_queue())
    {
@@ -336,6 +460,15 @@ int ResourceMonitor::process_queues()
       ds->m_here_stats.m_StBlocksRemoved += i.record;
       ds->m_here_stats.m_NFilesRemoved   += 1;
       m_current_usage_in_st_blocks       -= i.record;
+
+      if (m_purge_index)
+         m_purge_index->Remove(i.id);
+   }
+   for (auto &i : m_index_drop_q.read_queue())
+   {
+      // i.id: LFN, i.record: time the file was found missing
+      if (m_purge_index)
+         m_purge_index->RemoveIfNotAccessedSince(i.id, i.record);
    }
 
    // Read queues / vectors are cleared at swap time.
@@ -344,6 +477,29 @@ int ResourceMonitor::process_queues()
    return n_records;
 }
 
+//------------------------------------------------------------------------------
+//! Multi-file purge records do not say which files were removed. Drop the
+//! purge index entries of the directory whose data files are gone, stopping
+//! once n_files of them have been found.
+//------------------------------------------------------------------------------
+void ResourceMonitor::purge_index_check_dir(const std::string &dir, int n_files)
+{
+   std::vector<std::string> files;
+   m_purge_index->ListDir(dir, files);
+
+   struct stat fstat;
+   for (auto &lfn : files)
+   {
+      if (n_files <= 0)
+         break;
+      if (m_oss.Stat(lfn.c_str(), &fstat) != XrdOssOK)
+      {
+         m_purge_index->Remove(lfn);
+         --n_files;
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
 // Heart beat
 //------------------------------------------------------------------------------
@@ -473,6 +629,11 @@ void ResourceMonitor::heart_beat()
       {
          perform_purge_check(do_purge_cold_files, do_purge_report ? TRACE_Info : TRACE_Debug);
 
+         if (do_purge_report && Cache::TheOne().GetAdmission())
+         {
+            Cache::TheOne().GetAdmission()->Report(Cache::GetInstance().GetGStream());
+         }
+
          next_purge_check_time = now + s_purge_check_interval;
          if (do_purge_report) next_purge_report_time = now + s_purge_report_interval;
          if (do_purge_cold_files) next_purge_cold_files_time = now + s_purge_cold_files_interval;
@@ -757,36 +918,64 @@ void ResourceMonitor::perform_purge_check(bool purge_cold_files, int tl)
    ps.m_dir_vec.emplace_back( DirPurgeElement(root_ds, root_ds.m_here_usage, root_ds.m_recursive_subdir_usage, -1) );
    fill_pshot_vec_children(root_ds, 0, ps.m_dir_vec, 9999);
 
+   // With the purge index, candidates are selected here, oldest first, and the
+   // purge task does not need to traverse the namespace. Every
+   // m_purgeIndexCrossCheck-th purge still does the full traversal and compares
+   // the measured usage with the one in the index, which is then reconciled
+   // with the files found, see process_queues().
+   std::unique_ptr<std::vector<PurgeIndex::Candidate>> icp;
+   if (m_purge_index && ++m_purge_index_cycle < conf.m_purgeIndexCrossCheck)
+   {
+      icp.reset(new std::vector<PurgeIndex::Candidate>);
+      time_t    cold_time = ps.m_age_based_purge ? time(0) - conf.m_purgeColdFilesAge : 0;
+      // Collect twice the required volume, as for the traversal, to leave room for
+      // purge-protected files and for reordering by the admission policy.
+      long long n_blocks  = m_purge_index->Collect(2 * (ps.m_bytes_to_remove >> 9), cold_time, *icp);
+      TRACE_INT(tl, trc_pfx << "purge index: n_files=" << m_purge_index->GetNFiles()
+                << ", usage=" << 512ll * m_purge_index->GetNStBlocks() << " B, selected "
+                << icp->size() << " candidates, " << 512ll * n_blocks << " B");
+   }
+   else if (m_purge_index)
+   {
+      m_purge_index_cycle = 0;
+      TRACE(Info, trc_pfx << "purge index: namespace cross-check scheduled, index n_files="
+            << m_purge_index->GetNFiles() << ", usage=" << 512ll * m_purge_index->GetNStBlocks()
+            << " B, file usage=" << ps.m_file_usage << " B");
+   }
+
    m_purge_task_active = true;
 
    struct PurgeDriverJob : public XrdJob
    {
-      DataFsPurgeshot  *m_purge_shot_ptr;
+      DataFsPurgeshot                      *m_purge_shot_ptr;
+      std::vector<PurgeIndex::Candidate>   *m_index_candidates;
 
-      PurgeDriverJob(DataFsPurgeshot *psp) :
+      PurgeDriverJob(DataFsPurgeshot *psp, std::vector<PurgeIndex::Candidate> *icp) :
          XrdJob("XrdPfc::ResourceMonitor::PurgeDriver"),
-         m_purge_shot_ptr(psp)
+         m_purge_shot_ptr(psp),
+         m_index_candidates(icp)
       {}
 
       void DoIt() override
       {
-         Cache::ResMon().perform_purge_task(*m_purge_shot_ptr);
+         Cache::ResMon().perform_purge_task(*m_purge_shot_ptr, m_index_candidates);
          Cache::ResMon().perform_purge_task_cleanup();
 
+         delete m_index_candidates;
          delete m_purge_shot_ptr;
          delete this;
       }
    };
 
-   Cache::schedP->Schedule( new PurgeDriverJob(psp.release()) );
+   Cache::schedP->Schedule( new PurgeDriverJob(psp.release(), icp.release()) );
 }
 
 namespace XrdPfc
 {
-   void OldStylePurgeDriver(DataFsPurgeshot &ps);
+   void OldStylePurgeDriver(DataFsPurgeshot &ps, const std::vector<PurgeIndex::Candidate> *index_candidates);
 }
 
-void ResourceMonitor::perform_purge_task(DataFsPurgeshot &ps)
+void ResourceMonitor::perform_purge_task(DataFsPurgeshot &ps, const std::vector<PurgeIndex::Candidate> *index_candidates)
 {
    // BEWARE: Runs in a dedicated thread - is only to communicate back to the
    // hear_beat() / data structs via the purge queues and condition variable.
@@ -803,7 +992,7 @@ void ResourceMonitor::perform_purge_task(DataFsPurgeshot &ps)
    // - usage of cinfo stat mtime for time of last access (touch already done at output);
    // - use DirState* to report back purged files.
    // Already changed to report back purged files --- but using the string / path variant.
-   OldStylePurgeDriver(ps); // In XrdPfcPurge.cc
+   OldStylePurgeDriver(ps, index_candidates); // In XrdPfcPurge.cc
 }
 
 void ResourceMonitor::perform_purge_task_cleanup()
@@ -860,6 +1049,7 @@ void ResourceMonitor::main_thread_function()
          m_file_purge_q1.shrink_read_queue();
          m_file_purge_q2.shrink_read_queue();
          m_file_purge_q3.shrink_read_queue();
+         m_index_drop_q.shrink_read_queue();
       }
    }
    heart_beat();
@@ -2,12 +2,15 @@
 #define __XRDPFC_RESOURCEMONITOR_HH__
 
 #include "XrdPfcStats.hh"
+#include "XrdPfcPurgeIndex.hh"
+#include "XrdPfcInfoStore.hh"
 
 #include "XrdSys/XrdSysPthread.hh"
 
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
 
 class XrdOss;
 
@@ -107,10 +110,18 @@ class ResourceMonitor
    Queue<DirState*,   PurgeRecord> m_file_purge_q1;
    Queue<std::string, PurgeRecord> m_file_purge_q2;
    Queue<std::string, long long>   m_file_purge_q3;
+   Queue<std::string, time_t>      m_index_drop_q;   // files found missing, to be dropped from the purge index
    // DirPurge queue -- not needed? But we do need last-change timestamp in DirState.
 
    long long    m_current_usage_in_st_blocks = 0;  // aggregate disk usage by files
 
+   // Eviction index, maintained from the queues when pfc.purgeindex is on.
+   PurgeIndex  *m_purge_index = nullptr;
+   int          m_purge_index_cycle = 0;  // purge tasks since the last namespace cross-check
+   // Files found by the cross-check traversal, handed over under m_queue_mutex.
+   std::vector<PurgeIndex::Candidate> m_index_reconcile_files;
+   time_t       m_index_reconcile_time = 0;   // start of the traversal, 0 if none pending
+
    XrdSysMutex  m_queue_mutex;        // mutex shared between queues
    unsigned int m_queue_swap_u1 = 0u; // identifier of current swap cycle
 
@@ -131,8 +142,14 @@ class ResourceMonitor
    int                      m_dir_scan_check_counter = 0;
    bool                     m_dir_scan_in_progress = true;
 
+   // With the cinfo store, the initial scan takes the files from the store
+   // records, grouped by directory.
+   std::map<std::string, std::vector<InfoStore::Entry>> m_store_dirs;
+
    void process_inter_dir_scan_open_requests(FsTraversal &fst);
    void cross_check_or_process_oob_lfn(const std::string &lfn, FsTraversal &fst);
+   void scan_store_dir(DirState *ds, const std::vector<InfoStore::Entry> &entries);
+   bool perform_initial_store_scan(InfoStore &store);
    long long get_file_usage_bytes_to_remove(const DataFsPurgeshot &ps, long long previous_file_usage, int logLeve);
 
 public:
@@ -206,6 +223,19 @@ public:
       m_file_purge_q3.push(filename, size_in_st_blocks);
    }
 
+   // Purge candidates that have already disappeared, or files left over in the
+   // purge index, are only dropped from the index.
+   bool has_purge_index() const { return m_purge_index != nullptr; }
+   void register_purge_index_drop(const std::string& filename, time_t found_missing_time) {
+      XrdSysMutexHelper _lock(&m_queue_mutex);
+      m_index_drop_q.push(filename, found_missing_time);
+   }
+   void register_purge_index_reconcile(std::vector<PurgeIndex::Candidate> &files, time_t scan_start) {
+      XrdSysMutexHelper _lock(&m_queue_mutex);
+      m_index_reconcile_files.swap(files);
+      m_index_reconcile_time = scan_start;
+   }
+
    // void register_dir_purge(DirState* target);
    // target assumed to be empty at this point, triggered by a file_purge removing the last file in it.
    // hmmh, this is actually tricky ... who will purge the dirs? we should now at export-to-vector time
@@ -219,6 +249,7 @@ public:
    // --- Actions
 
    int  process_queues();
+   void purge_index_check_dir(const std::string &dir, int n_files);
 
    void heart_beat();
 
@@ -255,7 +286,7 @@ public:
    void update_vs_and_file_usage_info();
    void perform_purge_check(bool purge_cold_files, int tl);
 
-   void perform_purge_task(DataFsPurgeshot &ps);
+   void perform_purge_task(DataFsPurgeshot &ps, const std::vector<PurgeIndex::Candidate> *index_candidates);
    void perform_purge_task_cleanup();
 };
 
@@ -18,9 +18,15 @@
 #include "TestEnv.hh"
 #include "GTestXrdHelpers.hh"
 #include "XrdCl/XrdClFile.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClConstants.hh"
+#include "XrdCl/XrdClMessageUtils.hh"
 #include "XrdSys/XrdSysPlatform.hh"
 
 #include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -458,6 +464,63 @@ TEST_F(LocalFileHandlerTest, WriteVTest)
   EXPECT_EQ( remove( targetURL.c_str() ), 0 );
 }
 
+TEST_F(LocalFileHandlerTest, ConcurrentIOTest)
+{
+  using namespace XrdCl;
+  std::string targetURL = m_tmpdir + "/lfilehandlertestfileconcurrent";
+  CreateTestFileFunc( targetURL, "" );
+
+  //----------------------------------------------------------------------------
+  // Many requests in flight at once, aligned so that the O_DIRECT descriptor
+  // is used where the file system supports it
+  //----------------------------------------------------------------------------
+  const uint32_t nbChunks  = 64;
+  const uint32_t chunkSize = 65536;
+  Env *env = DefaultEnv::GetEnv();
+  env->PutInt( "LocalODirect", 1 );
+
+  void *wrbuf = 0, *rdbuf = 0;
+  ASSERT_EQ( posix_memalign( &wrbuf, 4096, nbChunks * chunkSize ), 0 );
+  ASSERT_EQ( posix_memalign( &rdbuf, 4096, nbChunks * chunkSize ), 0 );
+  char *wr = reinterpret_cast<char*>( wrbuf );
+  char *rd = reinterpret_cast<char*>( rdbuf );
+  for( uint32_t i = 0; i < nbChunks * chunkSize; ++i )
+    wr[i] = char( i * 7 + i / chunkSize );
+  memset( rd, 0, nbChunks * chunkSize );
+
+  File file;
+  EXPECT_XRDST_OK( file.Open( targetURL, OpenFlags::Update ) );
+
+  std::vector<SyncResponseHandler> handlers( nbChunks );
+  for( uint32_t i = 0; i < nbChunks; ++i )
+    EXPECT_XRDST_OK( file.Write( i * chunkSize, chunkSize, wr + i * chunkSize,
+                                 &handlers[i] ) );
+  for( uint32_t i = 0; i < nbChunks; ++i )
+    EXPECT_XRDST_OK( MessageUtils::WaitForStatus( &handlers[i] ) );
+  EXPECT_XRDST_OK( file.Sync() );
+
+  std::vector<SyncResponseHandler> rdhandlers( nbChunks );
+  for( uint32_t i = 0; i < nbChunks; ++i )
+    EXPECT_XRDST_OK( file.Read( i * chunkSize, chunkSize, rd + i * chunkSize,
+                                &rdhandlers[i] ) );
+  for( uint32_t i = 0; i < nbChunks; ++i )
+  {
+    ChunkInfo *chunk = 0;
+    EXPECT_XRDST_OK( MessageUtils::WaitForResponse( &rdhandlers[i], chunk ) );
+    ASSERT_TRUE( chunk );
+    EXPECT_EQ( chunk->offset, uint64_t( i * chunkSize ) );
+    EXPECT_EQ( chunk->length, chunkSize );
+    delete chunk;
+  }
+  EXPECT_EQ( memcmp( wr, rd, nbChunks * chunkSize ), 0 );
+
+  EXPECT_XRDST_OK( file.Close() );
+  env->PutInt( "LocalODirect", DefaultLocalODirect );
+  free( wrbuf );
+  free( rdbuf );
+  EXPECT_EQ( remove( targetURL.c_str() ), 0 );
+}
+
 TEST_F(LocalFileHandlerTest, XAttrTest)
 {
   using namespace XrdCl;
@@ -28,6 +28,33 @@
 #include "XrdCl/XrdClTaskManager.hh"
 #include "XrdCl/XrdClSIDManager.hh"
 #include "XrdCl/XrdClPropertyList.hh"
+#include "XrdCl/XrdClInQueue.hh"
+#include "XrdCl/XrdClBuffer.hh"
+#include "XrdCl/XrdClRequestStats.hh"
+#include "XrdCl/XrdClCheckSumHelper.hh"
+#include "XrdCl/XrdClCheckSumPipeline.hh"
+#include "XrdCl/XrdClIoUring.hh"
+#include "XrdCl/XrdClPreWarm.hh"
+#include "XrdCl/XrdClReadAhead.hh"
+#include "XrdCl/XrdClReadCoalescer.hh"
+#include "XrdCl/XrdClFileStateHandler.hh"
+#include "XrdCl/XrdClXCpSrc.hh"
+#include "XrdCl/XrdClMessageUtils.hh"
+#include "XrdCl/XrdClURL.hh"
+#include "XrdCl/XrdClDefaultEnv.hh"
+#include "XrdCl/XrdClEnv.hh"
+#include "XProtocol/XProtocol.hh"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
 
 //------------------------------------------------------------------------------
 // Declaration
@@ -199,6 +226,179 @@ TEST(UtilsTest, SIDManagerTest)
   EXPECT_EQ( manager->NumberOfTimedOutSIDs(), 0u );
 }
 
+//------------------------------------------------------------------------------
+// SID manager concurrency test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, SIDManagerConcurrencyTest)
+{
+  using namespace XrdCl;
+  std::shared_ptr<SIDManager> manager = SIDMgrPool::Instance().GetSIDMgr( "root://fake:1095//dir/file" );
+
+  const int nThreads = 8;
+  const int nSIDs    = 512;
+  std::atomic<int> nDuplicates( 0 );
+  std::vector<std::atomic<uint8_t>> owned( 0x10000 );
+
+  auto worker = [&]()
+  {
+    std::vector<uint16_t> sids;
+    for( int round = 0; round < 20; ++round )
+    {
+      for( int i = 0; i < nSIDs; ++i )
+      {
+        uint8_t sid[2];
+        EXPECT_XRDST_OK( manager->AllocateSID( sid ) );
+        uint16_t s; memcpy( &s, sid, 2 );
+        if( owned[s].exchange( 1 ) ) ++nDuplicates;
+        sids.push_back( s );
+      }
+      for( uint16_t s : sids )
+      {
+        owned[s].store( 0 );
+        manager->ReleaseSID( reinterpret_cast<uint8_t*>( &s ) );
+      }
+      sids.clear();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for( int i = 0; i < nThreads; ++i )
+    threads.emplace_back( worker );
+  for( auto &t : threads )
+    t.join();
+
+  EXPECT_EQ( nDuplicates.load(), 0 );
+  EXPECT_EQ( manager->GetNumberOfAllocatedSIDs(), 0 );
+}
+
+//------------------------------------------------------------------------------
+// In-queue timeout test
+//------------------------------------------------------------------------------
+namespace
+{
+  class TimeoutHandler: public XrdCl::MsgHandler
+  {
+    public:
+      TimeoutHandler( uint16_t sid, time_t expires, bool remove ):
+        sid( sid ), expires( expires ), remove( remove ), timeouts( 0 ) { }
+
+      uint16_t Examine( std::shared_ptr<XrdCl::Message>& ) { return RemoveHandler; }
+      uint16_t InspectStatusRsp() { return 0; }
+      uint16_t GetSid() const { return sid; }
+      void OnStatusReady( const XrdCl::Message*, XrdCl::XRootDStatus ) { }
+      time_t GetExpiration() { return expires; }
+
+      uint8_t OnStreamEvent( StreamEvent event, XrdCl::XRootDStatus )
+      {
+        if( event != Timeout ) return 0;
+        ++timeouts;
+        return remove ? RemoveHandler : 0;
+      }
+
+      uint16_t sid;
+      time_t   expires;
+      bool     remove;
+      int      timeouts;
+  };
+}
+
+TEST(UtilsTest, InQueueTimeoutTest)
+{
+  using namespace XrdCl;
+  InQueue queue;
+  bool    rmMsg = false;
+
+  TimeoutHandler h1( 1, 1010, true );
+  TimeoutHandler h2( 300, 1020, true );
+  TimeoutHandler h3( 4000, 1010 + 512, true );
+  TimeoutHandler h4( 7, 1005, false );
+
+  queue.ReportTimeout( 1000 );
+  queue.AddMessageHandler( &h1, rmMsg );
+  queue.AddMessageHandler( &h2, rmMsg );
+  queue.AddMessageHandler( &h3, rmMsg );
+  queue.AddMessageHandler( &h4, rmMsg );
+  EXPECT_TRUE( queue.HasUnsetTimeout( &h1 ) );
+  queue.AssignTimeout( &h1 );
+  queue.AssignTimeout( &h2 );
+  queue.AssignTimeout( &h3 );
+  queue.AssignTimeout( &h4 );
+  EXPECT_FALSE( queue.HasUnsetTimeout( &h1 ) );
+
+  queue.ReportTimeout( 1010 );
+  EXPECT_EQ( h1.timeouts, 1 );
+  EXPECT_EQ( h2.timeouts, 0 );
+  EXPECT_EQ( h3.timeouts, 0 );
+  EXPECT_EQ( h4.timeouts, 1 );
+  EXPECT_FALSE( queue.HasUnsetTimeout( &h1 ) );
+
+  queue.RemoveMessageHandler( &h2 );
+  queue.ReportTimeout( 1100 );
+  EXPECT_EQ( h2.timeouts, 0 );
+  EXPECT_EQ( h3.timeouts, 0 );
+  EXPECT_EQ( h4.timeouts, 2 );
+
+  queue.ReportTimeout( 1600 );
+  EXPECT_EQ( h1.timeouts, 1 );
+  EXPECT_EQ( h3.timeouts, 1 );
+  EXPECT_EQ( h4.timeouts, 3 );
+}
+
+//------------------------------------------------------------------------------
+// Buffer cache test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, BufferCacheTest)
+{
+  using namespace XrdCl;
+
+  //----------------------------------------------------------------------------
+  // Growing a buffer keeps its content, also past the largest size class
+  //----------------------------------------------------------------------------
+  Buffer buffer( 10 );
+  memcpy( buffer.GetBuffer(), "0123456789", 10 );
+  buffer.ReAllocate( 100 );
+  buffer.ReAllocate( 5000 );
+  buffer.ReAllocate( 2000000 );
+  EXPECT_EQ( buffer.GetSize(), 2000000u );
+  EXPECT_EQ( memcmp( buffer.GetBuffer(), "0123456789", 10 ), 0 );
+  buffer.ReAllocate( 20 );
+  EXPECT_EQ( memcmp( buffer.GetBuffer(), "0123456789", 10 ), 0 );
+
+  //----------------------------------------------------------------------------
+  // Released memory can be freed with free()
+  //----------------------------------------------------------------------------
+  free( buffer.Release() );
+
+  //----------------------------------------------------------------------------
+  // Blocks allocated outside of the cache can be handed in and resized
+  //----------------------------------------------------------------------------
+  char *outside = (char *)malloc( 100 );
+  memcpy( outside, "0123456789", 10 );
+  buffer.Grab( outside, 100 );
+  buffer.ReAllocate( 90 );
+  buffer.ReAllocate( 3000 );
+  EXPECT_EQ( memcmp( buffer.GetBuffer(), "0123456789", 10 ), 0 );
+  buffer.Free();
+
+  //----------------------------------------------------------------------------
+  // Freed blocks are reused
+  //----------------------------------------------------------------------------
+  BufferCache::Stats before = BufferCache::GetStats();
+  std::thread worker( []()
+  {
+    for( int i = 0; i < 10000; ++i )
+    {
+      Buffer b( 24 + i % 1000 );
+      b.Zero();
+    }
+  } );
+  worker.join();
+  BufferCache::Stats after = BufferCache::GetStats();
+  EXPECT_EQ( after.allocs - before.allocs, 10000u );
+  EXPECT_GE( after.hits - before.hits, 9900u );
+  EXPECT_GT( after.cached, 0u );
+}
+
 //------------------------------------------------------------------------------
 // Property List test
 //------------------------------------------------------------------------------
@@ -250,3 +450,676 @@ TEST(UtilsTest, PropertyListTest)
   for( size_t i = 0; i < v1.size(); ++i )
     EXPECT_EQ( v1[i], v2[i] );
 }
+
+//------------------------------------------------------------------------------
+// Request statistics test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, RequestStatsTest)
+{
+  using namespace XrdCl;
+
+  //----------------------------------------------------------------------------
+  // Buckets are contiguous and a latency never exceeds its bucket's bound
+  //----------------------------------------------------------------------------
+  for( uint64_t lat = 0; lat < 100000; ++lat )
+  {
+    uint32_t b = RequestStats::Bucket( lat );
+    EXPECT_LE( lat, RequestStats::BucketBound( b ) );
+    if( b ) { EXPECT_GT( lat, RequestStats::BucketBound( b - 1 ) ); }
+  }
+
+  //----------------------------------------------------------------------------
+  // 90 fast reads, 10 slow ones (one of which failed) on sub-stream 1
+  //----------------------------------------------------------------------------
+  RequestStats::Reset();
+  for( int i = 0; i < 90; ++i )
+    RequestStats::Record( "statstest:1094", kXR_read, 1, 100, 48, 4104, false );
+  for( int i = 0; i < 10; ++i )
+    RequestStats::Record( "statstest:1094", kXR_read, 1, 10000, 48, 4104, i == 0 );
+  //----------------------------------------------------------------------------
+  // Wait answers only count as stalls
+  //----------------------------------------------------------------------------
+  for( int i = 0; i < 5; ++i )
+    RequestStats::Record( "statstest:1094", kXR_read, 1, 1000000, 0, 0, false,
+                          true, 3 );
+
+  std::vector<RequestStats::Entry> entries = RequestStats::GetSnapshot();
+  int found = 0;
+  for( auto &e : entries )
+  {
+    if( e.server != "statstest:1094" ) continue;
+    ++found;
+    EXPECT_TRUE( ( e.requestId == kXR_read && e.subStream == -1 ) ||
+                 ( e.requestId == 0 && e.subStream == 1 ) );
+    EXPECT_EQ( e.histogram.count, 100u );
+    EXPECT_EQ( e.histogram.errors, 1u );
+    EXPECT_EQ( e.histogram.stalls, 5u );
+    EXPECT_EQ( e.histogram.stallTime, 15u );
+    EXPECT_EQ( e.histogram.bytesOut, 4800u );
+    EXPECT_EQ( e.histogram.bytesIn, 410400u );
+    EXPECT_EQ( e.histogram.Mean(), 1090u );
+    EXPECT_EQ( e.histogram.Percentile( 50 ),
+               RequestStats::BucketBound( RequestStats::Bucket( 100 ) ) );
+    EXPECT_EQ( e.histogram.Percentile( 99 ),
+               RequestStats::BucketBound( RequestStats::Bucket( 10000 ) ) );
+  }
+  EXPECT_EQ( found, 2 );
+  EXPECT_NE( RequestStats::Report().find( "statstest:1094 kXR_read" ),
+             std::string::npos );
+}
+
+//------------------------------------------------------------------------------
+// Checksum pipeline test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, CheckSumPipelineTest)
+{
+  using namespace XrdCl;
+
+  std::vector<char> data( 5 * 1024 * 1024 + 123 );
+  for( size_t i = 0; i < data.size(); ++i )
+    data[i] = char( i * 7 + ( i >> 13 ) );
+
+  const char *types[] = { "adler32", "crc32", "md5" };
+
+  //----------------------------------------------------------------------------
+  // Reference checksums calculated inline in one go
+  //----------------------------------------------------------------------------
+  std::vector<std::string> expected;
+  for( auto type : types )
+  {
+    CheckSumHelper helper( "test", type );
+    ASSERT_XRDST_OK( helper.Initialize() );
+    helper.Update( data.data(), data.size() );
+    std::string cks, cksType = type;
+    ASSERT_XRDST_OK( helper.GetCheckSum( cks, cksType ) );
+    expected.push_back( cks );
+  }
+
+  //----------------------------------------------------------------------------
+  // The same in chunks of various sizes through pipelines with a queue
+  // smaller than a chunk, a bigger one, and none (inline)
+  //----------------------------------------------------------------------------
+  for( uint64_t queueSize : { 100000, 16 * 1024 * 1024, 0 } )
+  {
+    std::vector<std::unique_ptr<CheckSumHelper>> helpers;
+    std::vector<CheckSumHelper*> ptrs;
+    for( auto type : types )
+    {
+      helpers.emplace_back( new CheckSumHelper( "test", type ) );
+      ASSERT_XRDST_OK( helpers.back()->Initialize() );
+      ptrs.push_back( helpers.back().get() );
+    }
+
+    CheckSumPipeline pipeline( ptrs, queueSize );
+    size_t offset = 0, chunk = 1000;
+    while( offset < data.size() )
+    {
+      size_t size = std::min( chunk, data.size() - offset );
+      std::vector<char> buffer( data.begin() + offset, data.begin() + offset + size );
+      pipeline.Update( buffer.data(), size );
+      buffer.assign( size, 0 ); // the pipeline must not depend on our buffer
+      offset += size;
+      chunk   = chunk * 3 % 1000003;
+    }
+    pipeline.Sync();
+
+    for( size_t i = 0; i < helpers.size(); ++i )
+    {
+      std::string cks, cksType = types[i];
+      ASSERT_XRDST_OK( helpers[i]->GetCheckSum( cks, cksType ) );
+      EXPECT_EQ( cks, expected[i] );
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// io_uring test: many concurrent short reads, each resubmitted from the
+// completion thread, must all complete even when the queues are full
+//------------------------------------------------------------------------------
+namespace
+{
+  class UringRead : public XrdCl::IoUring::Request
+  {
+    public:
+      UringRead( XrdCl::IoUring *ring, int fd, uint64_t offset, uint32_t size,
+                 std::atomic<int> &completed, std::atomic<int> &failed ) :
+        ring( ring ), fd( fd ), offset( offset ), size( size ), done( 0 ),
+        buffer( size ), completed( completed ), failed( failed )
+      {
+      }
+
+      int Submit()
+      {
+        return ring->Read( fd, offset + done, size - done, buffer.data() + done,
+                           this );
+      }
+
+      void Done( int result ) override
+      {
+        if( result > 0 )
+        {
+          done += result;
+          if( done < size )
+          {
+            if( !Submit() ) return;
+            result = -1;
+          }
+        }
+        if( result < 0 ) ++failed;
+        ++completed;
+      }
+
+      XrdCl::IoUring   *ring;
+      int               fd;
+      uint64_t          offset;
+      uint32_t          size;
+      uint32_t          done;
+      std::vector<char> buffer;
+      std::atomic<int> &completed;
+      std::atomic<int> &failed;
+  };
+}
+
+TEST(UtilsTest, IoUringTest)
+{
+  using namespace XrdCl;
+
+  Env *env = DefaultEnv::GetEnv();
+  env->PutInt( "IoUring", 1 );
+  IoUring *ring = IoUring::Get();
+  env->PutInt( "IoUring", DefaultIoUring );
+  if( !ring )
+    GTEST_SKIP() << "io_uring is not available";
+
+  char path[] = "/tmp/xrdcl-iouring-XXXXXX";
+  int fd = mkstemp( path );
+  ASSERT_GE( fd, 0 );
+  unlink( path );
+  std::vector<char> data( 64 * 1024 );
+  for( size_t i = 0; i < data.size(); ++i )
+    data[i] = char( i * 13 );
+  ASSERT_EQ( pwrite( fd, data.data(), data.size(), 0 ), (ssize_t)data.size() );
+
+  //----------------------------------------------------------------------------
+  // Every read crosses the end of file: it is short, resubmitted by the
+  // completion thread and then hits the end of file
+  //----------------------------------------------------------------------------
+  const int nThreads = 8, nReads = 2000;
+  std::atomic<int> completed( 0 ), failed( 0 );
+  std::vector<std::unique_ptr<UringRead>> reads;
+  for( int i = 0; i < nThreads * nReads; ++i )
+    reads.emplace_back( new UringRead( ring, fd, data.size() - 100 - i % 50,
+                                       4096, completed, failed ) );
+
+  std::vector<std::thread> threads;
+  for( int t = 0; t < nThreads; ++t )
+    threads.emplace_back( [&, t]
+    {
+      for( int i = 0; i < nReads; ++i )
+        if( reads[t * nReads + i]->Submit() ) { ++failed; ++completed; }
+    } );
+  for( auto &t : threads )
+    t.join();
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 30 );
+  while( completed < nThreads * nReads && std::chrono::steady_clock::now() < deadline )
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+
+  if( completed < nThreads * nReads )
+  {
+    for( auto &r : reads ) r.release(); // still owned by the ring
+    FAIL() << "only " << completed << " reads completed";
+  }
+  EXPECT_EQ( failed.load(), 0 );
+  for( auto &r : reads )
+  {
+    ASSERT_EQ( r->done, data.size() - r->offset );
+    EXPECT_EQ( memcmp( r->buffer.data(), data.data() + r->offset, r->done ), 0 );
+  }
+  close( fd );
+}
+
+namespace
+{
+  class UringOp : public XrdCl::IoUring::Request
+  {
+    public:
+      UringOp( std::atomic<int> &writes, std::atomic<int> &result ) :
+        writes( writes ), result( result ), isSync( false )
+      {
+      }
+
+      void Done( int res ) override
+      {
+        if( isSync ) result = res < 0 ? -1 : writes.load();
+        else if( res > 0 ) ++writes;
+        else result = -1;
+      }
+
+      std::atomic<int> &writes;
+      std::atomic<int> &result;
+      bool              isSync;
+  };
+}
+
+TEST(UtilsTest, IoUringSyncTest)
+{
+  using namespace XrdCl;
+
+  Env *env = DefaultEnv::GetEnv();
+  env->PutInt( "IoUring", 1 );
+  IoUring *ring = IoUring::Get();
+  env->PutInt( "IoUring", DefaultIoUring );
+  if( !ring )
+    GTEST_SKIP() << "io_uring is not available";
+
+  char path[] = "/tmp/xrdcl-iouring-XXXXXX";
+  int fd = mkstemp( path );
+  ASSERT_GE( fd, 0 );
+  unlink( path );
+
+  //----------------------------------------------------------------------------
+  // The sync is called back only after all the writes queued ahead of it
+  //----------------------------------------------------------------------------
+  const int nWrites = 500;
+  std::vector<char> data( 4096, 'x' );
+  std::atomic<int> writes( 0 ), result( -2 );
+  std::vector<std::unique_ptr<UringOp>> ops;
+  for( int i = 0; i < nWrites; ++i )
+  {
+    ops.emplace_back( new UringOp( writes, result ) );
+    ASSERT_EQ( ring->Write( fd, uint64_t( i ) * data.size(), data.size(),
+                            data.data(), ops.back().get() ), 0 );
+  }
+  ops.emplace_back( new UringOp( writes, result ) );
+  ops.back()->isSync = true;
+  ASSERT_EQ( ring->Fsync( fd, ops.back().get() ), 0 );
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 30 );
+  while( result == -2 && std::chrono::steady_clock::now() < deadline )
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+
+  if( result == -2 )
+  {
+    for( auto &o : ops ) o.release(); // still owned by the ring
+    FAIL() << "the sync did not complete";
+  }
+  EXPECT_EQ( result.load(), nWrites );
+  close( fd );
+}
+
+//------------------------------------------------------------------------------
+// Pre-warmer test
+//------------------------------------------------------------------------------
+namespace
+{
+  //----------------------------------------------------------------------------
+  // A server that never answers: the connection is queued by the kernel and
+  // the handshake hangs until the socket is closed
+  //----------------------------------------------------------------------------
+  int SilentServer( std::string &url )
+  {
+    int fd = socket( AF_INET, SOCK_STREAM, 0 );
+    if( fd < 0 ) return -1;
+    sockaddr_in addr;
+    memset( &addr, 0, sizeof( addr ) );
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    socklen_t len = sizeof( addr );
+    if( bind( fd, (sockaddr*)&addr, len ) || listen( fd, 16 ) ||
+        getsockname( fd, (sockaddr*)&addr, &len ) )
+    {
+      close( fd );
+      return -1;
+    }
+    url = "root://127.0.0.1:" + std::to_string( ntohs( addr.sin_port ) ) + "/";
+    return fd;
+  }
+
+  bool WaitInFlight( XrdCl::PreWarmer &prewarmer, uint32_t n )
+  {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 60 );
+    while( prewarmer.InFlight() != n )
+    {
+      if( std::chrono::steady_clock::now() > deadline ) return false;
+      std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    }
+    return true;
+  }
+}
+
+TEST(UtilsTest, PreWarmTest)
+{
+  using namespace XrdCl;
+
+  std::string server;
+  int fd = SilentServer( server );
+  ASSERT_GE( fd, 0 );
+
+  Env *env = DefaultEnv::GetEnv();
+  env->PutInt( "PreWarm", 1 );
+  env->PutInt( "PreWarmMax", 1 );
+  env->PutInt( "ConnectionRetry", 1 );
+  PreWarmer &prewarmer = PreWarmer::Instance();
+
+  //----------------------------------------------------------------------------
+  // A background locate takes the only slot until it completes, a second
+  // redirect is not followed
+  //----------------------------------------------------------------------------
+  prewarmer.Redirected( URL( server + "/prewarm/a/file" ) );
+  EXPECT_EQ( prewarmer.InFlight(), 1u );
+  prewarmer.Redirected( URL( server + "/prewarm/b/file" ) );
+  EXPECT_EQ( prewarmer.InFlight(), 1u );
+
+  //----------------------------------------------------------------------------
+  // Once the locate has failed the slot is free again
+  //----------------------------------------------------------------------------
+  close( fd );
+  EXPECT_TRUE( WaitInFlight( prewarmer, 0 ) );
+
+  fd = SilentServer( server );
+  ASSERT_GE( fd, 0 );
+  prewarmer.Redirected( URL( server + "/prewarm/c/file" ) );
+  EXPECT_EQ( prewarmer.InFlight(), 1u );
+  close( fd );
+  EXPECT_TRUE( WaitInFlight( prewarmer, 0 ) );
+
+  env->PutInt( "PreWarm", DefaultPreWarm );
+  env->PutInt( "PreWarmMax", DefaultPreWarmMax );
+  env->PutInt( "ConnectionRetry", DefaultConnectionRetry );
+}
+
+//------------------------------------------------------------------------------
+// Read coalescer test
+//------------------------------------------------------------------------------
+namespace
+{
+  class CoalescedRead: public XrdCl::ResponseHandler
+  {
+    public:
+      CoalescedRead( uint64_t offset, std::atomic<int> &completed,
+                     std::atomic<int> &failed ):
+        offset( offset ), buffer( 4096 ), pCompleted( completed ),
+        pFailed( failed )
+      {
+      }
+
+      void HandleResponse( XrdCl::XRootDStatus *status,
+                           XrdCl::AnyObject    *response )
+      {
+        using namespace XrdCl;
+        ChunkInfo *chunk = 0;
+        if( status->IsOK() && response )
+          response->Get( chunk );
+        bool ok = chunk && chunk->offset == offset && chunk->length == 4096;
+        for( uint32_t i = 0; ok && i < 4096; ++i )
+          ok = buffer[i] == char( ( offset + i ) * 7 );
+        if( !ok ) ++pFailed;
+        delete status;
+        delete response;
+        ++pCompleted;
+      }
+
+      uint64_t          offset;
+      std::vector<char> buffer;
+
+    private:
+      std::atomic<int> &pCompleted;
+      std::atomic<int> &pFailed;
+  };
+}
+
+TEST(UtilsTest, ReadCoalescerStopTest)
+{
+  using namespace XrdCl;
+
+  char path[] = "/tmp/xrdcl-coalesce-XXXXXX";
+  int fd = mkstemp( path );
+  ASSERT_GE( fd, 0 );
+  std::vector<char> data( 1024 * 1024 );
+  for( size_t i = 0; i < data.size(); ++i )
+    data[i] = char( i * 7 );
+  ASSERT_EQ( write( fd, data.data(), data.size() ), (ssize_t)data.size() );
+  close( fd );
+
+  FilePlugIn *plugin = 0;
+  std::shared_ptr<FileStateHandler> file = std::make_shared<FileStateHandler>( plugin );
+  SyncResponseHandler openHandler;
+  ASSERT_TRUE( FileStateHandler::Open( file, std::string( "file://" ) + path,
+                                       OpenFlags::Read, 0, &openHandler ).IsOK() );
+  ASSERT_TRUE( MessageUtils::WaitForStatus( &openHandler ).IsOK() );
+  unlink( path );
+
+  //----------------------------------------------------------------------------
+  // With a single request in flight most of the reads are held back, they
+  // all have to come back before the coalescer reports to be idle
+  //----------------------------------------------------------------------------
+  const int nReads = 256;
+  std::atomic<int> completed( 0 ), failed( 0 );
+  std::vector<std::unique_ptr<CoalescedRead>> reads;
+  auto coalescer = std::make_shared<ReadCoalescer>( file, 1, 64 * 1024 );
+  for( int i = 0; i < nReads; ++i )
+  {
+    reads.emplace_back( new CoalescedRead( ( i * 4096 * 3 ) % ( data.size() - 4096 ),
+                                           completed, failed ) );
+    CoalescedRead *r = reads.back().get();
+    ASSERT_TRUE( coalescer->Read( r->offset, 4096, r->buffer.data(), r, 0 ) );
+  }
+
+  std::atomic<bool> idle( false );
+  std::atomic<int>  completedWhenIdle( -1 );
+  bool deferred = coalescer->Stop( [&]()
+  {
+    completedWhenIdle = completed.load();
+    idle = true;
+  } );
+  EXPECT_FALSE( coalescer->Read( 0, 4096, reads[0]->buffer.data(), reads[0].get(), 0 ) );
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 30 );
+  while( completed < nReads && std::chrono::steady_clock::now() < deadline )
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+  ASSERT_EQ( completed.load(), nReads );
+  EXPECT_EQ( failed.load(), 0 );
+  if( deferred )
+  {
+    while( !idle && std::chrono::steady_clock::now() < deadline )
+      std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    EXPECT_EQ( completedWhenIdle.load(), nReads );
+  }
+
+  SyncResponseHandler closeHandler;
+  ASSERT_TRUE( FileStateHandler::Close( file, &closeHandler ).IsOK() );
+  EXPECT_TRUE( MessageUtils::WaitForStatus( &closeHandler ).IsOK() );
+}
+
+//------------------------------------------------------------------------------
+// Readahead window test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, ReadAheadTest)
+{
+  using namespace XrdCl;
+
+  //----------------------------------------------------------------------------
+  // The window is twice the bandwidth-delay product in whole blocks, within
+  // [2 blocks, max window]
+  //----------------------------------------------------------------------------
+  EXPECT_EQ( ReadAhead::WindowSize( 0, 0, 65536, 1 << 30 ), 131072u );
+  EXPECT_EQ( ReadAhead::WindowSize( 1e6, 0.1, 65536, 1 << 30 ), 262144u );
+  EXPECT_EQ( ReadAhead::WindowSize( 1e6, 0.5, 65536, 1 << 30 ), 1048576u );
+  EXPECT_EQ( ReadAhead::WindowSize( 1e9, 1.0, 65536, 1 << 20 ), 1048576u );
+  EXPECT_EQ( ReadAhead::WindowSize( 1e9, 1.0, 65536, 4096 ), 131072u );
+
+  char path[] = "/tmp/xrdcl-readahead-XXXXXX";
+  int fd = mkstemp( path );
+  ASSERT_GE( fd, 0 );
+  std::vector<char> data( 1024 * 1024 );
+  for( size_t i = 0; i < data.size(); ++i )
+    data[i] = char( i * 7 );
+  ASSERT_EQ( write( fd, data.data(), data.size() ), (ssize_t)data.size() );
+  close( fd );
+
+  FilePlugIn *plugin = 0;
+  std::shared_ptr<FileStateHandler> file = std::make_shared<FileStateHandler>( plugin );
+  SyncResponseHandler openHandler;
+  ASSERT_TRUE( FileStateHandler::Open( file, std::string( "file://" ) + path,
+                                       OpenFlags::Read, 0, &openHandler ).IsOK() );
+  ASSERT_TRUE( MessageUtils::WaitForStatus( &openHandler ).IsOK() );
+  unlink( path );
+
+  //----------------------------------------------------------------------------
+  // The first two sequential reads are sent as usual, the second one starts
+  // the window and all the following reads up to the end of the file are
+  // served from the blocks
+  //----------------------------------------------------------------------------
+  std::atomic<int> completed( 0 ), failed( 0 );
+  std::vector<std::unique_ptr<CoalescedRead>> reads;
+  auto readAhead = std::make_shared<ReadAhead>( file, URL( "file://localhost" ),
+                                                16 * 1024, 64 * 1024 );
+  const int nReads = data.size() / 4096;
+  int served = 0;
+  for( int i = 0; i < nReads; ++i )
+  {
+    reads.emplace_back( new CoalescedRead( i * 4096, completed, failed ) );
+    CoalescedRead *r = reads.back().get();
+    bool ok = readAhead->Read( r->offset, 4096, r->buffer.data(), r, 0 );
+    EXPECT_EQ( ok, i >= 2 ) << "read " << i;
+    if( ok ) ++served;
+  }
+
+  //----------------------------------------------------------------------------
+  // A jump back is not served and restarts the detection
+  //----------------------------------------------------------------------------
+  EXPECT_FALSE( readAhead->Read( 0, 4096, reads[0]->buffer.data(), reads[0].get(), 0 ) );
+  EXPECT_FALSE( readAhead->Read( 4096, 4096, reads[1]->buffer.data(), reads[1].get(), 0 ) );
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 30 );
+  while( completed < served && std::chrono::steady_clock::now() < deadline )
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+  ASSERT_EQ( completed.load(), served );
+  EXPECT_EQ( failed.load(), 0 );
+
+  std::atomic<bool> idle( false );
+  if( readAhead->Stop( [&]() { idle = true; } ) )
+  {
+    while( !idle && std::chrono::steady_clock::now() < deadline )
+      std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    EXPECT_TRUE( idle.load() );
+  }
+  EXPECT_FALSE( readAhead->Read( 8192, 4096, reads[2]->buffer.data(), reads[2].get(), 0 ) );
+
+  SyncResponseHandler closeHandler;
+  ASSERT_TRUE( FileStateHandler::Close( file, &closeHandler ).IsOK() );
+  EXPECT_TRUE( MessageUtils::WaitForStatus( &closeHandler ).IsOK() );
+}
+
+//------------------------------------------------------------------------------
+// Striped read split test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, SplitReadTest)
+{
+  using namespace XrdCl;
+  typedef std::vector<std::pair<uint64_t, uint32_t>> Stripes;
+
+  //----------------------------------------------------------------------------
+  // The chunks cover the read without gaps, all but the last one end at a
+  // page boundary
+  //----------------------------------------------------------------------------
+  auto check = []( uint64_t offset, uint32_t size, uint32_t nbstripes )
+  {
+    Stripes stripes;
+    FileStateHandler::SplitRead( offset, size, nbstripes, stripes );
+    EXPECT_FALSE( stripes.empty() );
+    EXPECT_LE( stripes.size(), nbstripes );
+    uint64_t pos = offset;
+    for( size_t i = 0; i < stripes.size(); ++i )
+    {
+      EXPECT_EQ( stripes[i].first, pos );
+      EXPECT_GT( stripes[i].second, 0u );
+      pos += stripes[i].second;
+      if( i + 1 < stripes.size() )
+      {
+        EXPECT_EQ( pos % 4096, 0u );
+      }
+    }
+    EXPECT_EQ( pos, offset + size );
+    return stripes;
+  };
+
+  Stripes stripes = check( 0, 8 * 1024 * 1024, 4 );
+  ASSERT_EQ( stripes.size(), 4u );
+  for( auto &s : stripes )
+    EXPECT_EQ( s.second, 2u * 1024 * 1024 );
+
+  stripes = check( 1000, 8 * 1024 * 1024 + 123, 3 );
+  EXPECT_EQ( stripes.size(), 3u );
+
+  stripes = check( 0, 4096, 4 );
+  EXPECT_EQ( stripes.size(), 1u );
+
+  stripes = check( 12345, 3 * 4096, 8 );
+  EXPECT_LE( stripes.size(), 4u );
+
+  stripes = check( 0, 10 * 1024 * 1024, 1 );
+  EXPECT_EQ( stripes.size(), 1u );
+}
+
+//------------------------------------------------------------------------------
+// Extreme copy sliding window transfer rate test
+//------------------------------------------------------------------------------
+TEST(UtilsTest, XCpRateWindowTest)
+{
+  using namespace XrdCl;
+
+  XCpRateWindow window( 10 );
+  uint64_t total = 0;
+  window.Reset( 100, total );
+
+  //----------------------------------------------------------------------------
+  // 1MB/s for 10s, the rate is not judged before a full window
+  //----------------------------------------------------------------------------
+  for( time_t now = 101; now <= 110; ++now )
+  {
+    total += 1000000;
+    window.Update( now, total );
+    if( now < 110 )
+    {
+      EXPECT_FALSE( window.StayedBelow( now, 2000000 ) );
+    }
+  }
+  EXPECT_EQ( window.Rate( 110 ), 1000000u );
+
+  //----------------------------------------------------------------------------
+  // Slow down to 10kB/s, the average since the start stays well above the
+  // threshold, the rate over the window drops below it at t=120 and the
+  // source has been too slow for 10s at t=130
+  //----------------------------------------------------------------------------
+  for( time_t now = 111; now <= 130; ++now )
+  {
+    total += 10000;
+    window.Update( now, total );
+    EXPECT_GT( total / ( now - 100 ), 100000u );
+    EXPECT_EQ( window.StayedBelow( now, 100000 ), now >= 130 );
+  }
+  EXPECT_EQ( window.Rate( 130 ), 10000u );
+
+  //----------------------------------------------------------------------------
+  // Recovering resets the clock
+  //----------------------------------------------------------------------------
+  total += 2000000;
+  window.Update( 131, total );
+  EXPECT_FALSE( window.StayedBelow( 131, 100000 ) );
+  for( time_t now = 132; now <= 141; ++now )
+  {
+    window.Update( now, total );
+    EXPECT_FALSE( window.StayedBelow( now, 100000 ) );
+  }
+  EXPECT_TRUE( window.StayedBelow( 151, 100000 ) );
+
+  //----------------------------------------------------------------------------
+  // A stalled source decays to zero, a reset drops the history
+  //----------------------------------------------------------------------------
+  EXPECT_EQ( window.Rate( 160 ), 0u );
+  window.Reset( 160, total );
+  EXPECT_EQ( window.Rate( 160 ), 0u );
+  EXPECT_FALSE( window.StayedBelow( 165, 100000 ) );
+}
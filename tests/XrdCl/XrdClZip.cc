@@ -25,6 +25,7 @@
 #include "XrdCl/XrdClZipArchive.hh"
 #include "XrdCl/XrdClZipListHandler.hh"
 #include "XrdCl/XrdClZipOperations.hh"
+#include "XrdCl/XrdClMessageUtils.hh"
 
 using namespace XrdClTests;
 using namespace XrdCl;
@@ -96,3 +97,24 @@ TEST_F(ZipTest, GetterTests) {
   uint64_t offset;
   EXPECT_XRDST_OK(zip_file.GetOffset("paper.txt", offset));
 }
+
+TEST_F(ZipTest, PrefetchTest) {
+  // read the file the usual way
+  StatInfo* info_out = nullptr;
+  EXPECT_XRDST_OK(zip_file.Stat("paper.txt", info_out));
+  ASSERT_TRUE(info_out);
+  uint32_t size = info_out->GetSize();
+  delete info_out;
+  std::vector<char> expected(size), prefetched(size);
+  EXPECT_XRDST_OK(WaitFor(ReadFrom(zip_file, "paper.txt", 0, size, expected.data())));
+
+  // prefetch it and read it again from memory
+  SyncResponseHandler handler;
+  EXPECT_XRDST_OK(zip_file.Prefetch({"paper.txt"}, &handler));
+  EXPECT_XRDST_OK(MessageUtils::WaitForStatus(&handler));
+  EXPECT_XRDST_OK(WaitFor(ReadFrom(zip_file, "paper.txt", 0, size, prefetched.data())));
+  EXPECT_EQ(expected, prefetched);
+
+  // unknown files are refused
+  EXPECT_XRDST_NOTOK(zip_file.Prefetch({"gibberish.txt"}, &handler), errNotFound);
+}
@@ -0,0 +1,256 @@
+#include "XrdOssCsi/XrdOssCsiTagstoreFile.hh"
+#include "XrdOuc/XrdOucCRC.hh"
+#include "XrdOuc/XrdOucEnv.hh"
+#include "XrdOuc/XrdOucTrace.hh"
+#include "XrdSys/XrdSysError.hh"
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+XrdSysError OssCsiEroute(0, "osscsi_");
+XrdOucTrace OssCsiTrace(&OssCsiEroute);
+
+namespace
+{
+
+// A tag file kept in memory, its content outlives the file objects so that
+// it can be inspected and opened again
+//
+class MemFile : public XrdOssDF
+{
+public:
+    explicit MemFile(std::shared_ptr<std::vector<uint8_t>> data) : data_(data) { }
+
+    int Open(const char *, int, mode_t, XrdOucEnv &) override { return 0; }
+
+    ssize_t Read(void *buff, off_t offset, size_t size) override
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        if (offset >= (off_t)data_->size()) return 0;
+        const size_t n = std::min(size, data_->size() - offset);
+        memcpy(buff, data_->data() + offset, n);
+        return n;
+    }
+
+    ssize_t Write(const void *buff, off_t offset, size_t size) override
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        if (offset + size > data_->size()) data_->resize(offset + size);
+        memcpy(data_->data() + offset, buff, size);
+        return size;
+    }
+
+    int Fstat(struct stat *buf) override
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        memset(buf, 0, sizeof(*buf));
+        buf->st_size = data_->size();
+        return 0;
+    }
+
+    int Ftruncate(unsigned long long flen) override
+    {
+        std::lock_guard<std::mutex> guard(mtx_);
+        data_->resize(flen);
+        return 0;
+    }
+
+    int Fsync() override { return 0; }
+    int Close(long long *retsz = 0) override { return 0; }
+
+private:
+    std::mutex mtx_;
+    std::shared_ptr<std::vector<uint8_t>> data_;
+};
+
+const size_t pageTags = XrdSys::PageSize / 4;
+
+uint32_t TagFor(size_t i) { return 0x9e3779b9U * (i + 1); }
+
+class TagstoreFixture : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        data = std::make_shared<std::vector<uint8_t>>();
+    }
+
+    std::unique_ptr<XrdOssCsiTagstoreFile> OpenTags(off_t dsize, size_t tcpages)
+    {
+        std::unique_ptr<XrdOssCsiTagstoreFile> ts(new XrdOssCsiTagstoreFile("/test",
+            std::unique_ptr<XrdOssDF>(new MemFile(data)), "test", tcpages));
+        EXPECT_EQ(0, ts->Open("/test.cstag", dsize, O_RDWR, env));
+        return ts;
+    }
+
+    // tag i as stored in the file, in the file's byte order
+    uint32_t FileTag(size_t i)
+    {
+        uint32_t t;
+        memcpy(&t, data->data() + 20 + 4 * i, 4);
+        return t;
+    }
+
+    XrdOucEnv env;
+    std::shared_ptr<std::vector<uint8_t>> data;
+};
+
+}
+
+TEST_F(TagstoreFixture, WriteEvictReadBack)
+{
+    // more pages than the cache holds, so that dirty pages get evicted
+    const size_t ntags = 5 * pageTags + 17;
+    std::vector<uint32_t> tags(ntags), back(ntags);
+    for (size_t i = 0; i < ntags; i++) tags[i] = TagFor(i);
+
+    auto ts = OpenTags(0, 2);
+    ASSERT_EQ((ssize_t)ntags, ts->WriteTags(tags.data(), 0, ntags));
+    ASSERT_EQ(0, ts->SetTrackedSize(ntags * XrdSys::PageSize));
+
+    ASSERT_EQ((ssize_t)ntags, ts->ReadTags(back.data(), 0, ntags));
+    EXPECT_EQ(tags, back);
+
+    // rewrite an unaligned range spanning pages, then read around it
+    for (size_t i = pageTags - 3; i < 2 * pageTags + 5; i++) tags[i] = ~TagFor(i);
+    ASSERT_EQ((ssize_t)(pageTags + 8), ts->WriteTags(&tags[pageTags - 3], pageTags - 3, pageTags + 8));
+    std::fill(back.begin(), back.end(), 0);
+    ASSERT_EQ((ssize_t)ntags, ts->ReadTags(back.data(), 0, ntags));
+    EXPECT_EQ(tags, back);
+
+    // reading past the tags is refused as for an uncached tag store
+    EXPECT_EQ(-EDOM, ts->ReadTags(back.data(), ntags - 1, 2));
+    ASSERT_EQ(0, ts->Close());
+
+    ASSERT_EQ(20 + 4 * ntags, data->size());
+    for (size_t i = 0; i < ntags; i++) ASSERT_EQ(tags[i], FileTag(i)) << "tag " << i;
+
+    // the same tags are seen without the cache
+    auto ts2 = OpenTags(ntags * XrdSys::PageSize, 0);
+    std::fill(back.begin(), back.end(), 0);
+    ASSERT_EQ((ssize_t)ntags, ts2->ReadTags(back.data(), 0, ntags));
+    EXPECT_EQ(tags, back);
+    ASSERT_EQ(0, ts2->Close());
+}
+
+TEST_F(TagstoreFixture, Truncate)
+{
+    const size_t ntags = 3 * pageTags;
+    std::vector<uint32_t> tags(ntags), back(ntags);
+    for (size_t i = 0; i < ntags; i++) tags[i] = TagFor(i);
+
+    auto ts = OpenTags(0, 4);
+    ASSERT_EQ((ssize_t)ntags, ts->WriteTags(tags.data(), 0, ntags));
+    ASSERT_EQ(0, ts->SetTrackedSize(ntags * XrdSys::PageSize));
+
+    // the dirty tags below the new length are kept, the others are gone
+    const size_t keep = pageTags + pageTags / 2;
+    ASSERT_EQ(0, ts->Truncate(keep * XrdSys::PageSize - 100, true));
+    EXPECT_EQ((off_t)(keep * XrdSys::PageSize - 100), ts->GetTrackedTagSize());
+    EXPECT_EQ(20 + 4 * keep, data->size());
+    EXPECT_EQ(-EDOM, ts->ReadTags(back.data(), keep - 1, 2));
+    ASSERT_EQ((ssize_t)keep, ts->ReadTags(back.data(), 0, keep));
+    for (size_t i = 0; i < keep; i++) ASSERT_EQ(tags[i], back[i]) << "tag " << i;
+
+    // extending again starts from zeroed tags
+    const uint32_t last = 0x12345678U;
+    ASSERT_EQ(1, ts->WriteTags(&last, ntags - 1, 1));
+    ASSERT_EQ((ssize_t)(ntags - keep), ts->ReadTags(back.data(), keep, ntags - keep));
+    for (size_t i = 0; i + 1 < ntags - keep; i++) ASSERT_EQ(0U, back[i]) << "tag " << keep + i;
+    EXPECT_EQ(last, back[ntags - keep - 1]);
+    ASSERT_EQ(0, ts->Close());
+    EXPECT_EQ(last, FileTag(ntags - 1));
+}
+
+TEST_F(TagstoreFixture, ByteSwapped)
+{
+    // build a tag file in the other byte order
+    const size_t ntags = 2 * pageTags + 9;
+    const uint64_t tracked = ntags * XrdSys::PageSize;
+    data->resize(20 + 4 * ntags);
+    uint8_t *hdr = data->data();
+    const uint32_t magic = bswap_32(0x30544452U);
+    const uint64_t len = bswap_64(tracked);
+    const uint32_t flags = 0;
+    memcpy(hdr, &magic, 4);
+    memcpy(hdr + 4, &len, 8);
+    memcpy(hdr + 12, &flags, 4);
+    const uint32_t crc = bswap_32(XrdOucCRC::Calc32C(hdr, 16, 0U));
+    memcpy(hdr + 16, &crc, 4);
+    for (size_t i = 0; i < ntags; i++)
+    {
+        const uint32_t t = bswap_32(TagFor(i));
+        memcpy(hdr + 20 + 4 * i, &t, 4);
+    }
+
+    auto ts = OpenTags(tracked, 2);
+    std::vector<uint32_t> back(ntags);
+    ASSERT_EQ((ssize_t)ntags, ts->ReadTags(back.data(), 0, ntags));
+    for (size_t i = 0; i < ntags; i++) ASSERT_EQ(TagFor(i), back[i]) << "tag " << i;
+
+    // written tags reach the file swapped, across a page boundary
+    std::vector<uint32_t> tags(6);
+    for (size_t i = 0; i < tags.size(); i++) tags[i] = ~TagFor(pageTags - 3 + i);
+    ASSERT_EQ(6, ts->WriteTags(tags.data(), pageTags - 3, 6));
+    std::vector<uint32_t> mid(6);
+    ASSERT_EQ(6, ts->ReadTags(mid.data(), pageTags - 3, 6));
+    EXPECT_EQ(tags, mid);
+    ASSERT_EQ(0, ts->Close());
+    for (size_t i = 0; i < tags.size(); i++)
+        EXPECT_EQ(bswap_32(tags[i]), FileTag(pageTags - 3 + i));
+    EXPECT_EQ(bswap_32(TagFor(pageTags - 4)), FileTag(pageTags - 4));
+    EXPECT_EQ(bswap_32(TagFor(pageTags + 3)), FileTag(pageTags + 3));
+}
+
+TEST_F(TagstoreFixture, ConcurrentReaders)
+{
+    const size_t ntags = 16 * pageTags;
+    std::vector<uint32_t> tags(ntags);
+    for (size_t i = 0; i < ntags; i++) tags[i] = TagFor(i);
+    {
+        auto ts = OpenTags(0, 0);
+        ASSERT_EQ((ssize_t)ntags, ts->WriteTags(tags.data(), 0, ntags));
+        ASSERT_EQ(0, ts->SetTrackedSize(ntags * XrdSys::PageSize));
+        ASSERT_EQ(0, ts->Close());
+    }
+
+    // readers and a writer on a cache smaller than the pages they use
+    auto ts = OpenTags(ntags * XrdSys::PageSize, 3);
+    std::atomic<int> bad(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&ts, &bad, t]()
+        {
+            std::vector<uint32_t> back(100);
+            for (int n = 0; n < 2000; n++)
+            {
+                const size_t off = ((n * 7919 + t * 104729) % (ntags - 100));
+                if (ts->ReadTags(back.data(), off, 100) != 100) { bad++; continue; }
+                for (size_t i = 0; i < 100; i++)
+                    if (back[i] != TagFor(off + i)) { bad++; break; }
+            }
+        });
+    }
+    threads.emplace_back([&ts, &bad]()
+    {
+        for (int n = 0; n < 2000; n++)
+        {
+            const size_t off = (n * 4099) % ntags;
+            const uint32_t t = TagFor(off);
+            if (ts->WriteTags(&t, off, 1) != 1) bad++;
+        }
+    });
+    for (auto &th : threads) th.join();
+    EXPECT_EQ(0, bad.load());
+    ASSERT_EQ(0, ts->Close());
+    for (size_t i = 0; i < ntags; i++) ASSERT_EQ(tags[i], FileTag(i)) << "tag " << i;
+}
@@ -0,0 +1,146 @@
+#include "XrdPfc/XrdPfcInfo.hh"
+#include "XrdPfc/XrdPfcInfoStore.hh"
+#include "XrdSys/XrdSysTrace.hh"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+using namespace XrdPfc;
+
+class InfoStoreTest : public ::testing::Test {
+protected:
+    XrdSysTrace trace { "XrdPfc" };
+    std::string path;
+
+    void SetUp() override
+    {
+        char tmpl[] = "/tmp/xrdpfc-infostore-XXXXXX";
+        ASSERT_NE(mkdtemp(tmpl), nullptr);
+        path = std::string(tmpl) + "/cinfo.store";
+        trace.What = 0;
+    }
+
+    void TearDown() override
+    {
+        unlink(path.c_str());
+        rmdir(path.substr(0, path.rfind('/')).c_str());
+    }
+
+    void fill(Info &info, long long fsize, int nwritten)
+    {
+        info.SetBufferSizeFileSizeAndCreationTime(64 * 1024, fsize);
+        for (int i = 0; i < nwritten; ++i)
+            info.SetBitSynced(i);
+        info.WriteIOStatSingle(fsize);
+    }
+};
+
+TEST_F(InfoStoreTest, PutGetRemove)
+{
+    InfoStore store(&trace);
+    ASSERT_TRUE(store.Open(path, 0.5, false));
+
+    Info in(&trace);
+    fill(in, 1024 * 1024, 3);
+    ASSERT_TRUE(store.Put("/a/b/file1", in));
+
+    Info out(&trace);
+    ASSERT_TRUE(store.Get("/a/b/file1", out));
+    EXPECT_EQ(out.GetFileSize(), 1024 * 1024);
+    EXPECT_EQ(out.GetBufferSize(), 64 * 1024);
+    EXPECT_EQ(out.GetNDownloadedBlocks(), 3);
+    EXPECT_EQ(out.GetAccessCnt(), in.GetAccessCnt());
+
+    Info missing(&trace);
+    EXPECT_FALSE(store.Get("/a/b/file2", missing));
+
+    EXPECT_TRUE(store.Remove("/a/b/file1"));
+    EXPECT_FALSE(store.Contains("/a/b/file1"));
+    EXPECT_FALSE(store.Remove("/a/b/file1"));
+}
+
+TEST_F(InfoStoreTest, RecoverAfterReopen)
+{
+    {
+        InfoStore store(&trace);
+        ASSERT_TRUE(store.Open(path, 0.5, true));
+        for (int i = 0; i < 100; ++i)
+        {
+            Info in(&trace);
+            fill(in, (i + 1) * 100000ll, i % 2);
+            ASSERT_TRUE(store.Put("/f" + std::to_string(i), in));
+        }
+        for (int i = 0; i < 100; i += 10)
+            ASSERT_TRUE(store.Remove("/f" + std::to_string(i)));
+    }
+
+    InfoStore store(&trace);
+    ASSERT_TRUE(store.Open(path, 0.5, true));
+    EXPECT_EQ(store.GetStats().m_num_records, 90);
+
+    Info out(&trace);
+    ASSERT_TRUE(store.Get("/f55", out));
+    EXPECT_EQ(out.GetFileSize(), 56 * 100000ll);
+    EXPECT_FALSE(store.Contains("/f50"));
+}
+
+TEST_F(InfoStoreTest, Compact)
+{
+    InfoStore store(&trace);
+    ASSERT_TRUE(store.Open(path, 0, false));
+
+    for (int round = 0; round < 50; ++round)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            Info in(&trace);
+            fill(in, 10 * 1024 * 1024, round % 8);
+            ASSERT_TRUE(store.Put("/dir/file" + std::to_string(i), in));
+        }
+    }
+
+    InfoStore::Stats before = store.GetStats();
+    ASSERT_TRUE(store.Compact());
+    InfoStore::Stats after = store.GetStats();
+
+    EXPECT_EQ(after.m_num_records, 20);
+    EXPECT_EQ(after.m_dead_bytes, 0);
+    EXPECT_LT(after.m_log_size, before.m_log_size);
+
+    Info out(&trace);
+    ASSERT_TRUE(store.Get("/dir/file7", out));
+    EXPECT_EQ(out.GetNDownloadedBlocks(), 49 % 8);
+
+    int n = 0;
+    store.ForEach([&](const std::string &, const char *, size_t len) { ++n; EXPECT_GT(len, 0u); });
+    EXPECT_EQ(n, 20);
+}
+
+TEST_F(InfoStoreTest, Inventory)
+{
+    InfoStore store(&trace);
+    ASSERT_TRUE(store.Open(path, 0.5, false));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        Info in(&trace);
+        in.SetBufferSizeFileSizeAndCreationTime(64 * 1024, 1024 * 1024);
+        in.WriteIOStatSingle(1024, 1000 + i, 2000 + i);
+        ASSERT_TRUE(store.Put("/d" + std::to_string(i % 2) + "/f" + std::to_string(i), in));
+    }
+    ASSERT_TRUE(store.Remove("/d1/f3"));
+
+    std::vector<InfoStore::Entry> entries;
+    store.Inventory(entries);
+    ASSERT_EQ(entries.size(), 9u);
+    for (auto &e : entries)
+    {
+        int i = std::stoi(e.m_lfn.substr(e.m_lfn.rfind('f') + 1));
+        EXPECT_NE(i, 3);
+        EXPECT_EQ(e.m_lfn, "/d" + std::to_string(i % 2) + "/f" + std::to_string(i));
+        EXPECT_EQ(e.m_atime, 2000 + i);
+    }
+}
@@ -1,5 +1,10 @@
 #include "XrdPfc/XrdPfcPathParseTools.hh"
+#include "XrdPfc/XrdPfcAdmission.hh"
+#include "XrdPfc/XrdPfcPurgeIndex.hh"
+#include "XrdPfc/XrdPfcBlockGaps.hh"
+#include "XrdSys/XrdSysTrace.hh"
 
+#include <algorithm>
 #include <gtest/gtest.h>
 
 class PathParseToolTest : public ::testing::Test {
@@ -83,3 +88,188 @@ TEST_F(PathParseToolTest, PathTokenizer)
     }
     clear_path();
 }
+
+TEST(FrequencySketchTest, CountAndSaturate)
+{
+    FrequencySketch fs(10);
+
+    uint64_t hot  = FrequencySketch::Hash("/store/hot.root");
+    uint64_t cold = FrequencySketch::Hash("/store/cold.root");
+
+    for (int i = 0; i < 5; ++i)
+        fs.Increment(hot);
+    fs.Increment(cold);
+
+    EXPECT_EQ(fs.Estimate(hot), 5);
+    EXPECT_EQ(fs.Estimate(cold), 1);
+    EXPECT_EQ(fs.Estimate(FrequencySketch::Hash("/store/never.root")), 0);
+
+    for (int i = 0; i < 100; ++i)
+        fs.Increment(hot);
+    EXPECT_EQ(fs.Estimate(hot), FrequencySketch::s_max_count);
+}
+
+TEST(FrequencySketchTest, Aging)
+{
+    FrequencySketch fs(8);
+
+    uint64_t hot = FrequencySketch::Hash("/store/hot.root");
+    for (int i = 0; i < 8; ++i)
+        fs.Increment(hot);
+    ASSERT_EQ(fs.Estimate(hot), 8);
+
+    // One-shot scan over many distinct files triggers the periodic halving.
+    for (long long i = 0; i < fs.GetSampleSize(); ++i)
+        fs.Increment(FrequencySketch::Hash("/scan/" + std::to_string(i)));
+
+    EXPECT_LE(fs.Estimate(hot), 4);
+}
+
+TEST(AdmissionTest, KnownCached)
+{
+    XrdSysTrace trace("Test");
+    Admission::Parameters p;
+    p.m_min_freq = 2;
+    p.m_size_ref = 0;
+    p.m_width_log2 = 8;
+    Admission adm(p, &trace);
+
+    EXPECT_EQ(adm.KnownCached("/store/a.root"), -1);
+    adm.SetCached("/store/a.root", false);
+    EXPECT_EQ(adm.KnownCached("/store/a.root"), 0);
+
+    // Rejected on the first open, admitted on the second.
+    EXPECT_FALSE(adm.Admit("/store/a.root", 1024, false));
+    EXPECT_TRUE(adm.Admit("/store/a.root", 1024, false));
+
+    // Opened in the cache, then purged.
+    adm.SetCached("/store/a.root", true);
+    EXPECT_EQ(adm.KnownCached("/store/a.root"), 1);
+    adm.SetCached("/store/a.root", false);
+    EXPECT_EQ(adm.KnownCached("/store/a.root"), 0);
+
+    // The remembered state is bounded, it is all dropped when full.
+    for (int i = 0; i < 256; ++i)
+        adm.SetCached("/scan/" + std::to_string(i), false);
+    EXPECT_EQ(adm.KnownCached("/store/a.root"), -1);
+    EXPECT_EQ(adm.KnownCached("/scan/255"), 0);
+}
+
+TEST(PurgeIndexTest, CollectOldestFirst)
+{
+    PurgeIndex pi;
+
+    pi.Insert("/a/f1", 100, 10);
+    pi.Insert("/a/f2", 300, 20);
+    pi.Insert("/b/f3", 200, 30);
+    pi.Touch("/c/f4", 400);
+    pi.AddBlocks("/c/f4", 40);
+    EXPECT_EQ(pi.GetNFiles(), 4);
+    EXPECT_EQ(pi.GetNStBlocks(), 100);
+
+    // Access moves f1 to the end of the eviction order.
+    pi.Touch("/a/f1", 500);
+    // Older access times do not move a file back.
+    pi.Touch("/a/f2", 50);
+
+    std::vector<PurgeIndex::Candidate> cands;
+    EXPECT_EQ(pi.Collect(40, 0, cands), 50);
+    ASSERT_EQ(cands.size(), 2u);
+    EXPECT_EQ(cands[0].m_lfn, "/b/f3");
+    EXPECT_EQ(cands[1].m_lfn, "/a/f2");
+
+    // Cold files are all collected, even with nothing requested.
+    cands.clear();
+    pi.Collect(0, 350, cands);
+    EXPECT_EQ(cands.size(), 2u);
+
+    EXPECT_TRUE(pi.Remove("/b/f3"));
+    EXPECT_FALSE(pi.Remove("/b/f3"));
+    EXPECT_EQ(pi.GetNStBlocks(), 70);
+
+    cands.clear();
+    pi.Collect(1, 0, cands);
+    ASSERT_EQ(cands.size(), 1u);
+    EXPECT_EQ(cands[0].m_lfn, "/a/f2");
+    EXPECT_EQ(cands[0].m_atime, 300);
+}
+
+TEST(PurgeIndexTest, DropAndReconcile)
+{
+    PurgeIndex pi;
+
+    pi.Insert("/a/f1", 100, 10);
+    pi.Insert("/a/f2", 300, 20);
+    pi.Insert("/a/b/f3", 200, 30);
+
+    // Files found missing are only dropped if not accessed since.
+    EXPECT_FALSE(pi.RemoveIfNotAccessedSince("/a/f2", 250));
+    EXPECT_TRUE(pi.RemoveIfNotAccessedSince("/a/f1", 250));
+    EXPECT_EQ(pi.GetNFiles(), 2);
+
+    std::vector<std::string> dir;
+    pi.ListDir("/a", dir);
+    ASSERT_EQ(dir.size(), 1u);
+    EXPECT_EQ(dir[0], "/a/f2");
+
+    // Traversal started at 400 found f3 with a new size and an unknown f5;
+    // f2 is gone and f4, accessed during the traversal, is kept.
+    pi.Touch("/a/f4", 450);
+    std::vector<PurgeIndex::Candidate> files { { "/a/b/f3", 35, 200 }, { "/a/f5", 50, 150 } };
+    EXPECT_EQ(pi.Reconcile(files, 400), 3);
+    EXPECT_EQ(pi.GetNFiles(), 3);
+    EXPECT_EQ(pi.GetNStBlocks(), 85);
+
+    std::vector<PurgeIndex::Candidate> cands;
+    pi.Collect(1000, 0, cands);
+    ASSERT_EQ(cands.size(), 3u);
+    EXPECT_EQ(cands[0].m_lfn, "/a/f5");
+    EXPECT_EQ(cands[1].m_lfn, "/a/b/f3");
+    EXPECT_EQ(cands[2].m_lfn, "/a/f4");
+
+    // Directory buckets follow removals done by the reconcile.
+    dir.clear();
+    pi.ListDir("/a/", dir);
+    std::sort(dir.begin(), dir.end());
+    ASSERT_EQ(dir.size(), 2u);
+    EXPECT_EQ(dir[0], "/a/f4");
+    EXPECT_EQ(dir[1], "/a/f5");
+    dir.clear();
+    pi.ListDir("/a/b", dir);
+    ASSERT_EQ(dir.size(), 1u);
+    EXPECT_TRUE(pi.Remove("/a/b/f3"));
+    dir.clear();
+    pi.ListDir("/a/b", dir);
+    EXPECT_TRUE(dir.empty());
+}
+
+TEST(BlockGapsTest, SelectGapBlocks)
+{
+    // Missing blocks 0, 2, 6, 7 and 20; block 4 is already cached.
+    std::vector<int> idcs { 0, 2, 6, 7, 20 };
+    auto is_free = [](int g) { return g != 4; };
+
+    // Overfetch 0 puts no limit, only single-block holes fit maxgap 1.
+    std::vector<int> out;
+    EXPECT_EQ(SelectGapBlocks(idcs, 1, 0, is_free, out), 1);
+    EXPECT_EQ(out, std::vector<int>({ 1 }));
+
+    // Hole 3-5 holds a cached block, hole 8-19 is too long.
+    out.clear();
+    EXPECT_EQ(SelectGapBlocks(idcs, 8, 0, is_free, out), 1);
+
+    out.clear();
+    EXPECT_EQ(SelectGapBlocks(idcs, 12, 0, [](int) { return true; }, out), 16);
+    EXPECT_EQ(out.front(), 1);
+    EXPECT_EQ(out.back(), 19);
+
+    // Holes are filled in whole, within the overfetch limit.
+    out.clear();
+    EXPECT_EQ(SelectGapBlocks(idcs, 12, 4, [](int) { return true; }, out), 4);
+    EXPECT_EQ(out, std::vector<int>({ 1, 3, 4, 5 }));
+
+    // No holes between adjacent blocks.
+    out.clear();
+    EXPECT_EQ(SelectGapBlocks(std::vector<int>{ 6, 7 }, 4, 0, is_free, out), 0);
+    EXPECT_TRUE(out.empty());
+}
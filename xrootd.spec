@@ -611,6 +611,7 @@ fi
 %{_libdir}/libXrdMacaroons-6.so
 %{_libdir}/libXrdN2No2p-6.so
 %{_libdir}/libXrdOfsPrepGPI-6.so
+%{_libdir}/libXrdOfsTPCEngine-6.so
 %{_libdir}/libXrdOssArc-6.so
 %{_libdir}/libXrdOssCsi-6.so
 %{_libdir}/libXrdOssMirage-6.so